@@ -243,6 +243,19 @@ namespace AZ
             LoadAll = 1
         };
 
+        /**
+         * Priority lanes for asynchronous asset loads. The lane of a root asset is used for all of the dependencies that are loaded
+         * with it, and maps onto the deadline and priority of the streamer requests and onto the priority of the load jobs.
+         * Requesting an asset that's already queued in a lower lane moves the load up to the higher lane.
+         */
+        AZ_ENUM_CLASS_WITH_UNDERLYING_TYPE(AssetLoadLane, u8,
+            (Critical, 0),      ///< Assets that are needed right away, for instance because a thread is blocking on them. Loaded before all other assets.
+            (Gameplay, 1),      ///< Assets that are needed by running gameplay. Uses the deadline and priority provided by the asset handler.
+            (Background, 2),    ///< Preloads and bulk loads that can wait until the other lanes are idle.
+            Count,
+            (Default, Gameplay)
+        );
+
         struct AssetLoadParameters
         {
             AssetLoadParameters() : m_assetLoadFilterCB() {}
@@ -260,6 +273,8 @@ namespace AZ
             AZStd::optional<AZStd::chrono::milliseconds> m_deadline{ };
             AZStd::optional<IO::IStreamerTypes::Priority> m_priority{ };
             AssetDependencyLoadRules m_dependencyRules{ AssetDependencyLoadRules::Default };
+            // The priority lane of the load. An explicit deadline or priority overrides the values of the lane for the streamer.
+            AssetLoadLane m_lane{ AssetLoadLane::Default };
             // If the asset we're requesting is already loaded and we don't want to check for any
             // depenencies that need loading, leave this as true.  If you wish to force a clean evaluation
             // for dependent assets set to false
@@ -274,7 +289,8 @@ namespace AZ
                 return emptyLoadFilter
                     && rhsEmptyLoadFilter
                     && m_deadline == rhs.m_deadline
-                    && m_priority == rhs.m_priority;
+                    && m_priority == rhs.m_priority
+                    && m_lane == rhs.m_lane;
             }
         };
 
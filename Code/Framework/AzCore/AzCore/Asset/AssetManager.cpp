@@ -39,8 +39,41 @@ namespace AZ
         AZ_CVAR(bool, cl_assetLoadError, false, nullptr, AZ::ConsoleFunctorFlags::Null,
             "Enable failure of all asset loads.");
 
+        static void cl_assetLoadLaneStatistics([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (!AssetManager::IsReady())
+            {
+                return;
+            }
+
+            for (size_t laneIndex = 0; laneIndex < static_cast<size_t>(AssetLoadLane::Count); ++laneIndex)
+            {
+                const AssetLoadLane lane = static_cast<AssetLoadLane>(laneIndex);
+                const AssetManager::LaneStatistics statistics = AssetManager::Instance().GetLaneStatistics(lane);
+                const u64 finishedCount = statistics.m_completedCount + statistics.m_failedCount;
+                const double averageLatencyMs = finishedCount > 0
+                    ? static_cast<double>(statistics.m_totalLatency.count()) / 1000.0 / static_cast<double>(finishedCount)
+                    : 0.0;
+                AZ_TracePrintf("AssetManager", "%.*s lane: %" PRIu64 " queued, %" PRIu64 " completed, %" PRIu64 " failed, %" PRIu64 " bytes, "
+                    "average latency %.2f ms, max latency %.2f ms\n", AZ_STRING_ARG(ToString(lane)), statistics.m_queuedCount,
+                    statistics.m_completedCount, statistics.m_failedCount, statistics.m_bytesLoaded, averageLatencyMs,
+                    static_cast<double>(statistics.m_maxLatency.count()) / 1000.0);
+            }
+        }
+        AZ_CONSOLEFREEFUNC(cl_assetLoadLaneStatistics, AZ::ConsoleFunctorFlags::Null,
+            "Prints the number of asset loads, the bytes loaded and the load latency for each priority lane.");
+
         static constexpr char kAssetDBInstanceVarName[] = "AssetDatabaseInstance";
 
+        // Priorities of the load jobs of each lane. Gameplay loads keep the default job priority.
+        static constexpr AZ::s8 LaneJobPriorities[] = { 64, 0, -64 };
+        static_assert(AZ_ARRAY_SIZE(LaneJobPriorities) == static_cast<size_t>(AssetLoadLane::Count), "A job priority is needed for each lane.");
+
+        static AZ::s8 GetLaneJobPriority(AssetLoadLane lane)
+        {
+            return LaneJobPriorities[static_cast<size_t>(lane)];
+        }
+
         /*
          * This is the base class for Async AssetDatabase jobs
          */
@@ -49,9 +82,10 @@ namespace AZ
             , public Job
         {
         public:
-            AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler)
+            AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler,
+                AZ::s8 priority = 0)
                 : AssetDatabaseJob(owner, asset, assetHandler)
-                , Job(deleteWhenDone, jobContext)
+                , Job(deleteWhenDone, jobContext, false, priority)
             {
             }
 
@@ -119,13 +153,15 @@ namespace AZ
 
             LoadAssetJob(AssetManager* owner, const Asset<AssetData>& asset,
                 AZStd::shared_ptr<AssetDataStream> dataStream, bool isReload, AZ::IO::IStreamerTypes::RequestStatus requestState,
-                AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
-                : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler)
+                AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded,
+                AssetLoadLane lane, AZStd::chrono::system_clock::time_point queueTime)
+                : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler, GetLaneJobPriority(lane))
                 , m_dataStream(dataStream)
                 , m_isReload(isReload)
                 , m_requestState(requestState)
                 , m_loadParams(loadParams)
                 , m_signalLoaded(signalLoaded)
+                , m_queueTime(queueTime)
             {
                 AZ_Assert(m_dataStream, "Data stream pointer received through the callback from AZ::IO::Streamer is invalid.");
 
@@ -156,6 +192,7 @@ namespace AZ
 
                 if (shouldCancel)
                 {
+                    RecordLoad(false);
                     BlockingAssetLoadBus::Event(m_asset.GetId(), &BlockingAssetLoadBus::Events::OnLoadCanceled, m_asset.GetId());
                     AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetCanceled, m_asset.GetId());
                 }
@@ -171,12 +208,18 @@ namespace AZ
                     {
                         LoadAndSignal(asset);
                     }
+                    else
+                    {
+                        // The asset was already loaded by a blocking load, which completes the queued load as well.
+                        RecordLoad(true);
+                    }
                 }
             }
 
             void LoadAndSignal(Asset<AssetData>& asset)
             {
                 const bool loadSucceeded = LoadData();
+                RecordLoad(loadSucceeded);
 
                 if (m_signalLoaded && loadSucceeded)
                 {
@@ -217,9 +260,18 @@ namespace AZ
                 return loadedSuccessfully;
             }
 
+            // Statistics are recorded in the lane the load was queued in, even if it moved to a higher lane since.
+            void RecordLoad(bool succeeded)
+            {
+                const auto latency = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                    AZStd::chrono::system_clock::now() - m_queueTime);
+                m_owner->RecordLaneLoad(m_loadParams.m_lane, succeeded, succeeded ? m_dataStream->GetLoadedSize() : 0, latency);
+            }
+
         private:
             AZStd::shared_ptr<AssetDataStream> m_dataStream;
             AssetLoadParameters m_loadParams{};
+            AZStd::chrono::system_clock::time_point m_queueTime;
             AZ::IO::IStreamerTypes::RequestStatus m_requestState{ AZ::IO::IStreamerTypes::RequestStatus::Pending};
             bool m_isReload{ false };
             bool m_signalLoaded{ false };
@@ -820,6 +872,10 @@ namespace AZ
                 // since the main thread is typically responsible for calling DispatchEvents elsewhere
                 const bool shouldDispatch = AZStd::this_thread::get_id() == m_mainThreadId;
 
+                // Nothing is more urgent than an asset a thread is blocking on, so move its load to the critical lane.
+                RescheduleStreamerRequest(asset.GetId(), AZStd::chrono::milliseconds(0), AZ::IO::IStreamerTypes::s_priorityHighest,
+                    AssetLoadLane::Critical);
+
                 // Wait for the asset and all queued dependencies to finish loading.
                 WaitForAsset blockingWait(asset, shouldDispatch);
 
@@ -867,6 +923,21 @@ namespace AZ
 
             handler.GetDefaultAssetLoadPriority(assetType, deadline, priority);
 
+            switch (loadParams.m_lane)
+            {
+            case AssetLoadLane::Critical:
+                deadline = AZStd::chrono::milliseconds(0);
+                priority = AZ::IO::IStreamerTypes::s_priorityHighest;
+                break;
+            case AssetLoadLane::Background:
+                deadline = AZ::IO::IStreamerTypes::s_noDeadline;
+                priority = AZ::IO::IStreamerTypes::s_priorityLowest;
+                break;
+            default:
+                // Gameplay loads use the values of the handler.
+                break;
+            }
+
             if (loadParams.m_deadline)
             {
                 deadline = loadParams.m_deadline.value();
@@ -1092,7 +1163,7 @@ namespace AZ
                 {
                     auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, assetData->GetType(), loadParams);
                     
-                    RescheduleStreamerRequest(assetData->GetId(), deadline, priority);
+                    RescheduleStreamerRequest(assetData->GetId(), deadline, priority, loadParams.m_lane);
                 }
 
                 if (triggerAssetErrorNotification)
@@ -1602,7 +1673,8 @@ namespace AZ
             // can trigger an AssetManager::ReleaseAsset call.  If this occurs during lambda cleanup, it could happen at any time
             // on the file streamer thread as streamer requests get recycled, including during (or after) AssetManager shutdown.
             // By controlling when the refcount is changed, we can ensure that it occurs while the AssetManager is still active.
-            auto assetDataStreamCallback = [this, loadParams, handler, dataStream, signalLoaded, isReload,
+            const AZStd::chrono::system_clock::time_point queueTime = AZStd::chrono::system_clock::now();
+            auto assetDataStreamCallback = [this, loadParams, handler, dataStream, signalLoaded, isReload, queueTime,
                 weakAsset = AssetInternal::WeakAsset<AssetData>(asset)]
             (AZ::IO::IStreamerTypes::RequestStatus status) mutable
             {
@@ -1627,8 +1699,10 @@ namespace AZ
 
                     // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead, 
                     // do the majority of the work in a separate job.
+                    // The job runs in the highest lane the asset was requested in while it was streaming.
                     auto loadJob = aznew LoadAssetJob(this, loadingAsset,
-                        dataStream, isReload, status, handler, loadParams, signalLoaded);
+                        dataStream, isReload, status, handler, loadParams, signalLoaded,
+                        GetActiveStreamerRequestLane(assetId, loadParams.m_lane), queueTime);
 
                     bool jobQueued = false;
 
@@ -1654,6 +1728,8 @@ namespace AZ
                 }
                 else
                 {
+                    RecordLaneLoad(loadParams.m_lane, false, 0, AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                        AZStd::chrono::system_clock::now() - queueTime));
                     BlockingAssetLoadBus::Event(assetId, &BlockingAssetLoadBus::Events::OnLoadCanceled, assetId);
                     AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetCanceled, assetId);
                 }
@@ -1675,7 +1751,8 @@ namespace AZ
             auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, asset.GetType(), loadParams);
 
             // Track the load request and queue the asset data stream load.
-            AddActiveStreamerRequest(asset.GetId(), dataStream);
+            m_laneCounters[static_cast<size_t>(loadParams.m_lane)].m_queuedCount.fetch_add(1, AZStd::memory_order_relaxed);
+            AddActiveStreamerRequest(asset.GetId(), dataStream, loadParams.m_lane);
             dataStream->Open(
                 streamInfo.m_streamName,
                 streamInfo.m_dataOffset,
@@ -1819,18 +1896,19 @@ namespace AZ
         //=========================================================================
         // AddActiveStreamerRequest
         //=========================================================================
-        void AssetManager::AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest)
+        void AssetManager::AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest, AssetLoadLane lane)
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
 
             // Track the request to allow for manual cancellation and for validating completion before AssetManager shutdown
             [[maybe_unused]] auto inserted =
-                m_activeAssetDataStreamRequests.insert(AZStd::make_pair(assetId, readRequest));
+                m_activeAssetDataStreamRequests.insert(AZStd::make_pair(assetId, ActiveStreamerRequest{ readRequest, lane }));
             AZ_Assert(inserted.second, "Failed to insert streaming request into map for later retrieval by asset.");
 
         }
 
-        void AssetManager::RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority)
+        void AssetManager::RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority,
+            AssetLoadLane newLane)
         {
             AZStd::scoped_lock lock(m_activeJobOrRequestMutex);
 
@@ -1838,7 +1916,74 @@ namespace AZ
 
             if (iterator != m_activeAssetDataStreamRequests.end())
             {
-                iterator->second->Reschedule(newDeadline, newPriority);
+                // Requests only ever move up to a more urgent lane, in the same way the stream only moves up its deadline and priority.
+                iterator->second.m_dataStream->Reschedule(newDeadline, newPriority);
+                iterator->second.m_lane = AZStd::GetMin(iterator->second.m_lane, newLane);
+            }
+        }
+
+        AssetLoadLane AssetManager::GetActiveStreamerRequestLane(AssetId assetId, AssetLoadLane lane)
+        {
+            AZStd::scoped_lock lock(m_activeJobOrRequestMutex);
+
+            auto iterator = m_activeAssetDataStreamRequests.find(assetId);
+            return iterator != m_activeAssetDataStreamRequests.end() ? iterator->second.m_lane : lane;
+        }
+
+        //=========================================================================
+        // RecordLaneLoad
+        //=========================================================================
+        void AssetManager::RecordLaneLoad(AssetLoadLane lane, bool succeeded, u64 bytesLoaded, AZStd::chrono::microseconds latency)
+        {
+            LaneCounters& counters = m_laneCounters[static_cast<size_t>(lane)];
+            if (succeeded)
+            {
+                counters.m_completedCount.fetch_add(1, AZStd::memory_order_relaxed);
+                counters.m_bytesLoaded.fetch_add(bytesLoaded, AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                counters.m_failedCount.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+
+            const u64 latencyUs = aznumeric_cast<u64>(AZStd::GetMax(latency.count(), decltype(latency.count())(0)));
+            counters.m_totalLatencyUs.fetch_add(latencyUs, AZStd::memory_order_relaxed);
+            u64 maxLatencyUs = counters.m_maxLatencyUs.load(AZStd::memory_order_relaxed);
+            while (latencyUs > maxLatencyUs &&
+                !counters.m_maxLatencyUs.compare_exchange_weak(maxLatencyUs, latencyUs, AZStd::memory_order_relaxed))
+            {
+            }
+        }
+
+        //=========================================================================
+        // GetLaneStatistics
+        //=========================================================================
+        AssetManager::LaneStatistics AssetManager::GetLaneStatistics(AssetLoadLane lane) const
+        {
+            const LaneCounters& counters = m_laneCounters[static_cast<size_t>(lane)];
+            LaneStatistics statistics;
+            statistics.m_queuedCount = counters.m_queuedCount.load(AZStd::memory_order_relaxed);
+            statistics.m_completedCount = counters.m_completedCount.load(AZStd::memory_order_relaxed);
+            statistics.m_failedCount = counters.m_failedCount.load(AZStd::memory_order_relaxed);
+            statistics.m_bytesLoaded = counters.m_bytesLoaded.load(AZStd::memory_order_relaxed);
+            statistics.m_totalLatency = AZStd::chrono::microseconds(counters.m_totalLatencyUs.load(AZStd::memory_order_relaxed));
+            statistics.m_maxLatency = AZStd::chrono::microseconds(counters.m_maxLatencyUs.load(AZStd::memory_order_relaxed));
+            return statistics;
+        }
+
+        //=========================================================================
+        // ResetLaneStatistics
+        //=========================================================================
+        void AssetManager::ResetLaneStatistics()
+        {
+            for (LaneCounters& counters : m_laneCounters)
+            {
+                counters.m_queuedCount = 0;
+                counters.m_completedCount = 0;
+                counters.m_failedCount = 0;
+                counters.m_bytesLoaded = 0;
+                counters.m_totalLatencyUs = 0;
+                counters.m_maxLatencyUs = 0;
             }
         }
 
@@ -2185,5 +2330,6 @@ size_t AZStd::hash<AZ::Data::AssetContainerKey>::operator()(const AZ::Data::Asse
     hash_combine(h, obj.m_loadParameters.m_deadline.value_or(AZStd::chrono::milliseconds(-1)).count());
     hash_combine(h, obj.m_loadParameters.m_priority.value_or(-1));
     hash_combine(h, obj.m_loadParameters.m_dependencyRules);
+    hash_combine(h, obj.m_loadParameters.m_lane);
     return h;
 }
@@ -150,6 +150,17 @@ namespace AZ
                 Descriptor() = default;
             };
 
+            //! Throughput and latency of the asynchronous loads of a priority lane.
+            struct LaneStatistics
+            {
+                u64 m_queuedCount{ 0 };     //!< Loads that were queued in the lane.
+                u64 m_completedCount{ 0 };  //!< Loads that finished successfully.
+                u64 m_failedCount{ 0 };     //!< Loads that failed or were canceled.
+                u64 m_bytesLoaded{ 0 };     //!< Bytes read by the successful loads.
+                AZStd::chrono::microseconds m_totalLatency{ 0 }; //!< Sum of the time between queuing and finishing each load.
+                AZStd::chrono::microseconds m_maxLatency{ 0 };   //!< Longest time between queuing and finishing a load.
+            };
+
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
@@ -324,6 +335,13 @@ namespace AZ
             */
             bool HasActiveJobsOrStreamerRequests();
 
+            /**
+            * Returns the statistics of the asynchronous loads that were queued in a priority lane since the last reset.
+            * Loads that move to a higher lane are counted in the lane they were queued in.
+            */
+            LaneStatistics GetLaneStatistics(AssetLoadLane lane) const;
+            void ResetLaneStatistics();
+
         protected:
             AssetManager(const Descriptor& desc);
             virtual ~AssetManager();
@@ -342,8 +360,11 @@ namespace AZ
 
             void AddJob(AssetDatabaseJob* job);
             void RemoveJob(AssetDatabaseJob* job);
-            void AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest);
-            void RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority);
+            void AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest, AssetLoadLane lane);
+            void RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority, AssetLoadLane newLane);
+            //! Returns the highest lane the streamer request of the asset was moved to, or the provided lane if there's no request.
+            AssetLoadLane GetActiveStreamerRequestLane(AssetId assetId, AssetLoadLane lane);
+            void RecordLaneLoad(AssetLoadLane lane, bool succeeded, u64 bytesLoaded, AZStd::chrono::microseconds latency);
             void RemoveActiveStreamerRequest(AssetId assetId);
             void AddBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
             void RemoveBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
@@ -423,9 +444,26 @@ namespace AZ
             ActiveJobList           m_activeJobs;
 
             //! The AssetDataStream read requests that are pending or processing for a specific asset.
-            using AssetRequestMap = AZStd::unordered_map<AssetId, AZStd::shared_ptr<AssetDataStream>>;
+            struct ActiveStreamerRequest
+            {
+                AZStd::shared_ptr<AssetDataStream> m_dataStream;
+                AssetLoadLane m_lane;
+            };
+            using AssetRequestMap = AZStd::unordered_map<AssetId, ActiveStreamerRequest>;
             AssetRequestMap m_activeAssetDataStreamRequests;
 
+            //! Counters for the statistics of each priority lane, which are updated from the streamer and job threads.
+            struct LaneCounters
+            {
+                AZStd::atomic<u64> m_queuedCount{ 0 };
+                AZStd::atomic<u64> m_completedCount{ 0 };
+                AZStd::atomic<u64> m_failedCount{ 0 };
+                AZStd::atomic<u64> m_bytesLoaded{ 0 };
+                AZStd::atomic<u64> m_totalLatencyUs{ 0 };
+                AZStd::atomic<u64> m_maxLatencyUs{ 0 };
+            };
+            LaneCounters m_laneCounters[static_cast<size_t>(AssetLoadLane::Count)];
+
             // Lock when accessing the list of active jobs or streamer requests
             AZStd::recursive_mutex  m_activeJobOrRequestMutex;
 
@@ -402,6 +402,22 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether the services of the component can change based on the instance passed to the service functions.
+         * Entities cache the sorted order of their components for each combination of component types, which is only
+         * possible when every instance of the component reports the same services.
+         * @return True if the services can be different for each instance. Custom descriptors return true by default.
+         */
+        virtual bool HasInstanceDependentServices() const { return true; }
+
+        /**
+         * Specifies whether the component can be activated on a job thread, at the same time as the components of other entities.
+         * This requires that activating the component only changes the component itself and calls into thread safe systems.
+         * Entity::ActivateEntities activates entities on job threads when all of their components are thread safe to activate.
+         * @return True if the component can be activated on a job thread.
+         */
+        virtual bool IsThreadSafeToActivate() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -495,6 +511,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentThreadSafeToActivate, IsThreadSafeToActivate, bool, ());
     /// @endcond
 
     /**
@@ -567,6 +584,24 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * The services are provided by static functions, so they are the same for every instance.
+         * Descriptors that derive from this class and refine the services per instance should override this function.
+         */
+        bool HasInstanceDependentServices() const override
+        {
+            return false;
+        }
+
+        /**
+         * Calls the static function IsThreadSafeToActivate, if the user provided it.
+         * @return True if the component can be activated on a job thread, false if the component doesn't provide the function.
+         */
+        bool IsThreadSafeToActivate() const override
+        {
+            return CallIsThreadSafeToActivate(typename HasComponentThreadSafeToActivate<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -613,5 +648,15 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        bool CallIsThreadSafeToActivate(const AZStd::true_type&) const
+        {
+            return ComponentClass::IsThreadSafeToActivate();
+        }
+
+        bool CallIsThreadSafeToActivate(const AZStd::false_type&) const
+        {
+            return false;
+        }
     };
 }
@@ -21,6 +21,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -637,6 +638,8 @@ namespace AZ
 
         NameDictionary::Create();
 
+        Entity::CreateDependencySortCache();
+
         // Call this and child class's reflects
         ReflectionEnvironment::GetReflectionManager()->Reflect(azrtti_typeid(this), AZStd::bind(&ComponentApplication::Reflect, this, AZStd::placeholders::_1));
 
@@ -733,6 +736,8 @@ namespace AZ
 
         NameDictionary::Destroy();
 
+        Entity::DestroyDependencySortCache();
+
         m_systemEntity.reset();
 
         Sfmt::Destroy();
@@ -959,12 +964,27 @@ namespace AZ
         //!    2. <cache_root>/Registry
         //!    3. <project_build_path>/bin/$<CONFIG>/Registry
         //! 3. MergeSettingsToRegistry_GemRegistries - Merges the settings registry files from each gem's <GemRoot>/Registry directory
+        //! 4. When enabled, steps 2 and 3 plus the engine and project registries are replaced by loading a binary settings
+        //!    cache if none of the registry files changed since it was created.
 
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
-            AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        AZ::IO::FixedMaxPath settingsCachePath = SettingsRegistryMergeUtils::GetSettingsCachePath(registry);
+        SettingsRegistryInterface::CacheKey settingsCacheKey;
+        if (!settingsCachePath.empty())
+        {
+            settingsCacheKey = registry.CreateCacheKey(specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+        }
+        if (settingsCachePath.empty() || !registry.MergeSettingsCache(settingsCachePath.Native(), settingsCacheKey))
+        {
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
+                AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            if (!settingsCachePath.empty())
+            {
+                registry.StoreSettingsCache(settingsCachePath.Native(), settingsCacheKey);
+            }
+        }
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -998,6 +1018,9 @@ namespace AZ
         {
             ReflectionEnvironment::GetReflectionManager()->Reflect(descriptor->GetUuid(), AZStd::bind(&ComponentDescriptor::Reflect, descriptor, AZStd::placeholders::_1));
         }
+
+        // The services of the new descriptor can change the sorted order of components.
+        Entity::ClearDependencySortCache();
     }
 
     //=========================================================================
@@ -1009,6 +1032,8 @@ namespace AZ
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
         }
+
+        Entity::ClearDependencySortCache();
     }
 
     void ComponentApplication::RegisterEntityAddedEventHandler(EntityAddedEvent::Handler& handler)
@@ -1414,6 +1439,11 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
                 EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
             }
+            if (AllocatorInstance<FrameAllocator>::IsReady())
+            {
+                // memory allocated from the frame allocator in the previous frame is reused from here on
+                static_cast<FrameAllocator&>(AllocatorInstance<FrameAllocator>::GetAllocator()).AdvanceFrame();
+            }
         }
         if (m_drillerManager)
         {
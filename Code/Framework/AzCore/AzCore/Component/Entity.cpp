@@ -14,6 +14,9 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/NamedEntityId.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Module/Environment.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -26,6 +29,9 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Platform.h>
@@ -190,22 +196,117 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+        if (BeginActivation())
+        {
+            ActivateComponents();
+            EndActivation();
+        }
+    }
+
+    void Entity::ActivateEntities(const AZStd::vector<Entity*>& entities, const AZStd::function<void(Entity*)>& onEntityActivated)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        // Activating an entity sends notifications that can activate or deactivate other entities in the batch, so the state of
+        // each entity is checked again right before it's activated.
+        auto activateEntity = [&onEntityActivated](Entity* entity)
+        {
+            if (entity->GetState() == State::Init)
+            {
+                entity->Activate();
+                if (onEntityActivated)
+                {
+                    onEntityActivated(entity);
+                }
+            }
+        };
+
+        JobContext* jobContext = nullptr;
+        JobManagerBus::BroadcastResult(jobContext, &JobManagerEvents::GetGlobalContext);
+
+        // Entities that activate their components on job threads. Sorting the components and changing the state
+        // is done on the calling thread, as both can call into code that isn't thread safe.
+        AZStd::vector<Entity*> concurrentEntities;
+        AZStd::vector<bool> isConcurrent(entities.size(), false);
+        if (jobContext)
+        {
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                Entity* entity = entities[i];
+                if (azrtti_typeid(entity) == azrtti_typeid<Entity>() && entity->IsThreadSafeToActivate())
+                {
+                    concurrentEntities.push_back(entity);
+                    isConcurrent[i] = true;
+                }
+            }
+        }
+
+        if (concurrentEntities.size() < 2)
+        {
+            for (Entity* entity : entities)
+            {
+                activateEntity(entity);
+            }
+            return;
+        }
+
+        // Entities that fail to sort their components are removed from the list. No notifications are sent until all
+        // concurrent entities are in the Activating state, so their state can't change before this point.
+        concurrentEntities.erase(AZStd::remove_if(concurrentEntities.begin(), concurrentEntities.end(),
+            [](Entity* entity)
+            {
+                return !entity->BeginActivation();
+            }), concurrentEntities.end());
+
+        AZ::parallel_for(size_t(0), concurrentEntities.size(),
+            [&concurrentEntities](size_t index)
+            {
+                concurrentEntities[index]->ActivateComponents();
+            }, jobContext);
+
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            Entity* entity = entities[i];
+            if (!isConcurrent[i])
+            {
+                activateEntity(entity);
+            }
+            else if (entity->m_state == State::Activating)
+            {
+                entity->EndActivation();
+                if (onEntityActivated)
+                {
+                    onEntityActivated(entity);
+                }
+            }
+        }
+    }
+
+    bool Entity::BeginActivation()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
 
+    void Entity::ActivateComponents()
+    {
         for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
         {
             ActivateComponent(**it);
         }
+    }
 
+    void Entity::EndActivation()
+    {
         // Cache the transform interface to the transform interface
         // Generally this pattern is not recommended unless for component event buses
         // As we have a guarantee (by design) that components can't change during active state)
@@ -247,6 +348,181 @@ namespace AZ
         SetState(State::Init);
     }
 
+    bool Entity::IsThreadSafeToActivate() const
+    {
+        if (m_state != State::Init || m_components.empty())
+        {
+            return false;
+        }
+
+        for (const Component* component : m_components)
+        {
+            ComponentDescriptor* descriptor = nullptr;
+            ComponentDescriptorBus::EventResult(descriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!descriptor || !descriptor->IsThreadSafeToActivate())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    namespace DependencySortCacheInternal
+    {
+        static constexpr const char* CacheInstanceName = "EntityDependencySortCache";
+
+        // The components of entities with more components are sorted every time.
+        static constexpr size_t MaxCachedComponents = 32;
+
+        struct ComponentTypes
+        {
+            bool operator==(const ComponentTypes& rhs) const
+            {
+                return m_typeId == rhs.m_typeId && m_underlyingTypeId == rhs.m_underlyingTypeId;
+            }
+
+            Uuid m_typeId;
+            Uuid m_underlyingTypeId;
+        };
+
+        // The types of the components of an entity, in the order in which they are stored before sorting.
+        using Signature = AZStd::fixed_vector<ComponentTypes, MaxCachedComponents>;
+        // The index in the signature of each component, in sorted order.
+        using SortedOrder = AZStd::fixed_vector<u8, MaxCachedComponents>;
+
+        class Cache
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Cache, SystemAllocator, 0);
+
+            bool Find(size_t hash, const Signature& signature, SortedOrder& order) const
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+                auto entry = m_entries.find(hash);
+                if (entry != m_entries.end() && entry->second.m_signature == signature)
+                {
+                    order = entry->second.m_order;
+                    return true;
+                }
+                return false;
+            }
+
+            void Store(size_t hash, const Signature& signature, const SortedOrder& order)
+            {
+                AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+                // Keeps the existing entry if the hash of a different signature is the same.
+                m_entries.emplace(hash, Entry{ signature, order });
+            }
+
+            void Clear()
+            {
+                AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+                m_entries.clear();
+            }
+
+        private:
+            struct Entry
+            {
+                Signature m_signature;
+                SortedOrder m_order;
+            };
+
+            mutable AZStd::shared_mutex m_mutex;
+            AZStd::unordered_map<size_t, Entry> m_entries;
+        };
+
+        static EnvironmentVariable<Cache*> s_cache;
+
+        static Cache* GetCache()
+        {
+            if (!s_cache)
+            {
+                s_cache = Environment::FindVariable<Cache*>(CacheInstanceName);
+            }
+            return s_cache ? *s_cache : nullptr;
+        }
+
+        static bool MakeSignature(const Entity::ComponentArrayType& components, Signature& signature, size_t& hash)
+        {
+            if (components.size() > MaxCachedComponents)
+            {
+                return false;
+            }
+
+            for (const Component* component : components)
+            {
+                if (!component)
+                {
+                    return false;
+                }
+
+                const ComponentTypes types{ azrtti_typeid(component), component->GetUnderlyingComponentType() };
+                AZStd::hash_combine(hash, types.m_typeId);
+                AZStd::hash_combine(hash, types.m_underlyingTypeId);
+                signature.push_back(types);
+            }
+            return true;
+        }
+
+        // The sorted order can only be reused by other entities if it doesn't depend on the component instances.
+        static bool CanCacheOrder(const Signature& signature)
+        {
+            for (size_t i = 0; i < signature.size(); ++i)
+            {
+                // Components of the same type are sorted by their component id.
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (signature[j].m_typeId == signature[i].m_typeId || signature[j].m_underlyingTypeId == signature[i].m_underlyingTypeId)
+                    {
+                        return false;
+                    }
+                }
+
+                ComponentDescriptor* descriptor = nullptr;
+                ComponentDescriptorBus::EventResult(descriptor, signature[i].m_typeId, &ComponentDescriptorBus::Events::GetDescriptor);
+                if (!descriptor || descriptor->HasInstanceDependentServices())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    void Entity::CreateDependencySortCache()
+    {
+        using namespace DependencySortCacheInternal;
+
+        if (!s_cache)
+        {
+            s_cache = Environment::CreateVariable<Cache*>(CacheInstanceName);
+        }
+
+        if (!s_cache.Get())
+        {
+            s_cache.Set(aznew Cache());
+        }
+    }
+
+    void Entity::DestroyDependencySortCache()
+    {
+        using namespace DependencySortCacheInternal;
+
+        if (s_cache)
+        {
+            delete (*s_cache);
+            *s_cache = nullptr;
+        }
+    }
+
+    void Entity::ClearDependencySortCache()
+    {
+        if (DependencySortCacheInternal::Cache* cache = DependencySortCacheInternal::GetCache())
+        {
+            cache->Clear();
+        }
+    }
+
     Entity::DependencySortResult Entity::EvaluateDependencies()
     {
         DependencySortOutcome outcome = EvaluateDependenciesGetDetails();
@@ -259,8 +535,42 @@ namespace AZ
 
         if (!m_isDependencyReady)
         {
+            using namespace DependencySortCacheInternal;
+
+            Cache* cache = GetCache();
+            Signature signature;
+            size_t hash = 0;
+            SortedOrder order;
+            if (cache && !MakeSignature(m_components, signature, hash))
+            {
+                cache = nullptr;
+            }
+
+            const AZStd::fixed_vector<Component*, MaxCachedComponents> unsortedComponents = cache
+                ? AZStd::fixed_vector<Component*, MaxCachedComponents>(m_components.begin(), m_components.end())
+                : AZStd::fixed_vector<Component*, MaxCachedComponents>();
+
+            if (cache && cache->Find(hash, signature, order))
+            {
+                for (size_t i = 0; i < order.size(); ++i)
+                {
+                    m_components[i] = unsortedComponents[order[i]];
+                }
+                m_isDependencyReady = true;
+                return outcome;
+            }
+
             outcome = DependencySort(m_components);
             m_isDependencyReady = outcome.IsSuccess();
+
+            if (cache && m_isDependencyReady && CanCacheOrder(signature))
+            {
+                for (Component* component : m_components)
+                {
+                    order.push_back(aznumeric_cast<u8>(AZStd::find(unsortedComponents.begin(), unsortedComponents.end(), component) - unsortedComponents.begin()));
+                }
+                cache->Store(hash, signature, order);
+            }
         }
 
         return outcome;
@@ -17,6 +17,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/std/function/function_fwd.h>
 #include <AzCore/std/string/string.h>
 
 namespace AZ
@@ -158,6 +159,17 @@ namespace AZ
         //! of each component.
         virtual void Activate();
 
+        //! Activates a batch of entities.
+        //! Entities whose components are all thread safe to activate (see ComponentDescriptor::IsThreadSafeToActivate)
+        //! activate their components on job threads, all other entities are activated on the calling thread.
+        //! The activation notifications are sent on the calling thread, in the order of the entities in the batch.
+        //! Entities of derived classes that override Activate() are always activated on the calling thread.
+        //! The state of each entity is checked again right before it's activated, so entities that were activated or deactivated
+        //! by the notifications of an earlier entity in the batch are skipped.
+        //! @param entities The entities to activate. Entities that are not in the State::Init state are skipped.
+        //! @param onEntityActivated Optional callback called on the calling thread after each entity has been activated.
+        static void ActivateEntities(const AZStd::vector<Entity*>& entities, const AZStd::function<void(Entity*)>& onEntityActivated = {});
+
         //! Deactivates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an
         //! entity. This function calls the Deactivate function of each component.
@@ -366,6 +378,18 @@ namespace AZ
         //! Otherwise the outcome contains details on why the sort failed.
         static DependencySortOutcome DependencySort(ComponentArrayType& components);
 
+        //! Creates and destroys the cache that allows entities with the same component types to reuse
+        //! the sorted order of their components. The cache is owned by the AZ::ComponentApplication.
+        //! Without a cache, the components of every entity are sorted when the entity is activated.
+        //! @{
+        static void CreateDependencySortCache();
+        static void DestroyDependencySortCache();
+        //! @}
+
+        //! Removes all sorted orders from the cache.
+        //! Needs to be called when component descriptors are registered or unregistered.
+        static void ClearDependencySortCache();
+
     protected:
 
         /// @cond EXCLUDE_DOCS 
@@ -419,6 +443,17 @@ namespace AZ
         //! such as AZStd::bit_set<>. With just a couple flags, AZStd::bit_set's word-size of 32-bits will actually waste space.
         bool m_isDependencyReady;           ///< Indicates the component dependencies have been evaluated and sorting was completed successfully.
         bool m_isRuntimeActiveByDefault;    ///< Indicates the entity should be activated on initial creation.
+
+    private:
+        //! The steps of Activate(), so ActivateEntities() can activate the components of multiple entities at the same time.
+        //! @{
+        bool BeginActivation();
+        void ActivateComponents();
+        void EndActivation();
+        //! @}
+
+        //! Returns true if all components can be activated on a job thread.
+        bool IsThreadSafeToActivate() const;
     };
 
     template<class ComponentType, typename... Args>
@@ -9,12 +9,191 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <limits>
 
 #include <AzCore/Compression/zstd_compression.h>
 
+#include <zdict.h>
+
 using namespace AZ;
 
+namespace ZStdInternal
+{
+    using RegisteredDictionaries = AZStd::fixed_vector<AZStd::shared_ptr<const ZStdDictionary>, ZStdDictionary::MaxRegisteredDictionaries>;
+
+    static RegisteredDictionaries& GetRegisteredDictionaries()
+    {
+        static RegisteredDictionaries dictionaries;
+        return dictionaries;
+    }
+
+    static AZStd::mutex& GetRegistrationMutex()
+    {
+        static AZStd::mutex mutex;
+        return mutex;
+    }
+
+    // Contexts are expensive to create, so keep one per thread around for dictionary compression and decompression.
+    struct ThreadContexts
+    {
+        ~ThreadContexts()
+        {
+            ZSTD_freeCCtx(m_compression);
+            ZSTD_freeDCtx(m_decompression);
+        }
+
+        ZSTD_CCtx* GetCompressionContext()
+        {
+            if (!m_compression)
+            {
+                m_compression = ZSTD_createCCtx();
+            }
+            return m_compression;
+        }
+
+        ZSTD_DCtx* GetDecompressionContext()
+        {
+            if (!m_decompression)
+            {
+                m_decompression = ZSTD_createDCtx();
+            }
+            return m_decompression;
+        }
+
+        ZSTD_CCtx* m_compression{ nullptr };
+        ZSTD_DCtx* m_decompression{ nullptr };
+    };
+    static thread_local ThreadContexts s_threadContexts;
+}
+
+ZStdDictionary::ZStdDictionary(const void* data, size_t size, int compressionLevel)
+    : m_data(reinterpret_cast<const u8*>(data), reinterpret_cast<const u8*>(data) + size)
+{
+    m_id = ZDICT_getDictID(m_data.data(), m_data.size());
+    m_compressionDictionary = ZSTD_createCDict(m_data.data(), m_data.size(), compressionLevel);
+    m_decompressionDictionary = ZSTD_createDDict(m_data.data(), m_data.size());
+    AZ_Error("ZStandard", IsValid(), "Unable to create a zstd dictionary from the provided data.");
+}
+
+ZStdDictionary::~ZStdDictionary()
+{
+    ZSTD_freeCDict(m_compressionDictionary);
+    ZSTD_freeDDict(m_decompressionDictionary);
+}
+
+AZStd::vector<u8> ZStdDictionary::Train(const void* samples, const size_t* sampleSizes, u32 numSamples, size_t maxDictionarySize)
+{
+    AZStd::vector<u8> dictionary(maxDictionarySize);
+    size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples, sampleSizes, numSamples);
+    if (ZDICT_isError(result))
+    {
+        AZ_Warning("ZStandard", false, "Unable to train zstd dictionary: %s", ZDICT_getErrorName(result));
+        return {};
+    }
+    dictionary.resize(result);
+    return dictionary;
+}
+
+bool ZStdDictionary::IsValid() const
+{
+    return m_id != 0 && m_compressionDictionary && m_decompressionDictionary;
+}
+
+u32 ZStdDictionary::GetId() const
+{
+    return m_id;
+}
+
+const void* ZStdDictionary::GetData() const
+{
+    return m_data.data();
+}
+
+size_t ZStdDictionary::GetSize() const
+{
+    return m_data.size();
+}
+
+const ZSTD_CDict* ZStdDictionary::GetCompressionDictionary() const
+{
+    return m_compressionDictionary;
+}
+
+const ZSTD_DDict* ZStdDictionary::GetDecompressionDictionary() const
+{
+    return m_decompressionDictionary;
+}
+
+size_t ZStdDictionary::Compress(void* compressed, size_t compressedCapacity, const void* uncompressed, size_t uncompressedSize) const
+{
+    return ZSTD_compress_usingCDict(ZStdInternal::s_threadContexts.GetCompressionContext(),
+        compressed, compressedCapacity, uncompressed, uncompressedSize, m_compressionDictionary);
+}
+
+size_t ZStdDictionary::Decompress(void* uncompressed, size_t uncompressedCapacity, const void* compressed, size_t compressedSize) const
+{
+    return ZSTD_decompress_usingDDict(ZStdInternal::s_threadContexts.GetDecompressionContext(),
+        uncompressed, uncompressedCapacity, compressed, compressedSize, m_decompressionDictionary);
+}
+
+bool ZStdDictionary::Register(AZStd::shared_ptr<const ZStdDictionary> dictionary)
+{
+    if (!dictionary || !dictionary->IsValid())
+    {
+        return false;
+    }
+
+    AZStd::scoped_lock lock(ZStdInternal::GetRegistrationMutex());
+    ZStdInternal::RegisteredDictionaries& dictionaries = ZStdInternal::GetRegisteredDictionaries();
+    for (AZStd::shared_ptr<const ZStdDictionary>& registered : dictionaries)
+    {
+        if (registered->GetId() == dictionary->GetId())
+        {
+            registered = AZStd::move(dictionary);
+            return true;
+        }
+    }
+    if (dictionaries.size() == dictionaries.capacity())
+    {
+        AZ_Error("ZStandard", false, "Unable to register zstd dictionary %u because the maximum of %zu dictionaries has been reached.",
+            dictionary->GetId(), MaxRegisteredDictionaries);
+        return false;
+    }
+    dictionaries.push_back(AZStd::move(dictionary));
+    return true;
+}
+
+void ZStdDictionary::Unregister(u32 id)
+{
+    AZStd::scoped_lock lock(ZStdInternal::GetRegistrationMutex());
+    ZStdInternal::RegisteredDictionaries& dictionaries = ZStdInternal::GetRegisteredDictionaries();
+    auto it = AZStd::find_if(dictionaries.begin(), dictionaries.end(),
+        [id](const AZStd::shared_ptr<const ZStdDictionary>& dictionary) { return dictionary->GetId() == id; });
+    if (it != dictionaries.end())
+    {
+        dictionaries.erase(it);
+    }
+}
+
+AZStd::shared_ptr<const ZStdDictionary> ZStdDictionary::Find(u32 id)
+{
+    AZStd::scoped_lock lock(ZStdInternal::GetRegistrationMutex());
+    for (const AZStd::shared_ptr<const ZStdDictionary>& dictionary : ZStdInternal::GetRegisteredDictionaries())
+    {
+        if (dictionary->GetId() == id)
+        {
+            return dictionary;
+        }
+    }
+    return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 ZStd::ZStd(IAllocatorAllocate* workMemAllocator)
 {
     m_workMemoryAllocator = workMemAllocator;
@@ -50,6 +229,12 @@ void ZStd::FreeMem(void* userData, void* address)
     allocator->DeAllocate(address);
 }
 
+void ZStd::SetDictionary(const ZStdDictionary* dictionary)
+{
+    AZ_Assert(!m_streamCompression && !m_streamDecompression, "The dictionary can't be changed while a stream is active.");
+    m_dictionary = dictionary;
+}
+
 void ZStd::StartCompressor(unsigned int compressionLevel)
 {
     AZ_Assert(!m_streamCompression, "Compressor already started!");
@@ -60,6 +245,12 @@ void ZStd::StartCompressor(unsigned int compressionLevel)
     AZ_UNUSED(compressionLevel);
     m_streamCompression = (ZSTD_createCStream_advanced(customAlloc));
     AZ_Assert( m_streamCompression , "ZStandard internal error - failed to create compression stream\n");
+    if (m_streamCompression && m_dictionary)
+    {
+        size_t result = ZSTD_CCtx_refCDict(m_streamCompression, m_dictionary->GetCompressionDictionary());
+        AZ_UNUSED(result);
+        AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    }
 }
 
 void ZStd::StopCompressor()
@@ -104,6 +295,13 @@ void ZStd::StartDecompressor()
     m_streamDecompression = ZSTD_createDStream_advanced(customAlloc);
     m_nextBlockSize = ZSTD_initDStream(m_streamDecompression);
     AZ_Assert(!ZSTD_isError(m_nextBlockSize), "ZStandard internal error: %s", ZSTD_getErrorName(m_nextBlockSize));
+    if (m_dictionary)
+    {
+        // Resetting the stream at the end of a frame only resets the session, so the dictionary stays referenced.
+        size_t result = ZSTD_DCtx_refDDict(m_streamDecompression, m_dictionary->GetDecompressionDictionary());
+        AZ_UNUSED(result);
+        AZ_Assert(!ZSTD_isError(result), "ZStandard internal error: %s", ZSTD_getErrorName(result));
+    }
 
     //pointers will be set later....
     m_inBuffer.pos = 0;
@@ -7,6 +7,9 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #define ZSTD_STATIC_LINKING_ONLY
@@ -18,6 +21,55 @@ namespace AZ
     class IAllocator;
     class IAllocatorAllocate;
 
+    //! A trained zstd dictionary. Small pieces of data, such as individual assets, compress poorly on their own because
+    //! there's little history for the compressor to reference. A dictionary trained on representative samples provides
+    //! that history up front. Frames compressed with a dictionary store the dictionary id, so data can find its dictionary
+    //! again through the registered dictionaries when it's decompressed.
+    class ZStdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdDictionary, SystemAllocator, 0);
+
+        static constexpr int DefaultCompressionLevel = 3;
+        static constexpr size_t MaxRegisteredDictionaries = 16;
+
+        ZStdDictionary(const void* data, size_t size, int compressionLevel = DefaultCompressionLevel);
+        ~ZStdDictionary();
+
+        ZStdDictionary(const ZStdDictionary&) = delete;
+        ZStdDictionary& operator=(const ZStdDictionary&) = delete;
+
+        //! Trains a dictionary. The samples are stored back to back in "samples" and "sampleSizes" contains the size of each sample.
+        //! Returns an empty buffer if no dictionary could be trained, for instance because there were too few samples.
+        static AZStd::vector<AZ::u8> Train(const void* samples, const size_t* sampleSizes, AZ::u32 numSamples, size_t maxDictionarySize);
+
+        bool IsValid() const;
+        //! The id that's stored in frames compressed with this dictionary.
+        AZ::u32 GetId() const;
+        const void* GetData() const;
+        size_t GetSize() const;
+
+        const ZSTD_CDict* GetCompressionDictionary() const;
+        const ZSTD_DDict* GetDecompressionDictionary() const;
+
+        //! Compresses or decompresses a single frame with this dictionary. Both functions are thread safe and return the number of
+        //! bytes written or an error code that can be checked with ZSTD_isError.
+        size_t Compress(void* compressed, size_t compressedCapacity, const void* uncompressed, size_t uncompressedSize) const;
+        size_t Decompress(void* uncompressed, size_t uncompressedCapacity, const void* compressed, size_t compressedSize) const;
+
+        //! Registers a dictionary so it can be found by the id stored in the frames that were compressed with it. Registered dictionaries
+        //! need to be unregistered before the allocators are destroyed.
+        static bool Register(AZStd::shared_ptr<const ZStdDictionary> dictionary);
+        static void Unregister(AZ::u32 id);
+        static AZStd::shared_ptr<const ZStdDictionary> Find(AZ::u32 id);
+
+    private:
+        AZStd::vector<AZ::u8> m_data;
+        ZSTD_CDict* m_compressionDictionary{ nullptr };
+        ZSTD_DDict* m_decompressionDictionary{ nullptr };
+        AZ::u32 m_id{ 0 };
+    };
+
     class ZStd
     {
     public:
@@ -46,6 +98,10 @@ namespace AZ
 
         using Header = AZ::u32;     ///< Typedef for the  byte zstd header.
 
+        /// Use the dictionary for compression and decompression streams that are started after this call. The dictionary needs to
+        /// outlive the streams.
+        void SetDictionary(const ZStdDictionary* dictionary);
+
         void StartCompressor(unsigned int compressionLevel = 1);
         bool IsCompressorStarted() const;
         void StopCompressor();
@@ -76,6 +132,7 @@ namespace AZ
 
         ZSTD_CStream*   m_streamCompression;
         ZSTD_DStream*   m_streamDecompression;
+        const ZStdDictionary* m_dictionary{ nullptr };
         IAllocatorAllocate*     m_workMemoryAllocator;
         ZSTD_inBuffer   m_inBuffer;
         ZSTD_outBuffer  m_outBuffer;
@@ -0,0 +1,907 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/AsyncLogSink.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace AsyncLogSinkInternal
+    {
+        enum class RecordType : u8
+        {
+            //! Fills the end of a buffer when a record doesn't fit before the buffer wraps around.
+            Padding,
+            //! An ILogger message stored as the format string and the binary values of the arguments.
+            Log,
+            //! An ILogger message that was formatted on the logging thread, because its arguments couldn't be stored.
+            LogText,
+            //! A trace message followed by its window.
+            Trace
+        };
+
+        //! Records are aligned to this, which also guarantees there's room for the size and type of a padding record at the
+        //! end of a buffer.
+        static constexpr size_t RecordAlignment = 8;
+
+        struct alignas(RecordAlignment) RecordHeader
+        {
+            const char* GetPayload() const
+            {
+                return reinterpret_cast<const char*>(this + 1);
+            }
+
+            char* GetPayload()
+            {
+                return reinterpret_cast<char*>(this + 1);
+            }
+
+            //! The size of the record including the header and alignment.
+            u32 m_size;
+            RecordType m_type;
+            LogLevel m_level;
+            AsyncLogSink::TraceType m_traceType;
+            int32_t m_line;
+            AZStd::sys_time_t m_timestamp;
+            const char* m_format;
+            const char* m_file;
+            const char* m_function;
+        };
+
+        //! A ring buffer that's written by a single thread and read by the thread writing the records.
+        struct ThreadBuffer
+        {
+            char* m_data{ nullptr };
+            u64 m_mask{ 0 };
+            //! The total number of bytes written, only updated by the owning thread.
+            AZStd::atomic<u64> m_writePosition{ 0 };
+            //! The total number of bytes read, only updated by the thread writing the records.
+            AZStd::atomic<u64> m_readPosition{ 0 };
+            //! Cleared when the owning thread exits, so the buffer can be picked up by another thread.
+            AZStd::atomic_bool m_inUse{ false };
+        };
+
+        //! The sinks that currently exist, so a thread that exits only releases its buffer if the sink is still around.
+        struct LiveSinks
+        {
+            AZStd::mutex m_mutex;
+            AZStd::fixed_vector<u64, 16> m_ids;
+        };
+
+        static LiveSinks& GetLiveSinks()
+        {
+            static LiveSinks s_liveSinks;
+            return s_liveSinks;
+        }
+
+        static AZStd::atomic<u64> s_nextSinkId{ 1 };
+
+        struct ThreadState
+        {
+            ~ThreadState()
+            {
+                if (m_buffer)
+                {
+                    LiveSinks& liveSinks = GetLiveSinks();
+                    AZStd::scoped_lock lock(liveSinks.m_mutex);
+                    if (AZStd::find(liveSinks.m_ids.begin(), liveSinks.m_ids.end(), m_sinkId) != liveSinks.m_ids.end())
+                    {
+                        m_buffer->m_inUse.store(false, AZStd::memory_order_release);
+                    }
+                }
+            }
+
+            //! The sink the buffer belongs to. The buffer is null if the sink had no buffers left for this thread.
+            u64 m_sinkId{ 0 };
+            ThreadBuffer* m_buffer{ nullptr };
+            //! Set while this thread writes records, so messages logged by the handlers are handled synchronously instead of
+            //! being queued again.
+            bool m_isWriting{ false };
+        };
+
+        static thread_local ThreadState t_threadState;
+
+        enum class ArgumentType : u8
+        {
+            None,
+            Int,
+            Long,
+            LongLong,
+            IntMax,
+            Size,
+            PtrDiff,
+            Double,
+            Pointer,
+            String,
+            Unsupported
+        };
+
+        //! A single conversion specification in a printf style format string.
+        struct Conversion
+        {
+            //! One past the conversion specifier.
+            const char* m_end{ nullptr };
+            ArgumentType m_type{ ArgumentType::Unsupported };
+            //! The number of int arguments that precede the value for the width and precision.
+            u8 m_starCount{ 0 };
+            bool m_hasStarPrecision{ false };
+            //! The precision if it's part of the format string, otherwise -1.
+            int m_precision{ -1 };
+        };
+
+        //! Conversion specifications longer than this are formatted on the logging thread.
+        static constexpr size_t MaxConversionLength = 32;
+
+        static bool IsDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        //! Parses the conversion specification that starts at the '%' in text.
+        static Conversion ParseConversion(const char* text)
+        {
+            enum class Length { Default, Char, Short, Long, LongLong, IntMax, Size, PtrDiff, LongDouble };
+
+            Conversion conversion;
+            const char* c = text + 1;
+            while (*c == '-' || *c == '+' || *c == ' ' || *c == '#' || *c == '0' || *c == '\'')
+            {
+                ++c;
+            }
+
+            if (*c == '*')
+            {
+                ++conversion.m_starCount;
+                ++c;
+            }
+            else
+            {
+                while (IsDigit(*c))
+                {
+                    ++c;
+                }
+            }
+
+            if (*c == '.')
+            {
+                ++c;
+                if (*c == '*')
+                {
+                    ++conversion.m_starCount;
+                    conversion.m_hasStarPrecision = true;
+                    ++c;
+                }
+                else
+                {
+                    conversion.m_precision = 0;
+                    while (IsDigit(*c))
+                    {
+                        conversion.m_precision = conversion.m_precision * 10 + (*c - '0');
+                        ++c;
+                    }
+                }
+            }
+
+            Length length = Length::Default;
+            switch (*c)
+            {
+            case 'h':
+                ++c;
+                length = *c == 'h' ? Length::Char : Length::Short;
+                c += length == Length::Char ? 1 : 0;
+                break;
+            case 'l':
+                ++c;
+                length = *c == 'l' ? Length::LongLong : Length::Long;
+                c += length == Length::LongLong ? 1 : 0;
+                break;
+            case 'j':
+                ++c;
+                length = Length::IntMax;
+                break;
+            case 'z':
+                ++c;
+                length = Length::Size;
+                break;
+            case 't':
+                ++c;
+                length = Length::PtrDiff;
+                break;
+            case 'L':
+                ++c;
+                length = Length::LongDouble;
+                break;
+            default:
+                break;
+            }
+
+            switch (*c)
+            {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                switch (length)
+                {
+                case Length::Default:
+                case Length::Char:
+                case Length::Short:
+                    conversion.m_type = ArgumentType::Int;
+                    break;
+                case Length::Long:
+                    conversion.m_type = ArgumentType::Long;
+                    break;
+                case Length::LongLong:
+                    conversion.m_type = ArgumentType::LongLong;
+                    break;
+                case Length::IntMax:
+                    conversion.m_type = ArgumentType::IntMax;
+                    break;
+                case Length::Size:
+                    conversion.m_type = ArgumentType::Size;
+                    break;
+                case Length::PtrDiff:
+                    conversion.m_type = ArgumentType::PtrDiff;
+                    break;
+                default:
+                    break;
+                }
+                break;
+            case 'c':
+                conversion.m_type = length == Length::Default ? ArgumentType::Int : ArgumentType::Unsupported;
+                break;
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                conversion.m_type = length == Length::LongDouble ? ArgumentType::Unsupported : ArgumentType::Double;
+                break;
+            case 's':
+                conversion.m_type = length == Length::Default ? ArgumentType::String : ArgumentType::Unsupported;
+                break;
+            case 'p':
+                conversion.m_type = ArgumentType::Pointer;
+                break;
+            case '%':
+                conversion.m_type = ArgumentType::None;
+                break;
+            default:
+                // Includes %n, which writes through its argument and can't be deferred.
+                break;
+            }
+
+            conversion.m_end = *c ? c + 1 : c;
+            if (static_cast<size_t>(conversion.m_end - text) >= MaxConversionLength)
+            {
+                conversion.m_type = ArgumentType::Unsupported;
+            }
+            return conversion;
+        }
+
+        //! Appends the binary values of the arguments to a payload.
+        class ArgumentWriter
+        {
+        public:
+            ArgumentWriter(char* payload, size_t capacity)
+                : m_payload(payload)
+                , m_capacity(capacity)
+            {
+            }
+
+            template<typename T>
+            bool Write(const T& value)
+            {
+                return Write(&value, sizeof(T));
+            }
+
+            bool Write(const void* data, size_t size)
+            {
+                if (m_size + size > m_capacity)
+                {
+                    return false;
+                }
+                memcpy(m_payload + m_size, data, size);
+                m_size += size;
+                return true;
+            }
+
+            size_t GetSize() const
+            {
+                return m_size;
+            }
+
+        private:
+            char* m_payload;
+            size_t m_capacity;
+            size_t m_size{ 0 };
+        };
+
+        //! Reads the binary values of the arguments in the order they were written.
+        class ArgumentReader
+        {
+        public:
+            explicit ArgumentReader(const char* payload)
+                : m_position(payload)
+            {
+            }
+
+            template<typename T>
+            T Read()
+            {
+                T value;
+                memcpy(&value, m_position, sizeof(T));
+                m_position += sizeof(T);
+                return value;
+            }
+
+            const char* ReadString()
+            {
+                const u32 length = Read<u32>();
+                const char* string = m_position;
+                m_position += length + 1;
+                return string;
+            }
+
+        private:
+            const char* m_position;
+        };
+
+        //! Stores the arguments for all conversions in the format string. Returns false if an argument can't be stored in binary
+        //! form or the payload is too small, in which case the message needs to be formatted right away.
+        static bool CaptureArguments(const char* format, va_list args, ArgumentWriter& writer)
+        {
+            for (const char* c = format; *c;)
+            {
+                if (*c != '%')
+                {
+                    ++c;
+                    continue;
+                }
+
+                const Conversion conversion = ParseConversion(c);
+                int starValue = 0;
+                for (u8 star = 0; star < conversion.m_starCount; ++star)
+                {
+                    starValue = va_arg(args, int);
+                    if (!writer.Write(starValue))
+                    {
+                        return false;
+                    }
+                }
+
+                bool result = true;
+                switch (conversion.m_type)
+                {
+                case ArgumentType::None:
+                    break;
+                case ArgumentType::Int:
+                    result = writer.Write(va_arg(args, int));
+                    break;
+                case ArgumentType::Long:
+                    result = writer.Write(va_arg(args, long));
+                    break;
+                case ArgumentType::LongLong:
+                    result = writer.Write(va_arg(args, long long));
+                    break;
+                case ArgumentType::IntMax:
+                    result = writer.Write(va_arg(args, intmax_t));
+                    break;
+                case ArgumentType::Size:
+                    result = writer.Write(va_arg(args, size_t));
+                    break;
+                case ArgumentType::PtrDiff:
+                    result = writer.Write(va_arg(args, ptrdiff_t));
+                    break;
+                case ArgumentType::Double:
+                    result = writer.Write(va_arg(args, double));
+                    break;
+                case ArgumentType::Pointer:
+                    result = writer.Write(va_arg(args, void*));
+                    break;
+                case ArgumentType::String:
+                {
+                    const char* string = va_arg(args, const char*);
+                    if (!string)
+                    {
+                        string = "(null)";
+                    }
+                    // Strings with a precision don't need to be null terminated.
+                    const int precision = conversion.m_hasStarPrecision ? starValue : conversion.m_precision;
+                    const size_t length = precision >= 0 ? strnlen(string, static_cast<size_t>(precision)) : strlen(string);
+                    const char terminator = 0;
+                    result = writer.Write(aznumeric_cast<u32>(length)) && writer.Write(string, length) && writer.Write(terminator);
+                    break;
+                }
+                default:
+                    return false;
+                }
+
+                if (!result)
+                {
+                    return false;
+                }
+                c = conversion.m_end;
+            }
+            return true;
+        }
+
+        //! Returns the number of characters written to the buffer, excluding the terminator.
+        static size_t ClampFormatResult(int result, size_t capacity)
+        {
+            // Depending on the platform, truncation either reports the untruncated length or a negative value.
+            return (result < 0 || static_cast<size_t>(result) >= capacity) ? capacity - 1 : static_cast<size_t>(result);
+        }
+
+        template<typename T>
+        static int FormatValue(char* buffer, size_t capacity, const char* conversion, const int* stars, u8 starCount, T value)
+        {
+            switch (starCount)
+            {
+            case 0:
+                return azsnprintf(buffer, capacity, conversion, value);
+            case 1:
+                return azsnprintf(buffer, capacity, conversion, stars[0], value);
+            default:
+                return azsnprintf(buffer, capacity, conversion, stars[0], stars[1], value);
+            }
+        }
+
+        //! Formats a record with binary arguments. Returns the length of the message, excluding the terminator.
+        static size_t FormatRecord(const RecordHeader& record, char* buffer, size_t capacity)
+        {
+            ArgumentReader reader(record.GetPayload());
+            size_t length = 0;
+            const char* c = record.m_format;
+            while (*c && length + 1 < capacity)
+            {
+                const char* percent = strchr(c, '%');
+                const size_t literalLength = percent ? static_cast<size_t>(percent - c) : strlen(c);
+                const size_t copyLength = AZStd::min(literalLength, capacity - 1 - length);
+                memcpy(buffer + length, c, copyLength);
+                length += copyLength;
+                if (!percent)
+                {
+                    break;
+                }
+
+                const Conversion conversion = ParseConversion(percent);
+                char conversionText[MaxConversionLength];
+                const size_t conversionLength = static_cast<size_t>(conversion.m_end - percent);
+                memcpy(conversionText, percent, conversionLength);
+                conversionText[conversionLength] = 0;
+
+                int stars[2] = { 0, 0 };
+                for (u8 star = 0; star < conversion.m_starCount; ++star)
+                {
+                    stars[star] = reader.Read<int>();
+                }
+
+                char* target = buffer + length;
+                const size_t remaining = capacity - length;
+                const u8 starCount = conversion.m_starCount;
+                int result = 0;
+                switch (conversion.m_type)
+                {
+                case ArgumentType::None:
+                    result = azsnprintf(target, remaining, "%s", "%");
+                    break;
+                case ArgumentType::Int:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<int>());
+                    break;
+                case ArgumentType::Long:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<long>());
+                    break;
+                case ArgumentType::LongLong:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<long long>());
+                    break;
+                case ArgumentType::IntMax:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<intmax_t>());
+                    break;
+                case ArgumentType::Size:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<size_t>());
+                    break;
+                case ArgumentType::PtrDiff:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<ptrdiff_t>());
+                    break;
+                case ArgumentType::Double:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<double>());
+                    break;
+                case ArgumentType::Pointer:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.Read<void*>());
+                    break;
+                case ArgumentType::String:
+                    result = FormatValue(target, remaining, conversionText, stars, starCount, reader.ReadString());
+                    break;
+                default:
+                    // Records with unsupported conversions are formatted on the logging thread.
+                    break;
+                }
+                length += ClampFormatResult(result, remaining);
+                c = conversion.m_end;
+            }
+            buffer[length] = 0;
+            return length;
+        }
+
+        static constexpr size_t GetRecordSize(size_t payloadSize)
+        {
+            return AZ_SIZE_ALIGN_UP(sizeof(RecordHeader) + payloadSize, RecordAlignment);
+        }
+    } // namespace AsyncLogSinkInternal
+
+    using namespace AsyncLogSinkInternal;
+
+    AsyncLogSink::AsyncLogSink(LogHandler logHandler, TraceHandler traceHandler, size_t bufferSize)
+        : m_logHandler(AZStd::move(logHandler))
+        , m_traceHandler(AZStd::move(traceHandler))
+        , m_id(s_nextSinkId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+        m_bufferSize = MinBufferSize;
+        while (m_bufferSize < bufferSize)
+        {
+            m_bufferSize <<= 1;
+        }
+
+        {
+            LiveSinks& liveSinks = GetLiveSinks();
+            AZStd::scoped_lock lock(liveSinks.m_mutex);
+            if (liveSinks.m_ids.size() < liveSinks.m_ids.capacity())
+            {
+                liveSinks.m_ids.push_back(m_id);
+            }
+        }
+
+        m_threadDesc.m_name = "AsyncLogSink";
+        m_thread = AZStd::thread([this]()
+            {
+                WriterThread();
+            }, &m_threadDesc);
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        m_running.store(false, AZStd::memory_order_release);
+        m_wakeWriter.release();
+        m_thread.join();
+
+        {
+            LiveSinks& liveSinks = GetLiveSinks();
+            AZStd::scoped_lock lock(liveSinks.m_mutex);
+            auto it = AZStd::find(liveSinks.m_ids.begin(), liveSinks.m_ids.end(), m_id);
+            if (it != liveSinks.m_ids.end())
+            {
+                liveSinks.m_ids.erase(it);
+            }
+        }
+
+        for (ThreadBuffer* buffer : m_buffers)
+        {
+            buffer->~ThreadBuffer();
+            AZ_OS_FREE(buffer);
+        }
+    }
+
+    bool AsyncLogSink::QueueLogV(LogLevel level, const char* format, const char* file, const char* function, int32_t line, va_list args)
+    {
+        if (t_threadState.m_isWriting)
+        {
+            return false;
+        }
+        ThreadBuffer* buffer = GetThreadBuffer();
+        if (!buffer)
+        {
+            return false;
+        }
+
+        char payload[MaxMessageLength];
+        RecordType type = RecordType::Log;
+        ArgumentWriter writer(payload, sizeof(payload));
+        va_list captureArgs;
+        va_copy(captureArgs, args);
+        const bool captured = CaptureArguments(format, captureArgs, writer);
+        va_end(captureArgs);
+
+        size_t payloadSize = writer.GetSize();
+        if (!captured)
+        {
+            type = RecordType::LogText;
+            payloadSize = ClampFormatResult(azvsnprintf(payload, sizeof(payload), format, args), sizeof(payload)) + 1;
+            payload[payloadSize - 1] = 0;
+        }
+
+        u64 writePosition = 0;
+        RecordHeader* record = BeginRecord(*buffer, payloadSize, writePosition);
+        if (!record)
+        {
+            if (level >= LogLevel::Error)
+            {
+                return false;
+            }
+            m_droppedRecords.fetch_add(1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        record->m_type = type;
+        record->m_level = level;
+        record->m_line = line;
+        record->m_format = format;
+        record->m_file = file;
+        record->m_function = function;
+        memcpy(record->GetPayload(), payload, payloadSize);
+        EndRecord(*buffer, writePosition);
+        return true;
+    }
+
+    bool AsyncLogSink::QueueTrace(TraceType traceType, const char* window, const char* message)
+    {
+        if (t_threadState.m_isWriting)
+        {
+            return false;
+        }
+        ThreadBuffer* buffer = GetThreadBuffer();
+        if (!buffer)
+        {
+            return false;
+        }
+
+        const size_t windowLength = strlen(window);
+        const size_t messageLength = AZStd::min(strlen(message), MaxMessageLength - 1);
+        u64 writePosition = 0;
+        RecordHeader* record = BeginRecord(*buffer, messageLength + windowLength + 2, writePosition);
+        if (!record)
+        {
+            m_droppedRecords.fetch_add(1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        record->m_type = RecordType::Trace;
+        record->m_traceType = traceType;
+        char* payload = record->GetPayload();
+        memcpy(payload, message, messageLength);
+        payload[messageLength] = 0;
+        memcpy(payload + messageLength + 1, window, windowLength + 1);
+        EndRecord(*buffer, writePosition);
+        return true;
+    }
+
+    void AsyncLogSink::Flush()
+    {
+        // Handlers that flush while records are written don't need to wait for themselves.
+        if (!t_threadState.m_isWriting)
+        {
+            WriteQueuedRecords();
+        }
+    }
+
+    AsyncLogSink::Statistics AsyncLogSink::GetStatistics() const
+    {
+        Statistics statistics;
+        statistics.m_queuedRecords = m_queuedRecords.load(AZStd::memory_order_relaxed);
+        statistics.m_writtenRecords = m_writtenRecords.load(AZStd::memory_order_relaxed);
+        statistics.m_droppedRecords = m_droppedRecords.load(AZStd::memory_order_relaxed);
+        return statistics;
+    }
+
+    ThreadBuffer* AsyncLogSink::GetThreadBuffer()
+    {
+        ThreadState& state = t_threadState;
+        if (state.m_sinkId == m_id)
+        {
+            return state.m_buffer;
+        }
+
+        AZStd::scoped_lock lock(m_buffersMutex);
+        ThreadBuffer* buffer = nullptr;
+        for (ThreadBuffer* existingBuffer : m_buffers)
+        {
+            if (!existingBuffer->m_inUse.load(AZStd::memory_order_acquire))
+            {
+                // Records left by the previous thread are still written, as the positions carry on.
+                buffer = existingBuffer;
+                break;
+            }
+        }
+
+        if (!buffer && m_buffers.size() < m_buffers.capacity())
+        {
+            if (void* memory = AZ_OS_MALLOC(sizeof(ThreadBuffer) + m_bufferSize, alignof(ThreadBuffer)); memory)
+            {
+                buffer = new(memory) ThreadBuffer;
+                buffer->m_data = reinterpret_cast<char*>(buffer + 1);
+                buffer->m_mask = m_bufferSize - 1;
+                m_buffers.push_back(buffer);
+            }
+        }
+
+        if (buffer)
+        {
+            buffer->m_inUse.store(true, AZStd::memory_order_relaxed);
+        }
+        // Without a buffer the messages of this thread are handled synchronously.
+        state.m_sinkId = m_id;
+        state.m_buffer = buffer;
+        return buffer;
+    }
+
+    RecordHeader* AsyncLogSink::BeginRecord(ThreadBuffer& buffer, size_t payloadSize, u64& writePosition)
+    {
+        const u64 capacity = buffer.m_mask + 1;
+        const u64 recordSize = GetRecordSize(payloadSize);
+        const u64 position = buffer.m_writePosition.load(AZStd::memory_order_relaxed);
+        const u64 offset = position & buffer.m_mask;
+        // Records are stored contiguously, so skip to the start of the buffer if the record doesn't fit at the end.
+        const u64 padding = offset + recordSize > capacity ? capacity - offset : 0;
+        if (position + padding + recordSize - buffer.m_readPosition.load(AZStd::memory_order_acquire) > capacity)
+        {
+            return nullptr;
+        }
+
+        if (padding > 0)
+        {
+            RecordHeader* paddingRecord = reinterpret_cast<RecordHeader*>(buffer.m_data + offset);
+            paddingRecord->m_size = aznumeric_cast<u32>(padding);
+            paddingRecord->m_type = RecordType::Padding;
+        }
+
+        RecordHeader* record = reinterpret_cast<RecordHeader*>(buffer.m_data + ((position + padding) & buffer.m_mask));
+        record->m_size = aznumeric_cast<u32>(recordSize);
+        record->m_timestamp = AZStd::GetTimeNowTicks();
+        writePosition = position + padding + recordSize;
+        return record;
+    }
+
+    void AsyncLogSink::EndRecord(ThreadBuffer& buffer, u64 writePosition)
+    {
+        buffer.m_writePosition.store(writePosition, AZStd::memory_order_release);
+        m_queuedRecords.fetch_add(1, AZStd::memory_order_relaxed);
+
+        // Wake the writer early if the buffer is filling up, to keep records from being dropped.
+        if (writePosition - buffer.m_readPosition.load(AZStd::memory_order_relaxed) > (buffer.m_mask + 1) / 2)
+        {
+            m_wakeWriter.release();
+        }
+    }
+
+    void AsyncLogSink::WriterThread()
+    {
+        while (m_running.load(AZStd::memory_order_acquire))
+        {
+            m_wakeWriter.try_acquire_for(WriteInterval);
+            WriteQueuedRecords();
+        }
+        WriteQueuedRecords();
+    }
+
+    void AsyncLogSink::WriteQueuedRecords()
+    {
+        AZStd::scoped_lock writeLock(m_writeMutex);
+        ThreadState& state = t_threadState;
+        state.m_isWriting = true;
+
+        AZStd::fixed_vector<ThreadBuffer*, MaxThreadCount> buffers;
+        {
+            AZStd::scoped_lock lock(m_buffersMutex);
+            buffers = m_buffers;
+        }
+
+        m_pendingRecords.clear();
+        m_readEnds.resize(buffers.size());
+        for (size_t index = 0; index < buffers.size(); ++index)
+        {
+            const ThreadBuffer& buffer = *buffers[index];
+            const u64 end = buffer.m_writePosition.load(AZStd::memory_order_acquire);
+            for (u64 position = buffer.m_readPosition.load(AZStd::memory_order_relaxed); position < end;)
+            {
+                const RecordHeader* record = reinterpret_cast<const RecordHeader*>(buffer.m_data + (position & buffer.m_mask));
+                if (record->m_type != RecordType::Padding)
+                {
+                    m_pendingRecords.push_back(record);
+                }
+                position += record->m_size;
+            }
+            m_readEnds[index] = end;
+        }
+
+        // Records of a single thread are already in order, so a stable sort keeps records with the same timestamp in order.
+        AZStd::stable_sort(m_pendingRecords.begin(), m_pendingRecords.end(),
+            [](const RecordHeader* lhs, const RecordHeader* rhs)
+            {
+                return lhs->m_timestamp < rhs->m_timestamp;
+            });
+
+        for (const RecordHeader* record : m_pendingRecords)
+        {
+            WriteRecord(*record);
+        }
+        m_writtenRecords.fetch_add(m_pendingRecords.size(), AZStd::memory_order_relaxed);
+
+        for (size_t index = 0; index < buffers.size(); ++index)
+        {
+            buffers[index]->m_readPosition.store(m_readEnds[index], AZStd::memory_order_release);
+        }
+
+        const u64 droppedRecords = m_droppedRecords.load(AZStd::memory_order_relaxed);
+        if (droppedRecords != m_reportedDroppedRecords)
+        {
+            char message[128];
+            azsnprintf(message, AZ_ARRAY_SIZE(message), "%llu log message(s) were dropped because the log buffers were full.",
+                static_cast<unsigned long long>(droppedRecords - m_reportedDroppedRecords));
+            m_reportedDroppedRecords = droppedRecords;
+            if (m_logHandler)
+            {
+                m_logHandler(LogLevel::Warn, message, __FILE__, __FUNCTION__, __LINE__);
+            }
+        }
+
+        state.m_isWriting = false;
+    }
+
+    void AsyncLogSink::WriteRecord(const RecordHeader& record)
+    {
+        switch (record.m_type)
+        {
+        case RecordType::Log:
+            if (m_logHandler)
+            {
+                char message[MaxMessageLength];
+                FormatRecord(record, message, AZ_ARRAY_SIZE(message));
+                m_logHandler(record.m_level, message, record.m_file, record.m_function, record.m_line);
+            }
+            break;
+        case RecordType::LogText:
+            if (m_logHandler)
+            {
+                m_logHandler(record.m_level, record.GetPayload(), record.m_file, record.m_function, record.m_line);
+            }
+            break;
+        case RecordType::Trace:
+            if (m_traceHandler)
+            {
+                const char* message = record.GetPayload();
+                const char* window = message + strlen(message) + 1;
+                m_traceHandler(record.m_traceType, window, message);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    AsyncLogSink* AsyncLogSinkSlot::Exchange(AsyncLogSink* sink)
+    {
+        AsyncLogSink* previousSink = m_sink.exchange(sink);
+        // Threads that start using the slot from here on see the new sink, so only the threads that are already using it
+        // can still hold the previous one. Users only hold the slot while passing on a single message, so the wait starts
+        // by yielding and only backs off to sleeping with a growing interval if a user is descheduled while holding it.
+        constexpr u32 YieldsBeforeSleeping = 64;
+        constexpr AZStd::chrono::microseconds MaxSleepTime(1000);
+        AZStd::chrono::microseconds sleepTime(10);
+        for (u32 attempt = 0; m_users.load() != 0; ++attempt)
+        {
+            if (attempt < YieldsBeforeSleeping)
+            {
+                AZStd::this_thread::yield();
+            }
+            else
+            {
+                AZStd::this_thread::sleep_for(sleepTime);
+                sleepTime = AZStd::min(sleepTime * 2, MaxSleepTime);
+            }
+        }
+        return previousSink;
+    }
+} // namespace AZ
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <stdarg.h>
+
+namespace AZ
+{
+    namespace AsyncLogSinkInternal
+    {
+        struct ThreadBuffer;
+        struct RecordHeader;
+    }
+
+    //! Moves the formatting and dispatch of log messages off the threads that log. Every thread writes binary records into its
+    //! own ring buffer without taking locks, and a writer thread periodically drains the buffers, formats the records and passes
+    //! them to the handlers in the order they were logged.
+    //! ILogger messages are stored as the format string and the binary values of the arguments, so formatting happens on the
+    //! writer thread. Trace messages are already formatted by AZ::Debug::Trace and are copied.
+    //! When the buffer of a thread is full new records are dropped and counted, and the number of dropped records is reported
+    //! once the writer catches up. Errors and fatal messages are never dropped, they're handled synchronously instead.
+    class AsyncLogSink
+    {
+    public:
+        AZ_RTTI(AsyncLogSink, "{1D3E7A0B-5C8F-4B1E-9E26-7F4A2C6D9B13}");
+        AZ_CLASS_ALLOCATOR(AsyncLogSink, SystemAllocator, 0);
+
+        enum class TraceType : u8
+        {
+            Printf,
+            Output
+        };
+
+        //! Called on the writer thread for every queued ILogger message.
+        using LogHandler = AZStd::function<void(LogLevel level, const char* message, const char* file, const char* function, int32_t line)>;
+        //! Called on the writer thread for every queued trace message.
+        using TraceHandler = AZStd::function<void(TraceType type, const char* window, const char* message)>;
+
+        struct Statistics
+        {
+            u64 m_queuedRecords{ 0 };
+            u64 m_writtenRecords{ 0 };
+            u64 m_droppedRecords{ 0 };
+        };
+
+        static constexpr size_t DefaultBufferSize = 64 * 1024;
+        static constexpr size_t MinBufferSize = 16 * 1024;
+        static constexpr size_t MaxThreadCount = 256;
+        //! Messages longer than this are truncated.
+        static constexpr size_t MaxMessageLength = 4096;
+        //! The time the writer thread waits between draining the buffers, unless a buffer is filling up.
+        static constexpr AZStd::chrono::milliseconds WriteInterval{ 10 };
+
+        //! @param bufferSize The size in bytes of the ring buffer of every thread. Rounded up to a power of two.
+        AsyncLogSink(LogHandler logHandler, TraceHandler traceHandler, size_t bufferSize = DefaultBufferSize);
+        virtual ~AsyncLogSink();
+
+        //! Queues an ILogger message. The format, file and function strings are only read when the record is written, so they
+        //! need to stay valid until then, see ILogger::Flush. String arguments are copied.
+        //! @return False if the message wasn't queued, in which case the caller needs to handle it synchronously.
+        bool QueueLogV(LogLevel level, const char* format, const char* file, const char* function, int32_t line, va_list args);
+
+        //! Queues an already formatted trace message. The window and message are copied.
+        //! @return False if the message wasn't queued, in which case the caller needs to handle it synchronously.
+        bool QueueTrace(TraceType type, const char* window, const char* message);
+
+        //! Writes all records that were queued before this call on the calling thread. Waits for the writer thread if it's writing.
+        void Flush();
+
+        Statistics GetStatistics() const;
+
+    private:
+        AsyncLogSinkInternal::ThreadBuffer* GetThreadBuffer();
+        //! Reserves space for a record in the buffer of the calling thread. Returns null if the buffer is full.
+        AsyncLogSinkInternal::RecordHeader* BeginRecord(AsyncLogSinkInternal::ThreadBuffer& buffer, size_t payloadSize, u64& writePosition);
+        //! Publishes the record to the writer thread.
+        void EndRecord(AsyncLogSinkInternal::ThreadBuffer& buffer, u64 writePosition);
+
+        void WriterThread();
+        //! Formats and passes on the records that are currently queued. Only one thread writes at a time.
+        void WriteQueuedRecords();
+        void WriteRecord(const AsyncLogSinkInternal::RecordHeader& record);
+
+        LogHandler m_logHandler;
+        TraceHandler m_traceHandler;
+        size_t m_bufferSize{ 0 };
+        //! Identifies this sink to the threads that logged to it, in case a new sink is created at the same address.
+        u64 m_id{ 0 };
+
+        AZStd::mutex m_buffersMutex;
+        AZStd::fixed_vector<AsyncLogSinkInternal::ThreadBuffer*, MaxThreadCount> m_buffers;
+
+        // The following are only used while holding the write mutex.
+        AZStd::mutex m_writeMutex;
+        AZStd::vector<const AsyncLogSinkInternal::RecordHeader*> m_pendingRecords;
+        AZStd::vector<u64> m_readEnds;
+        u64 m_reportedDroppedRecords{ 0 };
+
+        AZStd::atomic<u64> m_queuedRecords{ 0 };
+        AZStd::atomic<u64> m_writtenRecords{ 0 };
+        AZStd::atomic<u64> m_droppedRecords{ 0 };
+
+        AZStd::binary_semaphore m_wakeWriter;
+        AZStd::atomic_bool m_running{ true };
+        AZStd::thread_desc m_threadDesc;
+        AZStd::thread m_thread;
+    };
+
+    //! Publishes a sink to the threads that log and counts the threads that are using it, so the owner of the sink can wait
+    //! until no thread is queueing records in it anymore before destroying it.
+    class AsyncLogSinkSlot
+    {
+    public:
+        AsyncLogSinkSlot() = default;
+        AZ_DISABLE_COPY_MOVE(AsyncLogSinkSlot);
+
+        //! Calls the function with the published sink, or null if there's none. The sink isn't destroyed until the function returns.
+        //! @return The result of the function.
+        template<typename Function>
+        bool Use(Function&& function)
+        {
+            m_users.fetch_add(1);
+            const bool result = function(m_sink.load());
+            m_users.fetch_sub(1);
+            return result;
+        }
+
+        //! Publishes a new sink and waits until no thread is using the previous one. Can't be called from within Use.
+        //! @return The previous sink, which the caller can safely destroy once it's no longer published anywhere else.
+        AsyncLogSink* Exchange(AsyncLogSink* sink);
+
+    private:
+        AZStd::atomic<AsyncLogSink*> m_sink{ nullptr };
+        AZStd::atomic<u32> m_users{ 0 };
+    };
+} // namespace AZ
@@ -6,10 +6,16 @@
  */
 
 #include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Console/AsyncLogSink.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AZ
 {
+    AZ_CVAR(bool, bg_asyncLogging, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Formats and writes log and trace messages on a background thread, applied when the logger is activated");
+
+    constexpr AZStd::size_t MaxLogBufferSize = 1000;
+
     const char* GetEnumString(LogLevel logLevel)
     {
         switch (logLevel)
@@ -67,12 +73,44 @@ namespace AZ
 
     void LoggerSystemComponent::Activate()
     {
-        ;
+        if (!bg_asyncLogging || m_asyncLogSink)
+        {
+            return;
+        }
+
+        auto logHandler = [this](LogLevel level, const char* message, const char* file, const char* function, int32_t line)
+        {
+            char buffer[MaxLogBufferSize];
+            const AZStd::size_t length = azsnprintf(buffer, MaxLogBufferSize, "%s", message);
+            WriteLog(level, buffer, length, file, function, line);
+        };
+        auto traceHandler = [](AsyncLogSink::TraceType type, const char* window, const char* message)
+        {
+            if (type == AsyncLogSink::TraceType::Printf)
+            {
+                AZ::Debug::Trace::PrintfFormatted(window, message);
+            }
+            else
+            {
+                AZ::Debug::Trace::Output(window, message);
+            }
+        };
+        m_asyncLogSink = aznew AsyncLogSink(AZStd::move(logHandler), AZStd::move(traceHandler));
+        m_asyncLogSinkSlot.Exchange(m_asyncLogSink);
+        AZ::Debug::Trace::SetAsyncLogSink(m_asyncLogSink);
     }
 
     void LoggerSystemComponent::Deactivate()
     {
-        ;
+        if (m_asyncLogSink)
+        {
+            // Both unpublish the sink and wait for the threads that are still queueing messages in it, so it can be destroyed.
+            AZ::Debug::Trace::SetAsyncLogSink(nullptr);
+            m_asyncLogSinkSlot.Exchange(nullptr);
+            m_asyncLogSink->Flush();
+            delete m_asyncLogSink;
+            m_asyncLogSink = nullptr;
+        }
     }
 
     void LoggerSystemComponent::SetLogName(const char* logName)
@@ -112,15 +150,37 @@ namespace AZ
 
     void LoggerSystemComponent::Flush()
     {
-        ;
+        m_asyncLogSinkSlot.Use([](AsyncLogSink* asyncLogSink)
+            {
+                if (asyncLogSink)
+                {
+                    asyncLogSink->Flush();
+                }
+                return true;
+            });
     }
 
     void LoggerSystemComponent::LogInternalV(LogLevel level, const char* format, const char* file, const char* function, int32_t line, va_list args)
     {
-        constexpr AZStd::size_t MaxLogBufferSize = 1000;
-        char buffer[MaxLogBufferSize];
+        va_list queueArgs;
+        va_copy(queueArgs, args);
+        const bool queued = m_asyncLogSinkSlot.Use([&](AsyncLogSink* asyncLogSink)
+            {
+                return asyncLogSink && asyncLogSink->QueueLogV(level, format, file, function, line, queueArgs);
+            });
+        va_end(queueArgs);
+        if (queued)
+        {
+            return;
+        }
 
+        char buffer[MaxLogBufferSize];
         const AZStd::size_t length = azvsnprintf(buffer, MaxLogBufferSize, format, args);
+        WriteLog(level, buffer, length, file, function, line);
+    }
+
+    void LoggerSystemComponent::WriteLog(LogLevel level, char* buffer, AZStd::size_t length, const char* file, const char* function, int32_t line)
+    {
         buffer[AZStd::min<AZStd::size_t>(length + 1, MaxLogBufferSize - 1)] = '\0';
         m_logEvent.Signal(level, buffer, file, function, line);
 
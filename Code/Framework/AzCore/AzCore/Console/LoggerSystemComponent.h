@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AzCore/Console/AsyncLogSink.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Component/Component.h>
@@ -59,6 +60,9 @@ namespace AZ
 
     private:
 
+        //! Signals the log event and passes the message on to AZ::Debug::Trace.
+        void WriteLog(LogLevel level, char* buffer, AZStd::size_t length, const char* file, const char* function, int32_t line);
+
         void EnableLogHelper(AZ::HashValue32 a_HashValue);
         void DisableLogHelper(AZ::HashValue32 a_HashValue);
         bool IsTagEnabledHelper(AZ::HashValue32 a_HashValue);
@@ -78,5 +82,9 @@ namespace AZ
         AZStd::bitset<BitsetSize> m_quickHash;
         AZStd::mutex m_enabledTagsMutex;
         AZStd::vector<AZ::HashValue32> m_enabledTags;
+        //! Formats and writes messages on a background thread while bg_asyncLogging is enabled.
+        //! Owned by the component and only changed by Activate and Deactivate, logging threads access it through the slot.
+        AsyncLogSink* m_asyncLogSink = nullptr;
+        AsyncLogSinkSlot m_asyncLogSinkSlot;
     };
 }
@@ -38,7 +38,8 @@ namespace AZ
 }
 
 #ifdef AZ_PROFILE_TELEMETRY
-#   define AZ_TRACE_METHOD_NAME_CATEGORY(name, category) AZ::Debug::EventTrace::ScopedSlice AZ_JOIN(ScopedSlice__, __LINE__)(name, category);
+#   define AZ_TRACE_METHOD_NAME_CATEGORY(name, category) AZ::Debug::EventTrace::ScopedSlice AZ_JOIN(ScopedSlice__, __LINE__)(name, category); \
+        AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, category);
 #   define AZ_TRACE_METHOD_NAME(name) \
         AZ_TRACE_METHOD_NAME_CATEGORY(name, "") \
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzTrace, name)
@@ -47,7 +48,7 @@ namespace AZ
         AZ_TRACE_METHOD_NAME_CATEGORY(AZ_FUNCTION_SIGNATURE, "") \
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzTrace)
 #else
-#   define AZ_TRACE_METHOD_NAME_CATEGORY(name, category)
+#   define AZ_TRACE_METHOD_NAME_CATEGORY(name, category) AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, category);
 #   define AZ_TRACE_METHOD_NAME(name) AZ_TRACE_METHOD_NAME_CATEGORY(name, "")
 #   define AZ_TRACE_METHOD() AZ_TRACE_METHOD_NAME(AZ_FUNCTION_SIGNATURE)
 #endif
@@ -0,0 +1,953 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/EventTraceRecorder.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/Platform.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace AZ::Debug
+{
+    static void OnTraceRecorderEnabledChanged(const bool& enabled)
+    {
+        EventTraceRecorder::SetEnabled(enabled);
+    }
+
+    static void OnTraceRecorderEventsPerThreadChanged(const uint32_t& eventCount)
+    {
+        EventTraceRecorder::SetEventsPerThread(eventCount);
+    }
+
+    AZ_CVAR(bool, bg_traceRecorderEnabled, false, OnTraceRecorderEnabledChanged, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Records trace scopes, counters and flows into a ring buffer per thread so they can be written with bg_traceRecorderDump.");
+    AZ_CVAR(uint32_t, bg_traceRecorderEventsPerThread, aznumeric_cast<uint32_t>(EventTraceRecorder::DefaultEventsPerThread),
+        OnTraceRecorderEventsPerThreadChanged, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of trace events each thread keeps before the oldest are overwritten. Applies to threads that start recording afterwards.");
+
+    static void bg_traceRecorderDump(const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZ::IO::FixedMaxPath filePath{ arguments.empty() ? AZStd::string_view("@user@/Traces/EventTrace.perfetto-trace") : arguments[0] };
+        bool result = false;
+        if (arguments.size() > 1)
+        {
+            if (arguments[1] == "json")
+            {
+                result = EventTraceRecorder::WriteToFile(filePath.c_str(), EventTraceRecorder::Format::ChromeJson);
+            }
+            else if (arguments[1] == "perfetto")
+            {
+                result = EventTraceRecorder::WriteToFile(filePath.c_str(), EventTraceRecorder::Format::Perfetto);
+            }
+            else
+            {
+                AZ_Error("EventTraceRecorder", false, "Unknown trace format '%.*s'. Use 'json' or 'perfetto'.",
+                    aznumeric_cast<int>(arguments[1].size()), arguments[1].data());
+                return;
+            }
+        }
+        else
+        {
+            result = EventTraceRecorder::WriteToFile(filePath.c_str());
+        }
+
+        if (result)
+        {
+            AZ_TracePrintf("EventTraceRecorder", "Trace written to '%s'.\n", filePath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(bg_traceRecorderDump, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Writes the recorded trace events to a file. Parameters: [file path] [json|perfetto]. Without a format, files ending in "
+        "'.json' are written as Chrome traces and all other files as Perfetto traces.");
+
+    namespace EventTraceRecorderInternal
+    {
+        struct ThreadBuffer
+        {
+            void Record(EventTraceRecorder::EventType type, const char* name, const char* category, u64 value)
+            {
+                // Only the owning thread writes to the buffer, so the index can be read relaxed. The release store publishes the
+                // event to threads that are writing the trace.
+                const u64 index = m_writeIndex.load(AZStd::memory_order_relaxed);
+                EventTraceRecorder::Event& event = m_events[index & m_mask];
+                event.m_timestamp = AZStd::GetTimeNowTicks();
+                event.m_name = name;
+                event.m_category = category;
+                event.m_value = value;
+                event.m_type = type;
+                m_writeIndex.store(index + 1, AZStd::memory_order_release);
+            }
+
+            const AZStd::atomic_bool* m_enabled{ nullptr };
+            EventTraceRecorder::Event* m_events{ nullptr };
+            u64 m_mask{ 0 };
+            //! The total number of events recorded into this buffer.
+            AZStd::atomic<u64> m_writeIndex{ 0 };
+            //! Events before this index have been cleared.
+            AZStd::atomic<u64> m_clearIndex{ 0 };
+
+            // The following are protected by the mutex in the shared state.
+            AZStd::thread_id m_threadId;
+            u32 m_tid{ 0 };
+            //! The number of modules that are recording into this buffer for the owning thread. Once all modules have released the
+            //! buffer when the thread exits, the buffer can be picked up by a new thread.
+            u32 m_moduleCount{ 0 };
+            char m_threadName[EventTraceRecorder::MaxThreadNameLength]{};
+        };
+
+        //! State that's shared between all modules through the environment.
+        struct SharedState
+        {
+            ~SharedState()
+            {
+                for (ThreadBuffer* buffer : m_buffers)
+                {
+                    buffer->~ThreadBuffer();
+                    AZ_OS_FREE(buffer);
+                }
+            }
+
+            AZStd::atomic_bool m_enabled{ false };
+            AZStd::atomic<size_t> m_eventsPerThread{ EventTraceRecorder::DefaultEventsPerThread };
+            AZStd::mutex m_mutex;
+            AZStd::fixed_vector<ThreadBuffer*, EventTraceRecorder::MaxThreadCount> m_buffers;
+            u32 m_nextTid{ 1 };
+        };
+
+        static constexpr const char* SharedStateName = "EventTraceRecorder";
+
+        static SharedState* GetSharedState()
+        {
+            // The recorder is inactive until the environment is available, which avoids recording from static initialization.
+            if (!Environment::IsReady())
+            {
+                return nullptr;
+            }
+            static EnvironmentVariable<SharedState> s_sharedState = Environment::CreateVariable<SharedState>(SharedStateName);
+            return &s_sharedState.Get();
+        }
+
+        // Thread local storage is replicated per module, so every module keeps its own pointer to the buffer of a thread. The
+        // buffers themselves are shared through the environment, so a thread writes into a single buffer across all modules.
+        static thread_local ThreadBuffer* t_threadBuffer = nullptr;
+        static thread_local bool t_threadBufferUnavailable = false;
+        static thread_local char t_pendingThreadName[EventTraceRecorder::MaxThreadNameLength]{};
+
+        struct ThreadBufferRelease
+        {
+            ~ThreadBufferRelease()
+            {
+                // Prevent any recording done by later thread local destructors from picking up a new buffer.
+                t_threadBufferUnavailable = true;
+                if (ThreadBuffer* buffer = t_threadBuffer; buffer)
+                {
+                    t_threadBuffer = nullptr;
+                    if (SharedState* state = GetSharedState(); state)
+                    {
+                        AZStd::scoped_lock lock(state->m_mutex);
+                        --buffer->m_moduleCount;
+                    }
+                }
+            }
+        };
+
+        static void CopyThreadName(char (&target)[EventTraceRecorder::MaxThreadNameLength], AZStd::string_view name)
+        {
+            const size_t length = AZStd::min(name.size(), EventTraceRecorder::MaxThreadNameLength - 1);
+            memcpy(target, name.data(), length);
+            target[length] = 0;
+        }
+
+        static ThreadBuffer* CreateThreadBuffer(SharedState& state, size_t eventCount)
+        {
+            void* memory = AZ_OS_MALLOC(sizeof(ThreadBuffer) + eventCount * sizeof(EventTraceRecorder::Event), alignof(ThreadBuffer));
+            if (!memory)
+            {
+                return nullptr;
+            }
+            ThreadBuffer* buffer = new(memory) ThreadBuffer;
+            buffer->m_enabled = &state.m_enabled;
+            buffer->m_events = reinterpret_cast<EventTraceRecorder::Event*>(buffer + 1);
+            buffer->m_mask = eventCount - 1;
+            state.m_buffers.push_back(buffer);
+            return buffer;
+        }
+
+        static ThreadBuffer* AcquireThreadBuffer()
+        {
+            if (t_threadBufferUnavailable)
+            {
+                return nullptr;
+            }
+            SharedState* state = GetSharedState();
+            if (!state || !state->m_enabled.load(AZStd::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+
+            static thread_local ThreadBufferRelease t_threadBufferRelease;
+            (void)t_threadBufferRelease;
+
+            AZStd::scoped_lock lock(state->m_mutex);
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+            const size_t eventCount = state->m_eventsPerThread.load(AZStd::memory_order_relaxed);
+            ThreadBuffer* reusableBuffer = nullptr;
+            for (ThreadBuffer* buffer : state->m_buffers)
+            {
+                if (buffer->m_moduleCount > 0)
+                {
+                    if (buffer->m_threadId == threadId)
+                    {
+                        // Another module already started recording for this thread.
+                        ++buffer->m_moduleCount;
+                        t_threadBuffer = buffer;
+                        return buffer;
+                    }
+                }
+                else if (!reusableBuffer && buffer->m_mask + 1 == eventCount)
+                {
+                    reusableBuffer = buffer;
+                }
+            }
+
+            ThreadBuffer* buffer = reusableBuffer;
+            if (buffer)
+            {
+                // The events of the thread that previously used this buffer are dropped.
+                buffer->m_clearIndex.store(buffer->m_writeIndex.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+            }
+            else if (state->m_buffers.size() < state->m_buffers.capacity())
+            {
+                buffer = CreateThreadBuffer(*state, eventCount);
+            }
+
+            if (!buffer)
+            {
+                AZ_Warning("EventTraceRecorder", false, "Unable to record trace events for this thread because there are no buffers available.");
+                t_threadBufferUnavailable = true;
+                return nullptr;
+            }
+
+            buffer->m_threadId = threadId;
+            buffer->m_tid = state->m_nextTid++;
+            buffer->m_moduleCount = 1;
+            if (t_pendingThreadName[0] != 0)
+            {
+                CopyThreadName(buffer->m_threadName, t_pendingThreadName);
+            }
+            else
+            {
+                azsnprintf(buffer->m_threadName, EventTraceRecorder::MaxThreadNameLength, "Thread %u", buffer->m_tid);
+            }
+            t_threadBuffer = buffer;
+            return buffer;
+        }
+
+        //! Returns the buffer to record into for the calling thread, or null if recording is disabled.
+        static ThreadBuffer* GetRecordingBuffer()
+        {
+            if (ThreadBuffer* buffer = t_threadBuffer; buffer)
+            {
+                return buffer->m_enabled->load(AZStd::memory_order_relaxed) ? buffer : nullptr;
+            }
+            return AcquireThreadBuffer();
+        }
+
+        //! The events that could be read from the buffer of a single thread.
+        struct ThreadEvents
+        {
+            AZStd::vector<EventTraceRecorder::Event> m_events;
+            u32 m_tid{ 0 };
+            char m_threadName[EventTraceRecorder::MaxThreadNameLength]{};
+        };
+
+        static void ReadEvents(const ThreadBuffer& buffer, ThreadEvents& target)
+        {
+            const u64 capacity = buffer.m_mask + 1;
+            const u64 end = buffer.m_writeIndex.load(AZStd::memory_order_acquire);
+            const u64 clearIndex = buffer.m_clearIndex.load(AZStd::memory_order_relaxed);
+            const u64 begin = AZStd::max(clearIndex, end > capacity ? end - capacity : 0);
+
+            AZStd::vector<EventTraceRecorder::Event>& events = target.m_events;
+            events.reserve(aznumeric_cast<size_t>(end - begin));
+            for (u64 index = begin; index < end; ++index)
+            {
+                events.push_back(buffer.m_events[index & buffer.m_mask]);
+            }
+
+            // The owning thread continues to record while the events are copied, so events may have been overwritten. The slot
+            // for the event that's currently being written is also unreliable, so anything before it that shares a slot is
+            // dropped.
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            const u64 latest = buffer.m_writeIndex.load(AZStd::memory_order_relaxed);
+            const u64 firstValid = latest + 1 > capacity ? latest + 1 - capacity : 0;
+            if (firstValid > begin)
+            {
+                const size_t overwritten = aznumeric_cast<size_t>(AZStd::min(firstValid, end) - begin);
+                events.erase(events.begin(), events.begin() + overwritten);
+            }
+
+            // Drop end events that lost their begin event when it was overwritten.
+            size_t depth = 0;
+            auto endIt = AZStd::remove_if(events.begin(), events.end(), [&depth](const EventTraceRecorder::Event& event)
+                {
+                    if (event.m_type == EventTraceRecorder::EventType::Begin)
+                    {
+                        ++depth;
+                    }
+                    else if (event.m_type == EventTraceRecorder::EventType::End)
+                    {
+                        if (depth == 0)
+                        {
+                            return true;
+                        }
+                        --depth;
+                    }
+                    return false;
+                });
+            events.erase(endIt, events.end());
+        }
+
+        static AZStd::vector<ThreadEvents> ReadAllEvents(SharedState& state)
+        {
+            AZStd::vector<ThreadEvents> result;
+            AZStd::scoped_lock lock(state.m_mutex);
+            result.reserve(state.m_buffers.size());
+            for (const ThreadBuffer* buffer : state.m_buffers)
+            {
+                ThreadEvents& threadEvents = result.emplace_back();
+                threadEvents.m_tid = buffer->m_tid;
+                CopyThreadName(threadEvents.m_threadName, buffer->m_threadName);
+                ReadEvents(*buffer, threadEvents);
+                if (threadEvents.m_events.empty())
+                {
+                    result.pop_back();
+                }
+            }
+            return result;
+        }
+
+        static u64 TicksToNanoseconds(u64 ticks, u64 ticksPerSecond)
+        {
+            constexpr u64 NanosecondsPerSecond = 1'000'000'000;
+            return (ticks / ticksPerSecond) * NanosecondsPerSecond + ((ticks % ticksPerSecond) * NanosecondsPerSecond) / ticksPerSecond;
+        }
+
+        static const char* NameOrEmpty(const char* name)
+        {
+            return name ? name : "";
+        }
+
+        //! Collects the output in a memory block and writes it to the stream in large chunks.
+        class BufferedStreamWriter
+        {
+        public:
+            static constexpr size_t FlushSize = 64 * 1024;
+
+            explicit BufferedStreamWriter(IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+                m_buffer.reserve(FlushSize + 1024);
+            }
+
+            void Write(const void* data, size_t size)
+            {
+                const u8* bytes = reinterpret_cast<const u8*>(data);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+                if (m_buffer.size() >= FlushSize)
+                {
+                    Flush();
+                }
+            }
+
+            void Write(AZStd::string_view text)
+            {
+                Write(text.data(), text.size());
+            }
+
+            bool Flush()
+            {
+                if (!m_buffer.empty())
+                {
+                    m_success = m_stream.Write(m_buffer.size(), m_buffer.data()) == m_buffer.size() && m_success;
+                    m_buffer.clear();
+                }
+                return m_success;
+            }
+
+        private:
+            AZStd::vector<u8> m_buffer;
+            IO::GenericStream& m_stream;
+            bool m_success{ true };
+        };
+
+        //
+        // Chrome trace
+        //
+
+        static void WriteJsonString(BufferedStreamWriter& writer, const char* text)
+        {
+            writer.Write("\"", 1);
+            const char* start = text;
+            for (; *text != 0; ++text)
+            {
+                const char character = *text;
+                if (character == '"' || character == '\\' || static_cast<unsigned char>(character) < 0x20)
+                {
+                    writer.Write(start, text - start);
+                    char escaped[8];
+                    int length = (character == '"' || character == '\\')
+                        ? azsnprintf(escaped, sizeof(escaped), "\\%c", character)
+                        : azsnprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+                    writer.Write(escaped, length);
+                    start = text + 1;
+                }
+            }
+            writer.Write(start, text - start);
+            writer.Write("\"", 1);
+        }
+
+        static bool WriteChromeJson(IO::GenericStream& stream, const AZStd::vector<ThreadEvents>& threads)
+        {
+            const u64 ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+            const u32 pid = AZ::Platform::GetCurrentProcessId();
+
+            BufferedStreamWriter writer(stream);
+            writer.Write(R"({"displayTimeUnit":"ms","traceEvents":[)");
+            char buffer[128];
+            bool first = true;
+            auto startEvent = [&](const char* phase, u32 tid)
+            {
+                int length = azsnprintf(buffer, sizeof(buffer), R"(%s{"ph":"%s","pid":%u,"tid":%u)", first ? "" : ",\n", phase, pid, tid);
+                writer.Write(buffer, length);
+                first = false;
+            };
+
+            for (const ThreadEvents& thread : threads)
+            {
+                startEvent("M", thread.m_tid);
+                writer.Write(R"(,"name":"thread_name","args":{"name":)");
+                WriteJsonString(writer, thread.m_threadName);
+                writer.Write("}}");
+
+                for (const EventTraceRecorder::Event& event : thread.m_events)
+                {
+                    const char* phase = "";
+                    switch (event.m_type)
+                    {
+                    case EventTraceRecorder::EventType::Begin:
+                        phase = "B";
+                        break;
+                    case EventTraceRecorder::EventType::End:
+                        phase = "E";
+                        break;
+                    case EventTraceRecorder::EventType::Instant:
+                        phase = "i";
+                        break;
+                    case EventTraceRecorder::EventType::Counter:
+                        phase = "C";
+                        break;
+                    case EventTraceRecorder::EventType::FlowBegin:
+                        phase = "s";
+                        break;
+                    case EventTraceRecorder::EventType::FlowStep:
+                        phase = "t";
+                        break;
+                    case EventTraceRecorder::EventType::FlowEnd:
+                        phase = "f";
+                        break;
+                    }
+
+                    startEvent(phase, thread.m_tid);
+                    const u64 timestamp = TicksToNanoseconds(event.m_timestamp, ticksPerSecond);
+                    int length = azsnprintf(buffer, sizeof(buffer), R"(,"ts":%llu.%03u)",
+                        static_cast<unsigned long long>(timestamp / 1000), static_cast<unsigned int>(timestamp % 1000));
+                    writer.Write(buffer, length);
+
+                    if (event.m_type != EventTraceRecorder::EventType::End)
+                    {
+                        writer.Write(R"(,"name":)");
+                        WriteJsonString(writer, NameOrEmpty(event.m_name));
+                        writer.Write(R"(,"cat":)");
+                        WriteJsonString(writer, NameOrEmpty(event.m_category));
+                    }
+
+                    switch (event.m_type)
+                    {
+                    case EventTraceRecorder::EventType::Instant:
+                        writer.Write(R"(,"s":"t")");
+                        break;
+                    case EventTraceRecorder::EventType::Counter:
+                        length = azsnprintf(buffer, sizeof(buffer), R"(,"args":{"value":%lld})",
+                            static_cast<long long>(static_cast<s64>(event.m_value)));
+                        writer.Write(buffer, length);
+                        break;
+                    case EventTraceRecorder::EventType::FlowBegin:
+                    case EventTraceRecorder::EventType::FlowStep:
+                    case EventTraceRecorder::EventType::FlowEnd:
+                        // Bind the flow to the enclosing scope.
+                        length = azsnprintf(buffer, sizeof(buffer), R"(,"id":%llu,"bp":"e")", static_cast<unsigned long long>(event.m_value));
+                        writer.Write(buffer, length);
+                        break;
+                    default:
+                        break;
+                    }
+                    writer.Write("}");
+                }
+            }
+            writer.Write("]}\n");
+            return writer.Flush();
+        }
+
+        //
+        // Perfetto trace
+        //
+
+        //! Minimal protobuf encoder for the messages used in Perfetto traces.
+        class ProtoMessage
+        {
+        public:
+            void AddVarint(u32 field, u64 value)
+            {
+                WriteVarint((static_cast<u64>(field) << 3) | WireTypeVarint);
+                WriteVarint(value);
+            }
+
+            void AddFixed64(u32 field, u64 value)
+            {
+                WriteVarint((static_cast<u64>(field) << 3) | WireTypeFixed64);
+                for (int i = 0; i < 8; ++i)
+                {
+                    m_data.push_back(static_cast<u8>(value >> (i * 8)));
+                }
+            }
+
+            void AddBytes(u32 field, const void* data, size_t size)
+            {
+                WriteVarint((static_cast<u64>(field) << 3) | WireTypeLengthDelimited);
+                WriteVarint(size);
+                const u8* bytes = reinterpret_cast<const u8*>(data);
+                m_data.insert(m_data.end(), bytes, bytes + size);
+            }
+
+            void AddString(u32 field, const char* text)
+            {
+                AddBytes(field, text, strlen(text));
+            }
+
+            void AddMessage(u32 field, const ProtoMessage& message)
+            {
+                AddBytes(field, message.m_data.data(), message.m_data.size());
+            }
+
+            void Clear()
+            {
+                m_data.clear();
+            }
+
+            const AZStd::vector<u8>& GetData() const
+            {
+                return m_data;
+            }
+
+        private:
+            static constexpr u64 WireTypeVarint = 0;
+            static constexpr u64 WireTypeFixed64 = 1;
+            static constexpr u64 WireTypeLengthDelimited = 2;
+
+            void WriteVarint(u64 value)
+            {
+                while (value >= 0x80)
+                {
+                    m_data.push_back(static_cast<u8>(value | 0x80));
+                    value >>= 7;
+                }
+                m_data.push_back(static_cast<u8>(value));
+            }
+
+            AZStd::vector<u8> m_data;
+        };
+
+        namespace Perfetto
+        {
+            // Field numbers and values from the Perfetto trace format (protos/perfetto/trace).
+            constexpr u32 TracePacket = 1; // Trace
+            constexpr u32 PacketTimestamp = 8; // TracePacket
+            constexpr u32 PacketSequenceId = 10;
+            constexpr u32 PacketTrackEvent = 11;
+            constexpr u32 PacketSequenceFlags = 13;
+            constexpr u32 PacketTrackDescriptor = 60;
+            constexpr u32 TrackUuid = 1; // TrackDescriptor
+            constexpr u32 TrackName = 2;
+            constexpr u32 TrackProcess = 3;
+            constexpr u32 TrackThread = 4;
+            constexpr u32 TrackParentUuid = 5;
+            constexpr u32 TrackCounter = 8;
+            constexpr u32 ProcessPid = 1; // ProcessDescriptor
+            constexpr u32 ThreadPid = 1; // ThreadDescriptor
+            constexpr u32 ThreadTid = 2;
+            constexpr u32 ThreadName = 5;
+            constexpr u32 EventCategories = 22; // TrackEvent
+            constexpr u32 EventName = 23;
+            constexpr u32 EventType = 9;
+            constexpr u32 EventTrackUuid = 11;
+            constexpr u32 EventCounterValue = 30;
+            constexpr u32 EventFlowIds = 47;
+            constexpr u32 EventTerminatingFlowIds = 48;
+
+            constexpr u64 TypeSliceBegin = 1;
+            constexpr u64 TypeSliceEnd = 2;
+            constexpr u64 TypeInstant = 3;
+            constexpr u64 TypeCounter = 4;
+
+            constexpr u64 SequenceIncrementalStateCleared = 1;
+            constexpr u64 SequenceNeedsIncrementalState = 2;
+
+            constexpr u32 SequenceId = 1;
+            constexpr u64 ProcessTrackUuid = 1;
+            constexpr u64 ThreadTrackUuidBase = u64(1) << 32;
+            constexpr u64 CounterTrackUuidBase = u64(2) << 32;
+        } // namespace Perfetto
+
+        static void WritePacket(BufferedStreamWriter& writer, ProtoMessage& trace, const ProtoMessage& packet)
+        {
+            trace.Clear();
+            trace.AddMessage(Perfetto::TracePacket, packet);
+            writer.Write(trace.GetData().data(), trace.GetData().size());
+        }
+
+        static bool WritePerfetto(IO::GenericStream& stream, const AZStd::vector<ThreadEvents>& threads)
+        {
+            const u64 ticksPerSecond = AZStd::GetTimeTicksPerSecond();
+            const u32 pid = AZ::Platform::GetCurrentProcessId();
+
+            BufferedStreamWriter writer(stream);
+            ProtoMessage trace;
+            ProtoMessage packet;
+            ProtoMessage track;
+            ProtoMessage descriptor;
+
+            // Process track.
+            descriptor.AddVarint(Perfetto::ProcessPid, pid);
+            track.AddVarint(Perfetto::TrackUuid, Perfetto::ProcessTrackUuid);
+            track.AddMessage(Perfetto::TrackProcess, descriptor);
+            packet.AddVarint(Perfetto::PacketSequenceId, Perfetto::SequenceId);
+            packet.AddVarint(Perfetto::PacketSequenceFlags, Perfetto::SequenceIncrementalStateCleared);
+            packet.AddMessage(Perfetto::PacketTrackDescriptor, track);
+            WritePacket(writer, trace, packet);
+
+            // Thread tracks.
+            for (const ThreadEvents& thread : threads)
+            {
+                descriptor.Clear();
+                descriptor.AddVarint(Perfetto::ThreadPid, pid);
+                descriptor.AddVarint(Perfetto::ThreadTid, thread.m_tid);
+                descriptor.AddString(Perfetto::ThreadName, thread.m_threadName);
+                track.Clear();
+                track.AddVarint(Perfetto::TrackUuid, Perfetto::ThreadTrackUuidBase + thread.m_tid);
+                track.AddVarint(Perfetto::TrackParentUuid, Perfetto::ProcessTrackUuid);
+                track.AddMessage(Perfetto::TrackThread, descriptor);
+                packet.Clear();
+                packet.AddVarint(Perfetto::PacketSequenceId, Perfetto::SequenceId);
+                packet.AddMessage(Perfetto::PacketTrackDescriptor, track);
+                WritePacket(writer, trace, packet);
+            }
+
+            // Merge the events of all threads in timestamp order, as packets on a sequence are expected to be sorted.
+            struct EventReference
+            {
+                const EventTraceRecorder::Event* m_event;
+                u32 m_thread;
+            };
+            AZStd::vector<EventReference> events;
+            for (u32 threadIndex = 0; threadIndex < threads.size(); ++threadIndex)
+            {
+                for (const EventTraceRecorder::Event& event : threads[threadIndex].m_events)
+                {
+                    events.push_back(EventReference{ &event, threadIndex });
+                }
+            }
+            AZStd::sort(events.begin(), events.end(), [](const EventReference& lhs, const EventReference& rhs)
+                {
+                    // Events of a thread are stored consecutively, so the addresses keep their recorded order.
+                    return lhs.m_event->m_timestamp != rhs.m_event->m_timestamp
+                        ? lhs.m_event->m_timestamp < rhs.m_event->m_timestamp
+                        : (lhs.m_thread != rhs.m_thread ? lhs.m_thread < rhs.m_thread : lhs.m_event < rhs.m_event);
+                });
+
+            // Counters are shown on their own track, one per counter name.
+            AZStd::vector<AZStd::string_view> counterNames;
+            ProtoMessage trackEvent;
+            for (const EventReference& reference : events)
+            {
+                const EventTraceRecorder::Event& event = *reference.m_event;
+                const u64 threadTrackUuid = Perfetto::ThreadTrackUuidBase + threads[reference.m_thread].m_tid;
+                trackEvent.Clear();
+                switch (event.m_type)
+                {
+                case EventTraceRecorder::EventType::Begin:
+                    trackEvent.AddVarint(Perfetto::EventType, Perfetto::TypeSliceBegin);
+                    trackEvent.AddVarint(Perfetto::EventTrackUuid, threadTrackUuid);
+                    break;
+                case EventTraceRecorder::EventType::End:
+                    trackEvent.AddVarint(Perfetto::EventType, Perfetto::TypeSliceEnd);
+                    trackEvent.AddVarint(Perfetto::EventTrackUuid, threadTrackUuid);
+                    break;
+                case EventTraceRecorder::EventType::Instant:
+                    trackEvent.AddVarint(Perfetto::EventType, Perfetto::TypeInstant);
+                    trackEvent.AddVarint(Perfetto::EventTrackUuid, threadTrackUuid);
+                    break;
+                case EventTraceRecorder::EventType::Counter:
+                {
+                    AZStd::string_view counterName = NameOrEmpty(event.m_name);
+                    auto counterIt = AZStd::find(counterNames.begin(), counterNames.end(), counterName);
+                    const u64 counterTrackUuid = Perfetto::CounterTrackUuidBase + (counterIt - counterNames.begin());
+                    if (counterIt == counterNames.end())
+                    {
+                        counterNames.push_back(counterName);
+                        track.Clear();
+                        track.AddVarint(Perfetto::TrackUuid, counterTrackUuid);
+                        track.AddVarint(Perfetto::TrackParentUuid, Perfetto::ProcessTrackUuid);
+                        track.AddString(Perfetto::TrackName, NameOrEmpty(event.m_name));
+                        track.AddBytes(Perfetto::TrackCounter, nullptr, 0);
+                        packet.Clear();
+                        packet.AddVarint(Perfetto::PacketSequenceId, Perfetto::SequenceId);
+                        packet.AddMessage(Perfetto::PacketTrackDescriptor, track);
+                        WritePacket(writer, trace, packet);
+                    }
+                    trackEvent.AddVarint(Perfetto::EventType, Perfetto::TypeCounter);
+                    trackEvent.AddVarint(Perfetto::EventTrackUuid, counterTrackUuid);
+                    trackEvent.AddVarint(Perfetto::EventCounterValue, event.m_value);
+                    break;
+                }
+                case EventTraceRecorder::EventType::FlowBegin:
+                case EventTraceRecorder::EventType::FlowStep:
+                case EventTraceRecorder::EventType::FlowEnd:
+                    // Perfetto attaches flows to slices, so they're stored as instant events on the thread.
+                    trackEvent.AddVarint(Perfetto::EventType, Perfetto::TypeInstant);
+                    trackEvent.AddVarint(Perfetto::EventTrackUuid, threadTrackUuid);
+                    trackEvent.AddFixed64(event.m_type == EventTraceRecorder::EventType::FlowEnd
+                        ? Perfetto::EventTerminatingFlowIds : Perfetto::EventFlowIds, event.m_value);
+                    break;
+                }
+
+                if (event.m_type != EventTraceRecorder::EventType::End && event.m_type != EventTraceRecorder::EventType::Counter)
+                {
+                    trackEvent.AddString(Perfetto::EventName, NameOrEmpty(event.m_name));
+                    if (event.m_category && event.m_category[0] != 0)
+                    {
+                        trackEvent.AddString(Perfetto::EventCategories, event.m_category);
+                    }
+                }
+
+                packet.Clear();
+                packet.AddVarint(Perfetto::PacketTimestamp, TicksToNanoseconds(event.m_timestamp, ticksPerSecond));
+                packet.AddVarint(Perfetto::PacketSequenceId, Perfetto::SequenceId);
+                packet.AddVarint(Perfetto::PacketSequenceFlags, Perfetto::SequenceNeedsIncrementalState);
+                packet.AddMessage(Perfetto::PacketTrackEvent, trackEvent);
+                WritePacket(writer, trace, packet);
+            }
+            return writer.Flush();
+        }
+    } // namespace EventTraceRecorderInternal
+
+    using namespace EventTraceRecorderInternal;
+
+    void EventTraceRecorder::SetEnabled(bool enabled)
+    {
+        if (SharedState* state = GetSharedState(); state)
+        {
+            state->m_enabled.store(enabled, AZStd::memory_order_relaxed);
+        }
+    }
+
+    bool EventTraceRecorder::IsEnabled()
+    {
+        SharedState* state = GetSharedState();
+        return state ? state->m_enabled.load(AZStd::memory_order_relaxed) : false;
+    }
+
+    void EventTraceRecorder::SetEventsPerThread(size_t eventCount)
+    {
+        if (SharedState* state = GetSharedState(); state)
+        {
+            size_t count = 2;
+            while (count < eventCount)
+            {
+                count <<= 1;
+            }
+            state->m_eventsPerThread.store(count, AZStd::memory_order_relaxed);
+        }
+    }
+
+    size_t EventTraceRecorder::GetEventsPerThread()
+    {
+        SharedState* state = GetSharedState();
+        return state ? state->m_eventsPerThread.load(AZStd::memory_order_relaxed) : DefaultEventsPerThread;
+    }
+
+    void EventTraceRecorder::SetThreadName(AZStd::string_view name)
+    {
+        CopyThreadName(t_pendingThreadName, name);
+        if (ThreadBuffer* buffer = t_threadBuffer; buffer)
+        {
+            if (SharedState* state = GetSharedState(); state)
+            {
+                AZStd::scoped_lock lock(state->m_mutex);
+                CopyThreadName(buffer->m_threadName, name);
+            }
+        }
+    }
+
+    void EventTraceRecorder::Clear()
+    {
+        if (SharedState* state = GetSharedState(); state)
+        {
+            AZStd::scoped_lock lock(state->m_mutex);
+            for (ThreadBuffer* buffer : state->m_buffers)
+            {
+                buffer->m_clearIndex.store(buffer->m_writeIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    void EventTraceRecorder::Begin(const char* name, const char* category)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::Begin, name, category, 0);
+        }
+    }
+
+    void EventTraceRecorder::End()
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::End, nullptr, nullptr, 0);
+        }
+    }
+
+    void EventTraceRecorder::Instant(const char* name, const char* category)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::Instant, name, category, 0);
+        }
+    }
+
+    void EventTraceRecorder::Counter(const char* name, const char* category, s64 value)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::Counter, name, category, static_cast<u64>(value));
+        }
+    }
+
+    void EventTraceRecorder::FlowBegin(const char* name, const char* category, u64 id)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::FlowBegin, name, category, id);
+        }
+    }
+
+    void EventTraceRecorder::FlowStep(const char* name, const char* category, u64 id)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::FlowStep, name, category, id);
+        }
+    }
+
+    void EventTraceRecorder::FlowEnd(const char* name, const char* category, u64 id)
+    {
+        if (ThreadBuffer* buffer = GetRecordingBuffer(); buffer)
+        {
+            buffer->Record(EventType::FlowEnd, name, category, id);
+        }
+    }
+
+    ThreadBuffer* EventTraceRecorder::BeginScope(const char* name, const char* category)
+    {
+        ThreadBuffer* buffer = GetRecordingBuffer();
+        if (buffer)
+        {
+            buffer->Record(EventType::Begin, name, category, 0);
+        }
+        return buffer;
+    }
+
+    void EventTraceRecorder::EndScope(ThreadBuffer* buffer)
+    {
+        // Always close a scope that was opened, even if recording was disabled in the meantime.
+        buffer->Record(EventType::End, nullptr, nullptr, 0);
+    }
+
+    bool EventTraceRecorder::Write(IO::GenericStream& stream, Format format)
+    {
+        SharedState* state = GetSharedState();
+        if (!state)
+        {
+            return false;
+        }
+
+        AZStd::vector<ThreadEvents> threads = ReadAllEvents(*state);
+        switch (format)
+        {
+        case Format::ChromeJson:
+            return WriteChromeJson(stream, threads);
+        case Format::Perfetto:
+            return WritePerfetto(stream, threads);
+        default:
+            AZ_Assert(false, "Unsupported trace format %i.", static_cast<int>(format));
+            return false;
+        }
+    }
+
+    bool EventTraceRecorder::WriteToFile(const char* filePath, Format format)
+    {
+        AZ::IO::FixedMaxPath resolvedPath{ filePath };
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO)
+        {
+            fileIO->ResolvePath(resolvedPath, AZ::IO::PathView(filePath));
+        }
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(resolvedPath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH))
+        {
+            AZ_Error("EventTraceRecorder", false, "Unable to open '%s' to write the trace to.", resolvedPath.c_str());
+            return false;
+        }
+        AZ::IO::SystemFileStream stream(&file, false);
+        if (!Write(stream, format))
+        {
+            AZ_Error("EventTraceRecorder", false, "Failed to write the trace to '%s'.", resolvedPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool EventTraceRecorder::WriteToFile(const char* filePath)
+    {
+        return WriteToFile(filePath, AZ::IO::PathView(filePath).Extension() == ".json" ? Format::ChromeJson : Format::Perfetto);
+    }
+} // namespace AZ::Debug
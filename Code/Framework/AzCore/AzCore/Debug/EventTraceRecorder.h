@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/is_array.h>
+#include <AzCore/std/typetraits/remove_reference.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ::Debug
+{
+    namespace EventTraceRecorderInternal
+    {
+        struct ThreadBuffer;
+
+        //! Names are recorded by pointer and only read when a trace is written. Only character arrays, such as string literals
+        //! and AZ_FUNCTION_SIGNATURE, are accepted as names, as a pointer can't tell whether the string it points to outlives it.
+        template<typename NameType>
+        constexpr bool IsStaticName = AZStd::is_array_v<AZStd::remove_reference_t<NameType>>;
+
+        template<typename NameType>
+        constexpr const char* StaticName(const char* name)
+        {
+            static_assert(IsStaticName<NameType>, "Trace recorder names are stored by pointer and have to be string literals");
+            return name;
+        }
+
+        template<typename NameType>
+        constexpr const char* StaticNameOrNull(const char* name)
+        {
+            if constexpr (IsStaticName<NameType>)
+            {
+                return name;
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    //! Records trace events such as scopes, counters and flows into a ring buffer per thread, so the most recent events can be
+    //! written on demand as a Chrome trace (json) or as a Perfetto trace (protobuf). The recorder is always compiled in. While
+    //! disabled a recording costs a thread local read and a flag check. While enabled an event is written to the ring buffer of
+    //! the calling thread without taking any locks, which keeps the cost low enough to leave recording on for long running
+    //! sessions such as dedicated servers. When a ring buffer is full the oldest events are overwritten.
+    //! Note: Names and categories are stored as pointers and only read when a trace is written, so they need to remain valid
+    //!     for the lifetime of the application, for instance by using string literals.
+    class EventTraceRecorder
+    {
+    public:
+        enum class EventType : u8
+        {
+            Begin,
+            End,
+            Instant,
+            Counter,
+            FlowBegin,
+            FlowStep,
+            FlowEnd
+        };
+
+        enum class Format : u8
+        {
+            ChromeJson,
+            Perfetto
+        };
+
+        struct Event
+        {
+            u64 m_timestamp; // In ticks as returned by AZStd::GetTimeNowTicks.
+            const char* m_name;
+            const char* m_category;
+            u64 m_value; // The value for counters or the id for flows.
+            EventType m_type;
+        };
+
+        static constexpr size_t DefaultEventsPerThread = 32 * 1024;
+        static constexpr size_t MaxThreadCount = 512;
+        static constexpr size_t MaxThreadNameLength = 64;
+
+        static void SetEnabled(bool enabled);
+        static bool IsEnabled();
+
+        //! Sets the number of events each thread can hold before the oldest are overwritten. The count is rounded up to a power
+        //! of two and only applies to threads that start recording after this call.
+        static void SetEventsPerThread(size_t eventCount);
+        static size_t GetEventsPerThread();
+
+        //! Sets the name that's shown for the calling thread in the written traces.
+        static void SetThreadName(AZStd::string_view name);
+
+        //! Removes all recorded events. Events that are being recorded while clearing may be kept.
+        static void Clear();
+
+        static void Begin(const char* name, const char* category);
+        static void End();
+        static void Instant(const char* name, const char* category);
+        static void Counter(const char* name, const char* category, s64 value);
+        //! Flows connect the scopes that are active when the flow events with the same id are recorded, such as a request that's
+        //! started on one thread and completed on another.
+        //! @{
+        static void FlowBegin(const char* name, const char* category, u64 id);
+        static void FlowStep(const char* name, const char* category, u64 id);
+        static void FlowEnd(const char* name, const char* category, u64 id);
+        //! @}
+
+        //! Writes the events currently stored for all threads to the stream. Recording can continue while the trace is written.
+        static bool Write(IO::GenericStream& stream, Format format);
+        //! Writes the events currently stored for all threads to a file. Aliases in the path are resolved.
+        static bool WriteToFile(const char* filePath, Format format);
+        //! Same as the above but picks the format based on the extension. Files ending in ".json" are written as Chrome traces,
+        //! all other files are written as Perfetto traces.
+        static bool WriteToFile(const char* filePath);
+
+        //! Records the begin event of a scope on construction and the matching end event on destruction.
+        //! Nothing is recorded if the name is null.
+        class Scope
+        {
+        public:
+            Scope(const char* name, const char* category)
+                : m_buffer(name ? BeginScope(name, category) : nullptr)
+            {
+            }
+
+            ~Scope()
+            {
+                if (m_buffer)
+                {
+                    EndScope(m_buffer);
+                }
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            EventTraceRecorderInternal::ThreadBuffer* m_buffer;
+        };
+
+    private:
+        static EventTraceRecorderInternal::ThreadBuffer* BeginScope(const char* name, const char* category);
+        static void EndScope(EventTraceRecorderInternal::ThreadBuffer* buffer);
+    };
+} // namespace AZ::Debug
+
+// The recording macros only accept string literals as names. AZ_TRACE_RECORDER_OPTIONAL_SCOPE is for macros like AZ_PROFILE_SCOPE
+// that accept any name, it records scopes with literal names and skips the others.
+#if defined(AZ_TRACE_RECORDER_DISABLED)
+#   define AZ_TRACE_RECORDER_SCOPE(name, category)
+#   define AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, category)
+#   define AZ_TRACE_RECORDER_INSTANT(name, category)
+#   define AZ_TRACE_RECORDER_COUNTER(name, category, value)
+#   define AZ_TRACE_RECORDER_FLOW_BEGIN(name, category, id)
+#   define AZ_TRACE_RECORDER_FLOW_STEP(name, category, id)
+#   define AZ_TRACE_RECORDER_FLOW_END(name, category, id)
+#else
+#   define AZ_TRACE_RECORDER_STATIC_NAME(name) \
+        AZ::Debug::EventTraceRecorderInternal::StaticName<decltype(name)>(name)
+#   define AZ_TRACE_RECORDER_SCOPE(name, category) \
+        AZ::Debug::EventTraceRecorder::Scope AZ_JOIN(azTraceRecorderScope, __LINE__){ AZ_TRACE_RECORDER_STATIC_NAME(name), category }
+#   define AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, category) \
+        AZ::Debug::EventTraceRecorder::Scope AZ_JOIN(azTraceRecorderScope, __LINE__){ \
+            AZ::Debug::EventTraceRecorderInternal::StaticNameOrNull<decltype(name)>(name), category }
+#   define AZ_TRACE_RECORDER_INSTANT(name, category) \
+        AZ::Debug::EventTraceRecorder::Instant(AZ_TRACE_RECORDER_STATIC_NAME(name), category)
+#   define AZ_TRACE_RECORDER_COUNTER(name, category, value) \
+        AZ::Debug::EventTraceRecorder::Counter(AZ_TRACE_RECORDER_STATIC_NAME(name), category, static_cast<AZ::s64>(value))
+#   define AZ_TRACE_RECORDER_FLOW_BEGIN(name, category, id) \
+        AZ::Debug::EventTraceRecorder::FlowBegin(AZ_TRACE_RECORDER_STATIC_NAME(name), category, static_cast<AZ::u64>(id))
+#   define AZ_TRACE_RECORDER_FLOW_STEP(name, category, id) \
+        AZ::Debug::EventTraceRecorder::FlowStep(AZ_TRACE_RECORDER_STATIC_NAME(name), category, static_cast<AZ::u64>(id))
+#   define AZ_TRACE_RECORDER_FLOW_END(name, category, id) \
+        AZ::Debug::EventTraceRecorder::FlowEnd(AZ_TRACE_RECORDER_STATIC_NAME(name), category, static_cast<AZ::u64>(id))
+#endif
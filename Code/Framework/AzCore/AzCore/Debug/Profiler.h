@@ -7,6 +7,7 @@
 #ifndef AZCORE_PROFILER_H
 #define AZCORE_PROFILER_H 1
 
+#include <AzCore/Debug/EventTraceRecorder.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/function/function_fwd.h>
 
@@ -248,18 +249,25 @@ namespace AZ
 #   define AZ_INTERNAL_PROF_CAT_NAME(category) AZ::Debug::ProfileCategoryNames[static_cast<AZ::u32>(category)]
 
 #   define AZ_PROFILE_FUNCTION(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_SCOPE(AZ_FUNCTION_SIGNATURE, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 #   define AZ_PROFILE_FUNCTION_STALL(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_SCOPE(AZ_FUNCTION_SIGNATURE, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 #   define AZ_PROFILE_FUNCTION_IDLE(category) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_SCOPE(AZ_FUNCTION_SIGNATURE, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 
+// The EventTraceRecorder keeps scope names by pointer, so only scopes named with a string literal are recorded by it.
 #   define AZ_PROFILE_SCOPE(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 #   define AZ_PROFILE_SCOPE_STALL(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 #   define AZ_PROFILE_SCOPE_IDLE(category, name) \
-        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category)); (void)(name)
+        AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_TRACE_RECORDER_OPTIONAL_SCOPE(name, AZ_INTERNAL_PROF_CAT_NAME(category)); \
+        AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
 
 #   define AZ_PROFILE_SCOPE_DYNAMIC(category, ...) \
         AZ_INTERNAL_PROF_VERIFY_CAT(category); AZ_PROFILE_TIMER(AZ_INTERNAL_PROF_CAT_NAME(category))
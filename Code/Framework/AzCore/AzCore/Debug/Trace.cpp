@@ -13,6 +13,7 @@
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/Debug/TraceMessagesDrillerBus.h>
 #include <AzCore/Debug/IEventLogger.h>
+#include <AzCore/Console/AsyncLogSink.h>
 #include <AzCore/Interface/Interface.h>
 
 #include <stdarg.h>
@@ -63,6 +64,7 @@ namespace AZ
     static const char* ignoredAssertUID = "IgnoredAssertSet";
     static const char* assertVerbosityUID = "assertVerbosityLevel";
     static const char* logVerbosityUID = "sys_LogLevel";
+    static const char* asyncLogSinkUID = "AsyncTraceLogSink";
     static const int assertLevel_log = 1;
     static const int assertLevel_nativeUI = 2;
     static const int assertLevel_crash = 3;
@@ -77,7 +79,7 @@ namespace AZ
     static constexpr auto ErrorEventId = EventNameHash("Error");
     static constexpr auto AssertEventId = EventNameHash("Assert");
 
-    constexpr LogLevel DefaultLogLevel = LogLevel::Info;
+    constexpr Debug::LogLevel DefaultLogLevel = Debug::LogLevel::Info;
 
     AZ_CVAR_SCOPED(int, bg_traceLogLevel, DefaultLogLevel, nullptr, ConsoleFunctorFlags::Null, "Enable trace message logging in release mode.  0=disabled, 1=errors, 2=warnings, 3=info.");
 
@@ -92,6 +94,43 @@ namespace AZ
         void operator=(bool rhs)     { m_value = m_value || rhs; }
     };
 
+    //! Returns the slot of the sink that Printf messages are queued in, shared by all modules through the environment.
+    static AsyncLogSinkSlot* GetAsyncLogSinkSlot()
+    {
+        if (!AZ::Environment::IsReady())
+        {
+            return nullptr;
+        }
+        static AZ::EnvironmentVariable<AsyncLogSinkSlot> s_asyncLogSinkSlot = AZ::Environment::CreateVariable<AsyncLogSinkSlot>(asyncLogSinkUID);
+        return &s_asyncLogSinkSlot.Get();
+    }
+
+    static bool QueueAsyncPrintf(const char* window, const char* message)
+    {
+        AsyncLogSinkSlot* asyncLogSinkSlot = GetAsyncLogSinkSlot();
+        return asyncLogSinkSlot && asyncLogSinkSlot->Use([window, message](AsyncLogSink* asyncLogSink)
+            {
+                return asyncLogSink && asyncLogSink->QueueTrace(AsyncLogSink::TraceType::Printf, window, message);
+            });
+    }
+
+    //! Writes the queued Printf messages, so they show up before an assert, error or warning and aren't lost if the application crashes.
+    static void FlushAsyncPrintf()
+    {
+        AsyncLogSinkSlot* asyncLogSinkSlot = GetAsyncLogSinkSlot();
+        if (asyncLogSinkSlot && !DebugInternal::g_suppressEBusCalls)
+        {
+            asyncLogSinkSlot->Use([](AsyncLogSink* asyncLogSink)
+                {
+                    if (asyncLogSink)
+                    {
+                        asyncLogSink->Flush();
+                    }
+                    return true;
+                });
+        }
+    }
+
     // definition of init to initialize assert tracking global
     void Trace::Init()
     {
@@ -252,6 +291,7 @@ namespace AZ
         int currentLevel = GetAssertVerbosityLevel();
         if (currentLevel >= assertLevel_log)
         {
+            FlushAsyncPrintf();
             Output(g_dbgSystemWnd, "\n==================================================================\n");
             azsnprintf(header, g_maxMessageLength, "Trace::Assert\n %s(%d): (%tu) '%s'\n", fileName, line, (uintptr_t)(AZStd::this_thread::get_id().m_id), funcName);
             Output(g_dbgSystemWnd, header);
@@ -315,6 +355,7 @@ namespace AZ
             // Crash the application directly at assert level 3
             if (currentLevel >= assertLevel_crash)
             {
+                FlushAsyncPrintf();
                 AZ_Crash();
             }
         }
@@ -368,6 +409,7 @@ namespace AZ
             return;
         }
 
+        FlushAsyncPrintf();
         Output(window, "\n==================================================================\n");
         azsnprintf(header, g_maxMessageLength, "Trace::Error\n %s(%d): '%s'\n", fileName, line, funcName);
         Output(window, header);
@@ -419,6 +461,7 @@ namespace AZ
             return;
         }
 
+        FlushAsyncPrintf();
         Output(window, "\n==================================================================\n");
         azsnprintf(header, g_maxMessageLength, "Trace::Warning\n %s(%d): '%s'\n", fileName, line, funcName);
         Output(window, header);
@@ -454,6 +497,24 @@ namespace AZ
             logger->RecordStringEvent(PrintfEventId, message);
         }
 
+        if (QueueAsyncPrintf(window, message))
+        {
+            return;
+        }
+
+        PrintfFormatted(window, message);
+    }
+
+    //=========================================================================
+    // PrintfFormatted
+    //=========================================================================
+    void Trace::PrintfFormatted(const char* window, const char* message)
+    {
+        if (!window)
+        {
+            window = g_dbgSystemWnd;
+        }
+
         EBUS_EVENT(TraceMessageDrillerBus, OnPrintf, window, message);
 
         TraceMessageResult result;
@@ -503,6 +564,17 @@ namespace AZ
         fwrite(messageView.data(), 1, messageView.size(), stdout);
     }
 
+    //=========================================================================
+    // SetAsyncLogSink
+    //=========================================================================
+    void Trace::SetAsyncLogSink(AsyncLogSink* sink)
+    {
+        if (AsyncLogSinkSlot* asyncLogSinkSlot = GetAsyncLogSinkSlot(); asyncLogSinkSlot)
+        {
+            asyncLogSinkSlot->Exchange(sink);
+        }
+    }
+
     //=========================================================================
     // PrintCallstack
     // [8/3/2009]
@@ -12,6 +12,8 @@
 
 namespace AZ
 {
+    class AsyncLogSink;
+
     namespace Debug
     {
         /// Global instance to the tracer.
@@ -66,6 +68,15 @@ namespace AZ
 
             static void Output(const char* window, const char* message);
 
+            /// Sends an already formatted Printf message to the trace listeners on the calling thread.
+            static void PrintfFormatted(const char* window, const char* message);
+
+            /// Queues Printf messages in the sink, which passes them on to the trace listeners from its writer thread.
+            /// Asserts, errors and warnings are always written on the calling thread, after the queued messages are flushed.
+            /// Pass null to send messages from the calling thread again. Waits until no thread is queueing messages in the previous
+            /// sink, so it can be destroyed afterwards. The sink is shared by all modules.
+            static void SetAsyncLogSink(AsyncLogSink* sink);
+
             static void PrintCallstack(const char* window, unsigned int suppressCount = 0, void* nativeContext = 0);
 
             /// PEXCEPTION_POINTERS on Windows, always NULL on other platforms
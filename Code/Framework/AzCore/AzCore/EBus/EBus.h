@@ -169,6 +169,15 @@ namespace AZ
          */
         static const bool EnableQueuedReferences = false;
 
+        /**
+         * Specifies whether queued events are stored in pooled memory blocks instead of
+         * allocating a function object for every queued event. Use this for buses that queue
+         * a lot of events every frame, e.g. notifications sent from worker threads.
+         * Queued functions and their arguments can't require an alignment larger than 16 bytes.
+         * Used only when #EnableEventQueue is true.
+         */
+        static const bool EnablePooledEventQueue = false;
+
         /**
          * Locking primitive that is used when adding and removing
          * events from the queue.
@@ -440,7 +449,9 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = AZStd::conditional_t<Traits::EnableEventQueue && Traits::EnablePooledEventQueue,
+            EBusPooledQueuePolicy<ThisType, EventQueueMutexType>,
+            EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -17,6 +17,7 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
@@ -231,6 +232,8 @@ namespace AZ
         void SetActive(bool /*isActive*/) {};
         bool IsActive() { return false; }
         size_t Count() const { return 0; }
+        template <class Function>
+        void Push(Function&& /*call*/) {}
     };
 
     template <class Bus, class MutexType>
@@ -302,6 +305,280 @@ namespace AZ
             AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             return m_messages.size();
         }
+
+        template <class Function>
+        void Push(Function&& call)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Function>(call), typename Bus::AllocatorType()));
+        }
+    };
+
+    namespace Internal
+    {
+        /**
+         * Storage for queued EBus calls that keeps the calls as their concrete types in blocks of memory. Blocks are
+         * kept when the queue is emptied, so once the queue has grown to the number of calls queued per frame, queuing
+         * no longer allocates. Calls are stored back to back in the order they are pushed.
+         */
+        template <class Allocator>
+        class EBusQueuedCallBuffer
+        {
+        public:
+            //! Alignment of every stored call. Calls with a larger alignment requirement can't be stored.
+            static constexpr size_t CallAlignment = 16;
+            //! Default size of the blocks, calls that don't fit get a block of their own size.
+            static constexpr size_t BlockSize = 4096;
+
+            EBusQueuedCallBuffer() = default;
+            EBusQueuedCallBuffer(EBusQueuedCallBuffer&& rhs)
+                : m_blocks(AZStd::move(rhs.m_blocks))
+                , m_currentBlock(rhs.m_currentBlock)
+                , m_count(rhs.m_count)
+            {
+                rhs.m_currentBlock = 0;
+                rhs.m_count = 0;
+            }
+            EBusQueuedCallBuffer& operator=(EBusQueuedCallBuffer&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    Release();
+                    m_blocks = AZStd::move(rhs.m_blocks);
+                    m_currentBlock = rhs.m_currentBlock;
+                    m_count = rhs.m_count;
+                    rhs.m_currentBlock = 0;
+                    rhs.m_count = 0;
+                }
+                return *this;
+            }
+            EBusQueuedCallBuffer(const EBusQueuedCallBuffer&) = delete;
+            EBusQueuedCallBuffer& operator=(const EBusQueuedCallBuffer&) = delete;
+
+            ~EBusQueuedCallBuffer()
+            {
+                Release();
+            }
+
+            template <class Function>
+            void Push(Function&& call)
+            {
+                using CallType = AZStd::decay_t<Function>;
+                static_assert(alignof(CallType) <= CallAlignment, "Queued call requires a larger alignment than the pooled EBus queue supports. "
+                    "Disable EnablePooledEventQueue for this bus.");
+                constexpr size_t recordSize = AZ_SIZE_ALIGN_UP(HeaderSize + sizeof(CallType), CallAlignment);
+
+                AZ::u8* record = Allocate(recordSize);
+                new (record) CallHeader{ &InvokeCall<CallType>, &DestroyCall<CallType>, recordSize };
+                new (record + HeaderSize) CallType(AZStd::forward<Function>(call));
+                ++m_count;
+            }
+
+            //! Calls and destroys all stored calls in the order they were pushed. The memory is kept for reuse.
+            void InvokeAll()
+            {
+                Walk([](const CallHeader& header, void* call) { header.m_invoke(call); });
+            }
+
+            //! Destroys all stored calls without calling them. The memory is kept for reuse.
+            void DestroyAll()
+            {
+                Walk([](const CallHeader& header, void* call) { header.m_destroy(call); });
+            }
+
+            size_t Count() const
+            {
+                return m_count;
+            }
+
+        private:
+            struct CallHeader
+            {
+                //! Calls the stored call and then destroys it.
+                void (*m_invoke)(void*);
+                void (*m_destroy)(void*);
+                size_t m_size;
+            };
+            static constexpr size_t HeaderSize = AZ_SIZE_ALIGN_UP(sizeof(CallHeader), CallAlignment);
+
+            struct Block
+            {
+                AZ::u8* m_data;
+                size_t m_size;
+                size_t m_used;
+            };
+
+            template <class CallType>
+            static void InvokeCall(void* call)
+            {
+                CallType* typedCall = reinterpret_cast<CallType*>(call);
+                (*typedCall)();
+                typedCall->~CallType();
+            }
+
+            template <class CallType>
+            static void DestroyCall(void* call)
+            {
+                reinterpret_cast<CallType*>(call)->~CallType();
+            }
+
+            AZ::u8* Allocate(size_t size)
+            {
+                while (m_currentBlock < m_blocks.size())
+                {
+                    Block& block = m_blocks[m_currentBlock];
+                    if (block.m_used + size <= block.m_size)
+                    {
+                        AZ::u8* result = block.m_data + block.m_used;
+                        block.m_used += size;
+                        return result;
+                    }
+                    if (block.m_used == 0 && m_currentBlock + 1 == m_blocks.size())
+                    {
+                        break;
+                    }
+                    ++m_currentBlock;
+                }
+
+                Block block;
+                block.m_size = AZStd::max(size, BlockSize);
+                block.m_data = reinterpret_cast<AZ::u8*>(Allocator().allocate(block.m_size, CallAlignment));
+                block.m_used = size;
+                if (m_currentBlock < m_blocks.size())
+                {
+                    // The last block was too small for this call, so replace it with a bigger one.
+                    Allocator().deallocate(m_blocks[m_currentBlock].m_data, m_blocks[m_currentBlock].m_size, CallAlignment);
+                    m_blocks[m_currentBlock] = block;
+                }
+                else
+                {
+                    m_blocks.push_back(block);
+                }
+                return block.m_data;
+            }
+
+            template <class Function>
+            void Walk(Function&& function)
+            {
+                const size_t lastBlock = AZStd::min(m_currentBlock + 1, m_blocks.size());
+                for (size_t i = 0; i < lastBlock; ++i)
+                {
+                    Block& block = m_blocks[i];
+                    for (size_t offset = 0; offset < block.m_used;)
+                    {
+                        const CallHeader* header = reinterpret_cast<const CallHeader*>(block.m_data + offset);
+                        function(*header, block.m_data + offset + HeaderSize);
+                        offset += header->m_size;
+                    }
+                    block.m_used = 0;
+                }
+                m_currentBlock = 0;
+                m_count = 0;
+            }
+
+            void Release()
+            {
+                DestroyAll();
+                for (Block& block : m_blocks)
+                {
+                    Allocator().deallocate(block.m_data, block.m_size, CallAlignment);
+                }
+                m_blocks.clear();
+            }
+
+            AZStd::vector<Block, Allocator> m_blocks;
+            size_t m_currentBlock = 0;
+            size_t m_count = 0;
+        };
+    } // namespace Internal
+
+    /**
+     * Event queue used when EBusTraits::EnablePooledEventQueue is set. Instead of wrapping every queued call in an
+     * AZStd::function, the calls are stored with their arguments as their concrete type in pooled memory blocks.
+     * Queuing an event is a copy into memory that was already allocated for a previous frame and executing the queue
+     * walks the blocks in bulk, so in a steady state queuing and executing events doesn't allocate.
+     * All threads queue into the same buffer so events keep the order they were queued in, just like the default queue.
+     */
+    template <class Bus, class MutexType>
+    struct EBusPooledQueuePolicy
+    {
+        // Calls are never stored as this type, but it's used to detect if a bus supports queuing.
+        typedef AZStd::function<void()> BusMessageCall;
+        using CallBuffer = Internal::EBusQueuedCallBuffer<typename Bus::AllocatorType>;
+
+        EBusPooledQueuePolicy() = default;
+
+        bool                        m_isActive = Bus::Traits::EventQueueingActiveByDefault;
+        CallBuffer                  m_messages;             ///< Buffer new calls are queued in.
+        AZStd::vector<CallBuffer, typename Bus::AllocatorType> m_spareBuffers; ///< Emptied buffers that are swapped in while the queue is executing.
+        MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+            while (true)
+            {
+                CallBuffer executing;
+
+                //////////////////////////////////////////////////////////////////////////
+                // Take all queued calls and swap in an empty buffer for new calls, so calls can be queued while executing.
+                {
+                    AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+                    if (m_messages.Count() == 0)
+                    {
+                        break;
+                    }
+                    if (!m_spareBuffers.empty())
+                    {
+                        executing = AZStd::move(m_spareBuffers.back());
+                        m_spareBuffers.pop_back();
+                    }
+                    AZStd::swap(executing, m_messages);
+                }
+                //////////////////////////////////////////////////////////////////////////
+
+                executing.InvokeAll();
+
+                {
+                    AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+                    m_spareBuffers.push_back(AZStd::move(executing));
+                }
+            }
+        }
+
+        void Clear()
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.DestroyAll();
+        }
+
+        void SetActive(bool isActive)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_isActive = isActive;
+            if (!m_isActive)
+            {
+                m_messages.DestroyAll();
+            }
+        };
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            return m_messages.Count();
+        }
+
+        template <class Function>
+        void Push(Function&& call)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.Push(AZStd::forward<Function>(call));
+        }
     };
 
     /// @endcond
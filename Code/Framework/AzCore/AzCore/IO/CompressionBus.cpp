@@ -19,6 +19,7 @@ namespace AZ
         CompressionInfo& CompressionInfo::operator=(CompressionInfo&& rhs)
         {
             m_decompressor = AZStd::move(rhs.m_decompressor);
+            m_blockSplitter = AZStd::move(rhs.m_blockSplitter);
             m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
             m_compressionTag = rhs.m_compressionTag;
             m_offset = rhs.m_offset;
@@ -8,6 +8,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
@@ -30,8 +31,24 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Section of compressed data that can be decompressed independently from the rest of the data.
+        struct CompressionBlock
+        {
+            //! Offset of the block relative to the start of the compressed data.
+            size_t m_compressedOffset = 0;
+            //! Size of the block in the compressed data.
+            size_t m_compressedSize = 0;
+            //! Offset of the block relative to the start of the uncompressed data.
+            size_t m_uncompressedOffset = 0;
+            //! Size of the block after it has been decompressed.
+            size_t m_uncompressedSize = 0;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
+        //! Function that splits compressed data into blocks that can be decompressed independently and in any order. Returns false if the
+        //! data can't be split, in which case the data has to be decompressed as a single unit.
+        using BlockSplitFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, AZStd::vector<CompressionBlock>& blocks)>;
 
         struct CompressionInfo
         {
@@ -46,6 +63,9 @@ namespace AZ
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
             DecompressionFunc m_decompressor;
+            //< Optional function to split the compressed data into blocks. Each block will be passed to m_decompressor individually,
+            //< which allows large files to be decompressed in parallel.
+            BlockSplitFunc m_blockSplitter;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
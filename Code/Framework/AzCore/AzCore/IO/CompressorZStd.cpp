@@ -101,6 +101,7 @@ namespace AZ
 
             zstdData->m_decompressLastOffset = seekPointOffset; // set the start address of the seek points as the last valid read address for the compressed stream.
 
+            zstdData->m_zstd.SetDictionary(m_dictionary.get());
             zstdData->m_zstd.StartDecompressor();
 
             stream->SetCompressorData(zstdData.release());
@@ -393,6 +394,7 @@ namespace AZ
             zstdData->m_autoSeekSize = autoSeekDataSize;
             compressionLevel = AZ::GetClamp(compressionLevel, 1, 9); // remap to zlib levels
 
+            zstdData->m_zstd.SetDictionary(m_dictionary.get());
             zstdData->m_zstd.StartCompressor(compressionLevel);
 
             stream->SetCompressorData(zstdData);
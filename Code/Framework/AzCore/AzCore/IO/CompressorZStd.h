@@ -104,6 +104,11 @@ namespace AZ
             /// Called just before we close the stream. All compression data will be flushed and finalized. (You can't add data afterwards).
             bool Close(CompressorStream* stream) override;
 
+            /// Set a trained dictionary that's used by all streams that are opened afterwards. Small streams compress considerably better
+            /// with a dictionary, but the same dictionary has to be set to decompress the data again.
+            void SetDictionary(AZStd::shared_ptr<const ZStdDictionary> dictionary) { m_dictionary = AZStd::move(dictionary); }
+            const AZStd::shared_ptr<const ZStdDictionary>& GetDictionary() const { return m_dictionary; }
+
         protected:
 
             /// Read as much data as possible and adjust the parameters.
@@ -124,6 +129,7 @@ namespace AZ
             unsigned int        m_compressedDataBufferSize;                   ///< Data buffer size (stored so we can lazy allocate m_dataBuffer as we need).
             unsigned int        m_compressedDataBufferUseCount = 0;           ///< Data buffer use count.
             unsigned int        m_decompressionCachePerStream;      ///< Cache per stream for each compressed stream stream in bytes.
+            AZStd::shared_ptr<const ZStdDictionary> m_dictionary;   ///< Optional dictionary used by all streams.
         };
     }   // namespace IO
 }   // namespace AZ
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    namespace Platform
+    {
+        // Forward declaration of platform specific implementations.
+        bool Map(const char* filePath, MemoryMappedFile::NativeHandles& handles, const u8*& data, u64& size);
+        void Unmap(MemoryMappedFile::NativeHandles& handles, const u8* data, u64 size);
+        void Prefetch(const u8* address, u64 size);
+        void Discard(const u8* address, u64 size);
+    } // namespace Platform
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs)
+        : m_filePath(AZStd::move(rhs.m_filePath))
+        , m_handles(rhs.m_handles)
+        , m_data(rhs.m_data)
+        , m_size(rhs.m_size)
+    {
+        rhs.m_handles = NativeHandles{};
+        rhs.m_data = nullptr;
+        rhs.m_size = 0;
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Close();
+
+            m_filePath = AZStd::move(rhs.m_filePath);
+            m_handles = rhs.m_handles;
+            m_data = rhs.m_data;
+            m_size = rhs.m_size;
+
+            rhs.m_handles = NativeHandles{};
+            rhs.m_data = nullptr;
+            rhs.m_size = 0;
+        }
+        return *this;
+    }
+
+    bool MemoryMappedFile::Open(const char* filePath)
+    {
+        Close();
+
+        if (!filePath || filePath[0] == 0)
+        {
+            return false;
+        }
+
+        if (Platform::Map(filePath, m_handles, m_data, m_size))
+        {
+            m_filePath = filePath;
+            return true;
+        }
+
+        m_handles = NativeHandles{};
+        m_data = nullptr;
+        m_size = 0;
+        return false;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_data)
+        {
+            Platform::Unmap(m_handles, m_data, m_size);
+            m_handles = NativeHandles{};
+            m_data = nullptr;
+            m_size = 0;
+            m_filePath.clear();
+        }
+    }
+
+    bool MemoryMappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    const u8* MemoryMappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    u64 MemoryMappedFile::GetSize() const
+    {
+        return m_size;
+    }
+
+    const AZStd::string& MemoryMappedFile::GetFilePath() const
+    {
+        return m_filePath;
+    }
+
+    bool MemoryMappedFile::Contains(u64 offset, u64 size) const
+    {
+        return m_data && offset <= m_size && size <= m_size - offset;
+    }
+
+    void MemoryMappedFile::Prefetch(u64 offset, u64 size) const
+    {
+        if (Contains(offset, size) && size > 0)
+        {
+            Platform::Prefetch(m_data + offset, size);
+        }
+    }
+
+    void MemoryMappedFile::Discard(u64 offset, u64 size) const
+    {
+        if (Contains(offset, size) && size > 0)
+        {
+            Platform::Discard(m_data + offset, size);
+        }
+    }
+} // namespace AZ::IO
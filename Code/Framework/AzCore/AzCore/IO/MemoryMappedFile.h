@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    //! Read-only view of an entire file that's mapped into the address space of the process.
+    //! Data is paged in by the OS on first access, so reading from the mapping avoids a system call
+    //! and an intermediate copy per read. The mapping stays valid until Close is called or the
+    //! object is destroyed, so any pointer retrieved through GetData must not outlive the object.
+    class MemoryMappedFile
+    {
+    public:
+        //! Opaque handles that the platform implementation needs to keep around for the lifetime of the mapping.
+        struct NativeHandles
+        {
+            intptr_t m_file{ -1 };
+            intptr_t m_mapping{ -1 };
+        };
+
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& rhs);
+        MemoryMappedFile& operator=(MemoryMappedFile&& rhs);
+
+        //! Maps the file at the given absolute path for reading. If a file was already mapped, it will be closed first.
+        //! @return True if the file was successfully mapped, otherwise false. Zero sized files can't be mapped.
+        bool Open(const char* filePath);
+        //! Unmaps the file. Does nothing if no file is mapped.
+        void Close();
+        bool IsOpen() const;
+
+        //! Returns the start of the mapped file or null if no file is mapped.
+        const u8* GetData() const;
+        //! Returns the size of the mapped file in bytes.
+        u64 GetSize() const;
+        //! Returns the path of the mapped file. This is empty if no file is mapped.
+        const AZStd::string& GetFilePath() const;
+
+        //! Returns true if the range [offset, offset + size) is entirely inside the mapped file.
+        bool Contains(u64 offset, u64 size) const;
+
+        //! Hints the OS that the provided range will be accessed soon so it can start paging it in asynchronously.
+        //! This is only a hint and may be ignored on platforms that don't support it.
+        void Prefetch(u64 offset, u64 size) const;
+        //! Hints the OS that the provided range is no longer needed so the backing pages can be reclaimed first.
+        //! The mapping remains valid and the data will be paged in again if it's accessed.
+        void Discard(u64 offset, u64 size) const;
+
+    private:
+        AZStd::string m_filePath;
+        NativeHandles m_handles;
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompression.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        bool DecompressBlocks(bool& success, u32& numBlocks, JobContext* blockJobContext, u32 maxNumBlockJobs, const u8* compressed,
+            FileRequest::CompressedReadData& request)
+        {
+            const CompressionInfo& compressionInfo = request.m_compressionInfo;
+            if (maxNumBlockJobs == 0 || !compressionInfo.m_blockSplitter)
+            {
+                return false;
+            }
+
+            Job* currentJob = blockJobContext->GetJobManager().GetCurrentJob();
+            if (!currentJob)
+            {
+                return false;
+            }
+
+            AZStd::vector<CompressionBlock> blocks;
+            if (!compressionInfo.m_blockSplitter(compressionInfo, compressed, compressionInfo.m_compressedSize, blocks) || blocks.size() < 2)
+            {
+                return false;
+            }
+
+            // Only the blocks that overlap with the requested range need to be decompressed.
+            const size_t readStart = aznumeric_caster(request.m_readOffset);
+            const size_t readEnd = readStart + aznumeric_cast<size_t>(request.m_readSize);
+            auto firstBlock = AZStd::find_if(blocks.begin(), blocks.end(),
+                [readStart](const CompressionBlock& block) { return block.m_uncompressedOffset + block.m_uncompressedSize > readStart; });
+            auto lastBlock = AZStd::find_if(firstBlock, blocks.end(),
+                [readEnd](const CompressionBlock& block) { return block.m_uncompressedOffset >= readEnd; });
+            size_t numOverlappingBlocks = AZStd::distance(firstBlock, lastBlock);
+            if (numOverlappingBlocks == 0)
+            {
+                return false;
+            }
+            numBlocks = aznumeric_caster(numOverlappingBlocks);
+
+            AZStd::atomic_bool allSucceeded{ true };
+            auto decompressBlocks = [&compressionInfo, &request, &allSucceeded, compressed, readStart, readEnd]
+                (const CompressionBlock* begin, const CompressionBlock* end)
+            {
+                u8* output = reinterpret_cast<u8*>(request.m_output);
+                for (const CompressionBlock* block = begin; block != end && allSucceeded; ++block)
+                {
+                    const u8* blockData = compressed + block->m_compressedOffset;
+                    size_t blockStart = block->m_uncompressedOffset;
+                    size_t blockEnd = blockStart + block->m_uncompressedSize;
+                    bool result;
+                    if (blockStart >= readStart && blockEnd <= readEnd)
+                    {
+                        result = compressionInfo.m_decompressor(compressionInfo, blockData, block->m_compressedSize,
+                            output + (blockStart - readStart), block->m_uncompressedSize);
+                    }
+                    else
+                    {
+                        // The block only partially overlaps with the requested range so decompress to a temporary buffer.
+                        AZStd::unique_ptr<u8[]> blockBuffer = AZStd::unique_ptr<u8[]>(new u8[block->m_uncompressedSize]);
+                        result = compressionInfo.m_decompressor(compressionInfo, blockData, block->m_compressedSize,
+                            blockBuffer.get(), block->m_uncompressedSize);
+                        if (result)
+                        {
+                            size_t copyStart = AZStd::max(blockStart, readStart);
+                            size_t copyEnd = AZStd::min(blockEnd, readEnd);
+                            memcpy(output + (copyStart - readStart), blockBuffer.get() + (copyStart - blockStart), copyEnd - copyStart);
+                        }
+                    }
+                    if (!result)
+                    {
+                        allSucceeded = false;
+                    }
+                }
+            };
+
+            // Divide the blocks into evenly sized groups, one per job. The last group is decompressed on the current job.
+            size_t numJobs = AZStd::min(numOverlappingBlocks, size_t(maxNumBlockJobs) + 1);
+            const CompressionBlock* groupBegin = blocks.data() + AZStd::distance(blocks.begin(), firstBlock);
+            for (size_t i = 0; i < numJobs - 1; ++i)
+            {
+                const CompressionBlock* groupEnd = groupBegin + (numOverlappingBlocks / numJobs) + (i < (numOverlappingBlocks % numJobs) ? 1 : 0);
+                auto blockJob = [&decompressBlocks, groupBegin, groupEnd]()
+                {
+                    decompressBlocks(groupBegin, groupEnd);
+                };
+                currentJob->StartAsChild(AZ::CreateJobFunction(blockJob, true, blockJobContext));
+                groupBegin = groupEnd;
+            }
+            decompressBlocks(groupBegin, blocks.data() + AZStd::distance(blocks.begin(), lastBlock));
+            currentJob->WaitForChildren();
+
+            success = allSucceeded;
+            return true;
+        }
+    } // namespace IO
+} // namespace AZ
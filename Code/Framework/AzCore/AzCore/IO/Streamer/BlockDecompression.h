@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+
+namespace AZ
+{
+    class JobContext;
+
+    namespace IO
+    {
+        //! Splits the compressed data of a request into independent blocks using the request's block splitter and decompresses the
+        //! blocks that overlap with the requested range. The blocks are spread over the job that calls this function and up to
+        //! maxNumBlockJobs child jobs created in blockJobContext, so this has to be called from a job in blockJobContext.
+        //! Only the requested range is written to the output of the request, so partial reads don't need a buffer for the entire file.
+        //! @param success Set to true if all blocks were decompressed, false if any of them failed.
+        //! @param numBlocks Set to the number of blocks that were decompressed.
+        //! @param blockJobContext The job context the calling job runs in and child jobs will be created in.
+        //! @param maxNumBlockJobs The maximum number of additional jobs to create. If zero the data is not split.
+        //! @param compressed Pointer to the start of the compressed data of the request.
+        //! @param request The request to decompress.
+        //! @return False if the data can't be split, in which case it has to be decompressed as a whole, otherwise true.
+        bool DecompressBlocks(bool& success, u32& numBlocks, JobContext* blockJobContext, u32 maxNumBlockJobs, const u8* compressed,
+            FileRequest::CompressedReadData& request);
+    } // namespace IO
+} // namespace AZ
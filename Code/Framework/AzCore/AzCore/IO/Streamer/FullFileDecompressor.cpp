@@ -7,6 +7,7 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompression.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
@@ -27,7 +28,7 @@ namespace AZ
             const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
         {
             auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_maxNumBlockJobs);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -39,7 +40,8 @@ namespace AZ
                 serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
                     ->Version(1)
                     ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                    ->Field("MaxNumBlockJobs", &FullFileDecompressorConfig::m_maxNumBlockJobs);
             }
         }
 
@@ -51,14 +53,16 @@ namespace AZ
             return !!m_compressedData;
         }
         
-        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumBlockJobs)
             : StreamStackEntry("Full file decompressor")
             , m_maxNumReads(maxNumReads)
             , m_maxNumJobs(maxNumJobs)
+            , m_maxNumBlockJobs(maxNumBlockJobs)
             , m_alignment(alignment)
         {
             JobManagerDesc jobDesc;
-            u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
+            // Block jobs run on the same job manager as the decompression jobs, so reserve additional threads for them.
+            u32 numThreads = AZ::GetMin(maxNumJobs + maxNumBlockJobs, AZStd::thread::hardware_concurrency());
             for (u32 i = 0; i < numThreads; ++i)
             {
                 jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
@@ -79,6 +83,7 @@ namespace AZ
             // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
             m_bytesDecompressed.PushEntry(1);
             m_decompressionDurationMicroSec.PushEntry(1);
+            m_blocksPerDecompression.PushEntry(0);
         }
 
         void FullFileDecompressor::PrepareRequest(FileRequest* request)
@@ -320,6 +325,7 @@ namespace AZ
                 double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
                 double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
                 statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Blocks per decompression (avg.)", m_blocksPerDecompression.CalculateAverage()));
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 statistics.push_back(Statistic::CreatePercentage(m_name, DecompBoundName, m_decompressionBoundStat.GetAverage()));
@@ -603,6 +609,7 @@ namespace AZ
                     info.m_waitRequest = waitRequest;
                     info.m_queueStartTime = AZStd::chrono::high_resolution_clock::now();
                     info.m_jobStartTime = info.m_queueStartTime; // Set these to the same in case the scheduler requests an update before the job has started.
+                    info.m_numBlocks = 0;
                     info.m_compressedData = m_readBuffers[readSlot]; // Transfer ownership of the pointer.
                     m_readBuffers[readSlot] = nullptr;
 
@@ -618,7 +625,7 @@ namespace AZ
                     {
                         auto job = [this, &info]()
                         {
-                            FullDecompression(m_context, info);
+                            FullDecompression(m_context, m_decompressionjobContext.get(), m_maxNumBlockJobs, info);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
@@ -627,7 +634,7 @@ namespace AZ
                         m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
                         auto job = [this, &info]()
                         {
-                            PartialDecompression(m_context, info);
+                            PartialDecompression(m_context, m_decompressionjobContext.get(), m_maxNumBlockJobs, info);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
@@ -677,6 +684,7 @@ namespace AZ
             m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 endTime - jobInfo.m_jobStartTime).count());
             m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+            m_blocksPerDecompression.PushEntry(jobInfo.m_numBlocks);
 
             AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
             jobInfo.m_compressedData = nullptr;
@@ -685,7 +693,8 @@ namespace AZ
             return;
         }
 
-        void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
+        void FullFileDecompressor::FullDecompression(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs,
+            DecompressionInformation& info)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -701,16 +710,22 @@ namespace AZ
             AZ_Assert(compressionInfo.m_uncompressedSize == request->m_readSize,
                 "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
                 request->m_readSize, compressionInfo.m_uncompressedSize);
-            
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+
+            bool success = false;
+            if (!DecompressBlocks(success, info.m_numBlocks, blockJobContext, maxNumBlockJobs,
+                info.m_compressedData + info.m_alignmentOffset, *request))
+            {
+                success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+                    compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+            }
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
 
-        void FullFileDecompressor::PartialDecompression(StreamerContext* context, DecompressionInformation& info)
+        void FullFileDecompressor::PartialDecompression(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs,
+            DecompressionInformation& info)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -721,12 +736,21 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+            // Block decompression only decompresses the blocks that overlap with the requested range, so there's no need for a
+            // buffer that fits the entire file.
+            bool success = false;
+            if (!DecompressBlocks(success, info.m_numBlocks, blockJobContext, maxNumBlockJobs,
+                info.m_compressedData + info.m_alignmentOffset, *request))
+            {
+                AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
+                success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+                    compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+                if (success)
+                {
+                    memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+                }
+            }
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
-            
-            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
 
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
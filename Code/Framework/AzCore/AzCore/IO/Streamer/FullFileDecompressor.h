@@ -37,6 +37,9 @@ namespace AZ
             u32 m_maxNumReads{ 2 };
             //! Maximum number of decompression jobs that can run simultaneously.
             u32 m_maxNumJobs{ 2 };
+            //! Maximum number of additional jobs each decompression job can use to decompress blocks in parallel. This only
+            //! applies to compressed data that's stored as independent blocks. Set to zero to always decompress on a single job.
+            u32 m_maxNumBlockJobs{ 4 };
         };
 
         //! Entry in the streaming stack that decompresses files from an archive that are stored
@@ -48,11 +51,14 @@ namespace AZ
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
         //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
         //! the main job system from working.
+        //! If the compressed data is stored as independent blocks, the blocks are spread over multiple
+        //! jobs so large files can be decompressed on multiple cores. Partial reads in this case only
+        //! decompress the blocks that overlap with the requested range.
         class FullFileDecompressor
             : public StreamStackEntry
         {
         public:
-            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 maxNumBlockJobs = 0);
             ~FullFileDecompressor() override = default;
 
             void PrepareRequest(FileRequest* request) override;
@@ -84,6 +90,7 @@ namespace AZ
                 Buffer m_compressedData{ nullptr };
                 FileRequest* m_waitRequest{ nullptr };
                 u32 m_alignmentOffset{ 0 };
+                u32 m_numBlocks{ 0 }; //!< Number of blocks the data was decompressed in or 0 if decompressed as a whole.
             };
 
             bool IsIdle() const;
@@ -100,8 +107,10 @@ namespace AZ
             bool StartDecompressions();
             void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
             
-            static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
-            static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+            static void FullDecompression(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs,
+                DecompressionInformation& info);
+            static void PartialDecompression(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs,
+                DecompressionInformation& info);
 
             AZStd::deque<FileRequest*> m_pendingReads;
             AZStd::deque<FileRequest*> m_pendingFileExistChecks;
@@ -109,6 +118,7 @@ namespace AZ
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionJobDelayMicroSec;
             AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
             AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+            AverageWindow<u32, double, s_statisticsWindowSize> m_blocksPerDecompression;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
             AZ::Statistics::RunningStatistic m_decompressionBoundStat;
             AZ::Statistics::RunningStatistic m_readBoundStat;
@@ -129,6 +139,7 @@ namespace AZ
             u32 m_numPendingDecompression{ 0 };
             u32 m_maxNumJobs{ 1 };
             u32 m_numRunningJobs{ 0 };
+            u32 m_maxNumBlockJobs{ 0 };
             u32 m_alignment{ 0 };
         };
     } // namespace IO
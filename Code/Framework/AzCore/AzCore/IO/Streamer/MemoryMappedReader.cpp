@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompression.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> MemoryMappedReaderConfig::AddStreamStackEntry(
+            [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<MemoryMappedReader>(
+                m_extensions, m_maxMappedFiles, m_maxNumJobs, AZStd::chrono::milliseconds(m_prefetchWindowMs), m_maxNumBlockJobs);
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void MemoryMappedReaderConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<MemoryMappedReaderConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("Extensions", &MemoryMappedReaderConfig::m_extensions)
+                    ->Field("MaxMappedFiles", &MemoryMappedReaderConfig::m_maxMappedFiles)
+                    ->Field("MaxNumJobs", &MemoryMappedReaderConfig::m_maxNumJobs)
+                    ->Field("MaxNumBlockJobs", &MemoryMappedReaderConfig::m_maxNumBlockJobs)
+                    ->Field("PrefetchWindowMs", &MemoryMappedReaderConfig::m_prefetchWindowMs);
+            }
+        }
+
+        MemoryMappedReader::MemoryMappedReader(AZStd::vector<AZStd::string> extensions, u32 maxMappedFiles, u32 maxNumJobs,
+            AZStd::chrono::milliseconds prefetchWindow, u32 maxNumBlockJobs)
+            : StreamStackEntry("Memory mapped reader")
+            , m_extensions(AZStd::move(extensions))
+            , m_prefetchWindow(prefetchWindow)
+            , m_maxNumJobs(AZ::GetMax(maxNumJobs, 1u))
+            , m_maxNumBlockJobs(maxNumBlockJobs)
+        {
+            u32 numMappedFiles = AZ::GetMax(maxMappedFiles, 1u);
+            m_fileLastUsed.resize(numMappedFiles, AZStd::chrono::system_clock::time_point::min());
+            m_filePaths.resize(numMappedFiles);
+            m_mappedFiles.resize(numMappedFiles);
+
+            JobManagerDesc jobDesc;
+            // Block jobs run on the same job manager as the decompression jobs, so reserve additional threads for them.
+            u32 numThreads = AZ::GetMin(m_maxNumJobs + m_maxNumBlockJobs, AZStd::thread::hardware_concurrency());
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+            m_decompressionJobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
+
+            // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+            m_copySizeAverage.PushEntry(1);
+            m_copyTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+            m_bytesDecompressed.PushEntry(1);
+            m_decompressionDurationMicroSec.PushEntry(1);
+        }
+
+        void MemoryMappedReader::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                {
+                    if (TryQueueRead(request, args.m_path, args.m_offset, args.m_size))
+                    {
+                        return;
+                    }
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+                {
+                    const CompressionInfo& info = args.m_compressionInfo;
+                    if (TryQueueRead(request, info.m_archiveFilename, info.m_offset, info.m_compressedSize))
+                    {
+                        return;
+                    }
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+                {
+                    // Cancel the requests in this entry and let the rest of the stack do the same.
+                    CancelRequest(request, args.m_target);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }, request->GetCommand());
+        }
+
+        bool MemoryMappedReader::ExecuteRequests()
+        {
+            bool result = false;
+            while (!m_pendingRequests.empty())
+            {
+                PendingRequest& pending = m_pendingRequests.front();
+                auto compressedRead = AZStd::get_if<FileRequest::CompressedReadData>(&pending.m_request->GetCommand());
+                if (compressedRead && compressedRead->m_compressionInfo.m_isCompressed)
+                {
+                    if (m_numRunningJobs >= m_maxNumJobs)
+                    {
+                        break;
+                    }
+                    // Decompression runs on a job, so keep queuing jobs until all slots are taken.
+                    StartDecompression(pending);
+                    m_pendingRequests.pop_front();
+                    result = true;
+                }
+                else
+                {
+                    // Copies are done inline, so only process one per call to give other entries in the stack a turn.
+                    ReadFromMapping(pending);
+                    m_pendingRequests.pop_front();
+                    result = true;
+                    break;
+                }
+            }
+            return StreamStackEntry::ExecuteRequests() || result;
+        }
+
+        void MemoryMappedReader::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            status.m_isIdle = status.m_isIdle && IsIdle();
+        }
+
+        void MemoryMappedReader::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+            AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+            StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            double totalBytesCopied = aznumeric_caster(m_copySizeAverage.GetTotal());
+            double totalCopyTimeUs = aznumeric_caster(m_copyTimeAverage.GetTotal().count());
+            double totalBytesDecompressed = aznumeric_caster(m_bytesDecompressed.GetTotal());
+            double totalDecompressionTimeUs = aznumeric_caster(m_decompressionDurationMicroSec.GetTotal());
+
+            // Requests in this entry are processed in order, so each request has to wait for the ones in front of it.
+            // This is also a good moment to let the OS know which data is going to be needed soon.
+            AZStd::chrono::system_clock::time_point startTime = now;
+            for (PendingRequest& pending : m_pendingRequests)
+            {
+                PrefetchIfDue(pending, now);
+
+                auto compressedRead = AZStd::get_if<FileRequest::CompressedReadData>(&pending.m_request->GetCommand());
+                if (compressedRead && compressedRead->m_compressionInfo.m_isCompressed)
+                {
+                    startTime += AZStd::chrono::microseconds(
+                        aznumeric_cast<u64>((pending.m_size * totalDecompressionTimeUs) / totalBytesDecompressed));
+                }
+                else
+                {
+                    startTime += AZStd::chrono::microseconds(
+                        aznumeric_cast<u64>((pending.m_size * totalCopyTimeUs) / totalBytesCopied));
+                }
+                pending.m_request->SetEstimatedCompletion(startTime);
+            }
+        }
+
+        void MemoryMappedReader::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            if (m_mapTimeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateFloat(m_name, "Mapped memory (MB)", m_mappedBytes * bytesToMB));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Map file (avg. us)", m_mapTimeAverage.CalculateAverage().count()));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Prefetches", aznumeric_caster(m_numPrefetches)));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Pending requests", aznumeric_caster(m_pendingRequests.size())));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Available decompression slots", m_maxNumJobs - m_numRunningJobs));
+
+                double totalBytesCopiedMB = m_copySizeAverage.GetTotal() * bytesToMB;
+                double totalCopyTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_copyTimeAverage.GetTotal()).count();
+                statistics.push_back(Statistic::CreateFloat(m_name, "Copy Speed (avg. mbps)", totalBytesCopiedMB / totalCopyTimeSec));
+
+                if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+                {
+                    double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
+                    double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+                    statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)",
+                        totalBytesDecompressedMB / totalDecompressionTimeSec));
+                }
+            }
+
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        bool MemoryMappedReader::IsIdle() const
+        {
+            return m_pendingRequests.empty() && m_numRunningJobs == 0;
+        }
+
+        bool MemoryMappedReader::IsMappable(const RequestPath& path) const
+        {
+            if (!path.IsValid())
+            {
+                return false;
+            }
+
+            AZStd::string_view filePath = path.GetAbsolutePath();
+            for (const AZStd::string& extension : m_extensions)
+            {
+                if (filePath.size() >= extension.size() &&
+                    azstrnicmp(filePath.data() + filePath.size() - extension.size(), extension.c_str(), extension.size()) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        auto MemoryMappedReader::FindOrMapFile(const RequestPath& path) -> MappedFilePtr
+        {
+            size_t cacheIndex = FindFileInCache(path);
+            if (cacheIndex != s_fileNotFound)
+            {
+                m_fileLastUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+                return m_mappedFiles[cacheIndex];
+            }
+
+            // Eject the mapping that hasn't been used for the longest time. Any running decompression job will keep the
+            // mapping alive until it's done with it.
+            AZStd::chrono::system_clock::time_point oldest = m_fileLastUsed[0];
+            cacheIndex = 0;
+            size_t numFiles = m_filePaths.size();
+            for (size_t i = 1; i < numFiles; ++i)
+            {
+                if (m_fileLastUsed[i] < oldest)
+                {
+                    oldest = m_fileLastUsed[i];
+                    cacheIndex = i;
+                }
+            }
+
+            TIMED_AVERAGE_WINDOW_SCOPE(m_mapTimeAverage);
+            auto file = AZStd::make_shared<MemoryMappedFile>();
+            if (!file->Open(path.GetAbsolutePath()))
+            {
+                return nullptr;
+            }
+
+            if (m_mappedFiles[cacheIndex])
+            {
+                m_mappedBytes -= m_mappedFiles[cacheIndex]->GetSize();
+            }
+            m_mappedBytes += file->GetSize();
+
+            m_fileLastUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+            m_filePaths[cacheIndex] = path;
+            m_mappedFiles[cacheIndex] = file;
+            return file;
+        }
+
+        size_t MemoryMappedReader::FindFileInCache(const RequestPath& path) const
+        {
+            size_t numFiles = m_filePaths.size();
+            for (size_t i = 0; i < numFiles; ++i)
+            {
+                if (m_mappedFiles[i] && m_filePaths[i] == path)
+                {
+                    return i;
+                }
+            }
+            return s_fileNotFound;
+        }
+
+        bool MemoryMappedReader::TryQueueRead(FileRequest* request, const RequestPath& path, u64 offset, u64 size)
+        {
+            if (!IsMappable(path))
+            {
+                return false;
+            }
+
+            MappedFilePtr file = FindOrMapFile(path);
+            if (!file || !file->Contains(offset, size))
+            {
+                // Let the next entry deal with files that can't be mapped or reads that go outside the file.
+                return false;
+            }
+
+            PendingRequest pending;
+            pending.m_request = request;
+            pending.m_file = AZStd::move(file);
+            pending.m_offset = offset;
+            pending.m_size = size;
+            PrefetchIfDue(pending, AZStd::chrono::system_clock::now());
+            m_pendingRequests.push_back(AZStd::move(pending));
+            return true;
+        }
+
+        void MemoryMappedReader::PrefetchIfDue(PendingRequest& pending, AZStd::chrono::system_clock::time_point now)
+        {
+            if (pending.m_prefetched || m_prefetchWindow.count() == 0)
+            {
+                return;
+            }
+
+            const FileRequest::ReadRequestData* readRequest = pending.m_request->GetCommandFromChain<FileRequest::ReadRequestData>();
+            if (readRequest && readRequest->m_deadline != FileRequest::s_noDeadlineTime && readRequest->m_deadline - now <= m_prefetchWindow)
+            {
+                pending.m_file->Prefetch(pending.m_offset, pending.m_size);
+                pending.m_prefetched = true;
+                m_numPrefetches++;
+            }
+        }
+
+        void MemoryMappedReader::ReadFromMapping(PendingRequest& pending)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            FileRequest* request = pending.m_request;
+            const u8* source = pending.m_file->GetData() + pending.m_offset;
+            bool success = true;
+            {
+                TIMED_AVERAGE_WINDOW_SCOPE(m_copyTimeAverage);
+                AZStd::visit([source, &success](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                    {
+                        memcpy(args.m_output, source, args.m_size);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+                    {
+                        // Uncompressed data stored in an archive, so the data can be copied directly.
+                        if (args.m_readOffset + args.m_readSize <= args.m_compressionInfo.m_uncompressedSize)
+                        {
+                            memcpy(args.m_output, source + args.m_readOffset, args.m_readSize);
+                        }
+                        else
+                        {
+                            success = false;
+                        }
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "Unexpected request queued in the MemoryMappedReader.");
+                        success = false;
+                    }
+                }, request->GetCommand());
+            }
+            m_copySizeAverage.PushEntry(pending.m_size);
+
+            request->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void MemoryMappedReader::StartDecompression(PendingRequest& pending)
+        {
+            FileRequest* compressedRequest = pending.m_request;
+            [[maybe_unused]] auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Request queued for decompression in the MemoryMappedReader didn't contain compression read data.");
+            AZ_Assert(data->m_compressionInfo.m_decompressor, "MemoryMappedReader is queuing a decompression job but couldn't find a decompressor.");
+
+            // Add a wait so the compressed request isn't completed until the job has finished decompressing. The job will
+            // complete the wait, which in turn triggers the callback on the main Streamer thread.
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(compressedRequest);
+            waitRequest->SetCompletionCallback(
+                [this, startTime = AZStd::chrono::system_clock::now(), compressedSize = pending.m_size](FileRequest&)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    FinishDecompression(startTime, compressedSize);
+                });
+
+            auto job = [context = m_context, blockJobContext = m_decompressionJobContext.get(), maxNumBlockJobs = m_maxNumBlockJobs,
+                waitRequest, file = pending.m_file]()
+            {
+                Decompress(context, blockJobContext, maxNumBlockJobs, waitRequest, file);
+            };
+            ++m_numRunningJobs;
+            AZ::CreateJobFunction(job, true, m_decompressionJobContext.get())->Start();
+        }
+
+        void MemoryMappedReader::FinishDecompression(AZStd::chrono::system_clock::time_point startTime, u64 compressedSize)
+        {
+            m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - startTime).count());
+            m_bytesDecompressed.PushEntry(compressedSize);
+
+            AZ_Assert(m_numRunningJobs > 0, "About to complete a decompression job, but the internal count doesn't see a running job.");
+            --m_numRunningJobs;
+        }
+
+        void MemoryMappedReader::Decompress(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs,
+            FileRequest* waitRequest, const MappedFilePtr& file)
+        {
+            FileRequest* compressedRequest = waitRequest->GetParent();
+            AZ_Assert(compressedRequest, "A wait request attached to MemoryMappedReader didn't have a parent compressed request.");
+            auto request = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(request, "Compressed request in MemoryMappedReader that's running decompression didn't contain compression read data.");
+            const CompressionInfo& info = request->m_compressionInfo;
+
+            const u8* compressed = file->GetData() + info.m_offset;
+            bool success = false;
+            u32 numBlocks = 0;
+            // Independent blocks are decompressed straight into the output on multiple jobs. Partial reads only decompress the blocks
+            // that overlap with the requested range.
+            if (!DecompressBlocks(success, numBlocks, blockJobContext, maxNumBlockJobs, compressed, *request))
+            {
+                if (request->m_readOffset == 0 && request->m_readSize == info.m_uncompressedSize)
+                {
+                    success = info.m_decompressor(info, compressed, info.m_compressedSize, request->m_output, info.m_uncompressedSize);
+                }
+                else
+                {
+                    AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[info.m_uncompressedSize]);
+                    success = info.m_decompressor(info, compressed, info.m_compressedSize, decompressionBuffer.get(), info.m_uncompressedSize);
+                    if (success)
+                    {
+                        memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+                    }
+                }
+            }
+
+            waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            context->MarkRequestAsCompleted(waitRequest);
+            context->WakeUpSchedulingThread();
+        }
+
+        void MemoryMappedReader::CancelRequest([[maybe_unused]] FileRequest* cancelRequest, FileRequestPtr& target)
+        {
+            for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
+            {
+                if (it->m_request->WorksOn(target))
+                {
+                    it->m_request->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                    m_context->MarkRequestAsCompleted(it->m_request);
+                    it = m_pendingRequests.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void MemoryMappedReader::FlushCache(const RequestPath& filePath)
+        {
+            size_t cacheIndex = FindFileInCache(filePath);
+            if (cacheIndex != s_fileNotFound)
+            {
+                m_mappedBytes -= m_mappedFiles[cacheIndex]->GetSize();
+                m_fileLastUsed[cacheIndex] = AZStd::chrono::system_clock::time_point::min();
+                m_mappedFiles[cacheIndex].reset();
+                m_filePaths[cacheIndex].Clear();
+            }
+        }
+
+        void MemoryMappedReader::FlushEntireCache()
+        {
+            size_t numFiles = m_filePaths.size();
+            for (size_t i = 0; i < numFiles; ++i)
+            {
+                m_fileLastUsed[i] = AZStd::chrono::system_clock::time_point::min();
+                m_mappedFiles[i].reset();
+                m_filePaths[i].Clear();
+            }
+            m_mappedBytes = 0;
+        }
+
+        void MemoryMappedReader::Report(const FileRequest::ReportData& data) const
+        {
+            switch (data.m_reportType)
+            {
+            case FileRequest::ReportData::ReportType::FileLocks:
+                for (size_t i = 0; i < m_mappedFiles.size(); ++i)
+                {
+                    if (m_mappedFiles[i])
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_filePaths[i].GetRelativePath());
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct MemoryMappedReaderConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::MemoryMappedReaderConfig, "{0C5D8A1F-5E4B-4D0F-9E07-8F3C2B6A91D4}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(MemoryMappedReaderConfig, AZ::SystemAllocator, 0);
+
+            ~MemoryMappedReaderConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! File extensions of the archives that will be memory mapped. Reads from any other file are forwarded.
+            AZStd::vector<AZStd::string> m_extensions{ ".pak" };
+            //! Maximum number of archives that are kept mapped at the same time.
+            u32 m_maxMappedFiles{ 32 };
+            //! Maximum number of decompression jobs that can run simultaneously.
+            u32 m_maxNumJobs{ 2 };
+            //! Maximum number of additional jobs each decompression job can use to decompress blocks in parallel. This only
+            //! applies to compressed data that's stored as independent blocks. Set to zero to always decompress on a single job.
+            u32 m_maxNumBlockJobs{ 4 };
+            //! Requests with a deadline that's closer than this number of milliseconds will have their data prefetched
+            //! by the OS as soon as they're queued. Set to zero to disable prefetching.
+            u32 m_prefetchWindowMs{ 100 };
+        };
+
+        //! Entry in the streaming stack that serves reads from archives by memory mapping the archive once
+        //! and reading directly from the mapping. Uncompressed entries are copied straight from the mapped
+        //! pages to the output buffer, which avoids a system call per request. Compressed entries are
+        //! decompressed straight from the mapping on a dedicated job, which avoids reading the compressed
+        //! data into an intermediate buffer. Requests that will be needed soon have their pages prefetched
+        //! so the OS can page them in while the request waits to be processed.
+        //! If the compressed data is stored as independent blocks, the blocks are spread over multiple jobs
+        //! and partial reads only decompress the blocks that overlap with the requested range.
+        //! This entry should be placed above the FullFileDecompressor so it can pick up compressed reads
+        //! before they're handled by the decompressor. It's not part of the default streaming stacks, projects
+        //! that want to use it have to add a MemoryMappedReaderConfig to their stack.
+        class MemoryMappedReader
+            : public StreamStackEntry
+        {
+        public:
+            MemoryMappedReader(AZStd::vector<AZStd::string> extensions, u32 maxMappedFiles, u32 maxNumJobs,
+                AZStd::chrono::milliseconds prefetchWindow, u32 maxNumBlockJobs = 0);
+            ~MemoryMappedReader() override = default;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            using MappedFilePtr = AZStd::shared_ptr<MemoryMappedFile>;
+
+            struct PendingRequest
+            {
+                FileRequest* m_request{ nullptr };
+                MappedFilePtr m_file;
+                u64 m_offset{ 0 };
+                u64 m_size{ 0 };
+                bool m_prefetched{ false };
+            };
+
+            bool IsIdle() const;
+            bool IsMappable(const RequestPath& path) const;
+            MappedFilePtr FindOrMapFile(const RequestPath& path);
+            size_t FindFileInCache(const RequestPath& path) const;
+
+            bool TryQueueRead(FileRequest* request, const RequestPath& path, u64 offset, u64 size);
+            void PrefetchIfDue(PendingRequest& pending, AZStd::chrono::system_clock::time_point now);
+
+            void ReadFromMapping(PendingRequest& pending);
+            void StartDecompression(PendingRequest& pending);
+            void FinishDecompression(AZStd::chrono::system_clock::time_point startTime, u64 compressedSize);
+
+            void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+            void FlushCache(const RequestPath& filePath);
+            void FlushEntireCache();
+            void Report(const FileRequest::ReportData& data) const;
+
+            static void Decompress(StreamerContext* context, JobContext* blockJobContext, u32 maxNumBlockJobs, FileRequest* waitRequest,
+                const MappedFilePtr& file);
+
+            AZStd::deque<PendingRequest> m_pendingRequests;
+            AZStd::vector<AZStd::string> m_extensions;
+
+            //! The last time a mapped file was used. The mapping is stored in m_mappedFiles.
+            AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileLastUsed;
+            //! The path to the mapped file. The mapping is stored in m_mappedFiles.
+            AZStd::vector<RequestPath> m_filePaths;
+            //! The mapped files. These are shared so a mapping that's evicted while a decompression job is
+            //! still reading from it stays alive until the job completes.
+            AZStd::vector<MappedFilePtr> m_mappedFiles;
+
+            TimedAverageWindow<s_statisticsWindowSize> m_mapTimeAverage;
+            TimedAverageWindow<s_statisticsWindowSize> m_copyTimeAverage;
+            AverageWindow<u64, float, s_statisticsWindowSize> m_copySizeAverage;
+            AverageWindow<u64, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+            AverageWindow<u64, double, s_statisticsWindowSize> m_bytesDecompressed;
+
+            AZStd::unique_ptr<JobManager> m_decompressionJobManager;
+            AZStd::unique_ptr<JobContext> m_decompressionJobContext;
+
+            AZStd::chrono::milliseconds m_prefetchWindow;
+            u64 m_mappedBytes{ 0 };
+            u64 m_numPrefetches{ 0 };
+            u32 m_maxNumJobs{ 2 };
+            u32 m_maxNumBlockJobs{ 0 };
+            u32 m_numRunningJobs{ 0 };
+        };
+    } // namespace IO
+} // namespace AZ
@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -193,6 +194,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        MemoryMappedReaderConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
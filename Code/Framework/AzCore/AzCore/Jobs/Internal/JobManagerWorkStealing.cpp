@@ -52,6 +52,12 @@ Job* WorkQueue::LocalPopFront()
     return result;
 }
 
+bool WorkQueue::IsEmpty()
+{
+    LockGuard lock(m_lock);
+    return m_queue.empty();
+}
+
 Job* WorkQueue::TryStealFront()
 {
     AZStd::exponential_backoff backoff;
@@ -186,6 +192,33 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     }
 }
 
+void JobManagerWorkStealing::AddPendingJobToWorker(Job* job, AZ::u32 workerId)
+{
+    AZ_Assert(job->GetDependentCount() == 0, ("Job has a non-zero ready count, it should not be being added yet"));
+
+    if (!IsAsynchronous() || workerId >= m_workerThreads.size() || job->IsCompletion())
+    {
+        AddPendingJob(job);
+        return;
+    }
+
+    AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, job, "AzCore Job Queued Awaiting Execute");
+
+    ThreadInfo* worker = m_workerThreads[workerId];
+
+    //inserting into the affinity queue and waking the worker must be done while holding the global queue lock, as that's
+    //where the worker checks if it has anything to do before going to sleep
+    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+    worker->m_affinityJobs.LocalInsert(job);
+    if (worker->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
+    {
+        m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+
+        AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, worker, "AzCore WakeJobThread %d", worker->m_workerId);
+        worker->m_waitEvent.release();
+    }
+}
+
 void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
 {
     ThreadInfo* info = GetCurrentOrCreateThreadInfo();
@@ -326,6 +359,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
+    WorkQueue* affinityJobs = info->m_isWorker ? &info->m_affinityJobs : nullptr;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
     while (true)
@@ -352,7 +386,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    if (m_globalJobQueue.empty() && affinityJobs->IsEmpty())
                     {
                         shouldSleep = true;
 
@@ -399,6 +433,12 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             }
         }
 
+        if (!job && affinityJobs)
+        {
+            //nothing on the global queue, try to pop jobs that can only run on this thread
+            job = affinityJobs->LocalPopFront();
+        }
+
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
@@ -429,10 +469,14 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
+                //pop a new job from the local queues, jobs that can only run on this thread go first as nobody else can pick them up
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = affinityJobs->LocalPopFront();
+                    if (!job)
+                    {
+                        job = pendingJobs->LocalPopFront();
+                    }
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -32,6 +32,7 @@ namespace AZ
             void LocalInsert(Job *job);
             Job* LocalPopFront();
             Job* TryStealFront();
+            bool IsEmpty();
 
         private:
             enum
@@ -64,6 +65,9 @@ namespace AZ
 
             void AddPendingJob(Job* job);
 
+            //! Adds a job that will only be processed by the worker with the given id. Jobs added this way can't be stolen.
+            void AddPendingJobToWorker(Job* job, AZ::u32 workerId);
+
             void SuspendJobUntilReady(Job* job);
 
             void StartJobAndAssistUntilComplete(Job* job);
@@ -97,6 +101,7 @@ namespace AZ
                 AZStd::atomic_bool m_isAvailable{false};
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
+                WorkQueue m_affinityJobs; //jobs that can only run on this worker, other threads never steal from this queue
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
 
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -69,6 +69,15 @@ namespace AZ
          */
         void Start();
 
+        /**
+         * Same as Start, but the job will only be processed by the worker thread with the given id, see
+         * JobManager::GetWorkerThreadId. This is for work that needs to stay on a specific thread, e.g. because it
+         * touches thread local data. The job must not have any other dependencies left, and since other workers
+         * can't steal it, it may wait longer before it's processed than a regular job. If the id doesn't refer to a
+         * worker thread the job is started as usual.
+         */
+        void StartOnWorker(AZ::u32 workerId);
+
         /**
          * Resets a non-auto-deleting job so it can be used again. If the dependent is not cleared, then it
          * should be already in the reset state, in order to increment the dependent count.
@@ -277,6 +286,21 @@ namespace AZ
         DecrementDependentCount();
     }
 
+    inline void Job::StartOnWorker(AZ::u32 workerId)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, ("Jobs must be in the setup state before they can be started"));
+        SetState(STATE_PENDING);
+#endif
+        AZ_Assert(GetDependentCount() == 1, "Jobs can only be started on a specific worker if they have no other dependencies");
+#ifdef AZCORE_JOBS_IMPL_SYNCHRONOUS
+        --m_dependentCountAndFlags;
+#else
+        m_dependentCountAndFlags.fetch_sub(1, AZStd::memory_order_acq_rel);
+#endif
+        m_context->GetJobManager().AddPendingJobToWorker(this, workerId);
+    }
+
     inline void Job::Reset(bool isClearDependent)
     {
 #ifdef AZ_DEBUG_JOB_STATE
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobGraph.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobEmpty.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Reusable job that runs a single task of a JobGraph and releases the successors of the task when done.
+         */
+        class JobGraphTask
+            : public Job
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(JobGraphTask, ThreadPoolAllocator, 0)
+
+            JobGraphTask(JobGraph& graph, AZ::u32 sortedIndex, AZ::s8 priority, JobContext* context)
+                : Job(false, context, false, priority)
+                , m_graph(graph)
+                , m_sortedIndex(sortedIndex)
+            {
+            }
+
+        protected:
+            void Process() override
+            {
+                m_graph.CompleteTask(m_sortedIndex);
+            }
+
+            JobGraph& m_graph;
+            AZ::u32 m_sortedIndex;
+        };
+
+        static void AppendEscapedJsonString(AZStd::string& output, const AZStd::string& value)
+        {
+            for (char c : value)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    output += '\\';
+                    output += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    output += ' ';
+                }
+                else
+                {
+                    output += c;
+                }
+            }
+        }
+    } // namespace Internal
+
+    JobGraph::JobGraph(const char* name, JobContext* context)
+        : m_name(name)
+        , m_context(context ? context : JobContext::GetGlobalContext())
+    {
+        AZ_Assert(m_context, "No job context provided for job graph '%s' and no global context is available.", name);
+        AZ_Assert(!m_context->GetCancelGroup(), "Job graph '%s' can't be used with a job context that has a cancel group.", name);
+    }
+
+    JobGraph::~JobGraph()
+    {
+        AZ_Assert(!m_isRunning, "Job graph '%s' is destroyed while it's still running. Call Wait first.", m_name.c_str());
+        ReleaseJobs();
+    }
+
+    JobGraph::TaskId JobGraph::AddTask(const char* name, TaskFunction function, AZ::s8 priority, AZ::u32 workerAffinity)
+    {
+        AZ_Assert(!m_isCompiled, "Tasks can't be added to job graph '%s' after it has been compiled.", m_name.c_str());
+        AZ_Assert(function, "Task '%s' added to job graph '%s' doesn't have a function.", name, m_name.c_str());
+
+        TaskDeclaration& declaration = m_declarations.emplace_back();
+        declaration.m_name = name;
+        declaration.m_function = AZStd::move(function);
+        declaration.m_priority = priority;
+        declaration.m_workerAffinity = workerAffinity;
+        return aznumeric_cast<TaskId>(m_declarations.size() - 1);
+    }
+
+    void JobGraph::AddDependency(TaskId predecessor, TaskId successor)
+    {
+        AZ_Assert(!m_isCompiled, "Dependencies can't be added to job graph '%s' after it has been compiled.", m_name.c_str());
+        AZ_Assert(predecessor < m_declarations.size() && successor < m_declarations.size(),
+            "Invalid task id used for a dependency in job graph '%s'.", m_name.c_str());
+        AZ_Assert(predecessor != successor, "Task '%s' in job graph '%s' can't depend on itself.",
+            m_declarations[predecessor].m_name.c_str(), m_name.c_str());
+
+        m_declarations[predecessor].m_successors.push_back(successor);
+    }
+
+    bool JobGraph::Compile()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(!m_isRunning, "Job graph '%s' can't be compiled while it's running.", m_name.c_str());
+
+        ReleaseJobs();
+
+        const AZ::u32 numTasks = aznumeric_cast<AZ::u32>(m_declarations.size());
+
+        // Topologically sort the tasks using Kahn's algorithm, which also detects cycles.
+        AZStd::vector<AZ::u32> numPredecessors(numTasks, 0);
+        for (const TaskDeclaration& declaration : m_declarations)
+        {
+            for (TaskId successor : declaration.m_successors)
+            {
+                numPredecessors[successor]++;
+            }
+        }
+
+        AZStd::vector<AZ::u32> remaining = numPredecessors;
+        AZStd::vector<TaskId> sorted;
+        sorted.reserve(numTasks);
+        for (TaskId task = 0; task < numTasks; ++task)
+        {
+            if (remaining[task] == 0)
+            {
+                sorted.push_back(task);
+            }
+        }
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            for (TaskId successor : m_declarations[sorted[i]].m_successors)
+            {
+                if (--remaining[successor] == 0)
+                {
+                    sorted.push_back(successor);
+                }
+            }
+        }
+        if (sorted.size() != numTasks)
+        {
+            AZ_Error("JobGraph", false, "Job graph '%s' contains a cycle and can't be compiled.", m_name.c_str());
+            return false;
+        }
+
+        AZStd::vector<AZ::u32> taskIdToSorted(numTasks);
+        for (AZ::u32 i = 0; i < numTasks; ++i)
+        {
+            taskIdToSorted[sorted[i]] = i;
+        }
+
+        const AZ::u32 numWorkers = m_context->GetJobManager().GetNumWorkerThreads();
+
+        m_sortedToTaskId = AZStd::move(sorted);
+        m_successorOffsets.reserve(numTasks + 1);
+        m_numPredecessors.reserve(numTasks);
+        m_workerAffinities.reserve(numTasks);
+        m_jobs.reserve(numTasks);
+        m_pendingPredecessors.reset(new AZStd::atomic<AZ::u32>[numTasks]);
+        m_traces.resize(numTasks);
+
+        m_completionJob = aznew JobEmpty(false, m_context);
+
+        for (AZ::u32 i = 0; i < numTasks; ++i)
+        {
+            const TaskDeclaration& declaration = m_declarations[m_sortedToTaskId[i]];
+
+            m_successorOffsets.push_back(aznumeric_cast<AZ::u32>(m_successors.size()));
+            for (TaskId successor : declaration.m_successors)
+            {
+                m_successors.push_back(taskIdToSorted[successor]);
+            }
+
+            m_numPredecessors.push_back(numPredecessors[m_sortedToTaskId[i]]);
+            if (m_numPredecessors.back() == 0)
+            {
+                m_roots.push_back(i);
+            }
+
+            AZ::u32 affinity = declaration.m_workerAffinity;
+            if (affinity != AnyWorker && affinity >= numWorkers)
+            {
+                AZ_Warning("JobGraph", false, "Task '%s' in job graph '%s' is bound to worker %u, but there are only %u workers. "
+                    "The task will run on any worker instead.", declaration.m_name.c_str(), m_name.c_str(), affinity, numWorkers);
+                affinity = AnyWorker;
+            }
+            m_workerAffinities.push_back(affinity);
+
+            Internal::JobGraphTask* job = aznew Internal::JobGraphTask(*this, i, declaration.m_priority, m_context);
+            job->SetDependent(m_completionJob);
+            m_jobs.push_back(job);
+        }
+        m_successorOffsets.push_back(aznumeric_cast<AZ::u32>(m_successors.size()));
+
+        m_isCompiled = true;
+        return true;
+    }
+
+    void JobGraph::Submit()
+    {
+        AZ_Assert(m_isCompiled, "Job graph '%s' needs to be compiled before it can be submitted.", m_name.c_str());
+        AZ_Assert(!m_isRunning, "Job graph '%s' is already running. Call Wait before submitting it again.", m_name.c_str());
+
+        // Reset all jobs. The task jobs increment the dependent count of the completion job again while resetting, so
+        // the completion job doesn't run until every task has finished.
+        m_completionJob->Reset(true);
+        const AZ::u32 numTasks = GetNumTasks();
+        for (AZ::u32 i = 0; i < numTasks; ++i)
+        {
+            m_jobs[i]->Reset(false);
+            m_pendingPredecessors[i].store(m_numPredecessors[i], AZStd::memory_order_relaxed);
+        }
+
+        m_isRunning = true;
+        if (m_isTracingEnabled)
+        {
+            m_submitMicroSecond = AZStd::GetTimeNowMicroSecond();
+        }
+
+        for (AZ::u32 root : m_roots)
+        {
+            StartTask(root);
+        }
+    }
+
+    void JobGraph::Wait()
+    {
+        AZ_Assert(m_isRunning, "Job graph '%s' needs to be submitted before it can be waited on.", m_name.c_str());
+        AZ_PROFILE_SCOPE_STALL_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "JobGraph::Wait - %s", m_name.c_str());
+
+        m_completionJob->StartAndWaitForCompletion();
+        m_isRunning = false;
+    }
+
+    void JobGraph::SubmitAndWait()
+    {
+        Submit();
+        Wait();
+    }
+
+    void JobGraph::Clear()
+    {
+        AZ_Assert(!m_isRunning, "Job graph '%s' can't be cleared while it's running.", m_name.c_str());
+        ReleaseJobs();
+        m_declarations.clear();
+    }
+
+    bool JobGraph::IsCompiled() const
+    {
+        return m_isCompiled;
+    }
+
+    bool JobGraph::IsRunning() const
+    {
+        return m_isRunning;
+    }
+
+    AZ::u32 JobGraph::GetNumTasks() const
+    {
+        return aznumeric_cast<AZ::u32>(m_declarations.size());
+    }
+
+    const char* JobGraph::GetName() const
+    {
+        return m_name.c_str();
+    }
+
+    void JobGraph::EnableTracing(bool enable)
+    {
+        AZ_Assert(!m_isRunning, "Tracing for job graph '%s' can't be changed while it's running.", m_name.c_str());
+        m_isTracingEnabled = enable;
+    }
+
+    bool JobGraph::IsTracingEnabled() const
+    {
+        return m_isTracingEnabled;
+    }
+
+    const JobGraph::TaskTrace& JobGraph::GetTaskTrace(TaskId task) const
+    {
+        AZ_Assert(m_isCompiled && task < m_traces.size(), "Invalid task id %u for job graph '%s'.", task, m_name.c_str());
+        return m_traces[task];
+    }
+
+    void JobGraph::WriteChromeTrace(AZStd::string& output) const
+    {
+        AZ_Assert(!m_isRunning, "Trace of job graph '%s' can't be written while it's running.", m_name.c_str());
+
+        // Tasks that ran on a thread that isn't a worker, e.g. the thread that waited on the graph, use thread id 0 and
+        // workers use their worker id plus one.
+        auto toThreadId = [](AZ::u32 workerId) -> AZ::u32
+        {
+            return workerId == AnyWorker ? 0 : workerId + 1;
+        };
+
+        output = "{\"traceEvents\":[\n";
+        output += AZStd::string::format(R"({"name":"thread_name","ph":"M","pid":1,"tid":0,"args":{"name":"Non-worker"}})");
+        const AZ::u32 numWorkers = m_context->GetJobManager().GetNumWorkerThreads();
+        for (AZ::u32 worker = 0; worker < numWorkers; ++worker)
+        {
+            output += AZStd::string::format(R"(,
+{"name":"thread_name","ph":"M","pid":1,"tid":%u,"args":{"name":"Worker %u"}})", toThreadId(worker), worker);
+        }
+
+        for (TaskId task = 0; task < m_traces.size(); ++task)
+        {
+            const TaskTrace& trace = m_traces[task];
+            if (trace.m_endMicroSecond == 0)
+            {
+                continue;
+            }
+
+            output += ",\n{\"name\":\"";
+            Internal::AppendEscapedJsonString(output, m_declarations[task].m_name);
+            output += "\",\"cat\":\"";
+            Internal::AppendEscapedJsonString(output, m_name);
+            output += AZStd::string::format(R"(","ph":"X","pid":1,"tid":%u,"ts":%lld,"dur":%lld})",
+                toThreadId(trace.m_workerId),
+                static_cast<long long>(trace.m_startMicroSecond - m_submitMicroSecond),
+                static_cast<long long>(trace.m_endMicroSecond - trace.m_startMicroSecond));
+        }
+        output += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    bool JobGraph::WriteChromeTrace(const char* filePath) const
+    {
+        AZStd::string trace;
+        WriteChromeTrace(trace);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("JobGraph", false, "Unable to open '%s' to write the trace of job graph '%s'.", filePath, m_name.c_str());
+            return false;
+        }
+        bool result = file.Write(trace.data(), trace.size()) == trace.size();
+        file.Close();
+        return result;
+    }
+
+    void JobGraph::ReleaseJobs()
+    {
+        for (Internal::JobGraphTask* job : m_jobs)
+        {
+            delete job;
+        }
+        m_jobs.clear();
+        delete m_completionJob;
+        m_completionJob = nullptr;
+
+        m_successorOffsets.clear();
+        m_successors.clear();
+        m_numPredecessors.clear();
+        m_workerAffinities.clear();
+        m_roots.clear();
+        m_sortedToTaskId.clear();
+        m_pendingPredecessors.reset();
+        m_traces.clear();
+        m_isCompiled = false;
+    }
+
+    void JobGraph::StartTask(AZ::u32 sortedIndex)
+    {
+        AZ::u32 affinity = m_workerAffinities[sortedIndex];
+        if (affinity == AnyWorker)
+        {
+            m_jobs[sortedIndex]->Start();
+        }
+        else
+        {
+            m_jobs[sortedIndex]->StartOnWorker(affinity);
+        }
+    }
+
+    void JobGraph::CompleteTask(AZ::u32 sortedIndex)
+    {
+        const TaskId taskId = m_sortedToTaskId[sortedIndex];
+        const TaskDeclaration& declaration = m_declarations[taskId];
+        {
+            AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "JobGraph task - %s", declaration.m_name.c_str());
+            if (m_isTracingEnabled)
+            {
+                TaskTrace& trace = m_traces[taskId];
+                trace.m_workerId = m_context->GetJobManager().GetWorkerThreadId();
+                trace.m_startMicroSecond = AZStd::GetTimeNowMicroSecond();
+                declaration.m_function();
+                trace.m_endMicroSecond = AZStd::GetTimeNowMicroSecond();
+            }
+            else
+            {
+                declaration.m_function();
+            }
+        }
+
+        // Release the successors. The last predecessor to finish starts the successor.
+        const AZ::u32 successorsEnd = m_successorOffsets[sortedIndex + 1];
+        for (AZ::u32 i = m_successorOffsets[sortedIndex]; i < successorsEnd; ++i)
+        {
+            AZ::u32 successor = m_successors[i];
+            if (m_pendingPredecessors[successor].fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+            {
+                StartTask(successor);
+            }
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    class Job;
+    class JobEmpty;
+
+    namespace Internal
+    {
+        class JobGraphTask;
+    }
+
+    /**
+     * A graph of tasks with dependencies between them that's declared once and can then be submitted as often as needed,
+     * e.g. once per frame. Declaring the graph and compiling it allocates, but submitting a compiled graph does not, as
+     * all the jobs and bookkeeping are created up front and reused.
+     *
+     * Usage:
+     *      JobGraph graph("Physics");
+     *      JobGraph::TaskId broadphase = graph.AddTask("Broadphase", [this]() { UpdateBroadphase(); });
+     *      JobGraph::TaskId narrowphase = graph.AddTask("Narrowphase", [this]() { UpdateNarrowphase(); }, 10);
+     *      graph.AddDependency(broadphase, narrowphase);
+     *      graph.Compile();
+     *      ...
+     *      graph.SubmitAndWait(); // every frame
+     *
+     * Tasks can have a priority which is forwarded to the jobs, so the JobManager picks them before other pending jobs of
+     * a lower priority. Tasks can also be bound to a specific worker thread, see Job::StartOnWorker.
+     *
+     * Optionally the graph records when and on which thread each task ran, which can be written out in the Chrome
+     * tracing format (chrome://tracing or https://ui.perfetto.dev) to inspect how the graph was scheduled.
+     *
+     * Graphs can't be used with job contexts that have a cancel group, as a canceled task would never release its
+     * successors.
+     */
+    class JobGraph
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(JobGraph, SystemAllocator, 0);
+
+        using TaskId = AZ::u32;
+        using TaskFunction = AZStd::function<void()>;
+
+        static constexpr TaskId InvalidTaskId = ~0u;
+        //! Worker affinity for tasks that can run on any worker.
+        static constexpr AZ::u32 AnyWorker = JobManager::InvalidWorkerThreadId;
+
+        //! Timing information for a single task, collected when tracing is enabled.
+        struct TaskTrace
+        {
+            AZStd::sys_time_t m_startMicroSecond{ 0 };
+            AZStd::sys_time_t m_endMicroSecond{ 0 };
+            AZ::u32 m_workerId{ AnyWorker };
+        };
+
+        /**
+         * @param name Name of the graph used for tracing.
+         * @param context The context the tasks will run in. If no context is provided the global context is used.
+         */
+        explicit JobGraph(const char* name, JobContext* context = nullptr);
+        ~JobGraph();
+
+        /**
+         * Adds a new task to the graph. The graph can't be compiled when a task is added.
+         * @param name Name of the task used for tracing. The name is copied.
+         * @param function The function that will be called every time the task runs.
+         * @param priority Priority of the task's job, see Job.
+         * @param workerAffinity Id of the only worker the task is allowed to run on, or AnyWorker.
+         * @return The id of the task, which is used to add dependencies.
+         */
+        TaskId AddTask(const char* name, TaskFunction function, AZ::s8 priority = 0, AZ::u32 workerAffinity = AnyWorker);
+
+        /**
+         * Declares that the successor task can't start until the predecessor task has completed.
+         */
+        void AddDependency(TaskId predecessor, TaskId successor);
+
+        /**
+         * Sorts the tasks and creates all the jobs needed to run the graph. This needs to be called after all tasks and
+         * dependencies have been added and before the graph is submitted.
+         * @return False if the graph contains a cycle, in which case the graph remains uncompiled.
+         */
+        bool Compile();
+
+        /**
+         * Starts running the graph. The calling thread can do other work while the graph runs, but must call Wait before
+         * the graph is submitted again or destroyed.
+         */
+        void Submit();
+
+        /**
+         * Waits for the submitted graph to complete. If called from a job this will suspend the job and process other
+         * jobs in the meantime, otherwise the calling thread assists in processing jobs until the graph completes.
+         */
+        void Wait();
+
+        //! Submits the graph and waits for it to complete.
+        void SubmitAndWait();
+
+        //! Removes all tasks and dependencies. The graph can't be running.
+        void Clear();
+
+        bool IsCompiled() const;
+        bool IsRunning() const;
+        AZ::u32 GetNumTasks() const;
+        const char* GetName() const;
+
+        /**
+         * Enable recording of the start and end time of tasks. Only the most recent run of the graph is kept.
+         */
+        void EnableTracing(bool enable);
+        bool IsTracingEnabled() const;
+
+        //! Returns the trace of the last run of the given task.
+        const TaskTrace& GetTaskTrace(TaskId task) const;
+
+        /**
+         * Writes the trace of the last run in the Chrome tracing JSON format. Tasks that ran on the same worker
+         * are shown on the same row.
+         */
+        void WriteChromeTrace(AZStd::string& output) const;
+        //! Writes the trace of the last run to a file in the Chrome tracing JSON format.
+        bool WriteChromeTrace(const char* filePath) const;
+
+    private:
+        friend class Internal::JobGraphTask;
+
+        JobGraph(const JobGraph&) = delete;
+        JobGraph& operator=(const JobGraph&) = delete;
+
+        struct TaskDeclaration
+        {
+            AZStd::string m_name;
+            TaskFunction m_function;
+            AZStd::vector<TaskId> m_successors;
+            AZ::u32 m_workerAffinity{ AnyWorker };
+            AZ::s8 m_priority{ 0 };
+        };
+
+        void ReleaseJobs();
+        void StartTask(AZ::u32 sortedIndex);
+        void CompleteTask(AZ::u32 sortedIndex);
+
+        AZStd::string m_name;
+        JobContext* m_context{ nullptr };
+
+        //! The tasks as declared by the user, indexed by TaskId.
+        AZStd::vector<TaskDeclaration> m_declarations;
+
+        // Compiled graph. All of these are indexed by the position of the task in topological order and stored as
+        // flat arrays so running the graph only touches a few contiguous blocks of memory.
+        AZStd::vector<Internal::JobGraphTask*> m_jobs;
+        //! Offsets in m_successors, task i has the successors in [m_successorOffsets[i], m_successorOffsets[i + 1]).
+        AZStd::vector<AZ::u32> m_successorOffsets;
+        AZStd::vector<AZ::u32> m_successors;
+        AZStd::vector<AZ::u32> m_numPredecessors;
+        AZStd::vector<AZ::u32> m_workerAffinities;
+        AZStd::vector<AZ::u32> m_roots;
+        //! Map from the topological order back to TaskId.
+        AZStd::vector<TaskId> m_sortedToTaskId;
+        AZStd::unique_ptr<AZStd::atomic<AZ::u32>[]> m_pendingPredecessors;
+        AZStd::vector<TaskTrace> m_traces;
+
+        //! Job that every task reports to when it's done, used to wait for the graph.
+        JobEmpty* m_completionJob{ nullptr };
+        AZStd::sys_time_t m_submitMicroSecond{ 0 };
+        bool m_isCompiled{ false };
+        bool m_isRunning{ false };
+        bool m_isTracingEnabled{ false };
+    };
+} // namespace AZ
@@ -86,6 +86,9 @@ namespace AZ
         friend class Internal::JobNotify;
         AZ_FORCE_INLINE void AddPendingJob(Job* job) { m_impl.AddPendingJob(job); }
 
+        //called internally by Job class when it becomes available to run and may only run on a specific worker
+        AZ_FORCE_INLINE void AddPendingJobToWorker(Job* job, AZ::u32 workerId) { m_impl.AddPendingJobToWorker(job, workerId); }
+
         //called internally by Job class to suspend itself until child jobs are complete
         AZ_FORCE_INLINE void SuspendJobUntilReady(Job* job) { m_impl.SuspendJobUntilReady(job); }
 
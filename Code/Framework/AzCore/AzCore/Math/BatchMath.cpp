@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Quaternion.h>
+
+namespace AZ::BatchMath
+{
+    namespace
+    {
+        using Simd::Vec8;
+
+        //! The components of Width transforms loaded into registers.
+        struct TransformLanes
+        {
+            Vec8::FloatType m_rotationX;
+            Vec8::FloatType m_rotationY;
+            Vec8::FloatType m_rotationZ;
+            Vec8::FloatType m_rotationW;
+            Vec8::FloatType m_scale;
+            Vec8::FloatType m_translationX;
+            Vec8::FloatType m_translationY;
+            Vec8::FloatType m_translationZ;
+
+            static TransformLanes Load(const ConstTransformSoa& transforms, size_t offset)
+            {
+                return TransformLanes{
+                    Vec8::LoadUnaligned(transforms.m_rotationX + offset),
+                    Vec8::LoadUnaligned(transforms.m_rotationY + offset),
+                    Vec8::LoadUnaligned(transforms.m_rotationZ + offset),
+                    Vec8::LoadUnaligned(transforms.m_rotationW + offset),
+                    Vec8::LoadUnaligned(transforms.m_scale + offset),
+                    Vec8::LoadUnaligned(transforms.m_translationX + offset),
+                    Vec8::LoadUnaligned(transforms.m_translationY + offset),
+                    Vec8::LoadUnaligned(transforms.m_translationZ + offset) };
+            }
+
+            static TransformLanes Splat(const Transform& transform)
+            {
+                const Quaternion& rotation = transform.GetRotation();
+                const Vector3& translation = transform.GetTranslation();
+                return TransformLanes{
+                    Vec8::Splat(rotation.GetX()),
+                    Vec8::Splat(rotation.GetY()),
+                    Vec8::Splat(rotation.GetZ()),
+                    Vec8::Splat(rotation.GetW()),
+                    Vec8::Splat(transform.GetUniformScale()),
+                    Vec8::Splat(translation.GetX()),
+                    Vec8::Splat(translation.GetY()),
+                    Vec8::Splat(translation.GetZ()) };
+            }
+        };
+
+        //! Computes lhs * rhs for every lane and stores the results at offset.
+        //! This follows Transform::operator*, with the quaternion product and rotation written out per component.
+        void MultiplyTransformLanes(const TransformLanes& lhs, const TransformLanes& rhs, const TransformSoa& results, size_t offset)
+        {
+            // Rotation, lhs.rotation * rhs.rotation
+            const Vec8::FloatType rotationX = Vec8::Add(
+                Vec8::Sub(Vec8::Mul(lhs.m_rotationY, rhs.m_rotationZ), Vec8::Mul(lhs.m_rotationZ, rhs.m_rotationY)),
+                Vec8::Madd(lhs.m_rotationW, rhs.m_rotationX, Vec8::Mul(lhs.m_rotationX, rhs.m_rotationW)));
+            const Vec8::FloatType rotationY = Vec8::Add(
+                Vec8::Sub(Vec8::Mul(lhs.m_rotationZ, rhs.m_rotationX), Vec8::Mul(lhs.m_rotationX, rhs.m_rotationZ)),
+                Vec8::Madd(lhs.m_rotationW, rhs.m_rotationY, Vec8::Mul(lhs.m_rotationY, rhs.m_rotationW)));
+            const Vec8::FloatType rotationZ = Vec8::Add(
+                Vec8::Sub(Vec8::Mul(lhs.m_rotationX, rhs.m_rotationY), Vec8::Mul(lhs.m_rotationY, rhs.m_rotationX)),
+                Vec8::Madd(lhs.m_rotationW, rhs.m_rotationZ, Vec8::Mul(lhs.m_rotationZ, rhs.m_rotationW)));
+            const Vec8::FloatType rotationW = Vec8::Sub(
+                Vec8::Mul(lhs.m_rotationW, rhs.m_rotationW),
+                Vec8::Madd(lhs.m_rotationX, rhs.m_rotationX,
+                    Vec8::Madd(lhs.m_rotationY, rhs.m_rotationY, Vec8::Mul(lhs.m_rotationZ, rhs.m_rotationZ))));
+
+            // Translation, lhs.TransformPoint(rhs.translation)
+            const Vec8::FloatType pointX = Vec8::Mul(lhs.m_scale, rhs.m_translationX);
+            const Vec8::FloatType pointY = Vec8::Mul(lhs.m_scale, rhs.m_translationY);
+            const Vec8::FloatType pointZ = Vec8::Mul(lhs.m_scale, rhs.m_translationZ);
+
+            // Same terms as Vec4::QuaternionTransform:
+            // 2 * dot(q, v) * q + (w * w - dot(q, q)) * v + 2 * w * cross(q, v)
+            const Vec8::FloatType two = Vec8::Splat(2.0f);
+            const Vec8::FloatType dotQV = Vec8::Madd(lhs.m_rotationX, pointX,
+                Vec8::Madd(lhs.m_rotationY, pointY, Vec8::Mul(lhs.m_rotationZ, pointZ)));
+            const Vec8::FloatType dotQQ = Vec8::Madd(lhs.m_rotationX, lhs.m_rotationX,
+                Vec8::Madd(lhs.m_rotationY, lhs.m_rotationY, Vec8::Mul(lhs.m_rotationZ, lhs.m_rotationZ)));
+            const Vec8::FloatType scaleQ = Vec8::Mul(two, dotQV);
+            const Vec8::FloatType scaleV = Vec8::Sub(Vec8::Mul(lhs.m_rotationW, lhs.m_rotationW), dotQQ);
+            const Vec8::FloatType scaleCross = Vec8::Mul(two, lhs.m_rotationW);
+
+            const Vec8::FloatType crossX = Vec8::Sub(Vec8::Mul(lhs.m_rotationY, pointZ), Vec8::Mul(lhs.m_rotationZ, pointY));
+            const Vec8::FloatType crossY = Vec8::Sub(Vec8::Mul(lhs.m_rotationZ, pointX), Vec8::Mul(lhs.m_rotationX, pointZ));
+            const Vec8::FloatType crossZ = Vec8::Sub(Vec8::Mul(lhs.m_rotationX, pointY), Vec8::Mul(lhs.m_rotationY, pointX));
+
+            const Vec8::FloatType translationX = Vec8::Madd(scaleQ, lhs.m_rotationX,
+                Vec8::Madd(scaleV, pointX, Vec8::Madd(scaleCross, crossX, lhs.m_translationX)));
+            const Vec8::FloatType translationY = Vec8::Madd(scaleQ, lhs.m_rotationY,
+                Vec8::Madd(scaleV, pointY, Vec8::Madd(scaleCross, crossY, lhs.m_translationY)));
+            const Vec8::FloatType translationZ = Vec8::Madd(scaleQ, lhs.m_rotationZ,
+                Vec8::Madd(scaleV, pointZ, Vec8::Madd(scaleCross, crossZ, lhs.m_translationZ)));
+
+            Vec8::StoreUnaligned(results.m_rotationX + offset, rotationX);
+            Vec8::StoreUnaligned(results.m_rotationY + offset, rotationY);
+            Vec8::StoreUnaligned(results.m_rotationZ + offset, rotationZ);
+            Vec8::StoreUnaligned(results.m_rotationW + offset, rotationW);
+            Vec8::StoreUnaligned(results.m_scale + offset, Vec8::Mul(lhs.m_scale, rhs.m_scale));
+            Vec8::StoreUnaligned(results.m_translationX + offset, translationX);
+            Vec8::StoreUnaligned(results.m_translationY + offset, translationY);
+            Vec8::StoreUnaligned(results.m_translationZ + offset, translationZ);
+        }
+
+        Transform LoadTransform(const ConstTransformSoa& transforms, size_t index)
+        {
+            return Transform(
+                Vector3(transforms.m_translationX[index], transforms.m_translationY[index], transforms.m_translationZ[index]),
+                Quaternion(transforms.m_rotationX[index], transforms.m_rotationY[index], transforms.m_rotationZ[index], transforms.m_rotationW[index]),
+                transforms.m_scale[index]);
+        }
+
+        void StoreTransform(const TransformSoa& transforms, size_t index, const Transform& transform)
+        {
+            const Quaternion& rotation = transform.GetRotation();
+            const Vector3& translation = transform.GetTranslation();
+            transforms.m_rotationX[index] = rotation.GetX();
+            transforms.m_rotationY[index] = rotation.GetY();
+            transforms.m_rotationZ[index] = rotation.GetZ();
+            transforms.m_rotationW[index] = rotation.GetW();
+            transforms.m_scale[index] = transform.GetUniformScale();
+            transforms.m_translationX[index] = translation.GetX();
+            transforms.m_translationY[index] = translation.GetY();
+            transforms.m_translationZ[index] = translation.GetZ();
+        }
+
+
+        //! A frustum plane splatted across all lanes, along with which corner of a box is furthest along and against the
+        //! normal, matching the support points used by Frustum::IntersectAabb.
+        struct PlaneLanes
+        {
+            Vec8::FloatType m_normalX;
+            Vec8::FloatType m_normalY;
+            Vec8::FloatType m_normalZ;
+            Vec8::FloatType m_distance;
+            bool m_disjointMaxX;
+            bool m_disjointMaxY;
+            bool m_disjointMaxZ;
+            bool m_intersectMaxX;
+            bool m_intersectMaxY;
+            bool m_intersectMaxZ;
+        };
+
+        void SplatPlanes(const Frustum& frustum, PlaneLanes (&planes)[Frustum::PlaneId::MAX])
+        {
+            for (Frustum::PlaneId i = Frustum::PlaneId::Near; i < Frustum::PlaneId::MAX; ++i)
+            {
+                const Plane plane = frustum.GetPlane(i);
+                const Vector3 normal = plane.GetNormal();
+                PlaneLanes& lanes = planes[i];
+                lanes.m_normalX = Vec8::Splat(normal.GetX());
+                lanes.m_normalY = Vec8::Splat(normal.GetY());
+                lanes.m_normalZ = Vec8::Splat(normal.GetZ());
+                lanes.m_distance = Vec8::Splat(plane.GetDistance());
+                lanes.m_disjointMaxX = normal.GetX() > 0.0f;
+                lanes.m_disjointMaxY = normal.GetY() > 0.0f;
+                lanes.m_disjointMaxZ = normal.GetZ() > 0.0f;
+                lanes.m_intersectMaxX = normal.GetX() < 0.0f;
+                lanes.m_intersectMaxY = normal.GetY() < 0.0f;
+                lanes.m_intersectMaxZ = normal.GetZ() < 0.0f;
+            }
+        }
+
+        //! Tests Width boxes starting at offset against the planes.
+        void IntersectAabbLanes(const PlaneLanes (&planes)[Frustum::PlaneId::MAX], const AabbSoa& aabbs, size_t offset, IntersectResult* results)
+        {
+            const Vec8::FloatType minX = Vec8::LoadUnaligned(aabbs.m_minX + offset);
+            const Vec8::FloatType minY = Vec8::LoadUnaligned(aabbs.m_minY + offset);
+            const Vec8::FloatType minZ = Vec8::LoadUnaligned(aabbs.m_minZ + offset);
+            const Vec8::FloatType maxX = Vec8::LoadUnaligned(aabbs.m_maxX + offset);
+            const Vec8::FloatType maxY = Vec8::LoadUnaligned(aabbs.m_maxY + offset);
+            const Vec8::FloatType maxZ = Vec8::LoadUnaligned(aabbs.m_maxZ + offset);
+
+            const Vec8::FloatType zero = Vec8::ZeroFloat();
+            Vec8::FloatType exterior = zero;
+            Vec8::FloatType notInterior = zero;
+            for (const PlaneLanes& plane : planes)
+            {
+                const Vec8::FloatType disjointDistance =
+                    Vec8::Madd(plane.m_normalX, plane.m_disjointMaxX ? maxX : minX,
+                    Vec8::Madd(plane.m_normalY, plane.m_disjointMaxY ? maxY : minY,
+                    Vec8::Madd(plane.m_normalZ, plane.m_disjointMaxZ ? maxZ : minZ, plane.m_distance)));
+                const Vec8::FloatType intersectDistance =
+                    Vec8::Madd(plane.m_normalX, plane.m_intersectMaxX ? maxX : minX,
+                    Vec8::Madd(plane.m_normalY, plane.m_intersectMaxY ? maxY : minY,
+                    Vec8::Madd(plane.m_normalZ, plane.m_intersectMaxZ ? maxZ : minZ, plane.m_distance)));
+                exterior = Vec8::Or(exterior, Vec8::CmpLt(disjointDistance, zero));
+                notInterior = Vec8::Or(notInterior, Vec8::CmpLt(intersectDistance, zero));
+            }
+
+            const Vec8::Int32Type overlapsOrInterior = Vec8::Select(
+                Vec8::Splat(static_cast<int32_t>(IntersectResult::Overlaps)),
+                Vec8::Splat(static_cast<int32_t>(IntersectResult::Interior)),
+                Vec8::CastToInt(notInterior));
+            const Vec8::Int32Type result = Vec8::Select(
+                Vec8::Splat(static_cast<int32_t>(IntersectResult::Exterior)),
+                overlapsOrInterior,
+                Vec8::CastToInt(exterior));
+
+            alignas(32) int32_t values[Width];
+            Vec8::StoreAligned(values, result);
+            for (size_t i = 0; i < Width; ++i)
+            {
+                results[i] = static_cast<IntersectResult>(values[i]);
+            }
+        }
+    } // namespace
+
+    void TransformPoints(const Transform& transform, ConstVector3Soa points, Vector3Soa results, size_t count)
+    {
+        // Fold the rotation and scale into the basis vectors once, so every point only costs three multiply adds per component
+        const Vector3 basisX = transform.TransformVector(Vector3::CreateAxisX());
+        const Vector3 basisY = transform.TransformVector(Vector3::CreateAxisY());
+        const Vector3 basisZ = transform.TransformVector(Vector3::CreateAxisZ());
+        const Vector3& translation = transform.GetTranslation();
+
+        const Vec8::FloatType m00 = Vec8::Splat(basisX.GetX());
+        const Vec8::FloatType m10 = Vec8::Splat(basisX.GetY());
+        const Vec8::FloatType m20 = Vec8::Splat(basisX.GetZ());
+        const Vec8::FloatType m01 = Vec8::Splat(basisY.GetX());
+        const Vec8::FloatType m11 = Vec8::Splat(basisY.GetY());
+        const Vec8::FloatType m21 = Vec8::Splat(basisY.GetZ());
+        const Vec8::FloatType m02 = Vec8::Splat(basisZ.GetX());
+        const Vec8::FloatType m12 = Vec8::Splat(basisZ.GetY());
+        const Vec8::FloatType m22 = Vec8::Splat(basisZ.GetZ());
+        const Vec8::FloatType translationX = Vec8::Splat(translation.GetX());
+        const Vec8::FloatType translationY = Vec8::Splat(translation.GetY());
+        const Vec8::FloatType translationZ = Vec8::Splat(translation.GetZ());
+
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+        {
+            const Vec8::FloatType x = Vec8::LoadUnaligned(points.m_x + i);
+            const Vec8::FloatType y = Vec8::LoadUnaligned(points.m_y + i);
+            const Vec8::FloatType z = Vec8::LoadUnaligned(points.m_z + i);
+            Vec8::StoreUnaligned(results.m_x + i, Vec8::Madd(m00, x, Vec8::Madd(m01, y, Vec8::Madd(m02, z, translationX))));
+            Vec8::StoreUnaligned(results.m_y + i, Vec8::Madd(m10, x, Vec8::Madd(m11, y, Vec8::Madd(m12, z, translationY))));
+            Vec8::StoreUnaligned(results.m_z + i, Vec8::Madd(m20, x, Vec8::Madd(m21, y, Vec8::Madd(m22, z, translationZ))));
+        }
+
+        for (; i < count; ++i)
+        {
+            const Vector3 result = basisX * points.m_x[i] + basisY * points.m_y[i] + basisZ * points.m_z[i] + translation;
+            results.m_x[i] = result.GetX();
+            results.m_y[i] = result.GetY();
+            results.m_z[i] = result.GetZ();
+        }
+    }
+
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* results, size_t count)
+    {
+        // Vector3 already fills a Vec4 register, so the points are not regrouped, but the basis is still only computed once
+        const Vector3 basisX = transform.TransformVector(Vector3::CreateAxisX());
+        const Vector3 basisY = transform.TransformVector(Vector3::CreateAxisY());
+        const Vector3 basisZ = transform.TransformVector(Vector3::CreateAxisZ());
+        const Vector3& translation = transform.GetTranslation();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3& point = points[i];
+            results[i] = basisX * point.GetX() + basisY * point.GetY() + basisZ * point.GetZ() + translation;
+        }
+    }
+
+    void MultiplyTransforms(ConstTransformSoa lhs, ConstTransformSoa rhs, TransformSoa results, size_t count)
+    {
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+        {
+            MultiplyTransformLanes(TransformLanes::Load(lhs, i), TransformLanes::Load(rhs, i), results, i);
+        }
+
+        for (; i < count; ++i)
+        {
+            StoreTransform(results, i, LoadTransform(lhs, i) * LoadTransform(rhs, i));
+        }
+    }
+
+    void MultiplyTransforms(const Transform& lhs, ConstTransformSoa rhs, TransformSoa results, size_t count)
+    {
+        const TransformLanes lhsLanes = TransformLanes::Splat(lhs);
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+        {
+            MultiplyTransformLanes(lhsLanes, TransformLanes::Load(rhs, i), results, i);
+        }
+
+        for (; i < count; ++i)
+        {
+            StoreTransform(results, i, lhs * LoadTransform(rhs, i));
+        }
+    }
+
+    void MultiplyTransforms(const Transform& lhs, const Transform* rhs, Transform* results, size_t count)
+    {
+        // Transform already fills Vec4 registers and regrouping it into lanes costs more than it saves, so only fold the
+        // rotation and scale of lhs into basis vectors once, which makes each translation three multiply adds
+        const Vector3 basisX = lhs.TransformVector(Vector3::CreateAxisX());
+        const Vector3 basisY = lhs.TransformVector(Vector3::CreateAxisY());
+        const Vector3 basisZ = lhs.TransformVector(Vector3::CreateAxisZ());
+        const Quaternion& rotation = lhs.GetRotation();
+        const Vector3& translation = lhs.GetTranslation();
+        const float scale = lhs.GetUniformScale();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3& point = rhs[i].GetTranslation();
+            results[i] = Transform(
+                basisX * point.GetX() + basisY * point.GetY() + basisZ * point.GetZ() + translation,
+                rotation * rhs[i].GetRotation(),
+                scale * rhs[i].GetUniformScale());
+        }
+    }
+
+
+    void IntersectAabbs(const Frustum& frustum, const AabbSoa& aabbs, IntersectResult* results, size_t count)
+    {
+        PlaneLanes planes[Frustum::PlaneId::MAX];
+        SplatPlanes(frustum, planes);
+
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+        {
+            IntersectAabbLanes(planes, aabbs, i, results + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            const Vector3 minimum(aabbs.m_minX[i], aabbs.m_minY[i], aabbs.m_minZ[i]);
+            const Vector3 maximum(aabbs.m_maxX[i], aabbs.m_maxY[i], aabbs.m_maxZ[i]);
+            results[i] = frustum.IntersectAabb(minimum, maximum);
+        }
+    }
+
+    void IntersectAabbs(const Frustum& frustum, const Aabb* aabbs, IntersectResult* results, size_t count)
+    {
+        PlaneLanes planes[Frustum::PlaneId::MAX];
+        SplatPlanes(frustum, planes);
+
+        // Regroup the boxes Width at a time so they can be tested with the structure of arrays kernel
+        alignas(32) float minX[Width];
+        alignas(32) float minY[Width];
+        alignas(32) float minZ[Width];
+        alignas(32) float maxX[Width];
+        alignas(32) float maxY[Width];
+        alignas(32) float maxZ[Width];
+        const AabbSoa block{ minX, minY, minZ, maxX, maxY, maxZ };
+
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+        {
+            for (size_t j = 0; j < Width; ++j)
+            {
+                const Vector3& minimum = aabbs[i + j].GetMin();
+                const Vector3& maximum = aabbs[i + j].GetMax();
+                minX[j] = minimum.GetX();
+                minY[j] = minimum.GetY();
+                minZ[j] = minimum.GetZ();
+                maxX[j] = maximum.GetX();
+                maxY[j] = maximum.GetY();
+                maxZ[j] = maximum.GetZ();
+            }
+            IntersectAabbLanes(planes, block, 0, results + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            results[i] = frustum.IntersectAabb(aabbs[i]);
+        }
+    }
+} // namespace AZ::BatchMath
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+//! Batched math kernels that process many values per call.
+//! The kernels work on Simd::Vec8 lanes, so eight values are processed per iteration (with AVX2 when the build
+//! enables LY_SIMD_AVX2), and any remainder is processed one value at a time. Use them instead of per element loops
+//! over Transform and Frustum when there are many values to process at once, e.g. when updating a transform
+//! hierarchy or culling a list of bounds.
+//! The overloads taking structure of arrays views are the fastest, the ones taking arrays of Vector3, Transform or Aabb
+//! are there for data that isn't stored that way, and still save the per call setup of the equivalent loop.
+namespace AZ::BatchMath
+{
+    //! The number of values processed per iteration of the batched kernels.
+    constexpr size_t Width = static_cast<size_t>(Simd::Vec8::ElementCount);
+
+    //! Structure of arrays view of a list of points, each array holds one component of every point.
+    struct Vector3Soa
+    {
+        float* m_x = nullptr;
+        float* m_y = nullptr;
+        float* m_z = nullptr;
+    };
+
+    //! Read only version of Vector3Soa.
+    struct ConstVector3Soa
+    {
+        const float* m_x = nullptr;
+        const float* m_y = nullptr;
+        const float* m_z = nullptr;
+    };
+
+    //! Structure of arrays view of a list of transforms.
+    struct TransformSoa
+    {
+        float* m_rotationX = nullptr;
+        float* m_rotationY = nullptr;
+        float* m_rotationZ = nullptr;
+        float* m_rotationW = nullptr;
+        float* m_scale = nullptr;
+        float* m_translationX = nullptr;
+        float* m_translationY = nullptr;
+        float* m_translationZ = nullptr;
+    };
+
+    //! Read only version of TransformSoa.
+    struct ConstTransformSoa
+    {
+        const float* m_rotationX = nullptr;
+        const float* m_rotationY = nullptr;
+        const float* m_rotationZ = nullptr;
+        const float* m_rotationW = nullptr;
+        const float* m_scale = nullptr;
+        const float* m_translationX = nullptr;
+        const float* m_translationY = nullptr;
+        const float* m_translationZ = nullptr;
+    };
+
+    //! Structure of arrays view of a list of axis aligned bounding boxes.
+    struct AabbSoa
+    {
+        const float* m_minX = nullptr;
+        const float* m_minY = nullptr;
+        const float* m_minZ = nullptr;
+        const float* m_maxX = nullptr;
+        const float* m_maxY = nullptr;
+        const float* m_maxZ = nullptr;
+    };
+
+    //! Transforms count points by transform, same as calling Transform::TransformPoint on every point.
+    //! The results can use the same arrays as the points.
+    void TransformPoints(const Transform& transform, ConstVector3Soa points, Vector3Soa results, size_t count);
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* results, size_t count);
+
+    //! Computes results[i] = lhs[i] * rhs[i] for count transforms.
+    //! The results can use the same arrays as lhs or rhs.
+    void MultiplyTransforms(ConstTransformSoa lhs, ConstTransformSoa rhs, TransformSoa results, size_t count);
+
+    //! Computes results[i] = lhs * rhs[i] for count transforms, e.g. to move a list of local transforms into the space of
+    //! their shared parent. The results can use the same arrays as rhs.
+    void MultiplyTransforms(const Transform& lhs, ConstTransformSoa rhs, TransformSoa results, size_t count);
+    void MultiplyTransforms(const Transform& lhs, const Transform* rhs, Transform* results, size_t count);
+
+    //! Tests count bounding boxes against the frustum, same as calling Frustum::IntersectAabb on every box.
+    void IntersectAabbs(const Frustum& frustum, const AabbSoa& aabbs, IntersectResult* results, size_t count);
+    void IntersectAabbs(const Frustum& frustum, const Aabb* aabbs, IntersectResult* results, size_t count);
+} // namespace AZ::BatchMath
@@ -521,8 +521,8 @@ namespace AZ
 
             AZ_MATH_INLINE __m128 Madd(__m128 mul1, __m128 mul2, __m128 add)
             {
-#if 0
-                return _mm_fmadd_ps(mul1, mul2, add); // Requires FMA CPUID
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+                return _mm_fmadd_ps(mul1, mul2, add); // Requires FMA CPUID, only enabled when building with LY_SIMD_AVX2
 #else
                 return Add(Mul(mul1, mul2), add);
 #endif
@@ -150,5 +150,10 @@ namespace AZ
 
             return match;
         }
+
+        size_t GetFixedDataSize() const override
+        {
+            return NumFloats * sizeof(float);
+        }
     };
 }
@@ -19,6 +19,11 @@
 #   endif
 #endif
 
+// AVX2 is an extension of the SSE backend that's only enabled when the compiler targets AVX2 and FMA
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2)
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -48,6 +53,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! Eight floats or ints processed at once, meant for structure of arrays code that operates on one component
+        //! of eight different values per lane (see AzCore/Math/BatchMath.h).
+        //! This maps to AVX registers when building with AVX2 and FMA enabled (LY_SIMD_AVX2), and to a pair of Vec4
+        //! otherwise, so code written against Vec8 works on every platform.
+        struct Vec8
+        {
+            static constexpr int32_t ElementCount = 8;
+
+#if   AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            using FloatType = __m256;
+            using Int32Type = __m256i;
+            using FloatArgType = FloatType;
+            using Int32ArgType = Int32Type;
+#else
+            using FloatType = struct { Vec4::FloatType v[2]; };
+            using Int32Type = struct { Vec4::Int32Type v[2]; };
+            using FloatArgType = const FloatType&;
+            using Int32ArgType = const Int32Type&;
+#endif
+
+            static FloatType LoadAligned(const float* __restrict addr); // addr *must* be 32-byte aligned
+            static Int32Type LoadAligned(const int32_t* __restrict addr); // addr *must* be 32-byte aligned
+            static FloatType LoadUnaligned(const float* __restrict addr);
+            static Int32Type LoadUnaligned(const int32_t* __restrict addr);
+
+            static void StoreAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            static void StoreAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+            static void StoreUnaligned(float* __restrict addr, FloatArgType value);
+            static void StoreUnaligned(int32_t* __restrict addr, Int32ArgType value);
+
+            static FloatType Splat(float value);
+            static Int32Type Splat(int32_t value);
+
+            static FloatType Add(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Sub(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Mul(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add); // Fused when FMA is available
+            static FloatType Div(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Abs(FloatArgType value);
+
+            static Int32Type Add(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Sub(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType And(FloatArgType arg1, FloatArgType arg2);
+            static FloatType AndNot(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Or(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Xor(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type And(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type AndNot(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Or(Int32ArgType arg1, Int32ArgType arg2);
+            static Int32Type Xor(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType Min(FloatArgType arg1, FloatArgType arg2);
+            static FloatType Max(FloatArgType arg1, FloatArgType arg2);
+
+            static FloatType CmpEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpNeq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpGtEq(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLt(FloatArgType arg1, FloatArgType arg2);
+            static FloatType CmpLtEq(FloatArgType arg1, FloatArgType arg2);
+
+            static Int32Type CmpEq(Int32ArgType arg1, Int32ArgType arg2);
+
+            static FloatType Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask); // mask ? arg1 : arg2
+            static Int32Type Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask); // mask ? arg1 : arg2
+
+            static FloatType Sqrt(FloatArgType value);
+
+            static FloatType ConvertToFloat(Int32ArgType value);
+            static Int32Type ConvertToInt(FloatArgType value); // Truncates
+            static FloatType CastToFloat(Int32ArgType value);
+            static Int32Type CastToInt(FloatArgType value);
+
+            static FloatType ZeroFloat();
+            static Int32Type ZeroInt();
+        };
+    }
+}
+
+#if   AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   include <AzCore/Math/Internal/SimdMathVec8_avx.inl>
+#else
+#   include <AzCore/Math/Internal/SimdMathVec8_simd.inl>
+#endif
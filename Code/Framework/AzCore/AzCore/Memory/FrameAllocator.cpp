@@ -0,0 +1,562 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    //=========================================================================
+    // Block is the header of every chunk of memory the thread buffers allocate from
+    //=========================================================================
+    struct FrameSchema::Block
+    {
+        Block* m_next;
+        size_t m_size;     ///< Size of the block, including this header.
+
+        char* GetBegin() { return reinterpret_cast<char*>(this + 1); }
+        char* GetEnd() { return reinterpret_cast<char*>(this) + m_size; }
+    };
+
+    //=========================================================================
+    // Buffer holds the allocations of one thread for one frame, only the owning thread writes to it
+    //=========================================================================
+    struct FrameSchema::Buffer
+    {
+        Block* m_blocks = nullptr;          ///< Blocks of the buffer, the one being allocated from first.
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;   ///< Can be freed or resized in place.
+        unsigned int m_trimCount = 0;
+        AZStd::atomic<size_t> m_used{ 0 };      ///< Read by the statistics from other threads.
+        AZStd::atomic<AZ::u64> m_frame{ 0 };    ///< Frame the buffer holds the allocations of.
+    };
+
+    //=========================================================================
+    // ThreadArena is double buffered so memory of the previous frame is still valid while the current frame allocates
+    //=========================================================================
+    struct FrameSchema::ThreadArena
+    {
+        Buffer m_buffers[2];
+        ThreadArena* m_next = nullptr;
+        bool m_isOwned = true;              ///< False when the thread exited, another thread can take the arena over.
+    };
+
+    namespace
+    {
+        // The arenas of the current thread, at most one per schema. Schema ids are never reused, so a slot that
+        // refers to a destroyed schema never matches again and is reused when the thread needs a new arena.
+        struct FrameArenaSlot
+        {
+            size_t m_schemaId;
+            void* m_arena;
+        };
+        static const size_t FrameArenaSlots = 4;
+        static AZ_THREAD_LOCAL FrameArenaSlot t_frameArenaSlots[FrameArenaSlots];
+
+        FrameSchema* s_frameSchemas = nullptr;
+        size_t s_frameSchemaNextId = 0;
+
+        AZStd::mutex& GetFrameSchemaRegistryMutex()
+        {
+            static AZStd::mutex registryMutex;
+            return registryMutex;
+        }
+
+        // returns the arenas of a thread to their schemas when it exits
+        struct FrameArenaExitGuard
+        {
+            ~FrameArenaExitGuard()
+            {
+                FrameSchema::ReleaseThreadArenas();
+            }
+        };
+    }
+
+    //=========================================================================
+    // FrameSchema
+    //=========================================================================
+    FrameSchema::FrameSchema(const Descriptor& desc)
+        : m_blockAllocator(desc.m_blockAllocator ? desc.m_blockAllocator : &AllocatorInstance<SystemAllocator>::Get())
+        , m_blockSize(desc.m_blockSize)
+    {
+        AZ_Assert(m_blockSize > sizeof(Block), "FrameSchema block size %zu is too small", m_blockSize);
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFrameSchemaRegistryMutex());
+        m_id = ++s_frameSchemaNextId;
+        m_nextSchema = s_frameSchemas;
+        s_frameSchemas = this;
+    }
+
+    //=========================================================================
+    // ~FrameSchema
+    //=========================================================================
+    FrameSchema::~FrameSchema()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(GetFrameSchemaRegistryMutex());
+            FrameSchema** link = &s_frameSchemas;
+            while (*link != this)
+            {
+                link = &(*link)->m_nextSchema;
+            }
+            *link = m_nextSchema;
+        }
+
+        // the slots of the threads still refer to our id, which will never match again
+        while (ThreadArena* arena = m_arenas)
+        {
+            m_arenas = arena->m_next;
+            FreeBlocks(arena->m_buffers[0].m_blocks);
+            FreeBlocks(arena->m_buffers[1].m_blocks);
+            arena->~ThreadArena();
+            m_blockAllocator->DeAllocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+        }
+    }
+
+    //=========================================================================
+    // AdvanceFrame
+    //=========================================================================
+    void FrameSchema::AdvanceFrame()
+    {
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        size_t frameBytes = 0;
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            for (const Buffer& buffer : arena->m_buffers)
+            {
+                if (buffer.m_frame.load(AZStd::memory_order_relaxed) == frame)
+                {
+                    frameBytes += buffer.m_used.load(AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        m_lastFrameBytes = frameBytes;
+        m_highWaterMark = AZStd::GetMax(m_highWaterMark, frameBytes);
+
+        // the buffers are reset by their threads, the next time they allocate
+        m_frame.store(frame + 1, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // GetStatistics
+    //=========================================================================
+    FrameSchema::Statistics FrameSchema::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        Statistics statistics;
+        statistics.m_frame = m_frame.load(AZStd::memory_order_relaxed);
+        statistics.m_lastFrameBytes = m_lastFrameBytes;
+        statistics.m_highWaterMark = m_highWaterMark;
+        statistics.m_capacity = m_capacity.load(AZStd::memory_order_relaxed);
+        statistics.m_numThreadArenas = m_numArenas;
+        return statistics;
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameSchema::pointer_type FrameSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        ThreadArena* arena = GetThreadArena();
+        if (!arena)
+        {
+            return nullptr;
+        }
+
+        alignment = AZStd::GetMax<size_type>(alignment, 1);
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_acquire);
+        Buffer& buffer = arena->m_buffers[frame & 1];
+        if (buffer.m_frame.load(AZStd::memory_order_relaxed) != frame)
+        {
+            ResetBuffer(buffer, frame);
+        }
+
+        char* current = buffer.m_current;
+        char* ptr = PointerAlignUp(current, alignment);
+        if (!current || static_cast<size_type>(ptr - current) + byteSize > static_cast<size_type>(buffer.m_end - current))
+        {
+            return AllocateFromNewBlock(buffer, byteSize, alignment);
+        }
+
+        buffer.m_current = ptr + byteSize;
+        buffer.m_lastAllocation = ptr;
+        buffer.m_used.store(buffer.m_used.load(AZStd::memory_order_relaxed) + (buffer.m_current - current), AZStd::memory_order_relaxed);
+        return ptr;
+    }
+
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+
+        ThreadArena* arena = FindThreadArena();
+        if (!ptr || !arena)
+        {
+            return;
+        }
+
+        // only the last allocation of this thread can be reclaimed, everything else is reclaimed with its buffer
+        for (Buffer& buffer : arena->m_buffers)
+        {
+            if (buffer.m_lastAllocation == ptr)
+            {
+                char* freed = static_cast<char*>(ptr);
+                buffer.m_used.store(buffer.m_used.load(AZStd::memory_order_relaxed) - (buffer.m_current - freed), AZStd::memory_order_relaxed);
+                buffer.m_current = freed;
+                buffer.m_lastAllocation = nullptr;
+                return;
+            }
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameSchema::size_type FrameSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        ThreadArena* arena = FindThreadArena();
+        if (!ptr || !arena)
+        {
+            return 0;
+        }
+
+        // the last allocation ends at the current position of its buffer, so it can grow until the end of the block
+        for (Buffer& buffer : arena->m_buffers)
+        {
+            if (buffer.m_lastAllocation == ptr)
+            {
+                char* begin = static_cast<char*>(ptr);
+                if (newSize > static_cast<size_type>(buffer.m_end - begin))
+                {
+                    return buffer.m_current - begin;
+                }
+                buffer.m_used.store(buffer.m_used.load(AZStd::memory_order_relaxed) + (begin + newSize - buffer.m_current), AZStd::memory_order_relaxed);
+                buffer.m_current = begin + newSize;
+                return newSize;
+            }
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameSchema::pointer_type FrameSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        AZ_Assert(false, "unsupported");
+
+        return ptr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameSchema::size_type FrameSchema::AllocationSize(pointer_type ptr)
+    {
+        (void)ptr;
+        return 0;  // allocation sizes are not stored
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameSchema::size_type FrameSchema::NumAllocatedBytes() const
+    {
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        size_type numAllocatedBytes = 0;
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            for (const Buffer& buffer : arena->m_buffers)
+            {
+                // buffers of the current and the previous frame are in use, older ones are waiting to be reused
+                if (buffer.m_frame.load(AZStd::memory_order_relaxed) + 1 >= frame)
+                {
+                    numAllocatedBytes += buffer.m_used.load(AZStd::memory_order_relaxed);
+                }
+            }
+        }
+        return numAllocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameSchema::size_type FrameSchema::Capacity() const
+    {
+        return m_capacity.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameSchema::size_type FrameSchema::GetMaxAllocationSize() const
+    {
+        return m_blockAllocator->GetMaxAllocationSize() - sizeof(Block);
+    }
+
+    //=========================================================================
+    // GetSubAllocator
+    //=========================================================================
+    IAllocatorAllocate* FrameSchema::GetSubAllocator()
+    {
+        return m_blockAllocator;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void FrameSchema::GarbageCollect()
+    {
+        // buffers in use shrink back to a single block the next time their thread resets them
+        m_trimCount.fetch_add(1, AZStd::memory_order_relaxed);
+
+        // the arenas of exited threads are freed right away, unless they still hold memory of the last two frames
+        const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (ThreadArena** link = &m_arenas; *link;)
+        {
+            ThreadArena* arena = *link;
+            if (!arena->m_isOwned &&
+                arena->m_buffers[0].m_frame.load(AZStd::memory_order_relaxed) + 1 < frame &&
+                arena->m_buffers[1].m_frame.load(AZStd::memory_order_relaxed) + 1 < frame)
+            {
+                *link = arena->m_next;
+                --m_numArenas;
+                FreeBlocks(arena->m_buffers[0].m_blocks);
+                FreeBlocks(arena->m_buffers[1].m_blocks);
+                arena->~ThreadArena();
+                m_blockAllocator->DeAllocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+                m_capacity.fetch_sub(sizeof(ThreadArena), AZStd::memory_order_relaxed);
+            }
+            else
+            {
+                link = &arena->m_next;
+            }
+        }
+    }
+
+    //=========================================================================
+    // ReleaseThreadArenas
+    //=========================================================================
+    void FrameSchema::ReleaseThreadArenas()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(GetFrameSchemaRegistryMutex());
+        for (FrameArenaSlot& slot : t_frameArenaSlots)
+        {
+            if (slot.m_schemaId != 0)
+            {
+                if (FrameSchema* schema = FindSchema(slot.m_schemaId))
+                {
+                    AZStd::lock_guard<AZStd::mutex> arenasLock(schema->m_arenasMutex);
+                    static_cast<ThreadArena*>(slot.m_arena)->m_isOwned = false;
+                }
+                slot.m_schemaId = 0;
+                slot.m_arena = nullptr;
+            }
+        }
+    }
+
+    //=========================================================================
+    // FindThreadArena
+    //=========================================================================
+    FrameSchema::ThreadArena* FrameSchema::FindThreadArena() const
+    {
+        for (const FrameArenaSlot& slot : t_frameArenaSlots)
+        {
+            if (slot.m_schemaId == m_id)
+            {
+                return static_cast<ThreadArena*>(slot.m_arena);
+            }
+        }
+        return nullptr;
+    }
+
+    //=========================================================================
+    // GetThreadArena
+    //=========================================================================
+    FrameSchema::ThreadArena* FrameSchema::GetThreadArena()
+    {
+        ThreadArena* arena = FindThreadArena();
+        return arena ? arena : CreateThreadArena();
+    }
+
+    //=========================================================================
+    // CreateThreadArena
+    //=========================================================================
+    FrameSchema::ThreadArena* FrameSchema::CreateThreadArena()
+    {
+        // make sure the arenas of this thread are returned when it exits
+        static thread_local FrameArenaExitGuard exitGuard;
+        (void)exitGuard;
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFrameSchemaRegistryMutex());
+        FrameArenaSlot* freeSlot = nullptr;
+        for (FrameArenaSlot& slot : t_frameArenaSlots)
+        {
+            if (slot.m_schemaId == 0 || !FindSchema(slot.m_schemaId))
+            {
+                freeSlot = &slot;
+                break;
+            }
+        }
+        if (!freeSlot)
+        {
+            // the thread uses more schemas than it has slots, give up the arena of the last one
+            freeSlot = &t_frameArenaSlots[FrameArenaSlots - 1];
+            FrameSchema* schema = FindSchema(freeSlot->m_schemaId);
+            AZStd::lock_guard<AZStd::mutex> arenasLock(schema->m_arenasMutex);
+            static_cast<ThreadArena*>(freeSlot->m_arena)->m_isOwned = false;
+        }
+
+        ThreadArena* arena = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> arenasLock(m_arenasMutex);
+            // take over the arena of an exited thread, its buffers are reset once their frames are over
+            for (arena = m_arenas; arena && arena->m_isOwned; arena = arena->m_next)
+            {
+            }
+            if (!arena)
+            {
+                void* mem = m_blockAllocator->Allocate(sizeof(ThreadArena), alignof(ThreadArena), 0, "AZ::FrameSchema::ThreadArena", __FILE__, __LINE__);
+                if (!mem)
+                {
+                    return nullptr;
+                }
+                arena = new (mem) ThreadArena();
+                const AZ::u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+                arena->m_buffers[frame & 1].m_frame.store(frame, AZStd::memory_order_relaxed);
+                arena->m_next = m_arenas;
+                m_arenas = arena;
+                ++m_numArenas;
+                m_capacity.fetch_add(sizeof(ThreadArena), AZStd::memory_order_relaxed);
+            }
+            arena->m_isOwned = true;
+        }
+
+        freeSlot->m_schemaId = m_id;
+        freeSlot->m_arena = arena;
+        return arena;
+    }
+
+    //=========================================================================
+    // ResetBuffer
+    //=========================================================================
+    void FrameSchema::ResetBuffer(Buffer& buffer, AZ::u64 frame)
+    {
+        const unsigned int trimCount = m_trimCount.load(AZStd::memory_order_relaxed);
+        const bool trim = buffer.m_trimCount != trimCount;
+        buffer.m_trimCount = trimCount;
+
+        if (buffer.m_blocks && (buffer.m_blocks->m_next || trim))
+        {
+            // the buffer spilled into more blocks, replace them with a single block that fits what the frame used,
+            // so a steady frame load ends up allocating from one block without going back to the block allocator
+            const size_t used = buffer.m_used.load(AZStd::memory_order_relaxed);
+            const size_t blockSize = trim ? m_blockSize : AZStd::GetMax(m_blockSize, SizeAlignUp(used + sizeof(Block), m_blockSize));
+            FreeBlocks(buffer.m_blocks);
+            buffer.m_blocks = AllocateBlock(blockSize);
+            if (buffer.m_blocks)
+            {
+                buffer.m_blocks->m_next = nullptr;
+            }
+        }
+
+        buffer.m_current = buffer.m_blocks ? buffer.m_blocks->GetBegin() : nullptr;
+        buffer.m_end = buffer.m_blocks ? buffer.m_blocks->GetEnd() : nullptr;
+        buffer.m_lastAllocation = nullptr;
+        buffer.m_used.store(0, AZStd::memory_order_relaxed);
+        buffer.m_frame.store(frame, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // AllocateFromNewBlock
+    //=========================================================================
+    FrameSchema::pointer_type FrameSchema::AllocateFromNewBlock(Buffer& buffer, size_type byteSize, size_type alignment)
+    {
+        // the rest of the current block is left unused, allocations bigger than a block get a block of their own
+        Block* block = AllocateBlock(AZStd::GetMax(m_blockSize, SizeAlignUp(byteSize + alignment + sizeof(Block), m_blockSize)));
+        if (!block)
+        {
+            return nullptr;
+        }
+        block->m_next = buffer.m_blocks;
+        buffer.m_blocks = block;
+
+        char* ptr = PointerAlignUp(block->GetBegin(), alignment);
+        buffer.m_current = ptr + byteSize;
+        buffer.m_end = block->GetEnd();
+        buffer.m_lastAllocation = ptr;
+        buffer.m_used.store(buffer.m_used.load(AZStd::memory_order_relaxed) + (buffer.m_current - block->GetBegin()), AZStd::memory_order_relaxed);
+        return ptr;
+    }
+
+    //=========================================================================
+    // AllocateBlock
+    //=========================================================================
+    FrameSchema::Block* FrameSchema::AllocateBlock(size_type byteSize)
+    {
+        void* mem = m_blockAllocator->Allocate(byteSize, alignof(Block), 0, "AZ::FrameSchema::Block", __FILE__, __LINE__);
+        if (!mem)
+        {
+            return nullptr;
+        }
+        Block* block = static_cast<Block*>(mem);
+        block->m_next = nullptr;
+        block->m_size = byteSize;
+        m_capacity.fetch_add(byteSize, AZStd::memory_order_relaxed);
+        return block;
+    }
+
+    //=========================================================================
+    // FreeBlocks
+    //=========================================================================
+    void FrameSchema::FreeBlocks(Block* block)
+    {
+        while (block)
+        {
+            Block* next = block->m_next;
+            m_capacity.fetch_sub(block->m_size, AZStd::memory_order_relaxed);
+            m_blockAllocator->DeAllocate(block, block->m_size, alignof(Block));
+            block = next;
+        }
+    }
+
+    //=========================================================================
+    // FindSchema
+    //=========================================================================
+    FrameSchema* FrameSchema::FindSchema(size_t id)
+    {
+        for (FrameSchema* schema = s_frameSchemas; schema; schema = schema->m_nextSchema)
+        {
+            if (schema->m_id == id)
+            {
+                return schema;
+            }
+        }
+        return nullptr;
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame schema
+     * Linear (bump pointer) allocation for temporary memory that only has to live for the frame it was allocated in.
+     * Every thread allocates from its own double buffered arena, so allocations never take a lock. Each call to
+     * AdvanceFrame flips the arenas to their other buffer, which makes memory allocated in frame N valid until the end
+     * of frame N + 1, after that it is reused without being freed.
+     * DeAllocate only reclaims memory if it is the last allocation of the calling thread, everything else is
+     * reclaimed when the buffer is reused. Resize can grow the last allocation in place, which lets AZStd::vector
+     * grow without copying.
+     */
+    class FrameSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        AZ_TYPE_INFO(FrameSchema, "{0F6E2B3C-6B8A-4C1E-9D52-3A7F2E61C4B9}");
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_blockSize(64 * 1024)
+                , m_blockAllocator(nullptr)
+            {}
+            size_t              m_blockSize;        ///< Initial size of each thread buffer, buffers grow in multiples of it when a frame needs more.
+            IAllocatorAllocate* m_blockAllocator;   ///< If you provide this interface we will use it for block allocations, otherwise SystemAllocator will be used.
+        };
+
+        struct Statistics
+        {
+            AZ::u64 m_frame = 0;            ///< Number of times AdvanceFrame was called.
+            size_t m_lastFrameBytes = 0;    ///< Bytes allocated by all threads in the last completed frame.
+            size_t m_highWaterMark = 0;     ///< Most bytes allocated by all threads in a single frame.
+            size_t m_capacity = 0;          ///< Bytes reserved by the thread arenas.
+            size_t m_numThreadArenas = 0;   ///< Number of threads that allocated frame memory.
+        };
+
+        FrameSchema(const Descriptor& desc = Descriptor());
+        ~FrameSchema() override;
+
+        //! Starts a new frame. Memory allocated in the frame before the one that just ended is reused from here on.
+        void AdvanceFrame();
+
+        Statistics GetStatistics() const;
+
+        //---------------------------------------------------------------------
+        // IAllocatorAllocate
+        //---------------------------------------------------------------------
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+        void GarbageCollect() override;
+
+        //! Called when a thread exits, returns its arenas so other threads can use them.
+        static void ReleaseThreadArenas();
+
+    private:
+        AZ_DISABLE_COPY_MOVE(FrameSchema);
+
+        struct Block;
+        struct Buffer;
+        struct ThreadArena;
+
+        ThreadArena* FindThreadArena() const;
+        ThreadArena* GetThreadArena();
+        ThreadArena* CreateThreadArena();
+        void ResetBuffer(Buffer& buffer, AZ::u64 frame);
+        pointer_type AllocateFromNewBlock(Buffer& buffer, size_type byteSize, size_type alignment);
+        Block* AllocateBlock(size_type byteSize);
+        void FreeBlocks(Block* block);
+        static FrameSchema* FindSchema(size_t id);
+
+        IAllocatorAllocate* m_blockAllocator;
+        size_t m_blockSize;
+        size_t m_id;
+        FrameSchema* m_nextSchema = nullptr;
+
+        AZStd::atomic<AZ::u64> m_frame{ 0 };
+        AZStd::atomic<unsigned int> m_trimCount{ 0 };
+        AZStd::atomic<size_t> m_capacity{ 0 };
+        size_t m_lastFrameBytes = 0;
+        size_t m_highWaterMark = 0;
+
+        mutable AZStd::mutex m_arenasMutex;
+        ThreadArena* m_arenas = nullptr;
+        size_t m_numArenas = 0;
+    };
+
+    /**
+     * Frame allocator
+     * Per thread linear allocator for temporary memory that is thrown away at the end of the frame (culling lists,
+     * job captures, sort arrays, event arguments). Memory stays valid until the end of the next frame, so it can be
+     * handed to work that completes one frame later. ComponentApplication advances the frame after every tick.
+     * Use FrameStdAllocator to have AZStd containers allocate from it.
+     */
+    class FrameAllocator
+        : public SimpleSchemaAllocator<FrameSchema, FrameSchema::Descriptor, false, true>
+    {
+    public:
+        AZ_TYPE_INFO(FrameAllocator, "{7C1D3E5A-8B2F-4A69-B0E4-5D9C6A1F3E27}");
+
+        using Base = SimpleSchemaAllocator<FrameSchema, FrameSchema::Descriptor, false, true>;
+        using Descriptor = Base::Descriptor;
+
+        FrameAllocator()
+            : Base("FrameAllocator", "Per thread linear allocator for memory that lives until the end of the next frame")
+        {
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            // allocations are never freed one by one, so there is nothing to track
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        void AdvanceFrame()
+        {
+            static_cast<FrameSchema*>(m_schema)->AdvanceFrame();
+        }
+
+        FrameSchema::Statistics GetStatistics() const
+        {
+            return static_cast<const FrameSchema*>(m_schema)->GetStatistics();
+        }
+    };
+
+    typedef AZStdAlloc<FrameAllocator> FrameStdAllocator;
+}
@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -55,6 +56,24 @@ namespace AZ {
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+// Enabled per thread caches of small allocations (see HpAllocator::thread_cache). The debug allocator tracks every
+// allocation in the buckets, so the caches are disabled with it.
+#if defined(MULTITHREADED) && !defined(DEBUG_ALLOCATOR)
+#   define USE_THREAD_CACHE
+#endif
+
+#ifdef USE_THREAD_CACHE
+    // The thread caches of the current thread, at most one per allocator. Allocator ids are never reused, so a slot
+    // that refers to a destroyed allocator never matches again and is reused when the thread needs a new cache.
+    struct thread_cache_slot
+    {
+        size_t mAllocatorId;
+        void* mCache;
+    };
+    static const size_t THREAD_CACHE_SLOTS = 8;
+    static AZ_THREAD_LOCAL thread_cache_slot t_threadCacheSlots[THREAD_CACHE_SLOTS];
+#endif
+
     //////////////////////////////////////////////////////////////////////////
     // TODO: Replace with AZStd::intrusive_list
     class intrusive_list_base
@@ -467,6 +486,141 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#ifdef USE_THREAD_CACHE
+        // per thread cache of small allocations, it sits in front of the buckets so that most allocations and frees
+        // don't take the bucket locks. every thread keeps a free list per bucket which is refilled from and returned
+        // to the bucket in batches, under a single lock. cached elements are still used as far as the buckets are
+        // concerned, so they are excluded from allocated() and returned to the buckets before a purge.
+        struct thread_cache
+            : public intrusive_list<thread_cache>::node
+        {
+            struct bin
+            {
+                free_link* mFreeList;
+                unsigned mCount;
+            };
+            bin mBins[NUM_BUCKETS];
+            // value of mThreadCachePurgeCount when the cache was last flushed
+            unsigned mPurgeCount;
+            // number of bytes in the bins, only written by the owning thread
+            AZStd::atomic<size_t> mSize;
+        };
+        typedef intrusive_list<thread_cache> thread_cache_list;
+
+        // the bins keep up to THREAD_CACHE_BIN_SIZE bytes, but no less than THREAD_CACHE_MIN_COUNT elements
+        // a bin is refilled with, and trimmed down to, half of that
+        static constexpr size_t THREAD_CACHE_BIN_SIZE = 4096;
+        static constexpr unsigned THREAD_CACHE_MIN_COUNT = 8;
+        static inline unsigned thread_cache_max_count(unsigned bi)
+        {
+            return AZStd::GetMax((unsigned)(THREAD_CACHE_BIN_SIZE / bucket_spacing_function_inverse(bi)), THREAD_CACHE_MIN_COUNT);
+        }
+
+        // take up to count elements from bucket bi, or return count elements to it, with a single lock
+        unsigned bucket_alloc_batch(unsigned bi, unsigned count, free_link*& list);
+        void bucket_free_batch(unsigned bi, free_link* list);
+
+        // returns the cache of the current thread, NULL if the thread doesn't have one
+        inline thread_cache* thread_cache_find() const
+        {
+            for (const thread_cache_slot& slot : t_threadCacheSlots)
+            {
+                if (slot.mAllocatorId == mThreadCacheId)
+                {
+                    return static_cast<thread_cache*>(slot.mCache);
+                }
+            }
+            return nullptr;
+        }
+
+        // returns the cache of the current thread, creating it on first use. NULL if the cache is disabled.
+        inline thread_cache* thread_cache_get()
+        {
+            if (!mUseThreadCache)
+            {
+                return nullptr;
+            }
+            thread_cache* cache = thread_cache_find();
+            if (!cache)
+            {
+                return thread_cache_create();
+            }
+            if (cache->mPurgeCount != mThreadCachePurgeCount.load(AZStd::memory_order_relaxed))
+            {
+                thread_cache_flush(cache);
+            }
+            return cache;
+        }
+        thread_cache* thread_cache_create();
+        void thread_cache_destroy(thread_cache* cache);
+        void thread_cache_flush(thread_cache* cache);
+        size_t thread_cache_size() const;
+
+        inline void* thread_cache_alloc(thread_cache* cache, unsigned bi)
+        {
+            thread_cache::bin& b = cache->mBins[bi];
+            if (!b.mFreeList)
+            {
+                b.mCount = bucket_alloc_batch(bi, thread_cache_max_count(bi) / 2, b.mFreeList);
+                if (!b.mFreeList)
+                {
+                    return nullptr;
+                }
+                cache->mSize.store(cache->mSize.load(AZStd::memory_order_relaxed) + b.mCount * bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+            }
+            free_link* lnk = b.mFreeList;
+            b.mFreeList = lnk->mNext;
+            b.mCount--;
+            cache->mSize.store(cache->mSize.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+            return lnk;
+        }
+
+        inline void thread_cache_free(thread_cache* cache, void* ptr, unsigned bi)
+        {
+            thread_cache::bin& b = cache->mBins[bi];
+            free_link* lnk = (free_link*)ptr;
+            lnk->mNext = b.mFreeList;
+            b.mFreeList = lnk;
+            b.mCount++;
+            const size_t cacheSize = cache->mSize.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi);
+            const unsigned maxCount = thread_cache_max_count(bi);
+            if (b.mCount <= maxCount)
+            {
+                cache->mSize.store(cacheSize, AZStd::memory_order_relaxed);
+                return;
+            }
+            // keep the most recently freed elements, they are the most likely to be in the cpu cache
+            const unsigned keepCount = maxCount / 2;
+            free_link* last = b.mFreeList;
+            for (unsigned i = 1; i < keepCount; ++i)
+            {
+                last = last->mNext;
+            }
+            free_link* list = last->mNext;
+            last->mNext = nullptr;
+            cache->mSize.store(cacheSize - (b.mCount - keepCount) * bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+            b.mCount = keepCount;
+            bucket_free_batch(bi, list);
+        }
+
+        // returns the caches of the current thread to their allocators, called when a thread that used them exits
+        static void thread_cache_thread_exit();
+
+        // all the allocators that can have thread caches, so an exiting thread can find out which of its caches
+        // still have a live allocator to return to
+        static AZStd::mutex& thread_cache_registry_mutex();
+        static HpAllocator* thread_cache_find_allocator(size_t id);
+        static HpAllocator* sThreadCacheAllocators;
+        static size_t sThreadCacheNextId;
+
+        HpAllocator* mNextThreadCacheAllocator = nullptr;
+        thread_cache_list mThreadCaches;
+        size_t mThreadCacheId = 0;
+        size_t mThreadCacheOverhead = 0;
+        AZStd::atomic<unsigned> mThreadCachePurgeCount{ 0 };
+        bool mUseThreadCache = false;
+#endif // USE_THREAD_CACHE
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -718,7 +872,8 @@ namespace AZ {
 
 #endif // DEBUG_ALLOCATOR
 
-        size_t mTotalAllocatedSizeBuckets = 0;
+        // updated under the lock of each bucket, so it needs to be atomic
+        AZStd::atomic<size_t> mTotalAllocatedSizeBuckets{ 0 };
         size_t mTotalCapacitySizeBuckets = 0;
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
@@ -1046,6 +1201,16 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef USE_THREAD_CACHE
+            // other threads return their cached elements the next time they use the allocator, so the pages they
+            // hold are released by a later purge
+            mThreadCachePurgeCount.fetch_add(1, AZStd::memory_order_relaxed);
+            thread_cache* cache = mUseThreadCache ? thread_cache_find() : nullptr;
+            if (cache)
+            {
+                thread_cache_flush(cache);
+            }
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1062,7 +1227,11 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#ifdef USE_THREAD_CACHE
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_size();
+#else
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+#endif
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1170,6 +1339,14 @@ namespace AZ {
     #   endif // MULTITHREADED
     #endif // AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #endif
+
+#ifdef USE_THREAD_CACHE
+        mUseThreadCache = desc.m_useThreadCache && m_isPoolAllocations;
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        mThreadCacheId = ++sThreadCacheNextId;
+        mNextThreadCacheAllocator = sThreadCacheAllocators;
+        sThreadCacheAllocators = this;
+#endif
     }
 
     HpAllocator::~HpAllocator()
@@ -1179,7 +1356,25 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+#ifdef USE_THREAD_CACHE
+        {
+            // the allocator is no longer used by any thread, return what they cached so their pages can be purged
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+            while (!mThreadCaches.empty())
+            {
+                thread_cache_destroy(&mThreadCaches.front());
+            }
+            mUseThreadCache = false;
+            HpAllocator** allocator = &sThreadCacheAllocators;
+            while (*allocator != this)
+            {
+                allocator = &(*allocator)->mNextThreadCacheAllocator;
+            }
+            *allocator = mNextThreadCacheAllocator;
+        }
+#endif
+
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1342,6 +1537,12 @@ namespace AZ {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1370,6 +1571,12 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_alloc(cache, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1437,6 +1644,12 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1455,6 +1668,12 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#ifdef USE_THREAD_CACHE
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_free(cache, ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1569,6 +1788,194 @@ namespace AZ {
         }
     }
 
+#ifdef USE_THREAD_CACHE
+    HpAllocator* HpAllocator::sThreadCacheAllocators = nullptr;
+    size_t HpAllocator::sThreadCacheNextId = 0;
+
+    namespace
+    {
+        // returns the thread caches of a thread to their allocators when it exits
+        struct thread_cache_exit_guard
+        {
+            ~thread_cache_exit_guard()
+            {
+                HpAllocator::thread_cache_thread_exit();
+            }
+        };
+    }
+
+    unsigned HpAllocator::bucket_alloc_batch(unsigned bi, unsigned count, free_link*& list)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        free_link** tail = &list;
+        size_t allocatedSize = 0;
+        unsigned allocatedCount = 0;
+        for (; allocatedCount < count; ++allocatedCount)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            allocatedSize += p->elem_size();
+            free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+            *tail = lnk;
+            tail = &lnk->mNext;
+        }
+        *tail = nullptr;
+        mTotalAllocatedSizeBuckets += allocatedSize;
+        return allocatedCount;
+    }
+
+    void HpAllocator::bucket_free_batch(unsigned bi, free_link* list)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        size_t freedSize = 0;
+        while (list)
+        {
+            free_link* next = list->mNext;
+            page* p = ptr_get_page(list);
+            // if this asserts, the free size doesn't match the allocated size
+            HPPA_ASSERT(bi == p->bucket_index());
+            freedSize += p->elem_size();
+            mBuckets[bi].free(p, list);
+            list = next;
+        }
+        mTotalAllocatedSizeBuckets -= freedSize;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_create()
+    {
+        // make sure the caches of this thread are returned when it exits
+        static thread_local thread_cache_exit_guard exitGuard;
+        (void)exitGuard;
+
+        // allocate the cache before taking the registry lock, the tree may need memory from a sub allocator
+        void* mem = tree_alloc(sizeof(thread_cache));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        thread_cache* cache = new (mem) thread_cache();
+        cache->mPurgeCount = mThreadCachePurgeCount.load(AZStd::memory_order_relaxed);
+
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        thread_cache_slot* freeSlot = nullptr;
+        for (thread_cache_slot& slot : t_threadCacheSlots)
+        {
+            if (slot.mAllocatorId == 0 || !thread_cache_find_allocator(slot.mAllocatorId))
+            {
+                freeSlot = &slot;
+                break;
+            }
+        }
+        if (!freeSlot)
+        {
+            // the thread uses more allocators than it has slots, give up the cache of the last one
+            freeSlot = &t_threadCacheSlots[THREAD_CACHE_SLOTS - 1];
+            thread_cache_find_allocator(freeSlot->mAllocatorId)->thread_cache_destroy(static_cast<thread_cache*>(freeSlot->mCache));
+        }
+        mThreadCaches.push_back(cache);
+        mThreadCacheOverhead += tree_ptr_size(cache);
+        freeSlot->mAllocatorId = mThreadCacheId;
+        freeSlot->mCache = cache;
+        return cache;
+    }
+
+    void HpAllocator::thread_cache_destroy(thread_cache* cache)
+    {
+        thread_cache_flush(cache);
+        cache->unlink();
+        mThreadCacheOverhead -= tree_ptr_size(cache);
+        cache->~thread_cache();
+        tree_free(cache);
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache* cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; bi++)
+        {
+            thread_cache::bin& b = cache->mBins[bi];
+            if (b.mFreeList)
+            {
+                free_link* list = b.mFreeList;
+                cache->mSize.store(cache->mSize.load(AZStd::memory_order_relaxed) - b.mCount * bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+                b.mFreeList = nullptr;
+                b.mCount = 0;
+                bucket_free_batch(bi, list);
+            }
+        }
+        cache->mPurgeCount = mThreadCachePurgeCount.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t HpAllocator::thread_cache_size() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        size_t size = mThreadCacheOverhead;
+        const thread_cache* cacheEnd = mThreadCaches.end();
+        for (const thread_cache* cache = mThreadCaches.begin(); cache != cacheEnd; cache = cache->next())
+        {
+            size += cache->mSize.load(AZStd::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    void HpAllocator::thread_cache_thread_exit()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache_slot& slot : t_threadCacheSlots)
+        {
+            if (slot.mAllocatorId != 0)
+            {
+                if (HpAllocator* allocator = thread_cache_find_allocator(slot.mAllocatorId))
+                {
+                    allocator->thread_cache_destroy(static_cast<thread_cache*>(slot.mCache));
+                }
+                slot.mAllocatorId = 0;
+                slot.mCache = nullptr;
+            }
+        }
+    }
+
+    AZStd::mutex& HpAllocator::thread_cache_registry_mutex()
+    {
+        static AZStd::mutex registryMutex;
+        return registryMutex;
+    }
+
+    HpAllocator* HpAllocator::thread_cache_find_allocator(size_t id)
+    {
+        for (HpAllocator* allocator = sThreadCacheAllocators; allocator; allocator = allocator->mNextThreadCacheAllocator)
+        {
+            if (allocator->mThreadCacheId == id)
+            {
+                return allocator;
+            }
+        }
+        return nullptr;
+    }
+#endif // USE_THREAD_CACHE
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
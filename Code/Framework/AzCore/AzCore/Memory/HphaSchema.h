@@ -33,6 +33,7 @@ namespace AZ
                 , m_pageSize(AZ_PAGE_SIZE)
                 , m_poolPageSize(4*1024)
                 , m_isPoolAllocations(true)
+                , m_useThreadCache(true)
                 , m_fixedMemoryBlockByteSize(0)
                 , m_fixedMemoryBlock(nullptr)
                 , m_subAllocator(nullptr)
@@ -44,6 +45,7 @@ namespace AZ
             unsigned int            m_pageSize;                             ///< Page allocation size must be 1024 bytes aligned.
             unsigned int            m_poolPageSize : 31;                    ///< Page size used to small memory allocations. Must be less or equal to m_pageSize and a multiple of it.
             unsigned int            m_isPoolAllocations : 1;                ///< True to allow allocations from pools, otherwise false.
+            bool                    m_useThreadCache;                       ///< True to keep a per thread cache of small (pool) allocations, which avoids taking the pool locks on most allocations.
             size_t                  m_fixedMemoryBlockByteSize;             ///< Memory block size, if 0 we use the OS memory allocation functions.
             void*                   m_fixedMemoryBlock;                     ///< Can be NULL if so the we will allocate memory from the subAllocator if m_memoryBlocksByteSize is != 0.
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
@@ -8,6 +8,7 @@
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/Math/Crc.h>
 
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
@@ -23,9 +24,11 @@ namespace AZ
     {
         m_isPoolAllocator = true;
         m_isThreadPoolAllocator = true;
+        m_isFrameAllocator = true;
 
         m_createdPoolAllocator = false;
         m_createdThreadPoolAllocator = false;
+        m_createdFrameAllocator = false;
     }
 
     //=========================================================================
@@ -38,6 +41,10 @@ namespace AZ
         // and create in activate. But memory component is special that
         // it must be operational after Init so all parts of the engine can be operational.
         // This is why we must check the destructor (which is symmetrical to Init() anyway)
+        if (m_createdFrameAllocator && AZ::AllocatorInstance<AZ::FrameAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Destroy();
+        }
         if (m_createdThreadPoolAllocator && AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
         {
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
@@ -67,6 +74,11 @@ namespace AZ
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
             m_createdThreadPoolAllocator = true;
         }
+        if (m_isFrameAllocator)
+        {
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Create();
+            m_createdFrameAllocator = true;
+        }
     }
 
     //=========================================================================
@@ -112,6 +124,7 @@ namespace AZ
                 ->Version(1)
                 ->Field("isPoolAllocator", &MemoryComponent::m_isPoolAllocator)
                 ->Field("isThreadPoolAllocator", &MemoryComponent::m_isThreadPoolAllocator)
+                ->Field("isFrameAllocator", &MemoryComponent::m_isFrameAllocator)
                 ;
 
             ;
@@ -123,6 +136,7 @@ namespace AZ
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isPoolAllocator, "Pool allocator", "Fast allocation pooling for small allocations < 256 bytes, use from main thread only!")
                     ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isThreadPoolAllocator, "Thread pool allocator", "Fast allocation pool that can be used from any thread, if uses more memory! (as it keeps the pools per thread)")
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &MemoryComponent::m_isFrameAllocator, "Frame allocator", "Per thread linear allocator for temporary memory that is only used until the end of the next frame")
                     ;
             }
         }
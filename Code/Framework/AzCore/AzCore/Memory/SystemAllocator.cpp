@@ -108,6 +108,7 @@ SystemAllocator::Create(const Descriptor& desc)
         }
         heapDesc.m_subAllocator = desc.m_heap.m_subAllocator;
         heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
+        heapDesc.m_useThreadCache = desc.m_heap.m_useThreadCache;
         // Fix SystemAllocator from growing in small chunks
         heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
 
@@ -36,9 +36,11 @@ namespace AZ
         void NameData::release()
         {
             AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
+            // The entry may be reclaimed as soon as the count reaches 0, so don't touch it after that.
+            const Hash hash = m_hash;
             if (m_useCount.fetch_sub(1) == 1)
             {
-                AZ::NameDictionary::Instance().TryReleaseName(this);
+                AZ::NameDictionary::Instance().TryReleaseName(hash);
             }
         }
     }
@@ -10,6 +10,7 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -75,6 +76,45 @@ namespace AZ
         return *(*s_instance);
     }
     
+    NameDictionary::SlotTable::SlotTable(size_t capacity)
+        : m_capacity(capacity)
+    {
+        AZ_Assert((capacity & (capacity - 1)) == 0, "SlotTable capacity must be a power of two");
+        using Slot = AZStd::atomic<Internal::NameData*>;
+        m_slots = reinterpret_cast<Slot*>(azmalloc(sizeof(Slot) * capacity, alignof(Slot), AZ::OSAllocator, "NameDictionary"));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (m_slots + i) Slot(nullptr);
+        }
+    }
+
+    NameDictionary::SlotTable::~SlotTable()
+    {
+        azfree(m_slots, AZ::OSAllocator);
+    }
+
+    NameDictionary::ShardReadScope::ShardReadScope(Shard& shard)
+        : m_shard(shard)
+    {
+        // Register with the reader count of the current epoch. If the epoch changed before we were counted, the thread
+        // waiting for readers might have missed us, so register again with the new epoch.
+        while (true)
+        {
+            m_readerIndex = m_shard.m_readerEpoch.load() & 1;
+            m_shard.m_readerCounts[m_readerIndex].fetch_add(1);
+            if ((m_shard.m_readerEpoch.load() & 1) == m_readerIndex)
+            {
+                break;
+            }
+            m_shard.m_readerCounts[m_readerIndex].fetch_sub(1);
+        }
+    }
+
+    NameDictionary::ShardReadScope::~ShardReadScope()
+    {
+        m_shard.m_readerCounts[m_readerIndex].fetch_sub(1);
+    }
+
     NameDictionary::NameDictionary()
     {}
 
@@ -82,23 +122,26 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        ForEachEntry([&leaksDetected](Internal::NameData* nameData)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            const int useCount = nameData->m_useCount;
 
             if (useCount == 0)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                // Released names that haven't been reclaimed yet, and entries that had resolved hash collisions,
+                // are allowed to remain in the dictionary until shutdown.
                 delete nameData;
             }
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
             }
+        });
+
+        for (Shard& shard : m_shards)
+        {
+            delete shard.m_table.load();
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
@@ -106,11 +149,14 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        Shard& shard = GetShard(hash);
+        ShardReadScope readScope(shard);
+        Internal::NameData* nameData = FindEntry(shard, hash);
+        if (nameData && TryAcquire(nameData, false))
         {
-            return Name(iter->second);
+            Name name(nameData);
+            --nameData->m_useCount; // Drop the reference taken by TryAcquire, the Name holds its own
+            return name;
         }
         return Name();
     }
@@ -123,49 +169,65 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        const Name::Hash originalHash = CalcHash(nameString);
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // If we find the same name, just return it. This path doesn't lock, it follows the chain of resolved hash
+        // collisions until it finds the name or an unused hash.
+        for (Name::Hash hash = originalHash; ; ++hash)
         {
-            return AZStd::move(name);
+            Shard& shard = GetShard(hash);
+            ShardReadScope readScope(shard);
+            Internal::NameData* nameData = FindEntry(shard, hash);
+            if (!nameData)
+            {
+                break;
+            }
+            else if (nameData->GetName() == nameString)
+            {
+                // Released names can be picked up again as long as they are still in the dictionary.
+                if (TryAcquire(nameData, true))
+                {
+                    Name name(nameData);
+                    --nameData->m_useCount; // Drop the reference taken by TryAcquire, the Name holds its own
+                    return name;
+                }
+                break;
+            }
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
+        // The name doesn't exist in the dictionary, so we have to lock and add it. Every shard along the collision
+        // chain is locked in turn, entries are only added or removed while holding the lock of their shard.
         bool collisionDetected = false;
-        while (true)
+        for (Name::Hash hash = originalHash; ; ++hash)
         {
+            Shard& shard = GetShard(hash);
+            AZStd::lock_guard<AZStd::mutex> lock(shard.m_mutex);
+
+            Internal::NameData* nameData = FindEntry(shard, hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (!nameData)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                InsertEntry(shard, nameData);
                 return Name(nameData);
             }
-            // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            // Found the desired entry, return it. Entries are only reclaimed while holding the shard lock,
+            // so this one can't be deleted even if it was released.
+            else if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
             }
         }
     }
 
-    void NameDictionary::TryReleaseName(Internal::NameData* nameData)
+    void NameDictionary::TryReleaseName(Name::Hash hash)
     {
         // Note that we don't remove NameData from the dictionary if it has been involved in a collision.
         // This avoids specific edge cases where a Name object could get an incorrect hash value. Consider
@@ -177,36 +239,190 @@ namespace AZ
         //      try to find that hash in the dictionary, and nothing is found. So now "world" is added to
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
+        // Colliding entries are skipped by ReclaimReleasedNames().
 
-        // Early exit to avoid locking the mutex unnecessarily.
-        if (nameData->m_hashCollision)
+        // Released names are reclaimed in batches so releasing a name usually doesn't lock anything. If another
+        // thread is already working on this shard, the next release will try again.
+        Shard& shard = GetShard(hash);
+        if (shard.m_releasedCount.fetch_add(1) + 1 < ReclaimBatchSize)
         {
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::unique_lock<AZStd::mutex> lock(shard.m_mutex, AZStd::try_to_lock);
+        if (lock.owns_lock())
+        {
+            ReclaimReleasedNames(shard);
+        }
+    }
+
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash & (ShardCount - 1)];
+    }
+
+    Internal::NameData* NameDictionary::FindEntry(const Shard& shard, Name::Hash hash)
+    {
+        const SlotTable* table = shard.m_table.load();
+        if (!table)
+        {
+            return nullptr;
+        }
+
+        const size_t mask = table->m_capacity - 1;
+        size_t index = (hash >> ShardCountLog2) & mask;
+        for (size_t probeCount = 0; probeCount < table->m_capacity; ++probeCount, index = (index + 1) & mask)
+        {
+            Internal::NameData* nameData = table->m_slots[index].load();
+            if (!nameData)
+            {
+                return nullptr;
+            }
+            if (IsEntry(nameData) && nameData->GetHash() == hash)
+            {
+                return nameData;
+            }
+        }
+        return nullptr;
+    }
+
+    bool NameDictionary::TryAcquire(Internal::NameData* nameData, bool allowReleased)
+    {
+        // A use count of -1 means the entry is being reclaimed.
+        int32_t useCount = nameData->m_useCount.load();
+        do
+        {
+            if (useCount < 0 || (useCount == 0 && !allowReleased))
+            {
+                return false;
+            }
+        } while (!nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1));
+        return true;
+    }
+
+    bool NameDictionary::IsReleased(const Internal::NameData* nameData)
+    {
+        return nameData->m_useCount <= 0 && !nameData->m_hashCollision;
+    }
+
+    void NameDictionary::InsertEntry(Shard& shard, Internal::NameData* nameData)
+    {
+        SlotTable* table = shard.m_table.load();
+
+        // Keep the load factor, including tombstones, below 3/4. Before growing, try to make room by reclaiming
+        // released names, then rebuild the table without tombstones.
+        if (!table || (table->m_usedSlots + 1) * 4 > table->m_capacity * 3)
+        {
+            size_t entryCount = 0;
+            if (table)
+            {
+                ReclaimReleasedNames(shard);
+                for (size_t i = 0; i < table->m_capacity; ++i)
+                {
+                    entryCount += IsEntry(table->m_slots[i].load()) ? 1 : 0;
+                }
+            }
+
+            size_t capacity = table ? table->m_capacity : InitialShardCapacity;
+            while ((entryCount + 1) * 2 > capacity)
+            {
+                capacity *= 2;
+            }
+
+            SlotTable* newTable = aznew SlotTable(capacity);
+            if (table)
+            {
+                for (size_t i = 0; i < table->m_capacity; ++i)
+                {
+                    Internal::NameData* entry = table->m_slots[i].load();
+                    if (IsEntry(entry))
+                    {
+                        StoreEntry(*newTable, entry);
+                    }
+                }
+            }
+
+            shard.m_table.store(newTable);
+            if (table)
+            {
+                WaitForReaders(shard);
+                delete table;
+            }
+            table = newTable;
+        }
+
+        StoreEntry(*table, nameData);
+    }
+
+    void NameDictionary::StoreEntry(SlotTable& table, Internal::NameData* nameData)
+    {
+        const size_t mask = table.m_capacity - 1;
+        size_t index = (nameData->GetHash() >> ShardCountLog2) & mask;
+        while (IsEntry(table.m_slots[index].load()))
+        {
+            index = (index + 1) & mask;
+        }
+
+        if (!table.m_slots[index].load())
+        {
+            ++table.m_usedSlots;
+        }
+        table.m_slots[index].store(nameData);
+    }
+
+    void NameDictionary::ReclaimReleasedNames(Shard& shard)
+    {
+        shard.m_releasedCount = 0;
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        SlotTable* table = shard.m_table.load();
+        if (!table)
         {
             return;
         }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+        AZStd::vector<Internal::NameData*> reclaimedNames;
+        for (size_t i = 0; i < table->m_capacity; ++i)
+        {
+            Internal::NameData* nameData = table->m_slots[i].load();
+            if (!IsEntry(nameData) || nameData->m_hashCollision)
+            {
+                continue;
+            }
+
+            // Set the count to -1 so lookups that still see the entry won't pick it up again.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                table->m_slots[i].store(reinterpret_cast<Internal::NameData*>(TombstoneValue));
+                reclaimedNames.push_back(nameData);
+            }
+        }
+
+        if (!reclaimedNames.empty())
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Lock free lookups may have loaded one of these entries before it was replaced by a tombstone.
+            WaitForReaders(shard);
+            for (Internal::NameData* nameData : reclaimedNames)
+            {
+                delete nameData;
+            }
         }
 
         ReportStats();
     }
 
+    void NameDictionary::WaitForReaders(Shard& shard)
+    {
+        // Readers that register after the epoch changes can only see the current state of the table, so only
+        // the ones counted in the previous epoch need to finish. This relies on a single thread waiting at a
+        // time, which is guaranteed by holding the shard mutex.
+        const uint32_t previousReaderIndex = shard.m_readerEpoch.fetch_add(1) & 1;
+        while (shard.m_readerCounts[previousReaderIndex].load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
     void NameDictionary::ReportStats() const
     {
 #ifdef AZ_DEBUG_BUILD
@@ -222,34 +438,41 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            ForEachEntry([&](Internal::NameData* nameData)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                if (nameData->m_useCount <= 0)
+                {
+                    return;
+                }
+
+                ++nameCount;
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
-            }
+            });
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -7,10 +7,13 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -42,6 +45,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards selected by the name hash. Looking up an existing name doesn't
+    //! take any lock, only adding a name locks the shard it goes into. Releasing the last reference to a
+    //! name leaves the entry in place so it can be picked up again cheaply; released entries are removed
+    //! in batches and only deleted once no lookup on that shard can still be reading them.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -80,17 +88,118 @@ namespace AZ
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
-        // Attempts to release the name from the dictionary, but checks to make sure
-        // a reference wasn't taken by another thread.
-        void TryReleaseName(Internal::NameData* data);
+        // Called when the last reference to the name with this hash is released. The entry stays in the
+        // dictionary until enough names have been released on its shard to reclaim them as a batch.
+        void TryReleaseName(Name::Hash hash);
         
         //////////////////////////////////////////////////////////////////////////
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        static constexpr size_t ShardCountLog2 = 6;
+        static constexpr size_t ShardCount = size_t(1) << ShardCountLog2;
+        static constexpr size_t InitialShardCapacity = 16;
+        static constexpr uint32_t ReclaimBatchSize = 64;
+
+        // Open addressing table of entries keyed by the (collision resolved) name hash. Slots are only written
+        // while holding the shard mutex but can be read at any time from inside a ShardReadScope.
+        struct SlotTable
+        {
+            AZ_CLASS_ALLOCATOR(SlotTable, AZ::OSAllocator, 0);
+
+            explicit SlotTable(size_t capacity);
+            ~SlotTable();
+
+            size_t m_capacity = 0;
+            size_t m_usedSlots = 0; // Entries and tombstones, used to decide when the table needs to be rebuilt
+            AZStd::atomic<Internal::NameData*>* m_slots = nullptr;
+        };
+
+        // Shards are kept on their own cache lines so threads working on different names don't contend.
+        struct alignas(64) Shard
+        {
+            AZStd::atomic<SlotTable*> m_table = { nullptr };
+
+            // Lookups register in one of two reader counts, selected by the parity of the epoch. Deleting entries
+            // flips the epoch and waits for the previous reader count to drain.
+            AZStd::atomic<uint32_t> m_readerEpoch = { 0 };
+            AZStd::atomic<uint32_t> m_readerCounts[2] = { {0}, {0} };
+
+            // Number of entries whose reference count dropped to zero since the last time this shard was reclaimed.
+            AZStd::atomic<uint32_t> m_releasedCount = { 0 };
+            AZStd::mutex m_mutex;
+        };
+
+        // Marks a lock free read of a shard for the duration of its lifetime.
+        class ShardReadScope
+        {
+        public:
+            explicit ShardReadScope(Shard& shard);
+            ~ShardReadScope();
+
+        private:
+            Shard& m_shard;
+            uint32_t m_readerIndex;
+        };
+
+        Shard& GetShard(Name::Hash hash) const;
+
+        // Marks a slot whose entry was removed, lookups have to keep probing past it.
+        static constexpr uintptr_t TombstoneValue = 1;
+
+        static bool IsEntry(const Internal::NameData* slotValue)
+        {
+            return slotValue && reinterpret_cast<uintptr_t>(slotValue) != TombstoneValue;
+        }
+
+        // Returns true if nothing references the entry anymore and it can be reclaimed.
+        static bool IsReleased(const Internal::NameData* nameData);
+
+        // Returns the entry stored under exactly this hash, or null. Must be called from inside a ShardReadScope
+        // or while holding the shard mutex.
+        static Internal::NameData* FindEntry(const Shard& shard, Name::Hash hash);
+
+        // Adds a reference to an entry found by a lock free lookup. Fails if the entry is being deleted, and if
+        // allowReleased is false also when nothing references the entry anymore.
+        static bool TryAcquire(Internal::NameData* nameData, bool allowReleased);
+
+        // Inserts a new entry, rebuilding the table if it is too full. Must be called while holding the shard mutex.
+        void InsertEntry(Shard& shard, Internal::NameData* nameData);
+
+        // Stores the entry in the first free slot of its probe sequence.
+        static void StoreEntry(SlotTable& table, Internal::NameData* nameData);
+
+        // Removes released entries from the shard and deletes them once no reader can see them.
+        // Must be called while holding the shard mutex.
+        void ReclaimReleasedNames(Shard& shard);
+
+        // Waits until every lookup that started before this call on the shard has finished.
+        static void WaitForReaders(Shard& shard);
+
+        // Calls visitor(Internal::NameData*) for every entry in the dictionary, including released entries that
+        // haven't been reclaimed yet. Not safe to use while other threads add or reclaim names.
+        template<typename Visitor>
+        void ForEachEntry(Visitor&& visitor) const;
+
+        mutable AZStd::array<Shard, ShardCount> m_shards;
     };
+
+    template<typename Visitor>
+    void NameDictionary::ForEachEntry(Visitor&& visitor) const
+    {
+        for (const Shard& shard : m_shards)
+        {
+            const SlotTable* table = shard.m_table.load();
+            for (size_t i = 0; table && i < table->m_capacity; ++i)
+            {
+                Internal::NameData* nameData = table->m_slots[i].load();
+                if (IsEntry(nameData))
+                {
+                    visitor(nameData);
+                }
+            }
+        }
+    }
 }
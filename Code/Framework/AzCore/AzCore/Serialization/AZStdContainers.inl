@@ -363,6 +363,18 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            void* GetContiguousElements(void* instance) override
+            {
+                return reinterpret_cast<T*>(instance)->data();
+            }
+
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                auto arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(numElements);
+                return arrayPtr->data();
+            }
         };
         template<class T, bool IsStableIterators, size_t N>
         class AZStdFixedCapacityRandomAccessContainer
@@ -394,6 +406,17 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                if (numElements > N)
+                {
+                    return nullptr;
+                }
+                T* arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(numElements);
+                return arrayPtr->data();
+            }
         };
 
         class AZStdArrayEvents : public SerializeContext::IEventHandler
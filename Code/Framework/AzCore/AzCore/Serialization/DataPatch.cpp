@@ -2112,6 +2112,23 @@ namespace AZ
         return AZ::Success();
     }
 
+    //=========================================================================
+    // GetAddressHash
+    //=========================================================================
+    size_t DataPatch::GetAddressHash() const
+    {
+        // The patch map is unordered, so the address hashes are combined in a way that doesn't depend on the order.
+        size_t addressesHash = 0;
+        for (const auto& patch : m_patch)
+        {
+            addressesHash += AZStd::hash<AddressType>()(patch.first);
+        }
+
+        size_t hash = m_targetClassId.GetHash();
+        AZStd::hash_combine(hash, addressesHash, m_patch.size());
+        return hash;
+    }
+
     //=========================================================================
     // Apply
     //=========================================================================
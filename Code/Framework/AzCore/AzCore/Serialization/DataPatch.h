@@ -364,6 +364,10 @@ namespace AZ
             return !m_patch.empty();
         }
 
+        /// \returns a hash of the target class and the patched addresses, without the patched values. Identical patches
+        /// have the same hash, so patches with different hashes are known to be different without comparing their values.
+        size_t GetAddressHash() const;
+
         /**
          * Reflect a patch for serialization.
          */
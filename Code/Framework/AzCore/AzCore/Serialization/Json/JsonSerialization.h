@@ -16,6 +16,11 @@
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     class BaseJsonSerializer;
     
     enum class JsonMergeApproach
@@ -152,6 +157,39 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the json text from the provided stream into the supplied object. The object is expected to be created before calling
+        //! load. Unlike Load, the text isn't parsed into a document first but read directly into the object, which avoids holding
+        //! a document for the full text in memory. Values that can't be read this way, such as pointers, are still read through a
+        //! document that only contains that value. The loaded object and reported issues are the same as for Load, except for
+        //! malformed json which will be reported when encountered, potentially leaving the object partially loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream containing the json text, read from its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json text from the provided stream into the supplied object. See the other LoadFromStream for more details.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream containing the json text, read from its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the json text from the provided stream into the supplied object. See the other LoadFromStream for more details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json text, read from its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json text from the provided stream into the supplied object. See the other LoadFromStream for more details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json text, read from its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -311,6 +349,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -0,0 +1,991 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <limits>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/MapSerializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/Json/StackedString.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace JsonStreamingDeserializerInternal
+    {
+        //! Wraps a GenericStream so it can be used as an input stream for the rapidjson reader. Data is read from the stream
+        //! in blocks and a terminating zero is added once the end of the stream has been reached, similar to rapidjson's
+        //! FileReadStream.
+        class RapidJSONStreamReader
+        {
+        public:
+            typedef char Ch;    //!< Character type. Only support char.
+
+            explicit RapidJSONStreamReader(IO::GenericStream& stream, size_t readBufferSize = 64 * 1024)
+                : m_stream(stream)
+            {
+                m_buffer.resize(AZStd::max(readBufferSize, size_t(4)));
+                m_current = m_buffer.data();
+                m_last = m_buffer.data();
+                Read();
+            }
+
+            RapidJSONStreamReader(const RapidJSONStreamReader&) = delete;
+            RapidJSONStreamReader& operator=(const RapidJSONStreamReader&) = delete;
+
+            char Peek() const
+            {
+                return *m_current;
+            }
+
+            char Take()
+            {
+                char c = *m_current;
+                Read();
+                return c;
+            }
+
+            size_t Tell() const
+            {
+                return m_count + static_cast<size_t>(m_current - m_buffer.data());
+            }
+
+            // Not implemented
+            void Put(char)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Put not supported.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Flush not supported.");
+            }
+            char* PutBegin()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutBegin not supported.");
+                return nullptr;
+            }
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutEnd not supported.");
+                return 0;
+            }
+
+        private:
+            void Read()
+            {
+                if (m_current < m_last)
+                {
+                    ++m_current;
+                }
+                else if (!m_endOfStream)
+                {
+                    m_count += m_readCount;
+                    m_readCount = aznumeric_cast<size_t>(m_stream.Read(m_buffer.size(), m_buffer.data()));
+                    m_current = m_buffer.data();
+                    m_last = m_buffer.data() + m_readCount - 1;
+                    if (m_readCount < m_buffer.size())
+                    {
+                        m_buffer[m_readCount] = '\0';
+                        ++m_last;
+                        m_endOfStream = true;
+                    }
+                }
+            }
+
+            IO::GenericStream& m_stream;
+            AZStd::vector<char> m_buffer;
+            char* m_current{ nullptr };
+            char* m_last{ nullptr };
+            size_t m_readCount{ 0 };
+            size_t m_count{ 0 };
+            bool m_endOfStream{ false };
+        };
+    } // namespace JsonStreamingDeserializerInternal
+
+    JsonStreamingDeserializer::Frame::Frame(FrameType type)
+        : m_result(JsonSerializationResult::Tasks::ReadField)
+        , m_finalResult(JsonSerializationResult::Tasks::ReadField)
+        , m_keyResult(JsonSerializationResult::Tasks::ReadField)
+        , m_type(type)
+    {
+    }
+
+    JsonStreamingDeserializer::JsonStreamingDeserializer(JsonDeserializerContext& context)
+        : m_context(context)
+        , m_rootResult(JsonSerializationResult::Tasks::ReadField)
+        , m_captureAllocator(m_captureBuffer, CaptureBufferSize)
+        , m_captureStack(rapidjson::kArrayType)
+    {
+        m_frames.reserve(32);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(
+        void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        JsonStreamingDeserializer handler(context);
+        Target root;
+        root.m_object = object;
+        root.m_typeId = typeId;
+        handler.PushFrame(FrameType::Root, root);
+        handler.m_frames.back().m_next = root;
+
+        JsonStreamingDeserializerInternal::RapidJSONStreamReader input(stream);
+        rapidjson::Reader reader;
+        constexpr unsigned int flags = rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+        rapidjson::ParseResult parseResult = reader.Parse<flags>(input, handler);
+        if (parseResult.IsError())
+        {
+            handler.ReleaseReservedElements();
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Unable to parse json stream: %s (offset: %zu).",
+                    rapidjson::GetParseError_En(parseResult.Code()), parseResult.Offset()));
+        }
+        return handler.m_rootResult;
+    }
+
+    bool JsonStreamingDeserializer::Null()
+    {
+        return LoadScalar(rapidjson::Value());
+    }
+
+    bool JsonStreamingDeserializer::Bool(bool value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int(int value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint(unsigned value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Int64(int64_t value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Uint64(uint64_t value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::Double(double value)
+    {
+        return LoadScalar(rapidjson::Value(value));
+    }
+
+    bool JsonStreamingDeserializer::RawNumber(const Ch* value, rapidjson::SizeType length, bool copy)
+    {
+        // Only called if numbers are parsed as strings, which is how the document based path would store them as well.
+        return String(value, length, copy);
+    }
+
+    bool JsonStreamingDeserializer::String(const Ch* value, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        if (m_frames.back().m_type == FrameType::Capture)
+        {
+            // The string from the reader is only valid during this call, so make a copy for the captured document.
+            CaptureString(value, length);
+            return true;
+        }
+        return LoadScalar(rapidjson::Value(rapidjson::StringRef(value, length)));
+    }
+
+    bool JsonStreamingDeserializer::StartObject()
+    {
+        return StartComposite(rapidjson::kObjectType);
+    }
+
+    bool JsonStreamingDeserializer::Key(const Ch* value, rapidjson::SizeType length, [[maybe_unused]] bool copy)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Capture:
+            CaptureString(value, length);
+            return true;
+        case FrameType::Skip:
+            return true;
+        case FrameType::Class:
+            StartClassField(frame, AZStd::string_view(value, length));
+            return true;
+        case FrameType::AssociativeContainer:
+            StartAssociativeContainerKey(frame, AZStd::string_view(value, length));
+            return true;
+        default:
+            AZ_Assert(false, "Json Streaming Deserializer encountered a key outside of an object.");
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::EndObject(rapidjson::SizeType memberCount)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Capture:
+            CaptureComposite(rapidjson::kObjectType, memberCount);
+            if (--frame.m_depth == 0)
+            {
+                FinishCapture();
+            }
+            return true;
+        case FrameType::Skip:
+            if (--frame.m_depth == 0)
+            {
+                m_frames.pop_back();
+            }
+            return true;
+        case FrameType::Class:
+            PopFrameAndComplete(EndClass(frame));
+            return true;
+        case FrameType::AssociativeContainer:
+            PopFrameAndComplete(EndAssociativeContainer(frame));
+            return true;
+        default:
+            AZ_Assert(false, "Json Streaming Deserializer encountered the end of an object that wasn't started.");
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::StartArray()
+    {
+        return StartComposite(rapidjson::kArrayType);
+    }
+
+    bool JsonStreamingDeserializer::EndArray(rapidjson::SizeType elementCount)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Capture:
+            CaptureComposite(rapidjson::kArrayType, elementCount);
+            if (--frame.m_depth == 0)
+            {
+                FinishCapture();
+            }
+            return true;
+        case FrameType::Skip:
+            if (--frame.m_depth == 0)
+            {
+                m_frames.pop_back();
+            }
+            return true;
+        case FrameType::BasicContainer:
+            PopFrameAndComplete(EndBasicContainer(frame));
+            return true;
+        default:
+            AZ_Assert(false, "Json Streaming Deserializer encountered the end of an array that wasn't started.");
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::LoadScalar(rapidjson::Value&& value)
+    {
+        switch (m_frames.back().m_type)
+        {
+        case FrameType::Capture:
+            m_captureStack.PushBack(value, m_captureAllocator);
+            return true;
+        case FrameType::Skip:
+            return true;
+        default:
+        {
+            Target target = NextTarget();
+            if (!target.m_skip)
+            {
+                CompleteValue(LoadValue(target, value));
+            }
+            return true;
+        }
+        }
+    }
+
+    bool JsonStreamingDeserializer::StartComposite(rapidjson::Type type)
+    {
+        Frame& top = m_frames.back();
+        if (top.m_type == FrameType::Capture || top.m_type == FrameType::Skip)
+        {
+            top.m_depth++;
+            return true;
+        }
+
+        Target target = NextTarget();
+        if (target.m_skip)
+        {
+            PushFrame(FrameType::Skip, target);
+            m_frames.back().m_depth = 1;
+            return true;
+        }
+
+        const SerializeContext::ClassData* classData = nullptr;
+        FrameType frameType = SelectFrameType(target, type, classData);
+        PushFrame(frameType, target);
+        Frame& frame = m_frames.back();
+        frame.m_classData = classData;
+        frame.m_depth = 1;
+        if (frameType == FrameType::BasicContainer)
+        {
+            StartBasicContainer(frame);
+        }
+        // Classes and associative containers are started when the first field is found as an object without fields is an
+        // explicit default, which is handled by the regular deserializer.
+        return true;
+    }
+
+    JsonStreamingDeserializer::Target JsonStreamingDeserializer::NextTarget()
+    {
+        Frame& frame = m_frames.back();
+        if (frame.m_type == FrameType::BasicContainer)
+        {
+            return NextBasicContainerTarget(frame);
+        }
+
+        Target target = frame.m_next;
+        frame.m_next = Target{};
+        frame.m_next.m_skip = true;
+        return target;
+    }
+
+    void JsonStreamingDeserializer::CompleteValue(JsonSerializationResult::ResultCode result)
+    {
+        Frame& frame = m_frames.back();
+        switch (frame.m_type)
+        {
+        case FrameType::Root:
+            m_rootResult = result;
+            break;
+        case FrameType::Class:
+            CompleteClassValue(frame, result);
+            break;
+        case FrameType::BasicContainer:
+            CompleteBasicContainerValue(frame, result);
+            break;
+        case FrameType::AssociativeContainer:
+            CompleteAssociativeContainerValue(frame, result);
+            break;
+        default:
+            AZ_Assert(false, "Json Streaming Deserializer completed a value for a frame that doesn't accept values.");
+            break;
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadValue(const Target& target, const rapidjson::Value& value)
+    {
+        if (target.m_classElement)
+        {
+            return JsonDeserializer::LoadWithClassElement(target.m_object, value, *target.m_classElement, m_context);
+        }
+        return target.m_isPointer
+            ? JsonDeserializer::LoadToPointer(target.m_object, target.m_typeId, value, m_context)
+            : JsonDeserializer::Load(target.m_object, target.m_typeId, value, target.m_isNewInstance, m_context);
+    }
+
+    void JsonStreamingDeserializer::PushFrame(FrameType type, const Target& target)
+    {
+        m_frames.emplace_back(type);
+        m_frames.back().m_target = target;
+    }
+
+    void JsonStreamingDeserializer::PopFrameAndComplete(JsonSerializationResult::ResultCode result)
+    {
+        m_frames.pop_back();
+        CompleteValue(result);
+    }
+
+    JsonStreamingDeserializer::FrameType JsonStreamingDeserializer::SelectFrameType(
+        const Target& target, rapidjson::Type type, const SerializeContext::ClassData*& classData)
+    {
+        // This follows the same order of checks as JsonDeserializer::Load. Anything that isn't loaded field by field or element
+        // by element is captured so the regular deserializer can process it, including all reporting.
+        if (target.m_isPointer || !target.m_object)
+        {
+            return FrameType::Capture;
+        }
+
+        JsonRegistrationContext* registrationContext = m_context.GetRegistrationContext();
+        BaseJsonSerializer* serializer = registrationContext->GetSerializerForType(target.m_typeId);
+        classData = m_context.GetSerializeContext()->FindClassData(target.m_typeId);
+        if (!classData)
+        {
+            return FrameType::Capture;
+        }
+
+        const bool isEnum = classData->m_azRtti &&
+            (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum;
+        if (!serializer && classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != target.m_typeId)
+        {
+            if ((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{ 0 })
+            {
+                return FrameType::Capture;
+            }
+            serializer = registrationContext->GetSerializerForType(classData->m_azRtti->GetGenericTypeId());
+        }
+
+        if (serializer)
+        {
+            if (!classData->m_container)
+            {
+                return FrameType::Capture;
+            }
+            const Uuid& serializerType = serializer->RTTI_GetType();
+            if (type == rapidjson::kArrayType && serializerType == azrtti_typeid<JsonBasicContainerSerializer>())
+            {
+                return FrameType::BasicContainer;
+            }
+            // The multi-map serializer is excluded as it loads elements differently.
+            if (type == rapidjson::kObjectType &&
+                (serializerType == azrtti_typeid<JsonMapSerializer>() || serializerType == azrtti_typeid<JsonUnorderedMapSerializer>()))
+            {
+                return FrameType::AssociativeContainer;
+            }
+            return FrameType::Capture;
+        }
+
+        return (type == rapidjson::kObjectType && !isEnum && !classData->m_container) ? FrameType::Class : FrameType::Capture;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadExplicitDefault(const Frame& frame)
+    {
+        const rapidjson::Value explicitDefault(rapidjson::kObjectType);
+        return LoadValue(frame.m_target, explicitDefault);
+    }
+
+    // Class
+
+    void JsonStreamingDeserializer::StartClassField(Frame& frame, AZStd::string_view name)
+    {
+        using namespace JsonSerializationResult;
+
+        frame.m_inputCount++;
+        if (frame.m_hasFinalResult || name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            return;
+        }
+
+        auto foundElementData = JsonDeserializer::FindElementByNameCrc(
+            *m_context.GetSerializeContext(), frame.m_target.m_object, *frame.m_classData, Crc32(name));
+        m_context.PushPath(name);
+        if (foundElementData.m_found)
+        {
+            frame.m_pathPushed = true;
+            frame.m_next.m_object = foundElementData.m_data;
+            frame.m_next.m_typeId = foundElementData.m_info->m_typeId;
+            frame.m_next.m_classElement = foundElementData.m_info;
+            frame.m_next.m_isPointer = (foundElementData.m_info->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+            frame.m_next.m_isNewInstance = false;
+            frame.m_next.m_skip = false;
+        }
+        else
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Skipping field as there's no matching variable in the target."));
+            m_context.PopPath();
+        }
+    }
+
+    void JsonStreamingDeserializer::CompleteClassValue(Frame& frame, JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        frame.m_result.Combine(result);
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            frame.m_finalResult = m_context.Report(result, "Loading of element has failed.");
+            frame.m_hasFinalResult = true;
+        }
+        else if (result.GetProcessing() != Processing::Altered)
+        {
+            frame.m_numLoads++;
+        }
+
+        if (frame.m_pathPushed)
+        {
+            m_context.PopPath();
+            frame.m_pathPushed = false;
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::EndClass(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        if (frame.m_inputCount == 0)
+        {
+            return LoadExplicitDefault(frame);
+        }
+        if (frame.m_hasFinalResult)
+        {
+            return frame.m_finalResult;
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+        if (elementCount > frame.m_numLoads)
+        {
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+        return frame.m_result;
+    }
+
+    // Basic container
+
+    void JsonStreamingDeserializer::StartBasicContainer(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        SerializeContext::IDataContainer* container = frame.m_classData->m_container;
+        frame.m_container = container;
+
+        const SerializeContext::ClassElement* classElement = nullptr;
+        auto typeEnumCallback = [&classElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!classElement, "There are multiple class elements registered for a basic container where only one was expected.");
+            classElement = genericClassElement;
+            return true;
+        };
+        container->EnumTypes(typeEnumCallback);
+        AZ_Assert(classElement, "No class element found for the type in the basic container.");
+        frame.m_element = classElement;
+
+        void* object = frame.m_target.m_object;
+        frame.m_capacity = container->IsFixedCapacity() ? container->Capacity(object) : std::numeric_limits<size_t>::max();
+        frame.m_initialSize = container->Size(object);
+        if (frame.m_initialSize > 0 && m_context.ShouldClearContainers())
+        {
+            JsonSerializationResult::Result result = m_context.Report(Tasks::Clear, Outcomes::Success, "Clearing basic container.");
+            if (result.GetResultCode().GetOutcome() == Outcomes::Success)
+            {
+                container->ClearElements(object, m_context.GetSerializeContext());
+                frame.m_initialSize = container->Size(object);
+                result = m_context.Report(Tasks::Clear, frame.m_initialSize == 0 ? Outcomes::Success : Outcomes::Unsupported,
+                    frame.m_initialSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
+            }
+            if (result.GetResultCode().GetProcessing() != Processing::Completed)
+            {
+                frame.m_finalResult = result;
+                frame.m_hasFinalResult = true;
+                return;
+            }
+            frame.m_result.Combine(result);
+        }
+    }
+
+    JsonStreamingDeserializer::Target JsonStreamingDeserializer::NextBasicContainerTarget(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        Target target;
+        target.m_skip = true;
+
+        size_t index = frame.m_inputCount++;
+        if (frame.m_hasFinalResult || frame.m_stopped)
+        {
+            return target;
+        }
+
+        void* object = frame.m_target.m_object;
+        SerializeContext::IDataContainer* container = frame.m_container;
+        m_context.PushPath(index);
+
+        frame.m_expectedSize = container->Size(object) + 1;
+        if (frame.m_expectedSize > frame.m_capacity)
+        {
+            frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                "Unable to load more entries in basic container because it's full."));
+            frame.m_stopped = true;
+            m_context.PopPath();
+            return target;
+        }
+
+        void* elementAddress = container->ReserveElement(object, frame.m_element);
+        if (!elementAddress)
+        {
+            frame.m_finalResult = m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+            frame.m_hasFinalResult = true;
+            m_context.PopPath();
+            return target;
+        }
+
+        const bool isPointer = (frame.m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        if (isPointer)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
+        frame.m_reservedElement = elementAddress;
+        frame.m_pathPushed = true;
+
+        target.m_object = elementAddress;
+        target.m_typeId = frame.m_element->m_typeId;
+        target.m_isPointer = isPointer;
+        target.m_isNewInstance = true;
+        target.m_skip = false;
+        return target;
+    }
+
+    void JsonStreamingDeserializer::CompleteBasicContainerValue(Frame& frame, JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        void* object = frame.m_target.m_object;
+        SerializeContext::IDataContainer* container = frame.m_container;
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            container->FreeReservedElement(object, frame.m_reservedElement, m_context.GetSerializeContext());
+            frame.m_finalResult = m_context.Report(frame.m_result, "Failed to read element for basic container.");
+            frame.m_hasFinalResult = true;
+        }
+        else if (result.GetProcessing() == Processing::Altered)
+        {
+            container->FreeReservedElement(object, frame.m_reservedElement, m_context.GetSerializeContext());
+            frame.m_result.Combine(result);
+        }
+        else
+        {
+            container->StoreElement(object, frame.m_reservedElement);
+            if (container->Size(object) != frame.m_expectedSize)
+            {
+                frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Unavailable,
+                    "Unable to store element to basic container."));
+            }
+            else
+            {
+                frame.m_result.Combine(result);
+            }
+        }
+        frame.m_reservedElement = nullptr;
+
+        m_context.PopPath();
+        frame.m_pathPushed = false;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::EndBasicContainer(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        if (frame.m_hasFinalResult)
+        {
+            return frame.m_finalResult;
+        }
+        if (!frame.m_result.HasDoneWork() && frame.m_inputCount == 0)
+        {
+            return m_context.Report(Tasks::ReadField, Outcomes::Success, "No values provided for basic container.");
+        }
+
+        size_t addedCount = frame.m_container->Size(frame.m_target.m_object) - frame.m_initialSize;
+        if (addedCount > 0)
+        {
+            // Values were added which means the container is no longer in its default state of being empty.
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, Outcomes::Success));
+        }
+        AZStd::string_view message =
+            addedCount >= frame.m_inputCount ? "Successfully read basic container." :
+            addedCount == 0 ? "Unable to read data for basic container." :
+            "Partially read data for basic container.";
+        return m_context.Report(frame.m_result, message);
+    }
+
+    // Associative container
+
+    void JsonStreamingDeserializer::StartAssociativeContainer(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        frame.m_initialized = true;
+
+        SerializeContext::IDataContainer* container = frame.m_classData->m_container;
+        frame.m_container = container;
+
+        const SerializeContext::ClassElement* pairElement = nullptr;
+        auto pairTypeEnumCallback = [&pairElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!pairElement, "A map is expected to only have one element.");
+            pairElement = genericClassElement;
+            return true;
+        };
+        container->EnumTypes(pairTypeEnumCallback);
+        AZ_Assert(pairElement, "A map is expected to have exactly one pair element.");
+        frame.m_element = pairElement;
+
+        const SerializeContext::ClassData* pairClass = m_context.GetSerializeContext()->FindClassData(pairElement->m_typeId);
+        AZ_Assert(pairClass, "Associative container was registered but not the pair that's used for storage.");
+        frame.m_pairContainer = pairClass->m_container;
+        AZ_Assert(frame.m_pairContainer, "Associative container is missing the interface to the storage container.");
+        auto keyValueTypeEnumCallback = [&frame](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            if (frame.m_keyElement)
+            {
+                AZ_Assert(!frame.m_valueElement, "The pair element in a container can't have more than 2 elements.");
+                frame.m_valueElement = genericClassElement;
+            }
+            else
+            {
+                frame.m_keyElement = genericClassElement;
+            }
+            return true;
+        };
+        frame.m_pairContainer->EnumTypes(keyValueTypeEnumCallback);
+        AZ_Assert(frame.m_keyElement && frame.m_valueElement, "Expected the pair element in a container to have exactly 2 elements.");
+
+        void* object = frame.m_target.m_object;
+        frame.m_initialSize = container->Size(object);
+        if (frame.m_initialSize > 0 && m_context.ShouldClearContainers())
+        {
+            JsonSerializationResult::Result result = m_context.Report(Tasks::Clear, Outcomes::Success, "Clearing associative container.");
+            if (result.GetResultCode().GetOutcome() == Outcomes::Success)
+            {
+                container->ClearElements(object, m_context.GetSerializeContext());
+                frame.m_initialSize = container->Size(object);
+                result = m_context.Report(Tasks::Clear, frame.m_initialSize == 0 ? Outcomes::Success : Outcomes::Unsupported,
+                    frame.m_initialSize == 0 ? "Cleared associative container." : "Failed to clear associative container.");
+            }
+            if (result.GetResultCode().GetProcessing() != Processing::Completed)
+            {
+                frame.m_finalResult = result;
+                frame.m_hasFinalResult = true;
+                return;
+            }
+            frame.m_result.Combine(result);
+        }
+    }
+
+    void JsonStreamingDeserializer::StartAssociativeContainerKey(Frame& frame, AZStd::string_view name)
+    {
+        using namespace JsonSerializationResult;
+
+        frame.m_inputCount++;
+        if (!frame.m_initialized)
+        {
+            StartAssociativeContainer(frame);
+        }
+        if (frame.m_hasFinalResult)
+        {
+            return;
+        }
+
+        void* object = frame.m_target.m_object;
+        SerializeContext::IDataContainer* container = frame.m_container;
+        m_context.PushPath(name);
+
+        frame.m_expectedSize = container->Size(object) + 1;
+        void* address = container->ReserveElement(object, frame.m_element);
+        if (!address)
+        {
+            AddAssociativeContainerElementResult(frame, m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Failed to allocate an item for an associative container."));
+            m_context.PopPath();
+            return;
+        }
+
+        // Load key
+        void* keyAddress = frame.m_pairContainer->GetElementByIndex(address, frame.m_element, 0);
+        AZ_Assert(keyAddress, "Element reserved for associative container, but unable to retrieve address of the key.");
+        Target keyTarget;
+        keyTarget.m_object = keyAddress;
+        keyTarget.m_typeId = frame.m_keyElement->m_typeId;
+        keyTarget.m_isNewInstance = true;
+        if (frame.m_keyElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            keyTarget.m_isPointer = true;
+            *reinterpret_cast<void**>(keyAddress) = nullptr;
+        }
+        rapidjson::Value key;
+        if (name == JsonSerialization::DefaultStringIdentifier)
+        {
+            key.SetObject();
+        }
+        else
+        {
+            key.SetString(rapidjson::StringRef(name.data(), name.size()));
+        }
+        frame.m_keyResult = LoadValue(keyTarget, key);
+        if (frame.m_keyResult.GetProcessing() == Processing::Halted)
+        {
+            container->FreeReservedElement(object, address, m_context.GetSerializeContext());
+            AddAssociativeContainerElementResult(frame, m_context.Report(frame.m_keyResult, "Failed to read key for associative container."));
+            m_context.PopPath();
+            return;
+        }
+
+        // The value is loaded from the events that follow.
+        void* valueAddress = frame.m_pairContainer->GetElementByIndex(address, frame.m_element, 1);
+        AZ_Assert(valueAddress, "Element reserved for associative container, but unable to retrieve address of the value.");
+        frame.m_next.m_object = valueAddress;
+        frame.m_next.m_typeId = frame.m_valueElement->m_typeId;
+        frame.m_next.m_classElement = nullptr;
+        frame.m_next.m_isPointer = false;
+        frame.m_next.m_isNewInstance = true;
+        frame.m_next.m_skip = false;
+        if (frame.m_valueElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            frame.m_next.m_isPointer = true;
+            *reinterpret_cast<void**>(valueAddress) = nullptr;
+        }
+        frame.m_reservedElement = address;
+        frame.m_pathPushed = true;
+    }
+
+    void JsonStreamingDeserializer::CompleteAssociativeContainerValue(Frame& frame, JsonSerializationResult::ResultCode valueResult)
+    {
+        using namespace JsonSerializationResult;
+
+        void* object = frame.m_target.m_object;
+        SerializeContext::IDataContainer* container = frame.m_container;
+        if (valueResult.GetProcessing() == Processing::Halted)
+        {
+            container->FreeReservedElement(object, frame.m_reservedElement, m_context.GetSerializeContext());
+            AddAssociativeContainerElementResult(frame, m_context.Report(valueResult, "Failed to read value for associative container."));
+        }
+        else if (frame.m_keyResult.GetProcessing() == Processing::Altered || valueResult.GetProcessing() == Processing::Altered)
+        {
+            container->FreeReservedElement(object, frame.m_reservedElement, m_context.GetSerializeContext());
+            AddAssociativeContainerElementResult(frame, m_context.Report(Tasks::ReadField, Outcomes::Unavailable,
+                "Unable to fully process an element for the associative container."));
+        }
+        else
+        {
+            container->StoreElement(object, frame.m_reservedElement);
+            if (container->Size(object) != frame.m_expectedSize)
+            {
+                AddAssociativeContainerElementResult(frame, m_context.Report(Tasks::ReadField, Outcomes::Unavailable,
+                    "Unable to store the element that was read to the associative container."));
+            }
+            else
+            {
+                AddAssociativeContainerElementResult(frame, m_context.Report(ResultCode::Combine(frame.m_keyResult, valueResult),
+                    "Successfully loaded an entry into the associative container."));
+            }
+        }
+        frame.m_reservedElement = nullptr;
+
+        m_context.PopPath();
+        frame.m_pathPushed = false;
+    }
+
+    void JsonStreamingDeserializer::AddAssociativeContainerElementResult(Frame& frame, JsonSerializationResult::ResultCode elementResult)
+    {
+        if (elementResult.GetProcessing() != JsonSerializationResult::Processing::Halted)
+        {
+            frame.m_result.Combine(elementResult);
+        }
+        else
+        {
+            frame.m_finalResult = elementResult;
+            frame.m_hasFinalResult = true;
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::EndAssociativeContainer(Frame& frame)
+    {
+        using namespace JsonSerializationResult;
+
+        if (frame.m_inputCount == 0)
+        {
+            return LoadExplicitDefault(frame);
+        }
+        if (frame.m_hasFinalResult)
+        {
+            return frame.m_finalResult;
+        }
+
+        size_t addedCount = frame.m_container->Size(frame.m_target.m_object) - frame.m_initialSize;
+        if (addedCount > 0)
+        {
+            // If at least one entry was added then the map is no longer in it's default state so
+            // mark is with success so the result can at best be partial defaults.
+            frame.m_result.Combine(ResultCode(Tasks::ReadField, Outcomes::Success));
+        }
+        AZStd::string_view message =
+            addedCount >= frame.m_inputCount ? "Successfully read associative container." :
+            addedCount == 0 ? "Unable to read data for the associative container." :
+            "Partially read data for the associative container.";
+        return m_context.Report(frame.m_result, message);
+    }
+
+    // Capture
+
+    void JsonStreamingDeserializer::CaptureString(const Ch* value, rapidjson::SizeType length)
+    {
+        rapidjson::Value string(value, length, m_captureAllocator);
+        m_captureStack.PushBack(string, m_captureAllocator);
+    }
+
+    void JsonStreamingDeserializer::CaptureComposite(rapidjson::Type type, rapidjson::SizeType count)
+    {
+        // The members or elements of the composite are the last entries on the stack, in order.
+        const rapidjson::SizeType stackSize = m_captureStack.Size();
+        rapidjson::Value composite(type);
+        rapidjson::SizeType first;
+        if (type == rapidjson::kObjectType)
+        {
+            first = stackSize - count * 2;
+            for (rapidjson::SizeType i = first; i < stackSize; i += 2)
+            {
+                composite.AddMember(m_captureStack[i], m_captureStack[i + 1], m_captureAllocator);
+            }
+        }
+        else
+        {
+            first = stackSize - count;
+            composite.Reserve(count, m_captureAllocator);
+            for (rapidjson::SizeType i = first; i < stackSize; ++i)
+            {
+                composite.PushBack(m_captureStack[i], m_captureAllocator);
+            }
+        }
+        m_captureStack.Erase(m_captureStack.Begin() + first, m_captureStack.End());
+        m_captureStack.PushBack(composite, m_captureAllocator);
+    }
+
+    void JsonStreamingDeserializer::FinishCapture()
+    {
+        AZ_Assert(m_captureStack.Size() == 1, "Expected exactly one value to be captured by the Json Streaming Deserializer.");
+        JsonSerializationResult::ResultCode result = LoadValue(m_frames.back().m_target, m_captureStack[0]);
+
+        // The values for the capture are no longer needed, so reset the stack and return all memory except the local buffer.
+        m_captureStack.SetArray();
+        m_captureAllocator.Clear();
+
+        PopFrameAndComplete(result);
+    }
+
+    void JsonStreamingDeserializer::ReleaseReservedElements()
+    {
+        for (auto it = m_frames.rbegin(); it != m_frames.rend(); ++it)
+        {
+            if (it->m_reservedElement)
+            {
+                it->m_container->FreeReservedElement(it->m_target.m_object, it->m_reservedElement, m_context.GetSerializeContext());
+                it->m_reservedElement = nullptr;
+            }
+            if (it->m_pathPushed)
+            {
+                m_context.PopPath();
+                it->m_pathPushed = false;
+            }
+        }
+        m_frames.clear();
+    }
+} // namespace AZ
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    class JsonDeserializerContext;
+    struct Uuid;
+
+    //! Loads json text directly into reflected objects by consuming the SAX events produced by the rapidjson reader, without
+    //! building a document for the entire input first. Classes, basic containers and associative containers in their object
+    //! form are filled in as their fields arrive. Values that need random access, such as pointers which may hold a "$type" field
+    //! or types with a custom serializer, are collected into a small document holding only that value and passed to the regular
+    //! deserializer. This guarantees the same objects and the same reports as JsonSerialization::Load.
+    //! Note: Unlike the document based path, malformed json is only detected when it's reached, so the object may have been
+    //!     partially loaded when a parse error is reported.
+    class JsonStreamingDeserializer final
+    {
+    public:
+        using Ch = char;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context);
+
+        //! rapidjson SAX handler interface.
+        //! @{
+        bool Null();
+        bool Bool(bool value);
+        bool Int(int value);
+        bool Uint(unsigned value);
+        bool Int64(int64_t value);
+        bool Uint64(uint64_t value);
+        bool Double(double value);
+        bool RawNumber(const Ch* value, rapidjson::SizeType length, bool copy);
+        bool String(const Ch* value, rapidjson::SizeType length, bool copy);
+        bool StartObject();
+        bool Key(const Ch* value, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+        //! @}
+
+    private:
+        enum class FrameType : u8
+        {
+            Root, // The value at the root of the document.
+            Class, // A reflected class that's loaded field by field.
+            BasicContainer, // A container handled by the JsonBasicContainerSerializer which is loaded element by element.
+            AssociativeContainer, // A map in its object form which is loaded key by key.
+            Capture, // A value that's collected into a document and loaded once complete.
+            Skip // A value that will be ignored.
+        };
+
+        //! The location the next value in the json stream will be loaded into.
+        struct Target
+        {
+            void* m_object{ nullptr };
+            Uuid m_typeId{ Uuid::CreateNull() };
+            const SerializeContext::ClassElement* m_classElement{ nullptr };
+            bool m_isPointer{ false };
+            bool m_isNewInstance{ false };
+            bool m_skip{ false };
+        };
+
+        struct Frame
+        {
+            explicit Frame(FrameType type);
+
+            Target m_target;
+            Target m_next;
+            JsonSerializationResult::ResultCode m_result;
+            //! Set if the value has failed in a way that stops further processing. The remainder of the value will be skipped and
+            //! this result is returned once the end of the value is reached.
+            JsonSerializationResult::ResultCode m_finalResult;
+            JsonSerializationResult::ResultCode m_keyResult;
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            SerializeContext::IDataContainer* m_container{ nullptr };
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            SerializeContext::IDataContainer* m_pairContainer{ nullptr };
+            const SerializeContext::ClassElement* m_keyElement{ nullptr };
+            const SerializeContext::ClassElement* m_valueElement{ nullptr };
+            void* m_reservedElement{ nullptr };
+            size_t m_initialSize{ 0 };
+            size_t m_expectedSize{ 0 };
+            size_t m_capacity{ 0 };
+            size_t m_inputCount{ 0 };
+            size_t m_numLoads{ 0 };
+            size_t m_depth{ 0 };
+            FrameType m_type;
+            bool m_initialized{ false };
+            bool m_hasFinalResult{ false };
+            bool m_stopped{ false };
+            bool m_pathPushed{ false };
+        };
+
+        explicit JsonStreamingDeserializer(JsonDeserializerContext& context);
+
+        JsonStreamingDeserializer(const JsonStreamingDeserializer&) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&&) = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer&) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&&) = delete;
+
+        bool LoadScalar(rapidjson::Value&& value);
+        bool StartComposite(rapidjson::Type type);
+
+        //! Retrieves the target for the value that's about to be read into the frame at the top of the stack.
+        Target NextTarget();
+        //! Processes the result of a fully read value for the frame at the top of the stack.
+        void CompleteValue(JsonSerializationResult::ResultCode result);
+        //! Loads a value from a document in the same way BaseJsonSerializer::ContinueLoading does.
+        JsonSerializationResult::ResultCode LoadValue(const Target& target, const rapidjson::Value& value);
+
+        void PushFrame(FrameType type, const Target& target);
+        void PopFrameAndComplete(JsonSerializationResult::ResultCode result);
+
+        void StartClassField(Frame& frame, AZStd::string_view name);
+        void CompleteClassValue(Frame& frame, JsonSerializationResult::ResultCode result);
+        JsonSerializationResult::ResultCode EndClass(Frame& frame);
+
+        void StartBasicContainer(Frame& frame);
+        Target NextBasicContainerTarget(Frame& frame);
+        void CompleteBasicContainerValue(Frame& frame, JsonSerializationResult::ResultCode result);
+        JsonSerializationResult::ResultCode EndBasicContainer(Frame& frame);
+
+        void StartAssociativeContainer(Frame& frame);
+        void StartAssociativeContainerKey(Frame& frame, AZStd::string_view name);
+        void CompleteAssociativeContainerValue(Frame& frame, JsonSerializationResult::ResultCode valueResult);
+        void AddAssociativeContainerElementResult(Frame& frame, JsonSerializationResult::ResultCode elementResult);
+        JsonSerializationResult::ResultCode EndAssociativeContainer(Frame& frame);
+
+        //! Loads a class or associative container that didn't have any fields as an explicit default.
+        JsonSerializationResult::ResultCode LoadExplicitDefault(const Frame& frame);
+
+        //! Decides how a value that starts with an object or array will be processed.
+        FrameType SelectFrameType(const Target& target, rapidjson::Type type, const SerializeContext::ClassData*& classData);
+
+        void CaptureString(const Ch* value, rapidjson::SizeType length);
+        //! Combines the values at the top of the capture stack into an object or array.
+        void CaptureComposite(rapidjson::Type type, rapidjson::SizeType count);
+        //! Loads the fully captured value into the target of the capture frame.
+        void FinishCapture();
+
+        //! Releases any elements that were reserved in containers but not yet stored. Used when parsing stopped midway.
+        void ReleaseReservedElements();
+
+        JsonDeserializerContext& m_context;
+        AZStd::vector<Frame> m_frames;
+        JsonSerializationResult::ResultCode m_rootResult;
+
+        // Memory for the values that are captured. Captured values are typically small so a local buffer avoids most allocations.
+        static constexpr size_t CaptureBufferSize = 4096;
+        alignas(16) char m_captureBuffer[CaptureBufferSize];
+        rapidjson::Document::AllocatorType m_captureAllocator;
+        rapidjson::Value m_captureStack;
+    };
+} // namespace AZ
@@ -54,7 +54,7 @@ namespace AZ
 {
     namespace ObjectStreamInternal
     {
-        static const u32 s_objectStreamVersion = 3;
+        static const u32 s_objectStreamVersion = 4; // version 4 stores contiguous containers of fixed size values as a single binary value
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
@@ -178,6 +178,27 @@ namespace AZ
             bool ConvertOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
             void PreparseOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
 
+            // Binary streams store containers that keep fixed size values next to each other in memory (vector<float>, vector<Vector3>, ...)
+            // as a single value on the container element instead of an element per entry. The value holds a ContiguousElementsHeader
+            // followed by the values of all elements.
+            struct ContiguousElementsHeader
+            {
+                u32 m_numElements = 0;
+                u32 m_elementVersion = 0;
+                u32 m_elementDataSize = 0;
+                Uuid m_elementId = Uuid::CreateNull();
+            };
+            static constexpr size_t s_contiguousElementsHeaderSize = 3 * sizeof(u32) + 16;
+
+            /// Returns the class of the container elements if they can be written as one value, otherwise null.
+            const SerializeContext::ClassData* GetContiguousElementClass(const SerializeContext::ClassData* containerClass, const SerializeContext::ClassElement*& elementInfo);
+            /// Writes the elements of a container as one value. Returns the size of the value, 0 if the elements have to be written one by one.
+            size_t SaveContiguousElements(const void* containerPtr, const SerializeContext::ClassData* containerClass, IO::GenericStream& stream);
+            bool LoadContiguousElements(void* containerPtr, const SerializeContext::ClassData* containerClass, IO::GenericStream& stream, bool isDataBigEndian);
+            /// Splits the value of a container node into an element node per entry, the way it would be stored without the bulk format.
+            bool ExpandContiguousElements(SerializeContext::DataElementNode& containerNode, const SerializeContext::ClassData* containerClass);
+            bool ReadContiguousElementsHeader(IO::GenericStream& stream, ContiguousElementsHeader& header);
+
             int                                 m_flags;
             FilterDescriptor                    m_filterDesc;
             IO::GenericStream*              m_stream;
@@ -244,6 +265,12 @@ namespace AZ
                 m_errorLogger.Push(de);
             }
 #endif // AZ_ENABLE_TRACING
+            // Containers written as one value get an element node per entry, so converters see the same tree as without the bulk format
+            if (elementClass && elementClass->m_container && !elementClass->m_serializer && elementNode.m_element.m_dataSize > 0)
+            {
+                ExpandContiguousElements(elementNode, elementClass);
+            }
+
             SerializeContext::DataElement childElement;
             childElement.m_stream = &childElement.m_byteStream;
             childElement.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
@@ -363,6 +390,186 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // GetContiguousElementClass
+        //=========================================================================
+        const SerializeContext::ClassData* ObjectStreamImpl::GetContiguousElementClass(const SerializeContext::ClassData* containerClass, const SerializeContext::ClassElement*& elementInfo)
+        {
+            SerializeContext::IDataContainer* container = containerClass->m_container;
+            if (!container || containerClass->m_serializer)
+            {
+                return nullptr;
+            }
+
+            elementInfo = container->GetElement(container->GetElementNameCrC());
+            if (!elementInfo || (elementInfo->m_flags & SerializeContext::ClassElement::FLG_POINTER))
+            {
+                return nullptr;
+            }
+
+            const SerializeContext::ClassData* elementClass = elementInfo->m_genericClassInfo
+                ? elementInfo->m_genericClassInfo->GetClassData()
+                : m_sc->FindClassData(elementInfo->m_typeId, containerClass, elementInfo->m_nameCrc);
+
+            // Only plain values qualify, anything that needs to observe the elements one by one is written the regular way
+            if (!elementClass || !elementClass->m_serializer || elementClass->m_serializer->GetFixedDataSize() == 0
+                || elementClass->m_eventHandler || elementClass->m_doSave || elementClass->IsDeprecated()
+                || elementClass->m_typeId == GetAssetClassId()
+                || elementClass->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+            {
+                return nullptr;
+            }
+            return elementClass;
+        }
+
+        //=========================================================================
+        // SaveContiguousElements
+        //=========================================================================
+        size_t ObjectStreamImpl::SaveContiguousElements(const void* containerPtr, const SerializeContext::ClassData* containerClass, IO::GenericStream& stream)
+        {
+            const SerializeContext::ClassElement* elementInfo = nullptr;
+            const SerializeContext::ClassData* elementClass = GetContiguousElementClass(containerClass, elementInfo);
+            if (!elementClass)
+            {
+                return 0;
+            }
+
+            void* instance = const_cast<void*>(containerPtr);
+            const size_t numElements = containerClass->m_container->Size(instance);
+            const void* firstElement = numElements ? containerClass->m_container->GetContiguousElements(instance) : nullptr;
+            const size_t elementDataSize = elementClass->m_serializer->GetFixedDataSize();
+            const u64 dataSize = static_cast<u64>(numElements) * elementDataSize + s_contiguousElementsHeaderSize;
+            if (!firstElement || elementDataSize > 0xffffffff || dataSize > 0xffffffff)
+            {
+                return 0;
+            }
+
+            u32 header[3] = { static_cast<u32>(numElements), elementClass->m_version, static_cast<u32>(elementDataSize) };
+            AZStd::endian_swap(header, header + AZ_ARRAY_SIZE(header));
+            stream.Write(sizeof(header), header);
+            stream.Write(elementClass->m_typeId.end() - elementClass->m_typeId.begin(), elementClass->m_typeId.begin());
+
+            const size_t elementsSize = elementClass->m_serializer->SaveElements(firstElement, numElements, elementInfo->m_dataSize, stream, true);
+            if (elementsSize != numElements * elementDataSize)
+            {
+                // The serializer doesn't write the size it reported, fall back to writing the elements one by one
+                AZ_Warning("Serialization", false, "Serializer for %s wrote %zu bytes for %zu elements, expected %zu bytes per element.",
+                    elementClass->m_name, elementsSize, numElements, elementDataSize);
+                return 0;
+            }
+            return static_cast<size_t>(dataSize);
+        }
+
+        //=========================================================================
+        // ReadContiguousElementsHeader
+        //=========================================================================
+        bool ObjectStreamImpl::ReadContiguousElementsHeader(IO::GenericStream& stream, ContiguousElementsHeader& header)
+        {
+            u32 values[3];
+            if (stream.Read(sizeof(values), values) != sizeof(values)
+                || stream.Read(header.m_elementId.end() - header.m_elementId.begin(), header.m_elementId.begin()) != static_cast<IO::SizeType>(header.m_elementId.end() - header.m_elementId.begin()))
+            {
+                return false;
+            }
+            AZStd::endian_swap(values, values + AZ_ARRAY_SIZE(values));
+            header.m_numElements = values[0];
+            header.m_elementVersion = values[1];
+            header.m_elementDataSize = values[2];
+
+            // Don't trust the element count before checking that the stream holds all of them
+            return stream.GetLength() - stream.GetCurPos() >= static_cast<u64>(header.m_numElements) * header.m_elementDataSize;
+        }
+
+        //=========================================================================
+        // LoadContiguousElements
+        //=========================================================================
+        bool ObjectStreamImpl::LoadContiguousElements(void* containerPtr, const SerializeContext::ClassData* containerClass, IO::GenericStream& stream, bool isDataBigEndian)
+        {
+            ContiguousElementsHeader header;
+            if (!ReadContiguousElementsHeader(stream, header))
+            {
+                return false;
+            }
+
+            SerializeContext::IDataContainer* container = containerClass->m_container;
+            const SerializeContext::ClassElement* elementInfo = container->GetElement(container->GetElementNameCrC());
+            const SerializeContext::ClassData* elementClass = elementInfo ? m_sc->FindClassData(header.m_elementId, containerClass, elementInfo->m_nameCrc) : nullptr;
+            if (!elementClass || !elementClass->m_serializer || elementClass->m_typeId != elementInfo->m_typeId)
+            {
+                return false;
+            }
+
+            void* firstElement = container->ResizeContiguousElements(containerPtr, header.m_numElements);
+            if (!firstElement)
+            {
+                return header.m_numElements == 0;
+            }
+
+            if (header.m_elementDataSize == elementClass->m_serializer->GetFixedDataSize())
+            {
+                return elementClass->m_serializer->LoadElements(firstElement, header.m_numElements, elementInfo->m_dataSize, stream, header.m_elementVersion, isDataBigEndian);
+            }
+
+            // The serialized size of the elements changed since they were written, load them one by one
+            AZStd::vector<char> elementData(header.m_elementDataSize);
+            for (u32 i = 0; i < header.m_numElements; ++i)
+            {
+                stream.Read(elementData.size(), elementData.data());
+                IO::MemoryStream elementStream(static_cast<const void*>(elementData.data()), elementData.size());
+                if (!elementClass->m_serializer->Load(reinterpret_cast<char*>(firstElement) + i * elementInfo->m_dataSize, elementStream, header.m_elementVersion, isDataBigEndian))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // ExpandContiguousElements
+        //=========================================================================
+        bool ObjectStreamImpl::ExpandContiguousElements(SerializeContext::DataElementNode& containerNode, const SerializeContext::ClassData* containerClass)
+        {
+            SerializeContext::DataElement& element = containerNode.m_element;
+            IO::MemoryStream memStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
+            IO::GenericStream* currentStream = element.m_byteStream.GetLength() > 0 ? static_cast<IO::GenericStream*>(&element.m_byteStream) : &memStream;
+            currentStream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+            ContiguousElementsHeader header;
+            bool result = ReadContiguousElementsHeader(*currentStream, header);
+            if (result)
+            {
+                const u32 elementNameCrc = containerClass->m_container->GetElementNameCrC();
+                const SerializeContext::ClassData* elementClass = m_sc->FindClassData(header.m_elementId, containerClass, elementNameCrc);
+                containerNode.m_subElements.reserve(containerNode.m_subElements.size() + header.m_numElements);
+                for (u32 i = 0; i < header.m_numElements; ++i)
+                {
+                    containerNode.m_subElements.push_back();
+                    SerializeContext::DataElementNode& elementNode = containerNode.m_subElements.back();
+                    elementNode.m_classData = elementClass;
+                    SerializeContext::DataElement& subElement = elementNode.m_element;
+                    subElement.m_nameCrc = elementNameCrc;
+                    subElement.m_id = header.m_elementId;
+                    subElement.m_version = header.m_elementVersion;
+                    subElement.m_dataType = element.m_dataType;
+                    subElement.m_stream = &subElement.m_byteStream;
+                    subElement.m_dataSize = static_cast<size_t>(subElement.m_byteStream.WriteFromStream(header.m_elementDataSize, currentStream));
+                    subElement.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                }
+            }
+            else
+            {
+                AZStd::string error = AZStd::string::format("Failed to read the elements of container %s '%s'(0x%x).  File %s",
+                    containerClass->m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc, GetStreamFilename());
+                m_errorLogger.ReportError(error.c_str());
+            }
+
+            // The elements are sub elements now
+            element.m_buffer.clear();
+            element.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            element.m_dataSize = 0;
+            return result;
+        }
+
         //=========================================================================
         // LoadClass
         // [4/25/2012]
@@ -818,6 +1025,24 @@ namespace AZ
                 if (classData->m_container && dataAddress)
                 {
                     classData->m_container->ClearElements(dataAddress, m_sc);
+
+                    // Containers of fixed size values can be stored as a single value, in which case there are no child nodes
+                    if (!classData->m_serializer && element.m_dataSize > 0)
+                    {
+                        IO::MemoryStream memStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
+                        IO::GenericStream* currentStream = element.m_byteStream.GetLength() > 0 ? static_cast<IO::GenericStream*>(&element.m_byteStream) : &memStream;
+                        currentStream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+                        if (!LoadContiguousElements(dataAddress, classData, *currentStream, element.m_dataType == SerializeContext::DataElement::DT_BINARY_BE))
+                        {
+                            AZStd::string error = AZStd::string::format("Failed to load the elements of container %s '%s'(0x%x).  File %s",
+                                classData->m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc,
+                                GetStreamFilename());
+
+                            result = result && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                            m_errorLogger.ReportError(error.c_str());
+                        }
+                    }
                 }
 
                 // Read child nodes
@@ -1691,6 +1916,11 @@ namespace AZ
             {
                 element.m_dataSize = classData->m_serializer->Save(objectPtr, m_inStream, GetType() == ST_BINARY);
             }
+            else if (classData->m_container && objectPtr && GetType() == ST_BINARY)
+            {
+                element.m_dataSize = SaveContiguousElements(objectPtr, classData, m_inStream);
+            }
+            const bool hasValue = classData->m_serializer || element.m_dataSize > 0;
 
             if (GetType() == ST_XML)
             {
@@ -1789,7 +2019,7 @@ namespace AZ
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_NAME;
                 }
-                if (classData->m_serializer)
+                if (hasValue)
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_VALUE;
                     if (element.m_dataSize < 8)
@@ -1843,7 +2073,7 @@ namespace AZ
                 m_stream->Write(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
 
                 // Write value
-                if (classData->m_serializer)
+                if (hasValue)
                 {
                     // Write extra size field if necessary
                     if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
@@ -1883,6 +2113,13 @@ namespace AZ
 
                     element.m_stream = nullptr;
                 }
+
+                if (!classData->m_serializer && element.m_dataSize > 0)
+                {
+                    // The container elements are part of the value, close the element now so they are not enumerated
+                    CloseElement();
+                    return false;
+                }
             }
 
             return true;
@@ -65,6 +65,59 @@ namespace AZ
             AZ_SERIALIZE_SWAP_ENDIAN(value, isDataBigEndian);
             return static_cast<size_t>(stream.Write(sizeof(T), reinterpret_cast<const void*>(&value)));
         }
+
+        size_t GetFixedDataSize() const override
+        {
+            return sizeof(T);
+        }
+
+        /// Store packed arrays with a single write, swapping through a small buffer when needed.
+        size_t SaveElements(const void* firstElement, size_t numElements, size_t elementStride, IO::GenericStream& stream, bool isDataBigEndian = false) override
+        {
+            if (elementStride != sizeof(T))
+            {
+                return SerializeContext::IDataSerializer::SaveElements(firstElement, numElements, elementStride, stream, isDataBigEndian);
+            }
+
+            const T* elements = reinterpret_cast<const T*>(firstElement);
+            if (!isDataBigEndian || sizeof(T) == 1)
+            {
+                return static_cast<size_t>(stream.Write(numElements * sizeof(T), elements));
+            }
+
+            constexpr size_t bufferSize = AZ_SERIALIZE_BINARY_STACK_BUFFER / sizeof(T);
+            T buffer[bufferSize];
+            size_t bytesWritten = 0;
+            for (size_t first = 0; first < numElements; first += bufferSize)
+            {
+                const size_t count = AZStd::GetMin(bufferSize, numElements - first);
+                AZStd::copy(elements + first, elements + first + count, buffer);
+                AZStd::endian_swap(buffer, buffer + count);
+                bytesWritten += static_cast<size_t>(stream.Write(count * sizeof(T), buffer));
+            }
+            return bytesWritten;
+        }
+
+        /// Load packed arrays with a single read and swap them in place.
+        bool LoadElements(void* firstElement, size_t numElements, size_t elementStride, IO::GenericStream& stream, unsigned int version, bool isDataBigEndian = false) override
+        {
+            if (elementStride != sizeof(T))
+            {
+                return SerializeContext::IDataSerializer::LoadElements(firstElement, numElements, elementStride, stream, version, isDataBigEndian);
+            }
+
+            T* elements = reinterpret_cast<T*>(firstElement);
+            const IO::SizeType numBytes = numElements * sizeof(T);
+            if (stream.Read(numBytes, elements) != numBytes)
+            {
+                return false;
+            }
+            if (isDataBigEndian)
+            {
+                AZStd::endian_swap(elements, elements + numElements);
+            }
+            return true;
+        }
     };
 
 
@@ -693,6 +693,34 @@ namespace AZ
 
             /// Optional post processing of the cloned data to deal with members that are not serialize-reflected.
             virtual void PostClone(void* /*classPtr*/) {}
+
+            /// Returns the number of bytes Save writes for every instance, 0 if it depends on the value.
+            /// Binary streams store contiguous containers of fixed size types as a single value (see SaveElements).
+            virtual size_t GetFixedDataSize() const { return 0; }
+
+            /// Store numElements instances that are elementStride bytes apart into a stream.
+            virtual size_t SaveElements(const void* firstElement, size_t numElements, size_t elementStride, IO::GenericStream& stream, bool isDataBigEndian = false)
+            {
+                size_t bytesWritten = 0;
+                for (size_t i = 0; i < numElements; ++i)
+                {
+                    bytesWritten += Save(reinterpret_cast<const char*>(firstElement) + i * elementStride, stream, isDataBigEndian);
+                }
+                return bytesWritten;
+            }
+
+            /// Load numElements instances that are elementStride bytes apart from a stream.
+            virtual bool LoadElements(void* firstElement, size_t numElements, size_t elementStride, IO::GenericStream& stream, unsigned int version, bool isDataBigEndian = false)
+            {
+                for (size_t i = 0; i < numElements; ++i)
+                {
+                    if (!Load(reinterpret_cast<char*>(firstElement) + i * elementStride, stream, version, isDataBigEndian))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
         };
 
         /**
@@ -815,6 +843,10 @@ namespace AZ
             virtual void    ClearElements(void* instance, SerializeContext* deletePointerDataContext) = 0;
             /// Called when elements inside the container have been modified.
             virtual void    ElementsUpdated(void* instance);
+            /// Returns the first element if the elements are stored next to each other in memory (ClassElement::m_dataSize apart), otherwise null.
+            virtual void*   GetContiguousElements(void* /*instance*/) { return nullptr; }
+            /// Resizes a contiguous container to numElements default constructed elements and returns the first one. Returns null if the container can't hold that many elements.
+            virtual void*   ResizeContiguousElements(void* /*instance*/, size_t /*numElements*/) { return nullptr; }
 
         protected:
             /// Free element data (when the class elements are pointers).
@@ -318,6 +318,37 @@ namespace AZ
         virtual bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform = {}, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) = 0;
 
+        //! Identifies the settings a binary settings cache builds on. Create the key before merging the settings that will be
+        //! cached and use it for both MergeSettingsCache and StoreSettingsCache.
+        struct CacheKey
+        {
+            //! Hash of all the settings that were in the registry when the key was created.
+            AZ::u64 m_settingsHash{ 0 };
+            //! Hash of the specializations and platform the cached settings are merged with.
+            AZ::u64 m_configurationHash{ 0 };
+            //! The number of entries in the file history when the key was created.
+            size_t m_historyStart{ 0 };
+            //! The platform used to find the platform specific files in merged registry folders.
+            Specializations::TagName m_platform;
+        };
+        //! Creates a key for the current settings that can be used to load or store a binary settings cache.
+        //! @param specializations The specializations that will be used to merge the cached registry folders.
+        //! @param platform The platform that will be used to merge the cached registry folders.
+        //! @return A key describing the current settings and configuration.
+        virtual CacheKey CreateCacheKey(const Specializations& specializations, AZStd::string_view platform = {}) const = 0;
+        //! Replaces all settings with the settings stored in a binary settings cache. The cache is only used if it was created
+        //! with an identical key and none of the registry files and folders that were merged to create it have changed.
+        //! @param path The path to the binary settings cache.
+        //! @param key The key that was created before the cached settings would otherwise be merged.
+        //! @return True if the cache was up to date and loaded, otherwise false in which case the settings are unchanged.
+        virtual bool MergeSettingsCache(AZStd::string_view path, const CacheKey& key) = 0;
+        //! Stores all settings in a binary settings cache, together with a description of the registry files and folders that
+        //! were merged since the key was created. No cache is stored if any of those merges reported an error.
+        //! @param path The path to the binary settings cache.
+        //! @param key The key that was created before merging the settings that are cached.
+        //! @return True if the cache was successfully stored, otherwise false.
+        virtual bool StoreSettingsCache(AZStd::string_view path, const CacheKey& key) const = 0;
+
         //! Stores the settings structure which is used when merging settings to the Settings Registry
         //! using JSON Merge Patch or JSON Merge Patch.
         //! The settings contain an issue reporting callback which can be used to track patching process.
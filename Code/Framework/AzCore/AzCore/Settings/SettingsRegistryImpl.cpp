@@ -9,6 +9,10 @@
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/NativeUI//NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
@@ -18,6 +22,315 @@
 
 namespace AZ
 {
+    namespace SettingsRegistryImplInternal
+    {
+        // Layout of a binary settings cache:
+        //  - CacheHeader
+        //  - CacheHeader::m_sourceCount sources: SourceType, size, modification time, hash and path.
+        //  - The settings, stored depth first. Each value starts with a ValueTag followed by its data. Objects and arrays
+        //      store their number of entries after the tag, followed by the entries. Object entries store their name first.
+        // All values are stored in native byte order as the cache is only meant for the machine it was created on.
+        static constexpr AZ::u32 CacheSignature = 0x43524753; // "SGRC"
+        static constexpr AZ::u32 CacheVersion = 1;
+
+        struct CacheHeader
+        {
+            AZ::u32 m_signature{ CacheSignature };
+            AZ::u32 m_version{ CacheVersion };
+            AZ::u64 m_settingsHash{ 0 };
+            AZ::u64 m_configurationHash{ 0 };
+            AZ::u64 m_sourceCount{ 0 };
+            //! Size and hash of everything that follows the header.
+            AZ::u64 m_contentSize{ 0 };
+            AZ::u64 m_contentHash{ 0 };
+        };
+
+        enum class SourceType : AZ::u8
+        {
+            File, // A registry file. Size, modification time and hash are that of the file.
+            Folder // A search pattern for a registry folder. Size is the number of entries and hash is that of the entry names.
+        };
+
+        enum class ValueTag : AZ::u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Object,
+            Array
+        };
+
+        static constexpr size_t MaxCacheDepth = 256;
+
+        static AZ::u64 HashData(const void* data, size_t size)
+        {
+            return (aznumeric_cast<AZ::u64>(static_cast<AZ::u32>(AZ::Crc32(data, size))) << 32) | (size & 0xffffffff);
+        }
+
+        //! Creates an order independent hash of all the entries found with the search pattern.
+        static AZ::u64 HashFolder(const char* searchPattern, AZ::u64& entryCount)
+        {
+            AZ::u64 hash = 0;
+            entryCount = 0;
+            AZ::IO::SystemFile::FindFiles(searchPattern, [&hash, &entryCount](const char* name, bool isFile) -> bool
+                {
+                    AZ::Crc32 entryHash(name, strlen(name));
+                    entryHash.Add(isFile ? "f" : "d", 1);
+                    hash += static_cast<AZ::u32>(entryHash);
+                    entryCount++;
+                    return true;
+                });
+            return hash;
+        }
+
+        static bool ReadFile(const char* path, AZStd::vector<char>& buffer)
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                return false;
+            }
+            AZ::u64 fileSize = file.Length();
+            buffer.resize_no_construct(fileSize);
+            return file.Read(fileSize, buffer.data()) == fileSize;
+        }
+
+        class CacheWriter
+        {
+        public:
+            explicit CacheWriter(AZStd::vector<char>& buffer)
+                : m_buffer(buffer)
+            {
+            }
+
+            template<typename T>
+            void Write(T value)
+            {
+                const char* bytes = reinterpret_cast<const char*>(&value);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + sizeof(T));
+            }
+
+            void Write(AZStd::string_view text)
+            {
+                Write(aznumeric_cast<AZ::u32>(text.size()));
+                m_buffer.insert(m_buffer.end(), text.begin(), text.end());
+            }
+
+            void Write(const rapidjson::Value& value)
+            {
+                switch (value.GetType())
+                {
+                case rapidjson::kNullType:
+                    Write(ValueTag::Null);
+                    break;
+                case rapidjson::kFalseType:
+                    Write(ValueTag::False);
+                    break;
+                case rapidjson::kTrueType:
+                    Write(ValueTag::True);
+                    break;
+                case rapidjson::kObjectType:
+                    Write(ValueTag::Object);
+                    Write(aznumeric_cast<AZ::u32>(value.MemberCount()));
+                    for (const auto& member : value.GetObject())
+                    {
+                        Write(AZStd::string_view(member.name.GetString(), member.name.GetStringLength()));
+                        Write(member.value);
+                    }
+                    break;
+                case rapidjson::kArrayType:
+                    Write(ValueTag::Array);
+                    Write(aznumeric_cast<AZ::u32>(value.Size()));
+                    for (const rapidjson::Value& entry : value.GetArray())
+                    {
+                        Write(entry);
+                    }
+                    break;
+                case rapidjson::kStringType:
+                    Write(ValueTag::String);
+                    Write(AZStd::string_view(value.GetString(), value.GetStringLength()));
+                    break;
+                case rapidjson::kNumberType:
+                    if (value.IsDouble())
+                    {
+                        Write(ValueTag::Double);
+                        Write(value.GetDouble());
+                    }
+                    else if (value.IsInt64())
+                    {
+                        Write(ValueTag::Int64);
+                        Write(value.GetInt64());
+                    }
+                    else
+                    {
+                        Write(ValueTag::Uint64);
+                        Write(value.GetUint64());
+                    }
+                    break;
+                default:
+                    AZ_Assert(false, "Unsupported RapidJSON type: %i.", aznumeric_cast<int>(value.GetType()));
+                    Write(ValueTag::Null);
+                    break;
+                }
+            }
+
+        private:
+            AZStd::vector<char>& m_buffer;
+        };
+
+        class CacheReader
+        {
+        public:
+            CacheReader(const char* begin, const char* end)
+                : m_cursor(begin)
+                , m_end(end)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (aznumeric_cast<size_t>(m_end - m_cursor) < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_cursor, sizeof(T));
+                m_cursor += sizeof(T);
+                return true;
+            }
+
+            bool Read(AZStd::string_view& text)
+            {
+                AZ::u32 length;
+                if (!Read(length) || aznumeric_cast<size_t>(m_end - m_cursor) < length)
+                {
+                    return false;
+                }
+                text = AZStd::string_view(m_cursor, length);
+                m_cursor += length;
+                return true;
+            }
+
+            bool Read(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, size_t depth = 0)
+            {
+                ValueTag tag;
+                if (depth >= MaxCacheDepth || !Read(tag))
+                {
+                    return false;
+                }
+
+                switch (tag)
+                {
+                case ValueTag::Null:
+                    value.SetNull();
+                    return true;
+                case ValueTag::False:
+                    value.SetBool(false);
+                    return true;
+                case ValueTag::True:
+                    value.SetBool(true);
+                    return true;
+                case ValueTag::Int64:
+                {
+                    int64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(number);
+                    return true;
+                }
+                case ValueTag::Uint64:
+                {
+                    uint64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case ValueTag::Double:
+                {
+                    double number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetDouble(number);
+                    return true;
+                }
+                case ValueTag::String:
+                {
+                    AZStd::string_view text;
+                    if (!Read(text))
+                    {
+                        return false;
+                    }
+                    value.SetString(text.data(), aznumeric_caster(text.size()), allocator);
+                    return true;
+                }
+                case ValueTag::Object:
+                {
+                    AZ::u32 count;
+                    if (!Read(count))
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (AZ::u32 i = 0; i < count; ++i)
+                    {
+                        AZStd::string_view name;
+                        rapidjson::Value member;
+                        if (!Read(name) || !Read(member, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.AddMember(rapidjson::Value(name.data(), aznumeric_caster(name.size()), allocator), AZStd::move(member),
+                            allocator);
+                    }
+                    return true;
+                }
+                case ValueTag::Array:
+                {
+                    AZ::u32 count;
+                    if (!Read(count))
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(count, allocator);
+                    for (AZ::u32 i = 0; i < count; ++i)
+                    {
+                        rapidjson::Value entry;
+                        if (!Read(entry, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(AZStd::move(entry), allocator);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_cursor == m_end;
+            }
+
+        private:
+            const char* m_cursor;
+            const char* m_end;
+        };
+    } // namespace SettingsRegistryImplInternal
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type)
     {
@@ -1153,6 +1466,236 @@ namespace AZ
         return true;
     }
 
+    auto SettingsRegistryImpl::CreateCacheKey(const Specializations& specializations, AZStd::string_view platform) const -> CacheKey
+    {
+        CacheKey key;
+        key.m_platform = platform;
+
+        AZ::Crc32 configurationHash(platform);
+        size_t specializationCount = specializations.GetCount();
+        for (size_t i = 0; i < specializationCount; ++i)
+        {
+            configurationHash.Add("/", 1);
+            configurationHash.Add(specializations.GetSpecialization(i));
+        }
+        key.m_configurationHash = (aznumeric_cast<AZ::u64>(static_cast<AZ::u32>(configurationHash)) << 32) | specializationCount;
+
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        m_settings.Accept(writer);
+        key.m_settingsHash = SettingsRegistryImplInternal::HashData(buffer.GetString(), buffer.GetSize());
+
+        const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(m_settings);
+        key.m_historyStart = (history && history->IsArray()) ? history->Size() : 0;
+        return key;
+    }
+
+    bool SettingsRegistryImpl::MergeSettingsCache(AZStd::string_view path, const CacheKey& key)
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        if (path.empty() || path.size() >= AZ::IO::MaxPathLength)
+        {
+            AZ_Error("Settings Registry", false, "Invalid path provided for MergeSettingsCache.");
+            return false;
+        }
+        AZ::IO::FixedMaxPathString cachePath(path);
+
+        // The cache is only read once and the settings are copied out of it, so map it instead of reading it into a buffer.
+        AZ::IO::MemoryMappedFile cacheFile;
+        if (!AZ::IO::SystemFile::Exists(cachePath.c_str()) || !cacheFile.Open(cachePath.c_str()))
+        {
+            return false;
+        }
+
+        CacheHeader header;
+        if (cacheFile.GetSize() < sizeof(CacheHeader))
+        {
+            AZ_TracePrintf("Settings Registry", R"(Settings cache "%s" is too small and will be ignored.)" "\n", cachePath.c_str());
+            return false;
+        }
+        memcpy(&header, cacheFile.GetData(), sizeof(CacheHeader));
+        const char* content = reinterpret_cast<const char*>(cacheFile.GetData()) + sizeof(CacheHeader);
+        const size_t contentSize = aznumeric_cast<size_t>(cacheFile.GetSize() - sizeof(CacheHeader));
+        if (header.m_signature != CacheSignature || header.m_version != CacheVersion || header.m_contentSize != contentSize ||
+            header.m_contentHash != HashData(content, contentSize))
+        {
+            AZ_TracePrintf("Settings Registry", R"(Settings cache "%s" is invalid or uses an older version and will be ignored.)" "\n",
+                cachePath.c_str());
+            return false;
+        }
+        if (header.m_settingsHash != key.m_settingsHash || header.m_configurationHash != key.m_configurationHash)
+        {
+            AZ_TracePrintf("Settings Registry", R"(Settings cache "%s" was created for different settings and will be ignored.)" "\n",
+                cachePath.c_str());
+            return false;
+        }
+
+        // Verify that none of the registry files or folders have changed since the cache was created. Files are compared by size and
+        // modification time first and only hashed if the modification time changed, such as after checking out an unchanged file.
+        CacheReader reader(content, content + contentSize);
+        AZStd::vector<char> fileBuffer;
+        for (AZ::u64 i = 0; i < header.m_sourceCount; ++i)
+        {
+            SourceType type;
+            AZ::u64 size;
+            AZ::u64 modificationTime;
+            AZ::u64 hash;
+            AZStd::string_view sourcePath;
+            if (!reader.Read(type) || !reader.Read(size) || !reader.Read(modificationTime) || !reader.Read(hash) ||
+                !reader.Read(sourcePath) || sourcePath.size() >= AZ::IO::MaxPathLength)
+            {
+                return false;
+            }
+
+            AZ::IO::FixedMaxPathString sourcePathString(sourcePath);
+            bool isUpToDate = false;
+            if (type == SourceType::File)
+            {
+                if (AZ::IO::SystemFile::Exists(sourcePathString.c_str()) && AZ::IO::SystemFile::Length(sourcePathString.c_str()) == size)
+                {
+                    isUpToDate = AZ::IO::SystemFile::ModificationTime(sourcePathString.c_str()) == modificationTime ||
+                        (ReadFile(sourcePathString.c_str(), fileBuffer) && HashData(fileBuffer.data(), fileBuffer.size()) == hash);
+                }
+            }
+            else if (type == SourceType::Folder)
+            {
+                AZ::u64 entryCount;
+                isUpToDate = HashFolder(sourcePathString.c_str(), entryCount) == hash && entryCount == size;
+            }
+
+            if (!isUpToDate)
+            {
+                AZ_TracePrintf("Settings Registry", R"(Settings cache "%s" is out of date because "%s" changed.)" "\n",
+                    cachePath.c_str(), sourcePathString.c_str());
+                return false;
+            }
+        }
+
+        rapidjson::Document settings;
+        if (!reader.Read(settings, settings.GetAllocator()) || !reader.IsAtEnd())
+        {
+            AZ_Error("Settings Registry", false, R"(Unable to read the settings from settings cache "%s".)", cachePath.c_str());
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        m_settings.Swap(settings);
+
+        m_notifiers.Signal("", Type::Object);
+
+        return true;
+    }
+
+    bool SettingsRegistryImpl::StoreSettingsCache(AZStd::string_view path, const CacheKey& key) const
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        if (path.empty() || path.size() + 4 >= AZ::IO::MaxPathLength)
+        {
+            AZ_Error("Settings Registry", false, "Invalid path provided for StoreSettingsCache.");
+            return false;
+        }
+        AZ::IO::FixedMaxPathString cachePath(path);
+
+        AZStd::vector<char> buffer;
+        buffer.resize(sizeof(CacheHeader));
+        CacheWriter writer(buffer);
+        CacheHeader header;
+        header.m_settingsHash = key.m_settingsHash;
+        header.m_configurationHash = key.m_configurationHash;
+
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        // Record all registry files and folders that were merged since the key was created.
+        AZStd::vector<char> fileBuffer;
+        const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(m_settings);
+        const rapidjson::SizeType historySize = (history && history->IsArray()) ? history->Size() : 0;
+        for (rapidjson::SizeType i = aznumeric_caster(key.m_historyStart); i < historySize; ++i)
+        {
+            const rapidjson::Value& entry = (*history)[i];
+            if (entry.IsString())
+            {
+                const char* filePath = entry.GetString();
+                if (!ReadFile(filePath, fileBuffer))
+                {
+                    AZ_Warning("Settings Registry", false, R"(Settings cache not stored because "%s" can't be read.)", filePath);
+                    return false;
+                }
+                writer.Write(SourceType::File);
+                writer.Write(aznumeric_cast<AZ::u64>(fileBuffer.size()));
+                writer.Write(AZ::IO::SystemFile::ModificationTime(filePath));
+                writer.Write(HashData(fileBuffer.data(), fileBuffer.size()));
+                writer.Write(AZStd::string_view(entry.GetString(), entry.GetStringLength()));
+                header.m_sourceCount++;
+            }
+            else if (entry.IsObject() && entry.HasMember("Folder") && entry["Folder"].IsString())
+            {
+                // The folder is stored as a search pattern ending in "*".
+                AZ::IO::FixedMaxPathString searchPattern(entry["Folder"].GetString(), entry["Folder"].GetStringLength());
+                AZ::u64 entryCount;
+                AZ::u64 folderHash = HashFolder(searchPattern.c_str(), entryCount);
+                writer.Write(SourceType::Folder);
+                writer.Write(entryCount);
+                writer.Write(AZ::u64{ 0 });
+                writer.Write(folderHash);
+                writer.Write(AZStd::string_view(searchPattern));
+                header.m_sourceCount++;
+
+                if (!key.m_platform.empty())
+                {
+                    searchPattern.pop_back();
+                    searchPattern += PlatformFolder;
+                    searchPattern.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                    searchPattern += key.m_platform;
+                    searchPattern.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                    searchPattern.push_back('*');
+                    folderHash = HashFolder(searchPattern.c_str(), entryCount);
+                    writer.Write(SourceType::Folder);
+                    writer.Write(entryCount);
+                    writer.Write(AZ::u64{ 0 });
+                    writer.Write(folderHash);
+                    writer.Write(AZStd::string_view(searchPattern));
+                    header.m_sourceCount++;
+                }
+            }
+            else
+            {
+                // Errors are reported again on every launch, so don't hide them behind a cache.
+                AZ_TracePrintf("Settings Registry", "Settings cache not stored because merging registry files reported errors.\n");
+                return false;
+            }
+        }
+
+        writer.Write(static_cast<const rapidjson::Value&>(m_settings));
+
+        header.m_contentSize = buffer.size() - sizeof(CacheHeader);
+        header.m_contentHash = HashData(buffer.data() + sizeof(CacheHeader), header.m_contentSize);
+        memcpy(buffer.data(), &header, sizeof(CacheHeader));
+
+        // Write to a temporary file first so other processes never read a partially written cache.
+        AZ::IO::FixedMaxPathString tempPath(cachePath);
+        tempPath += ".tmp";
+        AZ::IO::SystemFile file;
+        if (!file.Open(tempPath.c_str(),
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to open settings cache "%s" for writing.)", tempPath.c_str());
+            return false;
+        }
+        const bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        if (!written || !AZ::IO::SystemFile::Rename(tempPath.c_str(), cachePath.c_str(), true))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write settings cache "%s".)", cachePath.c_str());
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
     void SettingsRegistryImpl::SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings)
     {
         m_applyPatchSettings = applyPatchSettings;
@@ -73,6 +73,10 @@ namespace AZ
         bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
 
+        CacheKey CreateCacheKey(const Specializations& specializations, AZStd::string_view platform = {}) const override;
+        bool MergeSettingsCache(AZStd::string_view path, const CacheKey& key) override;
+        bool StoreSettingsCache(AZStd::string_view path, const CacheKey& key) const override;
+
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
@@ -789,6 +789,38 @@ namespace AZ::SettingsRegistryMergeUtils
         }
     }
 
+    AZ::IO::FixedMaxPath GetSettingsCachePath(SettingsRegistryInterface& registry)
+    {
+        bool cacheEnabled = false;
+        AZ::IO::FixedMaxPath cachePath;
+        if (!registry.Get(cacheEnabled, SettingsCacheEnabledKey) || !cacheEnabled ||
+            !registry.Get(cachePath.Native(), FilePathKey_ProjectUserPath))
+        {
+            return {};
+        }
+
+        // Applications use different specializations so each gets its own cache.
+        AZ::SettingsRegistryInterface::FixedValueString targetName;
+        if (!registry.Get(targetName, BuildTargetNameKey))
+        {
+            char executablePath[AZ::IO::MaxPathLength];
+            auto executablePathResult = AZ::Utils::GetExecutablePath(executablePath, AZ::IO::MaxPathLength);
+            if (executablePathResult.m_pathStored == AZ::Utils::ExecutablePathResult::Success && executablePathResult.m_pathIncludesFilename)
+            {
+                targetName = AZ::IO::PathView(executablePath).Stem().Native();
+            }
+        }
+        if (targetName.empty())
+        {
+            return {};
+        }
+
+        cachePath /= "SettingsCache";
+        cachePath /= targetName;
+        cachePath.ReplaceExtension("setregcache");
+        return cachePath;
+    }
+
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
     {
@@ -63,6 +63,10 @@ namespace AZ::SettingsRegistryMergeUtils
     //! The value of the key has no meaning. Notification Handlers only need to check if the key was supplied
     inline static constexpr char CommandLineValueChangedKey[] = "/Amazon/AzCore/Runtime/CommandLineChanged";
 
+    //! When set to true the engine, gem and project registries are loaded from a binary settings cache in the project user folder
+    //! instead of merging all the individual registry files. The cache is recreated when any of the files it was created from change.
+    inline static constexpr char SettingsCacheEnabledKey[] = "/Amazon/AzCore/Settings/RegistryCache/Enabled";
+
     //! Root key where raw project settings (project.json) file is merged to settings registry
     inline static constexpr char ProjectSettingsRootKey[] = "/Amazon/Project/Settings";
 
@@ -185,6 +189,11 @@ namespace AZ::SettingsRegistryMergeUtils
     void MergeSettingsToRegistry_ProjectRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr);
 
+    //! Gets the path to the binary settings cache of the running application.
+    //! @return The path to the cache, or an empty path if the settings cache isn't enabled through the SettingsCacheEnabledKey or
+    //!     there's no project user folder to store it in.
+    AZ::IO::FixedMaxPath GetSettingsCachePath(SettingsRegistryInterface& registry);
+
     //! Adds the development settings added by individual users of the project to the Settings Registry.
     //! Note that this function is only called in development builds and is compiled out in release builds.
     void MergeSettingsToRegistry_ProjectUserRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
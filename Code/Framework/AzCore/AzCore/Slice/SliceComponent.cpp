@@ -11,6 +11,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -1047,6 +1048,110 @@ namespace AZ
         return m_isInstantiated;
     }
 
+    //=========================================================================
+    // SliceComponent::SliceReference::PatchedContainerCache
+    //=========================================================================
+    /**
+     * Slices placed many times frequently carry the same overrides on every instance. Applying a data patch builds and walks
+     * the data tree of the source entities, so instead the patched entities of a patch that's seen for the second time are kept
+     * and later instances with an identical patch clone them. Patches are compared by their serialized binary form, as patch
+     * data is type erased. Serializing is only done for patches that patch the same addresses as an earlier patch, so slices
+     * where every instance overrides something else don't pay for it. The cache lives for the duration of a single
+     * SliceReference::Instantiate call, so the source slice and the patches of its instances can't change while they're held.
+     */
+    class SliceComponent::SliceReference::PatchedContainerCache
+    {
+    public:
+        explicit PatchedContainerCache(SerializeContext* serializeContext)
+            : m_serializeContext(serializeContext)
+        {
+        }
+
+        //! Returns the patched entities of an identical patch, if they've been kept. Otherwise returns null and sets storeResult
+        //! if the entities produced by the patch should be passed to Store, which is the case the second time a patch is seen.
+        const InstantiatedContainer* Find(const DataPatch& dataPatch, bool& storeResult)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            storeResult = false;
+            m_pendingEntry = nullptr;
+
+            // The first patch for a set of addresses can't be a repeat, so it's only serialized once a second patch shows up.
+            auto [firstPatchIt, isFirstPatch] = m_firstPatchPerAddressHash.emplace(dataPatch.GetAddressHash(), &dataPatch);
+            if (isFirstPatch)
+            {
+                return nullptr;
+            }
+            if (firstPatchIt->second)
+            {
+                FindOrAddEntry(*firstPatchIt->second);
+                firstPatchIt->second = nullptr;
+            }
+
+            bool isNewEntry = false;
+            Entry* entry = FindOrAddEntry(dataPatch, &isNewEntry);
+            if (!entry || isNewEntry)
+            {
+                return nullptr;
+            }
+            if (!entry->m_container)
+            {
+                storeResult = true;
+                m_pendingEntry = entry;
+            }
+            return entry->m_container.get();
+        }
+
+        //! Keeps a copy of the entities produced by the patch last passed to Find, if Find requested them.
+        void Store(const InstantiatedContainer* container)
+        {
+            if (m_pendingEntry)
+            {
+                m_pendingEntry->m_container.reset(m_serializeContext->CloneObject(container));
+                m_pendingEntry = nullptr;
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            AZStd::vector<u8> m_patchData;
+            AZStd::unique_ptr<InstantiatedContainer> m_container;
+        };
+
+        Entry* FindOrAddEntry(const DataPatch& dataPatch, bool* isNewEntry = nullptr)
+        {
+            AZStd::vector<u8> patchData;
+            IO::ByteContainerStream<AZStd::vector<u8>> patchStream(&patchData);
+            if (!Utils::SaveObjectToStream(patchStream, ObjectStream::ST_BINARY, &dataPatch, m_serializeContext))
+            {
+                return nullptr;
+            }
+
+            const Crc32 key(patchData.data(), patchData.size());
+            auto range = m_entries.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second.m_patchData == patchData)
+                {
+                    return &it->second;
+                }
+            }
+
+            if (isNewEntry)
+            {
+                *isNewEntry = true;
+            }
+            return &m_entries.emplace(key, Entry{ AZStd::move(patchData), nullptr }).first->second;
+        }
+
+        SerializeContext* m_serializeContext;
+        //! The first patch seen for each address hash, or null once it has been serialized into an entry.
+        AZStd::unordered_map<size_t, const DataPatch*> m_firstPatchPerAddressHash;
+        AZStd::unordered_multimap<Crc32, Entry> m_entries;
+        Entry* m_pendingEntry = nullptr;
+    };
+
     //=========================================================================
     // SliceComponent::SliceReference::Instantiate
     //=========================================================================
@@ -1115,9 +1220,12 @@ namespace AZ
 
         m_isInstantiated = true;
 
+        // Only worth comparing patches when there is more than one instance that could share the result.
+        PatchedContainerCache patchedContainerCache(dependentSlice->GetSerializeContext());
+        PatchedContainerCache* sharedPatchedContainers = m_instances.size() > 1 ? &patchedContainerCache : nullptr;
         for (SliceInstance& instance : m_instances)
         {
-            InstantiateInstance(instance, filterDesc);
+            InstantiateInstance(instance, filterDesc, sharedPatchedContainers);
         }
         return true;
     }
@@ -1142,7 +1250,7 @@ namespace AZ
     //=========================================================================
     // SliceComponent::SliceReference::InstantiateInstance
     //=========================================================================
-    void SliceComponent::SliceReference::InstantiateInstance(SliceInstance& instance, const AZ::ObjectStream::FilterDescriptor& filterDesc)
+    void SliceComponent::SliceReference::InstantiateInstance(SliceInstance& instance, const AZ::ObjectStream::FilterDescriptor& filterDesc, PatchedContainerCache* patchedContainerCache)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
@@ -1183,7 +1291,26 @@ namespace AZ
             DataPatch::FlagsMap sourceDataFlags = dependentSlice->GetDataFlagsForInstances().GetDataFlagsForPatching();
             DataPatch::FlagsMap targetDataFlags = instance.GetDataFlags().GetDataFlagsForPatching(&instance.GetEntityIdToBaseMap());
 
-            instance.m_instantiated = dataPatch.Apply(&sourceObjects, dependentSlice->GetSerializeContext(), filterDesc, sourceDataFlags, targetDataFlags);
+            // The source data flags are the same for all instances of this reference, so instances without data flags of their own
+            // produce the same entities for the same patch.
+            SerializeContext* serializeContext = dependentSlice->GetSerializeContext();
+            bool storePatchedContainer = false;
+            const InstantiatedContainer* patchedContainer = (patchedContainerCache && targetDataFlags.empty()) ?
+                patchedContainerCache->Find(dataPatch, storePatchedContainer) : nullptr;
+
+            if (patchedContainer)
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "SliceComponent::SliceReference::InstantiateInstance:ClonePatchedContainer");
+                instance.m_instantiated = serializeContext->CloneObject(patchedContainer);
+            }
+            else
+            {
+                instance.m_instantiated = dataPatch.Apply(&sourceObjects, serializeContext, filterDesc, sourceDataFlags, targetDataFlags);
+                if (instance.m_instantiated && storePatchedContainer)
+                {
+                    patchedContainerCache->Store(instance.m_instantiated);
+                }
+            }
 
             if (!instance.m_instantiated)
             {
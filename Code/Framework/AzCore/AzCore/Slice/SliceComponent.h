@@ -506,6 +506,9 @@ namespace AZ
             void ComputeDataPatch(SliceInstance* instance);
         protected:
 
+            /// Patched copies of the dependent slice's entities, shared between instances with identical overrides during instantiation.
+            class PatchedContainerCache;
+
             /// Internal only function that computes the data patch for the given instance.
             /// This assumes that the instance has already been verified to be related to this slice.
             void ComputeDataPatchForInstanceKnownToReference(SliceInstance& instance, SerializeContext* serializeContext, InstantiatedContainer& sourceContainer);
@@ -528,7 +531,9 @@ namespace AZ
 
             void UnInstantiate();
 
-            void InstantiateInstance(SliceInstance& instance, const AZ::ObjectStream::FilterDescriptor& filterDesc);
+            /// Instantiates a single instance. If a patched container cache is provided, instances whose data patch was already applied
+            /// through the same cache clone the patched entities instead of applying their data patch again.
+            void InstantiateInstance(SliceInstance& instance, const AZ::ObjectStream::FilterDescriptor& filterDesc, PatchedContainerCache* patchedContainerCache = nullptr);
 
             void AddInstanceToEntityInfoMap(SliceInstance& instance);
 
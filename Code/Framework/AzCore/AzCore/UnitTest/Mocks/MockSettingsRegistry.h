@@ -49,6 +49,9 @@ namespace AZ
         MOCK_METHOD5(
             MergeSettingsFolder,
             bool(AZStd::string_view, const Specializations&, AZStd::string_view, AZStd::string_view, AZStd::vector<char>*));
+        MOCK_CONST_METHOD2(CreateCacheKey, CacheKey(const Specializations&, AZStd::string_view));
+        MOCK_METHOD2(MergeSettingsCache, bool(AZStd::string_view, const CacheKey&));
+        MOCK_CONST_METHOD2(StoreSettingsCache, bool(AZStd::string_view, const CacheKey&));
 
         MOCK_METHOD1(SetApplyPatchSettings, void(const JsonApplyPatchSettings&));
         MOCK_METHOD1(GetApplyPatchSettings, void(JsonApplyPatchSettings&));
@@ -57,6 +57,8 @@ set(FILES
     Component/NonUniformScaleBus.h
     Component/TickBus.h
     Component/TransformBus.h
+    Console/AsyncLogSink.cpp
+    Console/AsyncLogSink.h
     Console/Console.cpp
     Console/Console.h
     Console/ConsoleDataWrapper.h
@@ -112,6 +114,8 @@ set(FILES
     Debug/EventTraceDriller.h
     Debug/EventTraceDriller.cpp
     Debug/EventTraceDrillerBus.h
+    Debug/EventTraceRecorder.h
+    Debug/EventTraceRecorder.cpp
     Debug/Timer.h
     Debug/Trace.cpp
     Debug/Trace.h
@@ -174,6 +178,8 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MemoryMappedFile.cpp
+    IO/MemoryMappedFile.h
     IO/Path/Path.cpp
     IO/Path/Path.h
     IO/Path/Path.inl
@@ -183,6 +189,8 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/BlockDecompression.h
+    IO/Streamer/BlockDecompression.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -192,6 +200,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/MemoryMappedReader.h
+    IO/Streamer/MemoryMappedReader.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -228,6 +238,8 @@ set(FILES
     Jobs/JobContext.h
     Jobs/JobEmpty.h
     Jobs/JobFunction.h
+    Jobs/JobGraph.cpp
+    Jobs/JobGraph.h
     Jobs/JobManager.cpp
     Jobs/JobManager.h
     Jobs/JobManagerBus.h
@@ -240,6 +252,8 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
     Math/Color.cpp
     Math/Color.h
     Math/Color.inl
@@ -268,6 +282,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_simd.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -322,6 +338,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -372,6 +389,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameAllocator.cpp
+    Memory/FrameAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -523,6 +542,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
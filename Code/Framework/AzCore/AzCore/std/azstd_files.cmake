@@ -19,6 +19,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -50,6 +51,8 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, template<class> class SlotPolicy>
+        struct FlatHashMapTableTraits
+            : public SlotPolicy<AZStd::pair<const Key, MappedType>>
+        {
+            typedef Key                                     key_type;
+            typedef EqualKey                                key_eq;
+            typedef Hasher                                  hasher;
+            typedef AZStd::pair<const Key, MappedType>      value_type;
+            typedef Allocator                               allocator_type;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value)   { return value.first; }
+        };
+
+        /**
+         * The map interface shared by flat_hash_map and node_hash_map.
+         */
+        template<class Traits, class MappedType>
+        class flat_hash_map_base
+            : public flat_hash_table<Traits>
+        {
+            typedef flat_hash_map_base<Traits, MappedType> this_type;
+            typedef flat_hash_table<Traits> base_type;
+        public:
+            typedef typename base_type::key_type        key_type;
+            typedef typename base_type::key_eq          key_eq;
+            typedef typename base_type::hasher          hasher;
+            typedef MappedType                          mapped_type;
+            typedef typename base_type::value_type      value_type;
+            typedef typename base_type::allocator_type  allocator_type;
+            typedef typename base_type::size_type       size_type;
+            typedef typename base_type::iterator        iterator;
+            typedef typename base_type::const_iterator  const_iterator;
+            typedef typename base_type::pair_iter_bool  pair_iter_bool;
+
+            flat_hash_map_base()
+                : base_type(hasher(), key_eq(), allocator_type()) {}
+            explicit flat_hash_map_base(const allocator_type& alloc)
+                : base_type(hasher(), key_eq(), alloc) {}
+            /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+            flat_hash_map_base(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+                : base_type(hash, keyEqual, allocator) {}
+            explicit flat_hash_map_base(size_type numElementsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::reserve(numElementsHint);
+            }
+            template<class Iterator>
+            flat_hash_map_base(Iterator first, Iterator last, size_type numElementsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::reserve(numElementsHint);
+                base_type::insert(first, last);
+            }
+            flat_hash_map_base(const std::initializer_list<value_type>& list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::insert(list);
+            }
+
+            /**
+             * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+             */
+            AZ_FORCE_INLINE mapped_type& operator[](const key_type& key)
+            {
+                return try_emplace(key).first->second;
+            }
+            AZ_FORCE_INLINE mapped_type& operator[](key_type&& key)
+            {
+                return try_emplace(AZStd::move(key)).first->second;
+            }
+            /**
+             * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+             */
+            AZ_FORCE_INLINE mapped_type& at(const key_type& key)
+            {
+                iterator iter = base_type::find(key);
+                AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+                return iter->second;
+            }
+            AZ_FORCE_INLINE const mapped_type& at(const key_type& key) const
+            {
+                const_iterator iter = base_type::find(key);
+                AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+                return iter->second;
+            }
+
+            //! C++17 insert_or_assign function assigns the element to the mapped_type if the key exist in the container
+            //! Otherwise a new value is inserted into the container
+            template <typename M>
+            pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+            {
+                pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+                if (!result.second)
+                {
+                    result.first->second = AZStd::forward<M>(value);
+                }
+                return result;
+            }
+            template <typename M>
+            pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+            {
+                pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+                if (!result.second)
+                {
+                    result.first->second = AZStd::forward<M>(value);
+                }
+                return result;
+            }
+
+            //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+            //! otherwise it constructs the value type in place from the key and the arguments.
+            template <typename... Args>
+            pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+            {
+                return base_type::emplace_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                    AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+            }
+            template <typename... Args>
+            pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+            {
+                return base_type::emplace_unique(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                    AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+            }
+            template <typename... Args>
+            iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+            {
+                return try_emplace(key, AZStd::forward<Args>(arguments)...).first;
+            }
+            template <typename... Args>
+            iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+            {
+                return try_emplace(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Open addressing hash map that stores the key value pairs in a flat array, see \ref flat_hash_table.
+     * Lookups and inserts are considerably faster than with unordered_map, as they don't allocate per element or
+     * follow list pointers, which makes it the preferred map for hot paths.
+     * The interface follows unordered_map, but inserts can move the elements so references and iterators to elements
+     * are invalidated when the map grows. Use node_hash_map if references to the elements have to stay valid.
+     * There's no bucket interface and no node handles.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_map_base<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator, Internal::flat_hash_slot_policy>, MappedType>
+    {
+        typedef Internal::flat_hash_map_base<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator, Internal::flat_hash_slot_policy>, MappedType> base_type;
+    public:
+        using base_type::base_type;
+    };
+
+    /**
+     * Same as flat_hash_map, but the key value pairs are allocated separately and the table only stores pointers
+     * to them. Lookups pay for one more indirection, but references to the elements stay valid until the element
+     * is erased, even when the map grows. Iterators are still invalidated when the map grows.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class node_hash_map
+        : public Internal::flat_hash_map_base<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator, Internal::flat_hash_node_slot_policy>, MappedType>
+    {
+        typedef Internal::flat_hash_map_base<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator, Internal::flat_hash_node_slot_policy>, MappedType> base_type;
+    public:
+        using base_type::base_type;
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    namespace Internal
+    {
+        template<class Map>
+        bool flat_hash_map_equal(const Map& a, const Map& b)
+        {
+            if (a.size() != b.size())
+            {
+                return false;
+            }
+            // The order of the elements depends on the insertion history, so look up every element instead of comparing ranges.
+            for (const auto& element : a)
+            {
+                auto iter = b.find(element.first);
+                if (iter == b.end() || !(iter->second == element.second))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace Internal
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return Internal::flat_hash_map_equal(a, b);
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return Internal::flat_hash_map_equal(a, b);
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        return Internal::flat_hash_erase_if(container, predicate);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(node_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        return Internal::flat_hash_erase_if(container, predicate);
+    }
+} // namespace AZStd
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator, template<class> class SlotPolicy>
+        struct FlatHashSetTableTraits
+            : public SlotPolicy<Key>
+        {
+            typedef Key         key_type;
+            typedef EqualKey    key_eq;
+            typedef Hasher      hasher;
+            typedef Key         value_type;
+            typedef Allocator   allocator_type;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value)  { return value; }
+        };
+
+        /**
+         * The set interface shared by flat_hash_set and node_hash_set.
+         */
+        template<class Traits>
+        class flat_hash_set_base
+            : public flat_hash_table<Traits>
+        {
+            typedef flat_hash_table<Traits> base_type;
+        public:
+            typedef typename base_type::key_type        key_type;
+            typedef typename base_type::key_eq          key_eq;
+            typedef typename base_type::hasher          hasher;
+            typedef typename base_type::value_type      value_type;
+            typedef typename base_type::allocator_type  allocator_type;
+            typedef typename base_type::size_type       size_type;
+
+            flat_hash_set_base()
+                : base_type(hasher(), key_eq(), allocator_type()) {}
+            explicit flat_hash_set_base(const allocator_type& alloc)
+                : base_type(hasher(), key_eq(), alloc) {}
+            /// This constructor is AZStd extension (so we don't rehash/allocate memory)
+            flat_hash_set_base(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+                : base_type(hash, keyEqual, allocator) {}
+            explicit flat_hash_set_base(size_type numElementsHint, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::reserve(numElementsHint);
+            }
+            template<class Iterator>
+            flat_hash_set_base(Iterator first, Iterator last, size_type numElementsHint = 0, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::reserve(numElementsHint);
+                base_type::insert(first, last);
+            }
+            flat_hash_set_base(const std::initializer_list<value_type>& list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+                : base_type(hash, keyEqual, allocator)
+            {
+                base_type::insert(list);
+            }
+        };
+
+        template<class Set>
+        bool flat_hash_set_equal(const Set& a, const Set& b)
+        {
+            if (a.size() != b.size())
+            {
+                return false;
+            }
+            for (const auto& element : a)
+            {
+                if (!b.contains(element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace Internal
+
+    /**
+     * Open addressing hash set that stores the keys in a flat array, see \ref flat_hash_table.
+     * Lookups and inserts are considerably faster than with unordered_set, as they don't allocate per element or
+     * follow list pointers, which makes it the preferred set for hot paths.
+     * The interface follows unordered_set, but inserts can move the elements so references and iterators to elements
+     * are invalidated when the set grows. Use node_hash_set if references to the elements have to stay valid.
+     * There's no bucket interface and no node handles.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_set_base<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator, Internal::flat_hash_slot_policy>>
+    {
+        typedef Internal::flat_hash_set_base<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator, Internal::flat_hash_slot_policy>> base_type;
+    public:
+        using base_type::base_type;
+    };
+
+    /**
+     * Same as flat_hash_set, but the keys are allocated separately and the table only stores pointers to them.
+     * Lookups pay for one more indirection, but references to the elements stay valid until the element is erased,
+     * even when the set grows. Iterators are still invalidated when the set grows.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class node_hash_set
+        : public Internal::flat_hash_set_base<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator, Internal::flat_hash_node_slot_policy>>
+    {
+        typedef Internal::flat_hash_set_base<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator, Internal::flat_hash_node_slot_policy>> base_type;
+    public:
+        using base_type::base_type;
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(node_hash_set<Key, Hasher, EqualKey, Allocator>& left, node_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return Internal::flat_hash_set_equal(a, b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& a, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator==(const node_hash_set<Key, Hasher, EqualKey, Allocator>& a, const node_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return Internal::flat_hash_set_equal(a, b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const node_hash_set<Key, Hasher, EqualKey, Allocator>& a, const node_hash_set<Key, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        return Internal::flat_hash_erase_if(container, predicate);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(node_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        return Internal::flat_hash_erase_if(container, predicate);
+    }
+} // namespace AZStd
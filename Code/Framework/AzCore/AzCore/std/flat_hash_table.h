@@ -0,0 +1,955 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Internal/MathTypes.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/functional_basic.h>
+
+#include <string.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Every slot in a flat hash table has a control byte that's either empty, deleted or, when the slot
+         * is in use, 7 bits of the hash of the key stored in the slot. The control bytes are stored separately
+         * from the slots so a group of 16 can be checked at once for matching, empty or deleted entries.
+         */
+        using flat_hash_ctrl_t = AZ::s8;
+
+        static constexpr flat_hash_ctrl_t flat_hash_ctrl_empty = -128;
+        static constexpr flat_hash_ctrl_t flat_hash_ctrl_deleted = -2;
+        //! Marks the end of the control bytes so iteration stops without checking the capacity.
+        static constexpr flat_hash_ctrl_t flat_hash_ctrl_sentinel = -1;
+
+        static constexpr AZStd::size_t flat_hash_group_width = 16;
+        //! The first group_width - 1 control bytes are repeated after the sentinel so a group can be loaded from
+        //! any position without wrapping around.
+        static constexpr AZStd::size_t flat_hash_num_cloned_bytes = flat_hash_group_width - 1;
+
+        AZ_FORCE_INLINE bool flat_hash_is_full(flat_hash_ctrl_t ctrl)              { return ctrl >= 0; }
+        AZ_FORCE_INLINE bool flat_hash_is_empty_or_deleted(flat_hash_ctrl_t ctrl)  { return ctrl < flat_hash_ctrl_sentinel; }
+
+        //! Control bytes of a table that doesn't have any storage yet. This allows lookups and iteration on an
+        //! empty table without checking for a null pointer.
+        inline flat_hash_ctrl_t* flat_hash_empty_group()
+        {
+            alignas(16) static const flat_hash_ctrl_t emptyGroup[flat_hash_group_width] =
+            {
+                flat_hash_ctrl_sentinel, flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty,
+                flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty,
+                flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty,
+                flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty, flat_hash_ctrl_empty
+            };
+            // The empty group is never written to, as inserting into a table without storage always allocates first.
+            return const_cast<flat_hash_ctrl_t*>(emptyGroup);
+        }
+
+        /**
+         * The hashes from AZStd::hash are frequently the identity function (e.g. for integers and pointers), which
+         * would put consecutive keys in the same group and leave the 7 bits in the control byte without entropy.
+         * Mix the bits so both the probe start and the control byte depend on the entire hash.
+         */
+        AZ_FORCE_INLINE AZStd::size_t flat_hash_mix(AZStd::size_t hash)
+        {
+            const AZ::u64 mixed = static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull;
+            return static_cast<AZStd::size_t>(mixed ^ (mixed >> 32));
+        }
+        AZ_FORCE_INLINE AZStd::size_t flat_hash_h1(AZStd::size_t hash)         { return hash >> 7; }
+        AZ_FORCE_INLINE flat_hash_ctrl_t flat_hash_h2(AZStd::size_t hash)      { return static_cast<flat_hash_ctrl_t>(hash & 0x7f); }
+
+        /**
+         * A group of control bytes that are checked together. Every function returns a bit mask with a bit set
+         * for every control byte in the group that matches.
+         */
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        class flat_hash_group
+        {
+        public:
+            AZ_FORCE_INLINE explicit flat_hash_group(const flat_hash_ctrl_t* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match(flat_hash_ctrl_t h2) const
+            {
+                return static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match_empty_or_deleted() const
+            {
+                return static_cast<AZ::u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(flat_hash_ctrl_sentinel), m_ctrl)));
+            }
+
+            //! Returns the number of empty or deleted slots at the start of the group.
+            AZ_FORCE_INLINE AZ::u32 count_leading_empty_or_deleted() const
+            {
+                return az_ctz_u32(match_empty_or_deleted() + 1);
+            }
+
+        private:
+            __m128i m_ctrl;
+        };
+#else
+        class flat_hash_group
+        {
+        public:
+            AZ_FORCE_INLINE explicit flat_hash_group(const flat_hash_ctrl_t* ctrl)
+            {
+                memcpy(m_ctrl, ctrl, flat_hash_group_width);
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match(flat_hash_ctrl_t h2) const
+            {
+                AZ::u32 result = 0;
+                for (AZ::u32 i = 0; i < flat_hash_group_width; ++i)
+                {
+                    result |= static_cast<AZ::u32>(m_ctrl[i] == h2) << i;
+                }
+                return result;
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match_empty() const
+            {
+                return match(flat_hash_ctrl_empty);
+            }
+
+            AZ_FORCE_INLINE AZ::u32 match_empty_or_deleted() const
+            {
+                AZ::u32 result = 0;
+                for (AZ::u32 i = 0; i < flat_hash_group_width; ++i)
+                {
+                    result |= static_cast<AZ::u32>(flat_hash_is_empty_or_deleted(m_ctrl[i])) << i;
+                }
+                return result;
+            }
+
+            //! Returns the number of empty or deleted slots at the start of the group.
+            AZ_FORCE_INLINE AZ::u32 count_leading_empty_or_deleted() const
+            {
+                return az_ctz_u32(match_empty_or_deleted() + 1);
+            }
+
+        private:
+            flat_hash_ctrl_t m_ctrl[flat_hash_group_width];
+        };
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+
+        /**
+         * Triangular probing over groups. As the number of groups is a power of two this visits every group exactly once.
+         */
+        class flat_hash_probe
+        {
+        public:
+            AZ_FORCE_INLINE flat_hash_probe(AZStd::size_t hash, AZStd::size_t mask)
+                : m_mask(mask)
+                , m_offset(hash & mask)
+            {
+            }
+
+            AZ_FORCE_INLINE AZStd::size_t offset() const                    { return m_offset; }
+            AZ_FORCE_INLINE AZStd::size_t offset(AZStd::size_t i) const     { return (m_offset + i) & m_mask; }
+
+            AZ_FORCE_INLINE void next()
+            {
+                m_index += flat_hash_group_width;
+                m_offset = (m_offset + m_index) & m_mask;
+            }
+
+        private:
+            AZStd::size_t m_mask;
+            AZStd::size_t m_offset;
+            AZStd::size_t m_index{ 0 };
+        };
+
+        /**
+         * Slot policy that stores the values directly in the table. This is the fastest option, but values are moved
+         * when the table grows, so pointers and references to values are invalidated by inserts.
+         */
+        template<class T>
+        struct flat_hash_slot_policy
+        {
+            using slot_type = T;
+
+            static AZ_FORCE_INLINE T& element(slot_type* slot)             { return *slot; }
+            static AZ_FORCE_INLINE const T& element(const slot_type* slot) { return *slot; }
+
+            template<class Allocator, class... Args>
+            static AZ_FORCE_INLINE void construct(Allocator&, slot_type* slot, Args&&... args)
+            {
+                ::new (static_cast<void*>(slot)) T(AZStd::forward<Args>(args)...);
+            }
+
+            template<class Allocator>
+            static AZ_FORCE_INLINE void destroy(Allocator&, slot_type* slot)
+            {
+                slot->~T();
+            }
+
+            //! Moves the value from one slot to another, leaving the source slot uninitialized.
+            template<class Allocator>
+            static AZ_FORCE_INLINE void transfer(Allocator&, slot_type* destination, slot_type* source)
+            {
+                ::new (static_cast<void*>(destination)) T(AZStd::move(*source));
+                source->~T();
+            }
+        };
+
+        /**
+         * Slot policy that stores a pointer to a separately allocated value. Lookups pay for one more indirection, but
+         * values never move, so pointers and references to values stay valid until the value is erased.
+         */
+        template<class T>
+        struct flat_hash_node_slot_policy
+        {
+            using slot_type = T*;
+
+            static AZ_FORCE_INLINE T& element(slot_type* slot)             { return **slot; }
+            static AZ_FORCE_INLINE const T& element(const slot_type* slot) { return **slot; }
+
+            template<class Allocator, class... Args>
+            static AZ_FORCE_INLINE void construct(Allocator& allocator, slot_type* slot, Args&&... args)
+            {
+                void* node = allocator.allocate(sizeof(T), alignof(T));
+                *slot = ::new (node) T(AZStd::forward<Args>(args)...);
+            }
+
+            template<class Allocator>
+            static AZ_FORCE_INLINE void destroy(Allocator& allocator, slot_type* slot)
+            {
+                (*slot)->~T();
+                allocator.deallocate(*slot, sizeof(T), alignof(T));
+            }
+
+            template<class Allocator>
+            static AZ_FORCE_INLINE void transfer(Allocator&, slot_type* destination, slot_type* source)
+            {
+                *destination = *source;
+            }
+        };
+
+        //! Shared implementation of erase_if for the flat hash containers.
+        template<class Container, class Predicate>
+        typename Container::size_type flat_hash_erase_if(Container& container, Predicate predicate)
+        {
+            auto originalSize = container.size();
+            for (auto iter = container.begin(); iter != container.end(); )
+            {
+                if (predicate(*iter))
+                {
+                    iter = container.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+            return originalSize - container.size();
+        }
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table, the base for flat_hash_map/set and node_hash_map/set.
+     * Values are stored in a single array next to an array of one byte per slot, which stores 7 bits of the hash of
+     * the value in the slot. Lookups check 16 of these bytes at a time using SIMD (when available), and only compare
+     * keys of the slots where the hash bits match, which makes lookups a few cache misses at most and inserts
+     * allocation free until the table needs to grow. The maximum load factor is fixed at 7/8.
+     *
+     * Erased slots are marked as deleted instead of shifting values around, so erasing never invalidates iterators
+     * to other values. Inserting can grow the table, which invalidates all iterators.
+     *
+     * Traits has to provide the key_type, value_type, hasher, key_eq and allocator_type types, key_from_value
+     * and a slot policy (see Internal::flat_hash_slot_policy).
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        typedef flat_hash_table<Traits> this_type;
+        typedef typename Traits::slot_type slot_type;
+        typedef Internal::flat_hash_ctrl_t ctrl_t;
+
+    public:
+        typedef Traits                                  traits_type;
+        typedef typename Traits::key_type               key_type;
+        typedef typename Traits::key_eq                 key_eq;
+        typedef typename Traits::hasher                 hasher;
+        typedef typename Traits::value_type             value_type;
+        typedef typename Traits::allocator_type         allocator_type;
+
+        typedef AZStd::size_t                           size_type;
+        typedef AZStd::ptrdiff_t                        difference_type;
+        typedef value_type*                             pointer;
+        typedef const value_type*                       const_pointer;
+        typedef value_type&                             reference;
+        typedef const value_type&                       const_reference;
+
+        class const_iterator;
+
+        class iterator
+        {
+            friend class flat_hash_table;
+            friend class const_iterator;
+        public:
+            typedef AZStd::forward_iterator_tag         iterator_category;
+            typedef typename this_type::value_type      value_type;
+            typedef typename this_type::difference_type difference_type;
+            typedef typename this_type::pointer         pointer;
+            typedef typename this_type::reference       reference;
+
+            iterator() = default;
+
+            AZ_FORCE_INLINE reference operator*() const    { return Traits::element(m_slot); }
+            AZ_FORCE_INLINE pointer operator->() const     { return &Traits::element(m_slot); }
+
+            AZ_FORCE_INLINE iterator& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skip_empty_or_deleted();
+                return *this;
+            }
+            AZ_FORCE_INLINE iterator operator++(int)
+            {
+                iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            AZ_FORCE_INLINE bool operator==(const iterator& rhs) const { return m_ctrl == rhs.m_ctrl; }
+            AZ_FORCE_INLINE bool operator!=(const iterator& rhs) const { return m_ctrl != rhs.m_ctrl; }
+
+        private:
+            AZ_FORCE_INLINE iterator(ctrl_t* ctrl, slot_type* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+            }
+
+            AZ_FORCE_INLINE void skip_empty_or_deleted()
+            {
+                while (Internal::flat_hash_is_empty_or_deleted(*m_ctrl))
+                {
+                    const AZ::u32 shift = Internal::flat_hash_group(m_ctrl).count_leading_empty_or_deleted();
+                    m_ctrl += shift;
+                    m_slot += shift;
+                }
+            }
+
+            ctrl_t* m_ctrl{ nullptr };
+            slot_type* m_slot{ nullptr };
+        };
+
+        class const_iterator
+        {
+            friend class flat_hash_table;
+        public:
+            typedef AZStd::forward_iterator_tag         iterator_category;
+            typedef typename this_type::value_type      value_type;
+            typedef typename this_type::difference_type difference_type;
+            typedef typename this_type::const_pointer   pointer;
+            typedef typename this_type::const_reference reference;
+
+            const_iterator() = default;
+            AZ_FORCE_INLINE const_iterator(const iterator& rhs)
+                : m_iter(rhs)
+            {
+            }
+
+            AZ_FORCE_INLINE reference operator*() const    { return *m_iter; }
+            AZ_FORCE_INLINE pointer operator->() const     { return m_iter.operator->(); }
+
+            AZ_FORCE_INLINE const_iterator& operator++()
+            {
+                ++m_iter;
+                return *this;
+            }
+            AZ_FORCE_INLINE const_iterator operator++(int)
+            {
+                const_iterator result = *this;
+                ++m_iter;
+                return result;
+            }
+
+            AZ_FORCE_INLINE bool operator==(const const_iterator& rhs) const { return m_iter == rhs.m_iter; }
+            AZ_FORCE_INLINE bool operator!=(const const_iterator& rhs) const { return m_iter != rhs.m_iter; }
+
+        private:
+            iterator m_iter;
+        };
+
+        typedef AZStd::pair<iterator, bool>             pair_iter_bool;
+
+        explicit flat_hash_table(const hasher& hash, const key_eq& keyEqual, const allocator_type& alloc = allocator_type())
+            : m_keyEqual(keyEqual)
+            , m_hasher(hash)
+            , m_allocator(alloc)
+        {
+        }
+
+        flat_hash_table(const this_type& rhs)
+            : m_keyEqual(rhs.m_keyEqual)
+            , m_hasher(rhs.m_hasher)
+            , m_allocator(rhs.m_allocator)
+        {
+            copy(rhs);
+        }
+
+        flat_hash_table(this_type&& rhs)
+            : m_keyEqual(rhs.m_keyEqual)
+            , m_hasher(rhs.m_hasher)
+            , m_allocator(rhs.m_allocator)
+        {
+            steal(rhs);
+        }
+
+        ~flat_hash_table()
+        {
+            destroy_and_deallocate();
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_keyEqual = rhs.m_keyEqual;
+                m_hasher = rhs.m_hasher;
+                copy(rhs);
+            }
+            return *this;
+        }
+
+        this_type& operator=(this_type&& rhs)
+        {
+            if (this != &rhs)
+            {
+                destroy_and_deallocate();
+                m_keyEqual = rhs.m_keyEqual;
+                m_hasher = rhs.m_hasher;
+                if (m_allocator == rhs.m_allocator)
+                {
+                    steal(rhs);
+                }
+                else
+                {
+                    // The memory can't be handed over to a different allocator, so move the values one by one.
+                    reserve(rhs.m_size);
+                    for (size_type i = 0; i < rhs.m_capacity; ++i)
+                    {
+                        if (Internal::flat_hash_is_full(rhs.m_ctrl[i]))
+                        {
+                            value_type& value = Traits::element(rhs.m_slots + i);
+                            const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+                            Traits::construct(m_allocator, m_slots + index, AZStd::move(value));
+                        }
+                    }
+                    rhs.clear();
+                }
+            }
+            return *this;
+        }
+
+        AZ_FORCE_INLINE iterator begin()
+        {
+            iterator result(m_ctrl, m_slots);
+            result.skip_empty_or_deleted();
+            return result;
+        }
+        AZ_FORCE_INLINE const_iterator begin() const                { return const_cast<this_type*>(this)->begin(); }
+        AZ_FORCE_INLINE iterator end()                              { return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+        AZ_FORCE_INLINE const_iterator end() const                  { return const_cast<this_type*>(this)->end(); }
+        AZ_FORCE_INLINE const_iterator cbegin() const               { return begin(); }
+        AZ_FORCE_INLINE const_iterator cend() const                 { return end(); }
+
+        AZ_FORCE_INLINE bool empty() const                          { return m_size == 0; }
+        AZ_FORCE_INLINE size_type size() const                      { return m_size; }
+        AZ_FORCE_INLINE size_type max_size() const                  { return size_type(-1) / (sizeof(slot_type) + 1); }
+
+        //! Returns the number of slots. Unlike the node based containers there's a slot per value, not per bucket.
+        AZ_FORCE_INLINE size_type bucket_count() const              { return m_capacity; }
+        AZ_FORCE_INLINE size_type capacity() const                  { return m_capacity; }
+        AZ_FORCE_INLINE float load_factor() const                   { return m_capacity > 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f; }
+        AZ_FORCE_INLINE float max_load_factor() const               { return 7.0f / 8.0f; }
+        //! The maximum load factor is fixed for flat hash tables, this is for compatibility with unordered_map only.
+        AZ_FORCE_INLINE void max_load_factor(float)                 {}
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            return emplace_unique(Traits::key_from_value(value), value);
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            return emplace_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+        iterator insert(const_iterator, const value_type& value)
+        {
+            return insert(value).first;
+        }
+        iterator insert(const_iterator, value_type&& value)
+        {
+            return insert(AZStd::move(value)).first;
+        }
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        void insert(std::initializer_list<value_type> list)
+        {
+            reserve(m_size + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        /**
+         * Constructs the value in a temporary to find its key, then moves it into the table if the key isn't
+         * present yet. Prefer insert or try_emplace when the key is available up front.
+         */
+        template<class... Args>
+        pair_iter_bool emplace(Args&&... args)
+        {
+            value_type value(AZStd::forward<Args>(args)...);
+            return emplace_unique(Traits::key_from_value(value), AZStd::move(value));
+        }
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... args)
+        {
+            return emplace(AZStd::forward<Args>(args)...).first;
+        }
+
+        iterator erase(const_iterator where)
+        {
+            iterator next = where.m_iter;
+            ++next;
+            erase_at(where.m_iter.m_ctrl - m_ctrl);
+            return next;
+        }
+        iterator erase(iterator where)
+        {
+            return erase(const_iterator(where));
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return last.m_iter;
+        }
+        size_type erase(const key_type& key)
+        {
+            const size_type index = find_index(key, hash_key(key));
+            if (index == m_capacity)
+            {
+                return 0;
+            }
+            erase_at(index);
+            return 1;
+        }
+
+        //! Destroys all values, but keeps the memory so the table can be refilled without allocating.
+        void clear()
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            destroy_values();
+            reset_ctrl();
+            m_size = 0;
+            reset_growth_left();
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            AZStd::swap(m_ctrl, rhs.m_ctrl);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_allocator, rhs.m_allocator);
+        }
+
+        AZ_FORCE_INLINE iterator find(const key_type& key)
+        {
+            return iterator_at(find_index(key, hash_key(key)));
+        }
+        AZ_FORCE_INLINE const_iterator find(const key_type& key) const
+        {
+            return const_cast<this_type*>(this)->find(key);
+        }
+        AZ_FORCE_INLINE bool contains(const key_type& key) const
+        {
+            return find_index(key, hash_key(key)) != m_capacity;
+        }
+        AZ_FORCE_INLINE size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        //! Makes sure numElements values can be stored without the table growing.
+        void reserve(size_type numElements)
+        {
+            if (numElements > m_size + m_growthLeft)
+            {
+                resize(normalize_capacity(growth_to_capacity(numElements)));
+            }
+        }
+
+        //! Resizes the table to have at least numSlots slots, but never less than needed for the current values.
+        //! Rehashing to 0 slots releases the memory of an empty table.
+        void rehash(size_type numSlots)
+        {
+            if (numSlots == 0 && m_size == 0)
+            {
+                destroy_and_deallocate();
+                return;
+            }
+            const size_type newCapacity = normalize_capacity(AZStd::GetMax(numSlots, growth_to_capacity(m_size)));
+            if (numSlots == 0 || newCapacity > m_capacity)
+            {
+                resize(newCapacity);
+            }
+        }
+
+        AZ_FORCE_INLINE hasher hash_function() const                { return m_hasher; }
+        AZ_FORCE_INLINE key_eq key_eq_function() const              { return m_keyEqual; }
+
+        // The only difference from the standard is that we return the allocator instance, not a copy.
+        AZ_FORCE_INLINE allocator_type& get_allocator()             { return m_allocator; }
+        AZ_FORCE_INLINE const allocator_type& get_allocator() const { return m_allocator; }
+
+        /// Validates the internal state, returns false if the table is corrupted. Used for debugging and tests.
+        bool validate() const
+        {
+            size_type numFull = 0;
+            size_type numEmpty = 0;
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (Internal::flat_hash_is_full(m_ctrl[i]))
+                {
+                    ++numFull;
+                    const size_type hash = hash_key(Traits::key_from_value(Traits::element(m_slots + i)));
+                    if (Internal::flat_hash_h2(hash) != m_ctrl[i] || find_index(Traits::key_from_value(Traits::element(m_slots + i)), hash) != i)
+                    {
+                        return false;
+                    }
+                }
+                else if (m_ctrl[i] == Internal::flat_hash_ctrl_empty)
+                {
+                    ++numEmpty;
+                }
+            }
+            if (m_capacity > 0)
+            {
+                if (m_ctrl[m_capacity] != Internal::flat_hash_ctrl_sentinel ||
+                    memcmp(m_ctrl, m_ctrl + m_capacity + 1, AZStd::GetMin(m_capacity, Internal::flat_hash_num_cloned_bytes)) != 0)
+                {
+                    return false;
+                }
+            }
+            return numFull == m_size && m_growthLeft <= numEmpty;
+        }
+
+    protected:
+        AZ_FORCE_INLINE size_type hash_key(const key_type& key) const
+        {
+            return Internal::flat_hash_mix(m_hasher(key));
+        }
+
+        AZ_FORCE_INLINE iterator iterator_at(size_type index)
+        {
+            return iterator(m_ctrl + index, m_slots + index);
+        }
+
+        //! Returns the index of the slot with the key, or m_capacity if the key isn't in the table.
+        size_type find_index(const key_type& key, size_type hash) const
+        {
+            Internal::flat_hash_probe probe(Internal::flat_hash_h1(hash), m_capacity);
+            const ctrl_t h2 = Internal::flat_hash_h2(hash);
+            while (true)
+            {
+                const Internal::flat_hash_group group(m_ctrl + probe.offset());
+                for (AZ::u32 mask = group.match(h2); mask != 0; mask &= mask - 1)
+                {
+                    const size_type index = probe.offset(az_ctz_u32(mask));
+                    if (m_keyEqual(key, Traits::key_from_value(Traits::element(m_slots + index))))
+                    {
+                        return index;
+                    }
+                }
+                if (group.match_empty() != 0)
+                {
+                    return m_capacity;
+                }
+                probe.next();
+            }
+        }
+
+        /**
+         * Inserts a new value for the key if the key isn't in the table yet. The value is constructed in place
+         * from the arguments, so nothing is constructed if the key is already present.
+         */
+        template<class... Args>
+        pair_iter_bool emplace_unique(const key_type& key, Args&&... args)
+        {
+            const size_type hash = hash_key(key);
+            size_type index = find_index(key, hash);
+            if (index != m_capacity)
+            {
+                return pair_iter_bool(iterator_at(index), false);
+            }
+            index = prepare_insert(hash);
+            Traits::construct(m_allocator, m_slots + index, AZStd::forward<Args>(args)...);
+            return pair_iter_bool(iterator_at(index), true);
+        }
+
+    private:
+        static AZ_FORCE_INLINE size_type capacity_to_growth(size_type capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+        static AZ_FORCE_INLINE size_type growth_to_capacity(size_type growth)
+        {
+            return growth > 0 ? growth + (growth - 1) / 7 : 0;
+        }
+
+        //! Capacities are always a power of two minus one, so the capacity doubles as the mask for the probe sequence.
+        static size_type normalize_capacity(size_type capacity)
+        {
+            size_type result = Internal::flat_hash_group_width - 1;
+            while (result < capacity)
+            {
+                result = result * 2 + 1;
+            }
+            return result;
+        }
+
+        static AZ_FORCE_INLINE size_type slot_offset(size_type capacity)
+        {
+            return (capacity + Internal::flat_hash_group_width + alignof(slot_type) - 1) & ~(alignof(slot_type) - 1);
+        }
+
+        static AZ_FORCE_INLINE size_type allocation_size(size_type capacity)
+        {
+            return slot_offset(capacity) + capacity * sizeof(slot_type);
+        }
+
+        static constexpr size_type allocation_alignment()
+        {
+            return alignof(slot_type) > 16 ? alignof(slot_type) : 16;
+        }
+
+        AZ_FORCE_INLINE void reset_growth_left()
+        {
+            m_growthLeft = capacity_to_growth(m_capacity) - m_size;
+        }
+
+        void reset_ctrl()
+        {
+            memset(m_ctrl, Internal::flat_hash_ctrl_empty, m_capacity + Internal::flat_hash_group_width);
+            m_ctrl[m_capacity] = Internal::flat_hash_ctrl_sentinel;
+        }
+
+        //! Sets the control byte of a slot, as well as its clone if it's one of the first group_width - 1 slots.
+        AZ_FORCE_INLINE void set_ctrl(size_type index, ctrl_t ctrl)
+        {
+            m_ctrl[index] = ctrl;
+            m_ctrl[((index - Internal::flat_hash_num_cloned_bytes) & m_capacity) + (Internal::flat_hash_num_cloned_bytes & m_capacity)] = ctrl;
+        }
+
+        size_type find_first_non_full(size_type hash) const
+        {
+            Internal::flat_hash_probe probe(Internal::flat_hash_h1(hash), m_capacity);
+            while (true)
+            {
+                const AZ::u32 mask = Internal::flat_hash_group(m_ctrl + probe.offset()).match_empty_or_deleted();
+                if (mask != 0)
+                {
+                    return probe.offset(az_ctz_u32(mask));
+                }
+                probe.next();
+            }
+        }
+
+        //! Claims a slot for a value with the given hash, growing the table if needed. The caller constructs the value.
+        size_type prepare_insert(size_type hash)
+        {
+            size_type index = find_first_non_full(hash);
+            // Reusing a deleted slot doesn't reduce the number of empty slots, so it's allowed when the table is full.
+            if (m_growthLeft == 0 && m_ctrl[index] != Internal::flat_hash_ctrl_deleted)
+            {
+                rehash_and_grow_if_necessary();
+                index = find_first_non_full(hash);
+            }
+            ++m_size;
+            m_growthLeft -= (m_ctrl[index] == Internal::flat_hash_ctrl_empty) ? 1 : 0;
+            set_ctrl(index, Internal::flat_hash_h2(hash));
+            return index;
+        }
+
+        void rehash_and_grow_if_necessary()
+        {
+            if (m_capacity == 0)
+            {
+                resize(Internal::flat_hash_group_width - 1);
+            }
+            else if (m_size <= capacity_to_growth(m_capacity) / 2)
+            {
+                // Most of the used slots are deleted, rehashing at the same size is enough to reclaim them.
+                resize(m_capacity);
+            }
+            else
+            {
+                resize(m_capacity * 2 + 1);
+            }
+        }
+
+        void resize(size_type newCapacity)
+        {
+            ctrl_t* oldCtrl = m_ctrl;
+            slot_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            void* memory = m_allocator.allocate(allocation_size(newCapacity), allocation_alignment());
+            m_ctrl = static_cast<ctrl_t*>(memory);
+            m_slots = reinterpret_cast<slot_type*>(static_cast<char*>(memory) + slot_offset(newCapacity));
+            m_capacity = newCapacity;
+            reset_ctrl();
+            reset_growth_left();
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (Internal::flat_hash_is_full(oldCtrl[i]))
+                {
+                    const size_type hash = hash_key(Traits::key_from_value(Traits::element(oldSlots + i)));
+                    const size_type index = find_first_non_full(hash);
+                    set_ctrl(index, Internal::flat_hash_h2(hash));
+                    Traits::transfer(m_allocator, m_slots + index, oldSlots + i);
+                }
+            }
+
+            if (oldCapacity > 0)
+            {
+                m_allocator.deallocate(oldCtrl, allocation_size(oldCapacity), allocation_alignment());
+            }
+        }
+
+        void erase_at(size_type index)
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_capacity && Internal::flat_hash_is_full(m_ctrl[index]), "Erasing an invalid iterator!");
+            Traits::destroy(m_allocator, m_slots + index);
+            --m_size;
+
+            // If the slot was never part of a full group, no probe sequence continued past it and it can be marked as
+            // empty. Otherwise a lookup could stop at it, so it has to be marked as deleted.
+            const size_type indexBefore = (index - Internal::flat_hash_group_width) & m_capacity;
+            const AZ::u32 emptyAfter = Internal::flat_hash_group(m_ctrl + index).match_empty();
+            const AZ::u32 emptyBefore = Internal::flat_hash_group(m_ctrl + indexBefore).match_empty();
+            const bool wasNeverFull = emptyBefore != 0 && emptyAfter != 0 &&
+                (az_ctz_u32(emptyAfter) + az_clz_u32(emptyBefore) - (32 - Internal::flat_hash_group_width)) < Internal::flat_hash_group_width;
+            set_ctrl(index, wasNeverFull ? Internal::flat_hash_ctrl_empty : Internal::flat_hash_ctrl_deleted);
+            m_growthLeft += wasNeverFull ? 1 : 0;
+        }
+
+        void copy(const this_type& rhs)
+        {
+            reserve(rhs.m_size);
+            for (size_type i = 0; i < rhs.m_capacity; ++i)
+            {
+                if (Internal::flat_hash_is_full(rhs.m_ctrl[i]))
+                {
+                    const value_type& value = Traits::element(rhs.m_slots + i);
+                    const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+                    Traits::construct(m_allocator, m_slots + index, value);
+                }
+            }
+        }
+
+        void steal(this_type& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            m_growthLeft = rhs.m_growthLeft;
+
+            rhs.m_ctrl = Internal::flat_hash_empty_group();
+            rhs.m_slots = nullptr;
+            rhs.m_size = 0;
+            rhs.m_capacity = 0;
+            rhs.m_growthLeft = 0;
+        }
+
+        void destroy_values()
+        {
+            if (m_size == 0)
+            {
+                return;
+            }
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (Internal::flat_hash_is_full(m_ctrl[i]))
+                {
+                    Traits::destroy(m_allocator, m_slots + i);
+                }
+            }
+        }
+
+        void destroy_and_deallocate()
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            destroy_values();
+            m_allocator.deallocate(m_ctrl, allocation_size(m_capacity), allocation_alignment());
+            m_ctrl = Internal::flat_hash_empty_group();
+            m_slots = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        ctrl_t* m_ctrl{ Internal::flat_hash_empty_group() };
+        slot_type* m_slots{ nullptr };
+        size_type m_size{ 0 };
+        //! Number of slots, always zero or a power of two minus one.
+        size_type m_capacity{ 0 };
+        //! Number of values that can be inserted before the table has to grow.
+        size_type m_growthLeft{ 0 };
+
+    protected:
+        key_eq m_keyEqual;
+        hasher m_hasher;
+        allocator_type m_allocator;
+    };
+} // namespace AZStd
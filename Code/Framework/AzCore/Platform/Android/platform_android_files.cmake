@@ -33,6 +33,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
+    ../Common/UnixLike/AzCore/IO/MemoryMappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
     AzCore/IO/Streamer/StreamerContext_Platform.h
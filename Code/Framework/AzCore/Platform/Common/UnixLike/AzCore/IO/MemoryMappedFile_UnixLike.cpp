@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace AZ::IO::Platform
+{
+    namespace Internal
+    {
+        // madvise requires the start address to be aligned to the page size, so widen the range to cover full pages.
+        static void AdviseRange(const u8* address, u64 size, int advice)
+        {
+            static const uintptr_t pageSize = aznumeric_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+            uintptr_t start = reinterpret_cast<uintptr_t>(address);
+            uintptr_t alignedStart = start & ~(pageSize - 1);
+            size_t alignedSize = aznumeric_cast<size_t>(size + (start - alignedStart));
+            madvise(reinterpret_cast<void*>(alignedStart), alignedSize, advice);
+        }
+    } // namespace Internal
+
+    bool Map(const char* filePath, MemoryMappedFile::NativeHandles& handles, const u8*& data, u64& size)
+    {
+        int fileDescriptor = open(filePath, O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        void* mapping = mmap(nullptr, aznumeric_cast<size_t>(fileStats.st_size), PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file, so the descriptor is no longer needed.
+        close(fileDescriptor);
+        handles.m_file = -1;
+        handles.m_mapping = -1;
+        data = reinterpret_cast<const u8*>(mapping);
+        size = aznumeric_cast<u64>(fileStats.st_size);
+        return true;
+    }
+
+    void Unmap(MemoryMappedFile::NativeHandles& handles, const u8* data, u64 size)
+    {
+        munmap(const_cast<u8*>(data), aznumeric_cast<size_t>(size));
+        if (handles.m_file >= 0)
+        {
+            close(aznumeric_cast<int>(handles.m_file));
+        }
+    }
+
+    void Prefetch(const u8* address, u64 size)
+    {
+        Internal::AdviseRange(address, size, MADV_WILLNEED);
+    }
+
+    void Discard(const u8* address, u64 size)
+    {
+        Internal::AdviseRange(address, size, MADV_DONTNEED);
+    }
+} // namespace AZ::IO::Platform
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO::Platform
+{
+    bool Map(const char* filePath, MemoryMappedFile::NativeHandles& handles, const u8*& data, u64& size)
+    {
+        wchar_t filePathW[AZ_MAX_PATH_LEN];
+        size_t numCharsConverted;
+        if (mbstowcs_s(&numCharsConverted, filePathW, filePath, AZ_ARRAY_SIZE(filePathW) - 1) != 0)
+        {
+            return false;
+        }
+
+        HANDLE file = CreateFileW(filePathW, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        handles.m_file = reinterpret_cast<intptr_t>(file);
+        handles.m_mapping = reinterpret_cast<intptr_t>(mapping);
+        data = reinterpret_cast<const u8*>(view);
+        size = aznumeric_cast<u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void Unmap(MemoryMappedFile::NativeHandles& handles, const u8* data, [[maybe_unused]] u64 size)
+    {
+        UnmapViewOfFile(data);
+        CloseHandle(reinterpret_cast<HANDLE>(handles.m_mapping));
+        CloseHandle(reinterpret_cast<HANDLE>(handles.m_file));
+    }
+
+    void Prefetch(const u8* address, u64 size)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<u8*>(address);
+        range.NumberOfBytes = aznumeric_cast<SIZE_T>(size);
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+    void Discard(const u8* address, u64 size)
+    {
+        // Unlocking pages that aren't locked fails, but still removes them from the working set which is the intended effect.
+        VirtualUnlock(const_cast<u8*>(address), aznumeric_cast<SIZE_T>(size));
+    }
+} // namespace AZ::IO::Platform
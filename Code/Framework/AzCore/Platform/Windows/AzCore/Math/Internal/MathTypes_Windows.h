@@ -13,3 +13,7 @@
 #   include <pmmintrin.h>
 #   include <emmintrin.h>
 #endif
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+#   include <immintrin.h>
+#endif
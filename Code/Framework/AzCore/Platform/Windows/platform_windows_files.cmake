@@ -34,6 +34,7 @@ set(FILES
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
+    ../Common/WinAPI/AzCore/IO/MemoryMappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
     AzCore/IO/Streamer/StorageDrive_Windows.h
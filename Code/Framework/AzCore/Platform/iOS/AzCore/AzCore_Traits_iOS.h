@@ -12,6 +12,7 @@
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SCALAR 0
 #define AZ_TRAIT_USE_PLATFORM_SIMD_NEON 1
 #define AZ_TRAIT_USE_PLATFORM_SIMD_SSE 0
+#define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
 
 // OS traits ...
 #define AZ_TRAIT_OS_ALLOW_MULTICAST 0
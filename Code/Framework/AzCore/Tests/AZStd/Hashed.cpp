@@ -11,6 +11,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -2079,6 +2081,212 @@ namespace UnitTest
         EXPECT_EQ(0, HashedContainerTransparentTestInternal::s_allAssignmentCount);
     }
 
+    template <typename ContainerType>
+    class FlatHashMapContainers
+        : public AllocatorsFixture
+    {
+    };
+
+    template<template <typename, typename, typename, typename, typename> class ContainerTemplate>
+    struct FlatHashMapConfig
+    {
+        template<typename Key, typename MappedType>
+        using ContainerType = ContainerTemplate<Key, MappedType, AZStd::hash<Key>, AZStd::equal_to<Key>, AZStd::allocator>;
+    };
+
+    using FlatHashMapConfigs = ::testing::Types<
+        FlatHashMapConfig<AZStd::flat_hash_map>
+        , FlatHashMapConfig<AZStd::node_hash_map>
+    >;
+    TYPED_TEST_CASE(FlatHashMapContainers, FlatHashMapConfigs);
+
+    TYPED_TEST(FlatHashMapContainers, InsertFindErase_RandomOperations_MatchUnorderedMap)
+    {
+        typename TypeParam::template ContainerType<int, int> container;
+        AZStd::unordered_map<int, int> reference;
+
+        // Enough operations on a small key range to grow the table a few times and leave plenty of deleted slots behind.
+        unsigned int seed = 1;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            const int key = static_cast<int>((seed >> 8) % 2000);
+            switch ((seed >> 4) % 3)
+            {
+            case 0:
+            {
+                auto result = container.insert(AZStd::make_pair(key, i));
+                auto expected = reference.insert(AZStd::make_pair(key, i));
+                EXPECT_EQ(expected.second, result.second);
+                EXPECT_EQ(expected.first->second, result.first->second);
+                break;
+            }
+            case 1:
+                EXPECT_EQ(reference.erase(key), container.erase(key));
+                break;
+            default:
+            {
+                auto iter = container.find(key);
+                auto expected = reference.find(key);
+                ASSERT_EQ(expected == reference.end(), iter == container.end());
+                if (iter != container.end())
+                {
+                    EXPECT_EQ(expected->second, iter->second);
+                }
+                break;
+            }
+            }
+            ASSERT_EQ(reference.size(), container.size());
+        }
+        EXPECT_TRUE(container.validate());
+
+        size_t numVisited = 0;
+        for (const auto& element : container)
+        {
+            auto expected = reference.find(element.first);
+            ASSERT_NE(reference.end(), expected);
+            EXPECT_EQ(expected->second, element.second);
+            ++numVisited;
+        }
+        EXPECT_EQ(reference.size(), numVisited);
+    }
+
+    TYPED_TEST(FlatHashMapContainers, EraseWhileIterating_RemovesOnlyMatchingElements)
+    {
+        typename TypeParam::template ContainerType<int, int> container;
+        for (int i = 0; i < 1000; ++i)
+        {
+            container.emplace(i, i * 2);
+        }
+
+        for (auto iter = container.begin(); iter != container.end(); )
+        {
+            iter = (iter->first % 3 == 0) ? container.erase(iter) : AZStd::next(iter);
+        }
+        EXPECT_EQ(666, container.size());
+        EXPECT_TRUE(container.validate());
+        for (const auto& element : container)
+        {
+            EXPECT_NE(0, element.first % 3);
+            EXPECT_EQ(element.first * 2, element.second);
+        }
+
+        EXPECT_EQ(666, AZStd::erase_if(container, [](const auto& element) { return element.first % 3 != 0; }));
+        EXPECT_TRUE(container.empty());
+        EXPECT_EQ(container.end(), container.begin());
+    }
+
+    TYPED_TEST(FlatHashMapContainers, StringKeys_TryEmplaceAndInsertOrAssign_Succeeds)
+    {
+        typename TypeParam::template ContainerType<AZStd::string, AZStd::string> container;
+        for (int i = 0; i < 100; ++i)
+        {
+            AZStd::string key = AZStd::string::format("Key%i", i);
+            container[key] = key;
+        }
+        EXPECT_EQ(100, container.size());
+
+        auto result = container.try_emplace("Key5", "NotInserted");
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ("Key5", result.first->second);
+
+        result = container.insert_or_assign("Key5", "Assigned");
+        EXPECT_FALSE(result.second);
+        EXPECT_EQ("Assigned", container.at("Key5"));
+
+        result = container.try_emplace("Key100", "Inserted");
+        EXPECT_TRUE(result.second);
+        EXPECT_EQ(101, container.size());
+        EXPECT_TRUE(container.contains("Key100"));
+        EXPECT_FALSE(container.contains("Key101"));
+    }
+
+    TYPED_TEST(FlatHashMapContainers, CopyAndMove_ContainersCompareEqual)
+    {
+        using ContainerType = typename TypeParam::template ContainerType<int, int>;
+        ContainerType container({ {1, 10}, {2, 20}, {3, 30} });
+
+        ContainerType copy(container);
+        EXPECT_TRUE(copy.validate());
+        EXPECT_EQ(container, copy);
+
+        copy[4] = 40;
+        EXPECT_NE(container, copy);
+
+        ContainerType moved(AZStd::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(copy.end(), copy.find(4));
+        EXPECT_EQ(4, moved.size());
+
+        copy = moved;
+        EXPECT_EQ(moved, copy);
+        container = AZStd::move(moved);
+        EXPECT_EQ(copy, container);
+    }
+
+    TYPED_TEST(FlatHashMapContainers, ClearAndReserve_DoNotReallocate)
+    {
+        typename TypeParam::template ContainerType<int, int> container;
+        EXPECT_EQ(0, container.capacity());
+        container.reserve(100);
+        const size_t capacity = container.capacity();
+        EXPECT_LE(100, capacity);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            container.emplace(i, i);
+        }
+        EXPECT_EQ(capacity, container.capacity());
+
+        container.clear();
+        EXPECT_TRUE(container.empty());
+        EXPECT_EQ(capacity, container.capacity());
+
+        container.rehash(0);
+        EXPECT_EQ(0, container.capacity());
+    }
+
+    TEST_F(HashedContainers, NodeHashMap_Grow_ReferencesStayValid)
+    {
+        AZStd::node_hash_map<int, int> container;
+        int& first = container[0];
+        first = 42;
+        for (int i = 1; i < 1000; ++i)
+        {
+            container[i] = i;
+        }
+        EXPECT_EQ(&first, &container[0]);
+        EXPECT_EQ(42, first);
+    }
+
+    TEST_F(HashedContainers, FlatHashSet_InsertAndErase_Succeeds)
+    {
+        AZStd::flat_hash_set<int> container{ 1, 2, 3, 3 };
+        EXPECT_EQ(3, container.size());
+        EXPECT_FALSE(container.insert(2).second);
+        EXPECT_TRUE(container.insert(4).second);
+        EXPECT_EQ(1, container.count(4));
+        EXPECT_EQ(1, container.erase(1));
+        EXPECT_EQ(0, container.erase(1));
+        EXPECT_EQ((AZStd::flat_hash_set<int>{ 2, 3, 4 }), container);
+
+        AZStd::node_hash_set<AZStd::string> strings{ "a", "b" };
+        EXPECT_TRUE(strings.contains("a"));
+        EXPECT_FALSE(strings.contains("c"));
+    }
+
+    TEST_F(HashedContainers, FlatHashMap_CustomAllocator_AllocatesFromAllocator)
+    {
+        using AllocatorType = AZ::AZStdAlloc<AZ::SystemAllocator>;
+        const size_t allocatedBefore = AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        {
+            AZStd::flat_hash_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, AllocatorType> container;
+            container.reserve(1000);
+            EXPECT_LT(allocatedBefore, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+        }
+        EXPECT_EQ(allocatedBefore, AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes());
+    }
+
 #if defined(HAVE_BENCHMARK)
     template <template <typename...> class Hash>
     void Benchmark_Lookup(benchmark::State& state)
@@ -2172,6 +2380,48 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
+
+    void Benchmark_NodeHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapLookup);
+
+    void Benchmark_NodeHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapInsert);
+
+    void Benchmark_NodeHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::node_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_NodeHashMapErase);
 #endif
 } // namespace UnitTest
 
@@ -2275,5 +2525,81 @@ namespace Benchmark
     }
     BENCHMARK(BM_UnorderedMap_InsertDuplicatesViaBracket);
 
+    using FlatHashMap = AZStd::flat_hash_map<int, A>;
+
+    static void BM_FlatHashMap_InsertUniqueViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaBracket);
+
+    static void BM_FlatHashMap_InsertDuplicatesViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey % kModuloForDuplicates];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertDuplicatesViaBracket);
+
+    // BM_XXX_LookupScattered: look up keys in maps that don't fit in the cache, where following the
+    // node pointers of the node based containers dominates the cost.
+    template<class Map>
+    static void BM_HashMap_LookupScattered(::benchmark::State& state)
+    {
+        const int numElements = static_cast<int>(state.range(0));
+        Map map;
+        for (int i = 0; i < numElements; ++i)
+        {
+            map[i * 7919] = A{ i };
+        }
+        int found = 0;
+        int key = 0;
+        while (state.KeepRunning())
+        {
+            key = (key + 104729) % numElements;
+            auto iter = map.find(key * 7919);
+            found += (iter != map.end()) ? iter->second.m_int : 0;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    BENCHMARK_TEMPLATE(BM_HashMap_LookupScattered, UnorderedMap)->Range(1 << 10, 1 << 20);
+    BENCHMARK_TEMPLATE(BM_HashMap_LookupScattered, FlatHashMap)->Range(1 << 10, 1 << 20);
+    BENCHMARK_TEMPLATE(BM_HashMap_LookupScattered, AZStd::node_hash_map<int, A>)->Range(1 << 10, 1 << 20);
+
+    template<class Map>
+    static void BM_HashMap_InsertAndEraseAll(::benchmark::State& state)
+    {
+        const int numElements = static_cast<int>(state.range(0));
+        Map map;
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < numElements; ++i)
+            {
+                map.emplace(i, A{ i });
+            }
+            for (int i = 0; i < numElements; ++i)
+            {
+                map.erase(i);
+            }
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_HashMap_InsertAndEraseAll, UnorderedMap)->Range(1 << 6, 1 << 16);
+    BENCHMARK_TEMPLATE(BM_HashMap_InsertAndEraseAll, FlatHashMap)->Range(1 << 6, 1 << 16);
+    BENCHMARK_TEMPLATE(BM_HashMap_InsertAndEraseAll, AZStd::node_hash_map<int, A>)->Range(1 << 6, 1 << 16);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
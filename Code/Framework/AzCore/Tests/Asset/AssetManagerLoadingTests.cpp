@@ -1035,7 +1035,53 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ContainerLoadTest_BackgroundLane_LaneUsedForAllDependencies)
+#else
+    TEST_F(AssetJobsFloodTest, ContainerLoadTest_BackgroundLane_LaneUsedForAllDependencies)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        m_testAssetManager->ResetLaneStatistics();
+        {
+            ContainerReadyListener readyListener(PreloadAssetRootId);
+            auto asset = AssetManager::Instance().FindOrCreateAsset(PreloadAssetRootId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(),
+                AZ::Data::AssetLoadBehavior::Default);
+
+            AssetLoadParameters loadParams;
+            loadParams.m_lane = AssetLoadLane::Background;
+            auto containerReady = m_testAssetManager->GetAssetContainer(asset, loadParams);
+
+            auto maxTimeout = AZStd::chrono::system_clock::now() + DefaultTimeoutSeconds;
+
+            while (!readyListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::system_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(containerReady->IsReady(), true);
+
+            // The root and all of its dependencies were loaded in the background lane.
+            const AssetManager::LaneStatistics background = m_testAssetManager->GetLaneStatistics(AssetLoadLane::Background);
+            EXPECT_EQ(background.m_queuedCount, containerReady->GetDependencies().size() + 1);
+            EXPECT_EQ(background.m_completedCount, background.m_queuedCount);
+            EXPECT_EQ(background.m_failedCount, 0);
+            EXPECT_GT(background.m_bytesLoaded, 0);
+            EXPECT_GE(background.m_totalLatency, background.m_maxLatency);
+            EXPECT_EQ(m_testAssetManager->GetLaneStatistics(AssetLoadLane::Gameplay).m_queuedCount, 0);
+            EXPECT_EQ(m_testAssetManager->GetLaneStatistics(AssetLoadLane::Critical).m_queuedCount, 0);
+        }
 
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
 
     TEST_F(AssetJobsFloodTest, DISABLED_ContainerCoreTest_BasicDependencyManagement_Success)
     {
@@ -15,6 +15,7 @@
 #include <AzCore/Component/EntityUtils.h>
 
 #include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Serialization/ObjectStream.h>
 
 #include <AzCore/Memory/MemoryComponent.h>
@@ -601,6 +602,45 @@ namespace UnitTest
     };
     //////////////////////////////////////////////////////////////////////////
 
+    //////////////////////////////////////////////////////////////////////////
+    // Component Q - thread safe to activate, counts how often its services are queried
+    class ComponentQ
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ComponentQ, "{9D1185C1-1EF0-42DF-9026-BBECB112BFAE}");
+
+        void Activate() override { ++s_activateCount; }
+        void Deactivate() override {}
+
+        static bool IsThreadSafeToActivate() { return true; }
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided) { ++s_providedServicesCount; provided.push_back(AZ_CRC("ServiceQ")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        static AZStd::atomic_int s_activateCount;
+        static AZStd::atomic_int s_providedServicesCount;
+    };
+    AZStd::atomic_int ComponentQ::s_activateCount{ 0 };
+    AZStd::atomic_int ComponentQ::s_providedServicesCount{ 0 };
+    //////////////////////////////////////////////////////////////////////////
+
+    //////////////////////////////////////////////////////////////////////////
+    // Component R - thread safe to activate, requires ServiceQ
+    class ComponentR
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ComponentR, "{FEC4D9D7-1883-4E9A-9176-AF3C94E2ECB6}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static bool IsThreadSafeToActivate() { return true; }
+        static void GetRequiredServices(ComponentDescriptor::DependencyArrayType& required) { required.push_back(AZ_CRC("ServiceQ")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+    };
+    //////////////////////////////////////////////////////////////////////////
+
     class ComponentDependency
         : public Components
     {
@@ -627,6 +667,8 @@ namespace UnitTest
             aznew ComponentN::DescriptorType;
             aznew ComponentO::DescriptorType;
             aznew ComponentP::DescriptorType;
+            aznew ComponentQ::DescriptorType;
+            aznew ComponentR::DescriptorType;
 
             m_componentApp = aznew ComponentApplication();
 
@@ -1058,6 +1100,124 @@ namespace UnitTest
         EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, m_entity->EvaluateDependencies());
     }
 
+    TEST_F(ComponentDependency, EntitiesWithSameComponentTypes_ReuseSortedOrder)
+    {
+        m_entity->CreateComponent<ComponentR>(); // requires ServiceQ
+        m_entity->CreateComponent<ComponentQ>();
+        EXPECT_EQ(Entity::DependencySortResult::Success, m_entity->EvaluateDependencies());
+
+        Entity entity;
+        Component* r = entity.CreateComponent<ComponentR>();
+        Component* q = entity.CreateComponent<ComponentQ>();
+
+        ComponentQ::s_providedServicesCount = 0;
+        EXPECT_EQ(Entity::DependencySortResult::Success, entity.EvaluateDependencies());
+        EXPECT_EQ(0, ComponentQ::s_providedServicesCount); // the order was reused instead of sorting again
+
+        const Entity::ComponentArrayType& components = entity.GetComponents();
+        ASSERT_EQ(2, components.size());
+        EXPECT_EQ(q, components[0]);
+        EXPECT_EQ(r, components[1]);
+    }
+
+    TEST_F(ComponentDependency, InstanceDependentServices_SortedOrderNotReused)
+    {
+        m_entity->CreateComponent<ComponentA>();
+        m_entity->CreateComponent<ComponentD>();
+        EXPECT_EQ(Entity::DependencySortResult::Success, m_entity->EvaluateDependencies());
+
+        // the custom descriptor of A can report different services for each instance
+        m_descriptorComponentA->m_isDependent = true; // now A depends on ServiceD
+
+        Entity entity;
+        Component* a = entity.CreateComponent<ComponentA>();
+        Component* d = entity.CreateComponent<ComponentD>();
+        EXPECT_EQ(Entity::DependencySortResult::Success, entity.EvaluateDependencies());
+
+        const Entity::ComponentArrayType& components = entity.GetComponents();
+        ASSERT_EQ(2, components.size());
+        EXPECT_EQ(d, components[0]);
+        EXPECT_EQ(a, components[1]);
+    }
+
+    TEST_F(ComponentDependency, ActivateEntities_ActivatesAllEntities)
+    {
+        Entity jobEntity;
+        jobEntity.CreateComponent<JobManagerComponent>();
+        jobEntity.Init();
+        jobEntity.Activate();
+
+        constexpr int ThreadSafeEntityCount = 16;
+        AZStd::vector<Entity*> entities;
+        for (int i = 0; i < ThreadSafeEntityCount; ++i)
+        {
+            Entity* entity = aznew Entity();
+            entity->CreateComponent<ComponentR>();
+            entity->CreateComponent<ComponentQ>();
+            entity->Init();
+            entities.push_back(entity);
+        }
+        m_entity->CreateComponent<ComponentB>(); // not thread safe to activate
+        m_entity->Init();
+        entities.push_back(m_entity);
+
+        ComponentQ::s_activateCount = 0;
+        Entity::ActivateEntities(entities);
+
+        EXPECT_EQ(ThreadSafeEntityCount, ComponentQ::s_activateCount);
+        for (Entity* entity : entities)
+        {
+            EXPECT_EQ(Entity::State::Active, entity->GetState());
+        }
+
+        for (int i = 0; i < ThreadSafeEntityCount; ++i)
+        {
+            EXPECT_EQ(azrtti_typeid<ComponentQ>(), azrtti_typeid(entities[i]->GetComponents().front())); // sorted before activation
+            delete entities[i];
+        }
+        jobEntity.Deactivate();
+    }
+
+    TEST_F(ComponentDependency, ActivateEntities_SkipsEntitiesNotInInitState)
+    {
+        Entity jobEntity;
+        jobEntity.CreateComponent<JobManagerComponent>();
+        jobEntity.Init();
+        jobEntity.Activate();
+
+        constexpr int ThreadSafeEntityCount = 4;
+        AZStd::vector<Entity*> entities;
+        for (int i = 0; i < ThreadSafeEntityCount; ++i)
+        {
+            Entity* entity = aznew Entity();
+            entity->CreateComponent<ComponentR>();
+            entity->CreateComponent<ComponentQ>();
+            entity->Init();
+            entities.push_back(entity);
+        }
+        m_entity->CreateComponent<ComponentB>(); // not thread safe to activate
+        m_entity->Init();
+        m_entity->Activate(); // already active, must not be activated again
+        entities.push_back(m_entity);
+
+        AZStd::vector<Entity*> activatedEntities;
+        Entity::ActivateEntities(entities,
+            [&activatedEntities](Entity* entity)
+            {
+                activatedEntities.push_back(entity);
+            });
+
+        ASSERT_EQ(static_cast<size_t>(ThreadSafeEntityCount), activatedEntities.size());
+        for (int i = 0; i < ThreadSafeEntityCount; ++i)
+        {
+            EXPECT_EQ(entities[i], activatedEntities[i]);
+            EXPECT_EQ(Entity::State::Active, entities[i]->GetState());
+            delete entities[i];
+        }
+        EXPECT_EQ(Entity::State::Active, m_entity->GetState());
+        jobEntity.Deactivate();
+    }
+
     /**
      * UserSettingsComponent test
      */
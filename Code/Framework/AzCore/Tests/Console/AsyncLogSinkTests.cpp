@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/AsyncLogSink.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class AsyncLogSinkTests
+        : public AllocatorsFixture
+    {
+    public:
+        struct Message
+        {
+            AZ::LogLevel m_level;
+            AZStd::string m_window;
+            AZStd::string m_message;
+        };
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            CreateSink(AZ::AsyncLogSink::DefaultBufferSize);
+        }
+
+        void TearDown() override
+        {
+            m_sink.reset();
+            m_messages = {};
+            AllocatorsFixture::TearDown();
+        }
+
+        void CreateSink(size_t bufferSize)
+        {
+            m_sink.reset();
+            m_messages.clear();
+            m_sink = AZStd::make_unique<AZ::AsyncLogSink>(
+                [this](AZ::LogLevel level, const char* message, const char*, const char*, int32_t)
+                {
+                    m_messages.push_back({ level, "", message });
+                },
+                [this](AZ::AsyncLogSink::TraceType, const char* window, const char* message)
+                {
+                    m_messages.push_back({ AZ::LogLevel::Info, window, message });
+                },
+                bufferSize);
+        }
+
+        bool QueueLog(AZ::LogLevel level, const char* format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            const bool queued = m_sink->QueueLogV(level, format, __FILE__, __FUNCTION__, __LINE__, args);
+            va_end(args);
+            return queued;
+        }
+
+        static AZStd::string Format(const char* format, ...)
+        {
+            char buffer[AZ::AsyncLogSink::MaxMessageLength];
+            va_list args;
+            va_start(args, format);
+            azvsnprintf(buffer, AZ_ARRAY_SIZE(buffer), format, args);
+            va_end(args);
+            return buffer;
+        }
+
+        AZStd::unique_ptr<AZ::AsyncLogSink> m_sink;
+        // Only accessed by the writer thread until the sink is flushed.
+        AZStd::vector<Message> m_messages;
+    };
+
+    TEST_F(AsyncLogSinkTests, QueueLog_FormatsArgumentsOnFlush)
+    {
+        const char* text = "text";
+        AZStd::string temporary("copied");
+        EXPECT_TRUE(QueueLog(AZ::LogLevel::Info, "%d %u %lld %5.2f %x %c %%", -12, 34u, 1ll << 40, 3.14159, 255, 'z'));
+        EXPECT_TRUE(QueueLog(AZ::LogLevel::Warn, "[%s] [%-8s] [%.*s] [%*d]", text, text, 2, text, 4, 7));
+        EXPECT_TRUE(QueueLog(AZ::LogLevel::Info, "%s", temporary.c_str()));
+        temporary = "changed";
+        m_sink->Flush();
+
+        ASSERT_EQ(3, m_messages.size());
+        EXPECT_EQ(AZ::LogLevel::Info, m_messages[0].m_level);
+        EXPECT_EQ(Format("%d %u %lld %5.2f %x %c %%", -12, 34u, 1ll << 40, 3.14159, 255, 'z'), m_messages[0].m_message);
+        EXPECT_EQ(AZ::LogLevel::Warn, m_messages[1].m_level);
+        EXPECT_EQ(Format("[%s] [%-8s] [%.*s] [%*d]", text, text, 2, text, 4, 7), m_messages[1].m_message);
+        EXPECT_EQ("copied", m_messages[2].m_message);
+    }
+
+    TEST_F(AsyncLogSinkTests, QueueLog_UnsupportedConversion_FormatsOnCallingThread)
+    {
+        EXPECT_TRUE(QueueLog(AZ::LogLevel::Info, "%Lf", 1.5L));
+        m_sink->Flush();
+
+        ASSERT_EQ(1, m_messages.size());
+        EXPECT_EQ(Format("%Lf", 1.5L), m_messages[0].m_message);
+    }
+
+    TEST_F(AsyncLogSinkTests, QueueTrace_MessagesWrittenInOrder)
+    {
+        EXPECT_TRUE(m_sink->QueueTrace(AZ::AsyncLogSink::TraceType::Printf, "Window", "first\n"));
+        EXPECT_TRUE(QueueLog(AZ::LogLevel::Info, "second"));
+        EXPECT_TRUE(m_sink->QueueTrace(AZ::AsyncLogSink::TraceType::Output, "Other", "third\n"));
+        m_sink->Flush();
+
+        ASSERT_EQ(3, m_messages.size());
+        EXPECT_EQ("Window", m_messages[0].m_window);
+        EXPECT_EQ("first\n", m_messages[0].m_message);
+        EXPECT_EQ("second", m_messages[1].m_message);
+        EXPECT_EQ("Other", m_messages[2].m_window);
+        EXPECT_EQ("third\n", m_messages[2].m_message);
+    }
+
+    TEST_F(AsyncLogSinkTests, QueueLog_MultipleThreads_AllMessagesWritten)
+    {
+        constexpr int ThreadCount = 4;
+        constexpr int MessagesPerThread = 100;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back([this, i]()
+                {
+                    for (int j = 0; j < MessagesPerThread; ++j)
+                    {
+                        // Full buffers drop records below error level, so keep retrying until the writer catches up.
+                        while (!QueueLog(AZ::LogLevel::Error, "%d:%d", i, j))
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        m_sink->Flush();
+
+        ASSERT_EQ(ThreadCount * MessagesPerThread, m_messages.size());
+        // Messages from the same thread keep their order.
+        AZStd::vector<int> nextMessage(ThreadCount, 0);
+        for (const Message& message : m_messages)
+        {
+            int thread = -1;
+            int index = -1;
+            ASSERT_EQ(2, azsscanf(message.m_message.c_str(), "%d:%d", &thread, &index));
+            ASSERT_GE(thread, 0);
+            ASSERT_LT(thread, ThreadCount);
+            EXPECT_EQ(nextMessage[thread]++, index);
+        }
+        EXPECT_EQ(ThreadCount * MessagesPerThread, m_sink->GetStatistics().m_writtenRecords);
+    }
+
+    TEST_F(AsyncLogSinkTests, QueueLog_BufferFull_DropsRecordsAndReportsCount)
+    {
+        CreateSink(AZ::AsyncLogSink::MinBufferSize);
+        AZStd::string message(1024, 'x');
+
+        // The writer thread may drain the buffer at any time, so keep queueing until a record is dropped.
+        bool dropped = false;
+        for (int i = 0; i < 10000 && !dropped; ++i)
+        {
+            // Dropped records still count as handled, so the caller doesn't write them synchronously.
+            EXPECT_TRUE(QueueLog(AZ::LogLevel::Info, "%s", message.c_str()));
+            dropped = m_sink->GetStatistics().m_droppedRecords > 0;
+        }
+        ASSERT_TRUE(dropped);
+
+        m_sink->Flush();
+        const AZ::AsyncLogSink::Statistics statistics = m_sink->GetStatistics();
+        EXPECT_EQ(statistics.m_queuedRecords, statistics.m_writtenRecords);
+        // The number of dropped records is reported as a warning.
+        ASSERT_FALSE(m_messages.empty());
+        EXPECT_EQ(AZ::LogLevel::Warn, m_messages.back().m_level);
+        EXPECT_NE(AZStd::string::npos, m_messages.back().m_message.find("dropped"));
+    }
+
+    TEST_F(AsyncLogSinkTests, SlotExchange_WaitsForThreadsUsingThePreviousSink)
+    {
+        AZ::AsyncLogSinkSlot slot;
+        EXPECT_EQ(nullptr, slot.Exchange(m_sink.get()));
+
+        AZStd::atomic_bool isUsingSink{ false };
+        AZStd::atomic_bool releaseSink{ false };
+        AZStd::atomic_bool wasSinkValid{ false };
+        AZStd::thread logThread([&]()
+            {
+                slot.Use([&](AZ::AsyncLogSink* sink)
+                    {
+                        isUsingSink = true;
+                        while (!releaseSink)
+                        {
+                            AZStd::this_thread::yield();
+                        }
+                        wasSinkValid = sink == m_sink.get() && sink->QueueTrace(AZ::AsyncLogSink::TraceType::Printf, "Window", "message\n");
+                        return true;
+                    });
+            });
+        while (!isUsingSink)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        AZStd::atomic_bool exchanged{ false };
+        AZStd::thread exchangeThread([&]()
+            {
+                EXPECT_EQ(m_sink.get(), slot.Exchange(nullptr));
+                exchanged = true;
+            });
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(20));
+        EXPECT_FALSE(exchanged);
+
+        releaseSink = true;
+        exchangeThread.join();
+        logThread.join();
+        EXPECT_TRUE(exchanged);
+        EXPECT_TRUE(wasSinkValid);
+
+        // Threads that use the slot after the exchange don't see the previous sink anymore.
+        EXPECT_FALSE(slot.Use([](AZ::AsyncLogSink* sink)
+            {
+                return sink != nullptr;
+            }));
+    }
+} // namespace UnitTest
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/EventTraceRecorder.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AZ::Debug
+{
+    class EventTraceRecorderTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+            m_document = AZStd::make_unique<rapidjson::Document>();
+            m_eventsPerThread = EventTraceRecorder::GetEventsPerThread();
+            EventTraceRecorder::Clear();
+            EventTraceRecorder::SetEnabled(true);
+        }
+
+        void TearDown() override
+        {
+            EventTraceRecorder::SetEnabled(false);
+            EventTraceRecorder::Clear();
+            EventTraceRecorder::SetEventsPerThread(m_eventsPerThread);
+            m_document.reset();
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        AZStd::vector<u8> WriteTrace(EventTraceRecorder::Format format)
+        {
+            AZStd::vector<u8> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<u8>> stream(&buffer);
+            EXPECT_TRUE(EventTraceRecorder::Write(stream, format));
+            return buffer;
+        }
+
+        //! Writes the recorded events as a Chrome trace and returns the events, excluding the thread names.
+        AZStd::vector<const rapidjson::Value*> WriteChromeTrace()
+        {
+            AZStd::vector<u8> buffer = WriteTrace(EventTraceRecorder::Format::ChromeJson);
+            m_document->Parse(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+            EXPECT_FALSE(m_document->HasParseError());
+
+            AZStd::vector<const rapidjson::Value*> events;
+            if (m_document->IsObject() && m_document->HasMember("traceEvents"))
+            {
+                for (const rapidjson::Value& event : (*m_document)["traceEvents"].GetArray())
+                {
+                    if (strcmp(event["ph"].GetString(), "M") != 0)
+                    {
+                        events.push_back(&event);
+                    }
+                }
+            }
+            return events;
+        }
+
+    protected:
+        AZStd::unique_ptr<rapidjson::Document> m_document;
+        size_t m_eventsPerThread{ 0 };
+    };
+
+    TEST_F(EventTraceRecorderTest, Record_Disabled_NothingRecorded)
+    {
+        EventTraceRecorder::SetEnabled(false);
+        {
+            AZ_TRACE_RECORDER_SCOPE("Scope", "Test");
+            AZ_TRACE_RECORDER_COUNTER("Counter", "Test", 42);
+        }
+        EXPECT_TRUE(WriteChromeTrace().empty());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_Scope_WritesBeginAndEnd)
+    {
+        {
+            AZ_TRACE_RECORDER_SCOPE("Scope", "Test");
+        }
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        ASSERT_EQ(2, events.size());
+        EXPECT_STREQ("B", (*events[0])["ph"].GetString());
+        EXPECT_STREQ("Scope", (*events[0])["name"].GetString());
+        EXPECT_STREQ("Test", (*events[0])["cat"].GetString());
+        EXPECT_STREQ("E", (*events[1])["ph"].GetString());
+        EXPECT_EQ((*events[0])["tid"].GetUint(), (*events[1])["tid"].GetUint());
+        EXPECT_LE((*events[0])["ts"].GetDouble(), (*events[1])["ts"].GetDouble());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_OptionalScope_OnlyRecordsLiteralNames)
+    {
+        AZStd::string dynamicName("Dynamic");
+        const char* dynamicNamePtr = dynamicName.c_str();
+        {
+            AZ_TRACE_RECORDER_OPTIONAL_SCOPE("Literal", "Test");
+            AZ_TRACE_RECORDER_OPTIONAL_SCOPE(dynamicNamePtr, "Test");
+        }
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        ASSERT_EQ(2, events.size());
+        EXPECT_STREQ("B", (*events[0])["ph"].GetString());
+        EXPECT_STREQ("Literal", (*events[0])["name"].GetString());
+        EXPECT_STREQ("E", (*events[1])["ph"].GetString());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_DisabledWhileInScope_ScopeIsClosed)
+    {
+        {
+            AZ_TRACE_RECORDER_SCOPE("Scope", "Test");
+            EventTraceRecorder::SetEnabled(false);
+        }
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        ASSERT_EQ(2, events.size());
+        EXPECT_STREQ("B", (*events[0])["ph"].GetString());
+        EXPECT_STREQ("E", (*events[1])["ph"].GetString());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_CounterAndInstant_WritesValues)
+    {
+        AZ_TRACE_RECORDER_COUNTER("Counter", "Test", -42);
+        AZ_TRACE_RECORDER_INSTANT("Instant", "Test");
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        ASSERT_EQ(2, events.size());
+        EXPECT_STREQ("C", (*events[0])["ph"].GetString());
+        EXPECT_STREQ("Counter", (*events[0])["name"].GetString());
+        EXPECT_EQ(-42, (*events[0])["args"]["value"].GetInt64());
+        EXPECT_STREQ("i", (*events[1])["ph"].GetString());
+        EXPECT_STREQ("Instant", (*events[1])["name"].GetString());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_FlowAcrossThreads_WritesMatchingIds)
+    {
+        static constexpr u64 FlowId = 1234;
+        {
+            AZ_TRACE_RECORDER_SCOPE("Send", "Test");
+            AZ_TRACE_RECORDER_FLOW_BEGIN("Request", "Test", FlowId);
+        }
+        AZStd::thread thread([]()
+            {
+                AZ_TRACE_RECORDER_SCOPE("Receive", "Test");
+                AZ_TRACE_RECORDER_FLOW_END("Request", "Test", FlowId);
+            });
+        thread.join();
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        const rapidjson::Value* flowBegin = nullptr;
+        const rapidjson::Value* flowEnd = nullptr;
+        for (const rapidjson::Value* event : events)
+        {
+            if (strcmp((*event)["ph"].GetString(), "s") == 0)
+            {
+                flowBegin = event;
+            }
+            else if (strcmp((*event)["ph"].GetString(), "f") == 0)
+            {
+                flowEnd = event;
+            }
+        }
+        ASSERT_NE(nullptr, flowBegin);
+        ASSERT_NE(nullptr, flowEnd);
+        EXPECT_EQ(FlowId, (*flowBegin)["id"].GetUint64());
+        EXPECT_EQ(FlowId, (*flowEnd)["id"].GetUint64());
+        EXPECT_STREQ("e", (*flowEnd)["bp"].GetString());
+        EXPECT_NE((*flowBegin)["tid"].GetUint(), (*flowEnd)["tid"].GetUint());
+    }
+
+    TEST_F(EventTraceRecorderTest, Record_MoreEventsThanBufferSize_KeepsMostRecentEvents)
+    {
+        constexpr size_t EventsPerThread = 16;
+        EventTraceRecorder::SetEventsPerThread(EventsPerThread);
+        // The size only applies to threads that start recording after it was set.
+        AZStd::thread thread([]()
+            {
+                AZ_TRACE_RECORDER_SCOPE("Outer", "Test");
+                for (s64 i = 0; i < 100; ++i)
+                {
+                    AZ_TRACE_RECORDER_COUNTER("Counter", "Test", i);
+                }
+            });
+        thread.join();
+
+        AZStd::vector<const rapidjson::Value*> events = WriteChromeTrace();
+        ASSERT_FALSE(events.empty());
+        EXPECT_LT(events.size(), EventsPerThread);
+        // The begin event of the outer scope was overwritten, so its end event is dropped as well.
+        for (const rapidjson::Value* event : events)
+        {
+            EXPECT_STREQ("C", (*event)["ph"].GetString());
+        }
+        EXPECT_EQ(99, (*events.back())["args"]["value"].GetInt64());
+    }
+
+    TEST_F(EventTraceRecorderTest, SetThreadName_NameIsWritten)
+    {
+        AZStd::thread thread([]()
+            {
+                EventTraceRecorder::SetThreadName("Worker \"1\"");
+                AZ_TRACE_RECORDER_INSTANT("Instant", "Test");
+            });
+        thread.join();
+
+        WriteChromeTrace();
+        bool found = false;
+        for (const rapidjson::Value& event : (*m_document)["traceEvents"].GetArray())
+        {
+            if (strcmp(event["ph"].GetString(), "M") == 0 && strcmp(event["args"]["name"].GetString(), "Worker \"1\"") == 0)
+            {
+                found = true;
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+
+    TEST_F(EventTraceRecorderTest, Clear_RemovesRecordedEvents)
+    {
+        AZ_TRACE_RECORDER_INSTANT("Instant", "Test");
+        EventTraceRecorder::Clear();
+        EXPECT_TRUE(WriteChromeTrace().empty());
+    }
+
+    TEST_F(EventTraceRecorderTest, Write_Perfetto_WritesTracePackets)
+    {
+        {
+            AZ_TRACE_RECORDER_SCOPE("PerfettoScope", "Test");
+            AZ_TRACE_RECORDER_COUNTER("PerfettoCounter", "Test", 7);
+        }
+
+        AZStd::vector<u8> buffer = WriteTrace(EventTraceRecorder::Format::Perfetto);
+        ASSERT_FALSE(buffer.empty());
+        // Every top level field is a length delimited TracePacket (field 1).
+        size_t offset = 0;
+        size_t packetCount = 0;
+        while (offset < buffer.size())
+        {
+            ASSERT_EQ(0x0a, buffer[offset++]);
+            size_t length = 0;
+            int shift = 0;
+            u8 byte;
+            do
+            {
+                ASSERT_LT(offset, buffer.size());
+                byte = buffer[offset++];
+                length |= static_cast<size_t>(byte & 0x7f) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            offset += length;
+            ++packetCount;
+        }
+        EXPECT_EQ(buffer.size(), offset);
+        // Process track, thread track, counter track and three events.
+        EXPECT_EQ(6, packetCount);
+
+        AZStd::string_view content(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        EXPECT_NE(AZStd::string_view::npos, content.find("PerfettoScope"));
+        EXPECT_NE(AZStd::string_view::npos, content.find("PerfettoCounter"));
+    }
+} // namespace AZ::Debug
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Measures the cost of a recorded scope. Range 0 records with the recorder disabled, range 1 with it enabled.
+    class EventTraceRecorderBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::Debug::EventTraceRecorder::Clear();
+            AZ::Debug::EventTraceRecorder::SetEnabled(state.range(0) != 0);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::Debug::EventTraceRecorder::SetEnabled(false);
+            AZ::Debug::EventTraceRecorder::Clear();
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(EventTraceRecorderBenchmarkFixture, Scope)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ_TRACE_RECORDER_SCOPE("BenchmarkScope", "Benchmark");
+        }
+    }
+    BENCHMARK_REGISTER_F(EventTraceRecorderBenchmarkFixture, Scope)->Arg(0)->Arg(1);
+
+    BENCHMARK_DEFINE_F(EventTraceRecorderBenchmarkFixture, NestedScopes)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ_TRACE_RECORDER_SCOPE("OuterScope", "Benchmark");
+            {
+                AZ_TRACE_RECORDER_SCOPE("InnerScope", "Benchmark");
+            }
+        }
+    }
+    BENCHMARK_REGISTER_F(EventTraceRecorderBenchmarkFixture, NestedScopes)->Arg(0)->Arg(1);
+
+    BENCHMARK_DEFINE_F(EventTraceRecorderBenchmarkFixture, Counter)(benchmark::State& state)
+    {
+        AZ::s64 value = 0;
+        for (auto _ : state)
+        {
+            AZ_TRACE_RECORDER_COUNTER("BenchmarkCounter", "Benchmark", ++value);
+        }
+    }
+    BENCHMARK_REGISTER_F(EventTraceRecorderBenchmarkFixture, Counter)->Arg(0)->Arg(1);
+} // namespace Benchmark
+#endif
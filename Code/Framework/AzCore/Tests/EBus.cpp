@@ -11,6 +11,7 @@
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
@@ -44,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool pooledEventQueue = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -55,6 +56,7 @@ namespace BusImplementation
 
         // Allow queuing
         static const bool EnableEventQueue = true;
+        static const bool EnablePooledEventQueue = pooledEventQueue;
 
         // Force locking
         using MutexType = AZStd::recursive_mutex;
@@ -192,8 +194,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool pooledEventQueue = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, pooledEventQueue>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -212,6 +214,11 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Pooled event queue
+using OneToOnePooled = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Single, false, true>;
+namespace testing { namespace internal { template<> std::string GetTypeName<OneToOnePooled>() { return "OneToOnePooled"; } } }
+using ManyToManyPooled = TestBus<AZ::EBusAddressPolicy::ById, AZ::EBusHandlerPolicy::Multiple, false, true>;
+namespace testing { namespace internal { template<> std::string GetTypeName<ManyToManyPooled>() { return "ManyToManyPooled"; } } }
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -1847,6 +1854,198 @@ namespace UnitTest
 
     }
 
+    namespace PooledQueueTest
+    {
+        class PooledQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+            using BusIdType = int;
+            using MutexType = AZStd::mutex;
+            static const bool EnableEventQueue = true;
+            static const bool EnablePooledEventQueue = true;
+            //////////////////////////////////////////////////////////////////////////
+
+            virtual ~PooledQueueEvents() = default;
+            virtual void OnValue(int value, const AZStd::string& text) = 0;
+            virtual void OnShared(AZStd::shared_ptr<int> value) = 0;
+        };
+        using PooledQueueBus = AZ::EBus<PooledQueueEvents>;
+
+        class PooledQueueHandler
+            : public PooledQueueBus::Handler
+        {
+        public:
+            void OnValue(int value, const AZStd::string& text) override
+            {
+                m_values.push_back(value);
+                m_texts.push_back(text);
+                if (m_requeueCount > 0)
+                {
+                    --m_requeueCount;
+                    PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnValue, value + 1, text);
+                }
+            }
+
+            void OnShared(AZStd::shared_ptr<int> value) override
+            {
+                m_sharedSum += *value;
+            }
+
+            AZStd::vector<int> m_values;
+            AZStd::vector<AZStd::string> m_texts;
+            int m_requeueCount = 0;
+            int m_sharedSum = 0;
+        };
+    }
+
+    class PooledQueueEbusTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_handler = AZStd::make_unique<PooledQueueTest::PooledQueueHandler>();
+            m_handler->BusConnect(0);
+        }
+
+        void TearDown() override
+        {
+            PooledQueueTest::PooledQueueBus::ClearQueuedEvents();
+            m_handler->BusDisconnect();
+            m_handler.reset();
+        }
+
+    protected:
+        AZStd::unique_ptr<PooledQueueTest::PooledQueueHandler> m_handler;
+    };
+
+    TEST_F(PooledQueueEbusTest, QueueEvent_ManyEvents_EventsExecuteInOrder)
+    {
+        using namespace PooledQueueTest;
+        constexpr int numEvents = 10000;
+        // Long enough to not fit in the small string buffer so the queued copy owns memory that needs to be released.
+        const AZStd::string text = "A string that's too long to be stored in the small string buffer";
+
+        for (int i = 0; i < numEvents; ++i)
+        {
+            PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnValue, i, text);
+        }
+        EXPECT_EQ(numEvents, PooledQueueBus::QueuedEventCount());
+
+        PooledQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(0, PooledQueueBus::QueuedEventCount());
+
+        ASSERT_EQ(numEvents, m_handler->m_values.size());
+        for (int i = 0; i < numEvents; ++i)
+        {
+            EXPECT_EQ(i, m_handler->m_values[i]);
+            EXPECT_STREQ(text.c_str(), m_handler->m_texts[i].c_str());
+        }
+    }
+
+    TEST_F(PooledQueueEbusTest, QueueEvent_QueuedWhileExecuting_EventExecutesInSameCall)
+    {
+        using namespace PooledQueueTest;
+        m_handler->m_requeueCount = 3;
+        PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnValue, 0, AZStd::string("requeue"));
+
+        PooledQueueBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(4, m_handler->m_values.size());
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(i, m_handler->m_values[i]);
+        }
+    }
+
+    TEST_F(PooledQueueEbusTest, QueueFunction_CaptureLargerThanBlock_FunctionExecutes)
+    {
+        using namespace PooledQueueTest;
+        AZStd::array<int, 4096> largeCapture;
+        for (size_t i = 0; i < largeCapture.size(); ++i)
+        {
+            largeCapture[i] = aznumeric_cast<int>(i);
+        }
+
+        int sum = 0;
+        PooledQueueBus::QueueFunction([largeCapture, &sum]()
+            {
+                for (int value : largeCapture)
+                {
+                    sum += value;
+                }
+            });
+        PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnValue, 1, AZStd::string("after"));
+
+        PooledQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(4095 * 4096 / 2, sum);
+        ASSERT_EQ(1, m_handler->m_values.size());
+        EXPECT_EQ(1, m_handler->m_values[0]);
+    }
+
+    TEST_F(PooledQueueEbusTest, ClearQueuedEvents_QueuedArguments_ArgumentsAreReleased)
+    {
+        using namespace PooledQueueTest;
+        AZStd::shared_ptr<int> value = AZStd::make_shared<int>(5);
+        for (int i = 0; i < 16; ++i)
+        {
+            PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnShared, value);
+        }
+        EXPECT_EQ(17, value.use_count());
+
+        PooledQueueBus::ClearQueuedEvents();
+        EXPECT_EQ(1, value.use_count());
+
+        // The queue is reused after being cleared.
+        PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnShared, value);
+        PooledQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, value.use_count());
+        EXPECT_EQ(5, m_handler->m_sharedSum);
+    }
+
+    TEST_F(PooledQueueEbusTest, QueueEvent_MultipleThreads_AllEventsExecuteInOrderPerThread)
+    {
+        using namespace PooledQueueTest;
+        constexpr int numThreads = 4;
+        constexpr int numEventsPerThread = 2000;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int t = 0; t < numThreads; ++t)
+        {
+            threads.emplace_back([t]()
+                {
+                    for (int i = 0; i < numEventsPerThread; ++i)
+                    {
+                        PooledQueueBus::QueueEvent(0, &PooledQueueBus::Events::OnValue, t * numEventsPerThread + i, AZStd::string());
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        PooledQueueBus::ExecuteQueuedEvents();
+
+        ASSERT_EQ(numThreads * numEventsPerThread, m_handler->m_values.size());
+        int lastValue[numThreads];
+        for (int t = 0; t < numThreads; ++t)
+        {
+            lastValue[t] = t * numEventsPerThread - 1;
+        }
+        for (int value : m_handler->m_values)
+        {
+            int thread = value / numEventsPerThread;
+            EXPECT_EQ(lastValue[thread] + 1, value);
+            lastValue[thread] = value;
+        }
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -4447,6 +4646,47 @@ namespace Benchmark
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_ExecuteQueueCached);
 
+    // Batches of queued events, comparing the default queue against the pooled queue
+    template <typename Bus>
+    static void BM_EBus_QueueAndExecuteBroadcastBatch(::benchmark::State& state)
+    {
+        constexpr int batchSize = 1000;
+        s_benchmarkEBusEnv<Bus>.Connect(state);
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < batchSize; ++i)
+            {
+                Bus::QueueBroadcast(&Bus::Events::OnEvent);
+            }
+            Bus::ExecuteQueuedEvents();
+        }
+        s_benchmarkEBusEnv<Bus>.Disconnect(state);
+        state.SetItemsProcessed(state.iterations() * batchSize);
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteBroadcastBatch, OneToOne)->Apply(&BenchmarkSettings::OneToOne);
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteBroadcastBatch, OneToOnePooled)->Apply(&BenchmarkSettings::OneToOne);
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteBroadcastBatch, ManyToMany)->Apply(&BenchmarkSettings::ManyToMany);
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteBroadcastBatch, ManyToManyPooled)->Apply(&BenchmarkSettings::ManyToMany);
+
+    template <typename Bus>
+    static void BM_EBus_QueueAndExecuteEventBatch(::benchmark::State& state)
+    {
+        constexpr int batchSize = 1000;
+        s_benchmarkEBusEnv<Bus>.Connect(state);
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < batchSize; ++i)
+            {
+                Bus::QueueEvent(i % BenchmarkSettings::Many, &Bus::Events::OnEvent);
+            }
+            Bus::ExecuteQueuedEvents();
+        }
+        s_benchmarkEBusEnv<Bus>.Disconnect(state);
+        state.SetItemsProcessed(state.iterations() * batchSize);
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteEventBatch, ManyToMany)->Apply(&BenchmarkSettings::ManyToMany);
+    BENCHMARK_TEMPLATE(BM_EBus_QueueAndExecuteEventBatch, ManyToManyPooled)->Apply(&BenchmarkSettings::ManyToMany);
+
     //////////////////////////////////////////////////////////////////////////
     // Multithreaded Broadcasts
     //////////////////////////////////////////////////////////////////////////
@@ -9,6 +9,7 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobCompletionSpin.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobGraph.h>
 #include <AzCore/Jobs/LegacyJobExecutor.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
@@ -1651,6 +1652,151 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class JobGraphTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobGraphTestFixture() : DefaultJobManagerSetupFixture(4)
+        {
+        }
+    };
+
+    TEST_F(JobGraphTestFixture, SubmitAndWait_DiamondGraph_TasksRunAfterTheirPredecessors)
+    {
+        AZStd::atomic<int> order{ 0 };
+        int first = -1;
+        int left = -1;
+        int right = -1;
+        int last = -1;
+
+        JobGraph graph("Diamond", m_jobContext);
+        JobGraph::TaskId lastTask = graph.AddTask("Last", [&]() { last = order++; });
+        JobGraph::TaskId leftTask = graph.AddTask("Left", [&]() { left = order++; });
+        JobGraph::TaskId rightTask = graph.AddTask("Right", [&]() { right = order++; });
+        JobGraph::TaskId firstTask = graph.AddTask("First", [&]() { first = order++; });
+        graph.AddDependency(firstTask, leftTask);
+        graph.AddDependency(firstTask, rightTask);
+        graph.AddDependency(leftTask, lastTask);
+        graph.AddDependency(rightTask, lastTask);
+        ASSERT_TRUE(graph.Compile());
+
+        // The same compiled graph is submitted multiple times, like it would be every frame.
+        for (int i = 0; i < 64; ++i)
+        {
+            order = 0;
+            graph.SubmitAndWait();
+
+            EXPECT_EQ(0, first);
+            EXPECT_LT(first, left);
+            EXPECT_LT(first, right);
+            EXPECT_EQ(3, last);
+        }
+    }
+
+    TEST_F(JobGraphTestFixture, SubmitAndWait_WideGraph_AllTasksRun)
+    {
+        static constexpr AZ::u32 numTasks = 256;
+        AZStd::atomic<AZ::u32> counter{ 0 };
+
+        JobGraph graph("Wide", m_jobContext);
+        JobGraph::TaskId start = graph.AddTask("Start", []() {});
+        JobGraph::TaskId end = graph.AddTask("End", [&counter]() { EXPECT_EQ(numTasks, counter.load()); });
+        for (AZ::u32 i = 0; i < numTasks; ++i)
+        {
+            JobGraph::TaskId task = graph.AddTask("Work", [&counter]() { ++counter; }, aznumeric_cast<AZ::s8>(i % 3));
+            graph.AddDependency(start, task);
+            graph.AddDependency(task, end);
+        }
+        ASSERT_TRUE(graph.Compile());
+
+        for (int i = 0; i < 8; ++i)
+        {
+            counter = 0;
+            graph.SubmitAndWait();
+            EXPECT_EQ(numTasks, counter.load());
+        }
+    }
+
+    TEST_F(JobGraphTestFixture, SubmitAndWait_SubmitFromJob_GraphCompletes)
+    {
+        AZStd::atomic<AZ::u32> counter{ 0 };
+
+        JobGraph graph("Nested", m_jobContext);
+        JobGraph::TaskId first = graph.AddTask("First", [&counter]() { ++counter; });
+        JobGraph::TaskId second = graph.AddTask("Second", [&counter]() { ++counter; });
+        graph.AddDependency(first, second);
+        ASSERT_TRUE(graph.Compile());
+
+        Job* job = CreateJobFunction([&graph]() { graph.SubmitAndWait(); }, true, m_jobContext);
+        job->StartAndWaitForCompletion();
+
+        EXPECT_EQ(2, counter.load());
+    }
+
+    TEST_F(JobGraphTestFixture, SubmitAndWait_TasksWithWorkerAffinity_TasksRunOnRequestedWorker)
+    {
+        constexpr AZ::u32 numTasks = 32;
+        AZStd::atomic<AZ::u32> numOnWrongWorker{ 0 };
+
+        JobGraph graph("Affinity", m_jobContext);
+        for (AZ::u32 i = 0; i < numTasks; ++i)
+        {
+            AZ::u32 worker = i % m_numWorkerThreads;
+            graph.AddTask("Bound", [this, worker, &numOnWrongWorker]()
+                {
+                    if (m_jobManager->GetWorkerThreadId() != worker)
+                    {
+                        ++numOnWrongWorker;
+                    }
+                }, 0, worker);
+        }
+        ASSERT_TRUE(graph.Compile());
+
+        for (int i = 0; i < 8; ++i)
+        {
+            graph.SubmitAndWait();
+        }
+        EXPECT_EQ(0, numOnWrongWorker.load());
+    }
+
+    TEST_F(JobGraphTestFixture, Compile_GraphWithCycle_CompileFails)
+    {
+        JobGraph graph("Cycle", m_jobContext);
+        JobGraph::TaskId a = graph.AddTask("A", []() {});
+        JobGraph::TaskId b = graph.AddTask("B", []() {});
+        JobGraph::TaskId c = graph.AddTask("C", []() {});
+        graph.AddDependency(a, b);
+        graph.AddDependency(b, c);
+        graph.AddDependency(c, b);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(graph.Compile());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(graph.IsCompiled());
+    }
+
+    TEST_F(JobGraphTestFixture, WriteChromeTrace_TracingEnabled_AllTasksAreInTrace)
+    {
+        JobGraph graph("Traced", m_jobContext);
+        JobGraph::TaskId first = graph.AddTask("FirstTask", []() { AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1)); });
+        JobGraph::TaskId second = graph.AddTask("SecondTask", []() {});
+        graph.AddDependency(first, second);
+        ASSERT_TRUE(graph.Compile());
+        graph.EnableTracing(true);
+        graph.SubmitAndWait();
+
+        const JobGraph::TaskTrace& firstTrace = graph.GetTaskTrace(first);
+        const JobGraph::TaskTrace& secondTrace = graph.GetTaskTrace(second);
+        EXPECT_LE(firstTrace.m_startMicroSecond, firstTrace.m_endMicroSecond);
+        EXPECT_LE(firstTrace.m_endMicroSecond, secondTrace.m_startMicroSecond);
+
+        AZStd::string trace;
+        graph.WriteChromeTrace(trace);
+        EXPECT_NE(AZStd::string::npos, trace.find("\"traceEvents\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"name\":\"FirstTask\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"name\":\"SecondTask\""));
+        EXPECT_NE(AZStd::string::npos, trace.find("\"cat\":\"Traced\""));
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares the BatchMath kernels against the equivalent per element loops. Build with LY_SIMD_AVX2 to compare
+    //! the AVX2 and FMA kernels against the SSE ones.
+    class BM_MathBatch
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t Count = 1024;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+            m_transform = AZ::Transform(AZ::Vector3(1.0f, 2.0f, 3.0f), AZ::Quaternion::CreateRotationZ(0.5f), 1.5f);
+
+            for (size_t i = 0; i < AZ_ARRAY_SIZE(m_components); ++i)
+            {
+                m_components[i].resize(Count);
+                m_results[i].resize(Count);
+            }
+
+            m_points.resize(Count);
+            m_pointResults.resize(Count);
+            m_transforms.resize(Count);
+            m_transformResults.resize(Count);
+            m_aabbs.resize(Count);
+            m_intersectResults.resize(Count);
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_points[i] = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationZ(unif(rng) * AZ::Constants::TwoPi);
+                m_transforms[i] = AZ::Transform(m_points[i], rotation, unif(rng) + 0.5f);
+                const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 100.0f;
+                m_aabbs[i] = AZ::Aabb::CreateFromMinMax(aabbMin, AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 10.0f + aabbMin);
+
+                // The components are shared by the point, transform and aabb views, only the timings matter here
+                m_components[0][i] = rotation.GetX();
+                m_components[1][i] = rotation.GetY();
+                m_components[2][i] = rotation.GetZ();
+                m_components[3][i] = rotation.GetW();
+                m_components[4][i] = m_transforms[i].GetUniformScale();
+                m_components[5][i] = m_points[i].GetX();
+                m_components[6][i] = m_points[i].GetY();
+                m_components[7][i] = m_points[i].GetZ();
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            for (size_t i = 0; i < AZ_ARRAY_SIZE(m_components); ++i)
+            {
+                m_components[i] = {};
+                m_results[i] = {};
+            }
+            m_points = {};
+            m_pointResults = {};
+            m_transforms = {};
+            m_transformResults = {};
+            m_aabbs = {};
+            m_intersectResults = {};
+        }
+
+        AZ::BatchMath::ConstTransformSoa GetTransforms() const
+        {
+            return AZ::BatchMath::ConstTransformSoa{ m_components[0].data(), m_components[1].data(), m_components[2].data(),
+                m_components[3].data(), m_components[4].data(), m_components[5].data(), m_components[6].data(), m_components[7].data() };
+        }
+
+        AZ::BatchMath::TransformSoa GetTransformResults()
+        {
+            return AZ::BatchMath::TransformSoa{ m_results[0].data(), m_results[1].data(), m_results[2].data(),
+                m_results[3].data(), m_results[4].data(), m_results[5].data(), m_results[6].data(), m_results[7].data() };
+        }
+
+        AZ::Frustum m_frustum;
+        AZ::Transform m_transform;
+        AZStd::vector<float> m_components[8];
+        AZStd::vector<float> m_results[8];
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<AZ::Vector3> m_pointResults;
+        AZStd::vector<AZ::Transform> m_transforms;
+        AZStd::vector<AZ::Transform> m_transformResults;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<AZ::IntersectResult> m_intersectResults;
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPoint_Loop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_pointResults[i] = m_transform.TransformPoint(m_points[i]);
+            }
+            benchmark::DoNotOptimize(m_pointResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Aos)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, m_points.data(), m_pointResults.data(), Count);
+            benchmark::DoNotOptimize(m_pointResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Soa)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform,
+                { m_components[5].data(), m_components[6].data(), m_components[7].data() },
+                { m_results[5].data(), m_results[6].data(), m_results[7].data() }, Count);
+            benchmark::DoNotOptimize(m_results[5].data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransform_Loop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_transformResults[i] = m_transforms[i] * m_transforms[Count - 1 - i];
+            }
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransforms_Soa)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::MultiplyTransforms(GetTransforms(), GetTransforms(), GetTransformResults(), Count);
+            benchmark::DoNotOptimize(m_results[0].data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransformSharedParent_Loop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_transformResults[i] = m_transform * m_transforms[i];
+            }
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransformsSharedParent_Aos)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::MultiplyTransforms(m_transform, m_transforms.data(), m_transformResults.data(), Count);
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransformsSharedParent_Soa)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::MultiplyTransforms(m_transform, GetTransforms(), GetTransformResults(), Count);
+            benchmark::DoNotOptimize(m_results[0].data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectAabb_Loop)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                m_intersectResults[i] = m_frustum.IntersectAabb(m_aabbs[i]);
+            }
+            benchmark::DoNotOptimize(m_intersectResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectAabbs_Aos)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::IntersectAabbs(m_frustum, m_aabbs.data(), m_intersectResults.data(), Count);
+            benchmark::DoNotOptimize(m_intersectResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectAabbs_Soa)(benchmark::State& state)
+    {
+        const AZ::BatchMath::AabbSoa aabbs{ m_components[0].data(), m_components[1].data(), m_components[2].data(),
+            m_components[5].data(), m_components[6].data(), m_components[7].data() };
+        for (auto _ : state)
+        {
+            AZ::BatchMath::IntersectAabbs(m_frustum, aabbs, m_intersectResults.data(), Count);
+            benchmark::DoNotOptimize(m_intersectResults.data());
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    //! Owns the component arrays for a BatchMath::TransformSoa view.
+    class TransformArrays
+    {
+    public:
+        explicit TransformArrays(size_t count)
+        {
+            for (AZStd::vector<float>& component : m_components)
+            {
+                component.resize(count);
+            }
+        }
+
+        explicit TransformArrays(const AZStd::vector<AZ::Transform>& transforms)
+            : TransformArrays(transforms.size())
+        {
+            for (size_t i = 0; i < transforms.size(); ++i)
+            {
+                const AZ::Quaternion& rotation = transforms[i].GetRotation();
+                const AZ::Vector3& translation = transforms[i].GetTranslation();
+                m_components[0][i] = rotation.GetX();
+                m_components[1][i] = rotation.GetY();
+                m_components[2][i] = rotation.GetZ();
+                m_components[3][i] = rotation.GetW();
+                m_components[4][i] = transforms[i].GetUniformScale();
+                m_components[5][i] = translation.GetX();
+                m_components[6][i] = translation.GetY();
+                m_components[7][i] = translation.GetZ();
+            }
+        }
+
+        AZ::BatchMath::TransformSoa GetView()
+        {
+            return AZ::BatchMath::TransformSoa{ m_components[0].data(), m_components[1].data(), m_components[2].data(),
+                m_components[3].data(), m_components[4].data(), m_components[5].data(), m_components[6].data(), m_components[7].data() };
+        }
+
+        AZ::BatchMath::ConstTransformSoa GetConstView() const
+        {
+            return AZ::BatchMath::ConstTransformSoa{ m_components[0].data(), m_components[1].data(), m_components[2].data(),
+                m_components[3].data(), m_components[4].data(), m_components[5].data(), m_components[6].data(), m_components[7].data() };
+        }
+
+        AZ::Transform GetTransform(size_t index) const
+        {
+            return AZ::Transform(
+                AZ::Vector3(m_components[5][index], m_components[6][index], m_components[7][index]),
+                AZ::Quaternion(m_components[0][index], m_components[1][index], m_components[2][index], m_components[3][index]),
+                m_components[4][index]);
+        }
+
+    private:
+        AZStd::vector<float> m_components[8];
+    };
+
+    class BatchMathFixture
+        : public ::testing::TestWithParam<size_t>
+    {
+    protected:
+        float RandomFloat(float minimum, float maximum)
+        {
+            return minimum + m_random.GetRandomFloat() * (maximum - minimum);
+        }
+
+        AZ::Vector3 RandomVector3(float minimum, float maximum)
+        {
+            return AZ::Vector3(RandomFloat(minimum, maximum), RandomFloat(minimum, maximum), RandomFloat(minimum, maximum));
+        }
+
+        AZ::Transform RandomTransform()
+        {
+            const AZ::Vector3 axis = RandomVector3(-1.0f, 1.0f) + AZ::Vector3(0.0f, 0.0f, 0.01f);
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis.GetNormalized(), RandomFloat(-AZ::Constants::Pi, AZ::Constants::Pi));
+            return AZ::Transform(RandomVector3(-10.0f, 10.0f), rotation, RandomFloat(0.5f, 2.0f));
+        }
+
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    TEST_P(BatchMathFixture, TransformPointsSoa_MatchesTransformPoint)
+    {
+        const size_t count = GetParam();
+        const AZ::Transform transform = RandomTransform();
+
+        AZStd::vector<float> x(count), y(count), z(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            x[i] = RandomFloat(-100.0f, 100.0f);
+            y[i] = RandomFloat(-100.0f, 100.0f);
+            z[i] = RandomFloat(-100.0f, 100.0f);
+        }
+
+        AZStd::vector<float> resultX(count), resultY(count), resultZ(count);
+        AZ::BatchMath::TransformPoints(transform, { x.data(), y.data(), z.data() }, { resultX.data(), resultY.data(), resultZ.data() }, count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const AZ::Vector3 expected = transform.TransformPoint(AZ::Vector3(x[i], y[i], z[i]));
+            EXPECT_THAT(AZ::Vector3(resultX[i], resultY[i], resultZ[i]), IsCloseTolerance(expected, 1e-3f));
+        }
+    }
+
+    TEST_P(BatchMathFixture, TransformPointsAos_MatchesTransformPoint)
+    {
+        const size_t count = GetParam();
+        const AZ::Transform transform = RandomTransform();
+
+        AZStd::vector<AZ::Vector3> points(count);
+        for (AZ::Vector3& point : points)
+        {
+            point = RandomVector3(-100.0f, 100.0f);
+        }
+
+        // Transform in place to check that the results can alias the points
+        AZStd::vector<AZ::Vector3> results = points;
+        AZ::BatchMath::TransformPoints(transform, results.data(), results.data(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(results[i], IsCloseTolerance(transform.TransformPoint(points[i]), 1e-3f));
+        }
+    }
+
+    TEST_P(BatchMathFixture, MultiplyTransformsSoa_MatchesOperatorMultiply)
+    {
+        const size_t count = GetParam();
+
+        AZStd::vector<AZ::Transform> lhs(count), rhs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            lhs[i] = RandomTransform();
+            rhs[i] = RandomTransform();
+        }
+
+        TransformArrays lhsArrays(lhs), rhsArrays(rhs), resultArrays(count);
+        AZ::BatchMath::MultiplyTransforms(lhsArrays.GetConstView(), rhsArrays.GetConstView(), resultArrays.GetView(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(resultArrays.GetTransform(i), IsCloseTolerance(lhs[i] * rhs[i], 1e-3f));
+        }
+    }
+
+    TEST_P(BatchMathFixture, MultiplyTransformsSoaSharedParent_MatchesOperatorMultiply)
+    {
+        const size_t count = GetParam();
+        const AZ::Transform parent = RandomTransform();
+
+        AZStd::vector<AZ::Transform> locals(count);
+        for (AZ::Transform& local : locals)
+        {
+            local = RandomTransform();
+        }
+
+        // Multiply in place to check that the results can alias the rhs
+        TransformArrays arrays(locals);
+        AZ::BatchMath::MultiplyTransforms(parent, arrays.GetConstView(), arrays.GetView(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(arrays.GetTransform(i), IsCloseTolerance(parent * locals[i], 1e-3f));
+        }
+    }
+
+    TEST_P(BatchMathFixture, MultiplyTransformsAosSharedParent_MatchesOperatorMultiply)
+    {
+        const size_t count = GetParam();
+        const AZ::Transform parent = RandomTransform();
+
+        AZStd::vector<AZ::Transform> locals(count);
+        for (AZ::Transform& local : locals)
+        {
+            local = RandomTransform();
+        }
+
+        // Multiply in place to check that the results can alias the rhs
+        AZStd::vector<AZ::Transform> results = locals;
+        AZ::BatchMath::MultiplyTransforms(parent, results.data(), results.data(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_THAT(results[i], IsCloseTolerance(parent * locals[i], 1e-3f));
+        }
+    }
+
+    TEST_P(BatchMathFixture, IntersectAabbs_MatchesFrustumIntersectAabb)
+    {
+        const size_t count = GetParam();
+        const AZ::Frustum frustum(AZ::ViewFrustumAttributes(
+            AZ::Transform::CreateRotationZ(0.5f), 1.5f, AZ::DegToRad(60.0f), 1.0f, 50.0f));
+
+        AZStd::vector<AZ::Aabb> aabbs(count);
+        AZStd::vector<float> minX(count), minY(count), minZ(count), maxX(count), maxY(count), maxZ(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const AZ::Vector3 center = RandomVector3(-40.0f, 40.0f) + AZ::Vector3(0.0f, 30.0f, 0.0f);
+            const AZ::Vector3 extents = RandomVector3(0.1f, 5.0f);
+            aabbs[i] = AZ::Aabb::CreateFromMinMax(center - extents, center + extents);
+            minX[i] = aabbs[i].GetMin().GetX();
+            minY[i] = aabbs[i].GetMin().GetY();
+            minZ[i] = aabbs[i].GetMin().GetZ();
+            maxX[i] = aabbs[i].GetMax().GetX();
+            maxY[i] = aabbs[i].GetMax().GetY();
+            maxZ[i] = aabbs[i].GetMax().GetZ();
+        }
+
+        AZStd::vector<AZ::IntersectResult> soaResults(count), aosResults(count);
+        const AZ::BatchMath::AabbSoa soa{ minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data() };
+        AZ::BatchMath::IntersectAabbs(frustum, soa, soaResults.data(), count);
+        AZ::BatchMath::IntersectAabbs(frustum, aabbs.data(), aosResults.data(), count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const AZ::IntersectResult expected = frustum.IntersectAabb(aabbs[i]);
+            EXPECT_EQ(expected, soaResults[i]);
+            EXPECT_EQ(expected, aosResults[i]);
+        }
+    }
+
+    // Cover counts below, at and above the batch width so both the batched and the remainder paths are tested
+    INSTANTIATE_TEST_CASE_P(MATH_BatchMath, BatchMathFixture, ::testing::Values(0, 1, 7, 8, 9, 31, 256));
+} // namespace UnitTest
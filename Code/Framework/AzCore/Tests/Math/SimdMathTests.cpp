@@ -2875,4 +2875,78 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, TestLoadStoreVec8)
+    {
+        alignas(32) float floatValues[Simd::Vec8::ElementCount] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        alignas(32) float floatResults[Simd::Vec8::ElementCount] = {};
+        Simd::Vec8::StoreAligned(floatResults, Simd::Vec8::LoadAligned(floatValues));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(floatValues[i], floatResults[i]);
+        }
+
+        alignas(32) int32_t intValues[Simd::Vec8::ElementCount] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+        alignas(32) int32_t intResults[Simd::Vec8::ElementCount] = {};
+        Simd::Vec8::StoreUnaligned(intResults, Simd::Vec8::LoadUnaligned(intValues));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(intValues[i], intResults[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestArithmeticVec8)
+    {
+        float values[Simd::Vec8::ElementCount] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f };
+        float results[Simd::Vec8::ElementCount] = {};
+
+        const Simd::Vec8::FloatType value = Simd::Vec8::LoadUnaligned(values);
+        const Simd::Vec8::FloatType two = Simd::Vec8::Splat(2.0f);
+
+        Simd::Vec8::StoreUnaligned(results, Simd::Vec8::Madd(value, two, Simd::Vec8::Splat(1.0f)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(values[i] * 2.0f + 1.0f, results[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(results, Simd::Vec8::Sub(Simd::Vec8::Div(value, two), Simd::Vec8::Abs(value)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(values[i] / 2.0f - fabsf(values[i]), results[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(results, Simd::Vec8::Sqrt(Simd::Vec8::Mul(value, value)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(fabsf(values[i]), results[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestCompareSelectVec8)
+    {
+        float values[Simd::Vec8::ElementCount] = { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 0.0f, -0.0f };
+        float results[Simd::Vec8::ElementCount] = {};
+        int32_t intResults[Simd::Vec8::ElementCount] = {};
+
+        const Simd::Vec8::FloatType value = Simd::Vec8::LoadUnaligned(values);
+        const Simd::Vec8::FloatType negativeMask = Simd::Vec8::CmpLt(value, Simd::Vec8::ZeroFloat());
+
+        Simd::Vec8::StoreUnaligned(results, Simd::Vec8::Select(Simd::Vec8::Splat(-1.0f), Simd::Vec8::Splat(1.0f), negativeMask));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(values[i] < 0.0f ? -1.0f : 1.0f, results[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(intResults, Simd::Vec8::Select(Simd::Vec8::Splat(7), Simd::Vec8::Splat(3), Simd::Vec8::CastToInt(negativeMask)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(values[i] < 0.0f ? 7 : 3, intResults[i]);
+        }
+
+        Simd::Vec8::StoreUnaligned(intResults, Simd::Vec8::ConvertToInt(Simd::Vec8::Max(value, Simd::Vec8::ZeroFloat())));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(static_cast<int32_t>(AZ::GetMax(values[i], 0.0f)), intResults[i]);
+        }
+    }
 }
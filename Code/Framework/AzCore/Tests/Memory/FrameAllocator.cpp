@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace UnitTest
+{
+    class FrameSchemaTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        static constexpr size_t BlockSize = 4 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AZ::FrameSchema::Descriptor descriptor;
+            descriptor.m_blockSize = BlockSize;
+            m_schema = new AZ::FrameSchema(descriptor);
+        }
+
+        void TearDown() override
+        {
+            delete m_schema;
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZ::FrameSchema* m_schema = nullptr;
+    };
+
+    TEST_F(FrameSchemaTestFixture, Allocate_ReturnsAlignedMemoryThatDoesNotOverlap)
+    {
+        static const AZStd::pair<size_t, size_t> sizeAndAlignments[] =
+        {
+            { 1, 1 }, { 16, 16 }, { 3, 4 }, { 100, 64 }, { 7, 8 }, { 1000, 128 }, { 2 * BlockSize, 16 }, { 24, 8 }
+        };
+
+        AZStd::vector<AZStd::pair<char*, size_t>> allocations;
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (const auto& sizeAndAlignment : sizeAndAlignments)
+            {
+                char* allocation = static_cast<char*>(m_schema->Allocate(sizeAndAlignment.first, sizeAndAlignment.second));
+                ASSERT_NE(nullptr, allocation);
+                EXPECT_EQ(0, reinterpret_cast<uintptr_t>(allocation) & (sizeAndAlignment.second - 1));
+                memset(allocation, static_cast<int>(allocations.size() & 0xff), sizeAndAlignment.first);
+                allocations.emplace_back(allocation, sizeAndAlignment.first);
+            }
+        }
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            for (size_t j = 0; j < allocations[i].second; ++j)
+            {
+                ASSERT_EQ(static_cast<char>(i & 0xff), allocations[i].first[j]);
+            }
+        }
+    }
+
+    TEST_F(FrameSchemaTestFixture, AdvanceFrame_MemoryIsValidForOneMoreFrameThenReused)
+    {
+        char* allocation = static_cast<char*>(m_schema->Allocate(64, 8));
+        memset(allocation, 'a', 64);
+
+        // The next frame allocates from the other buffer
+        m_schema->AdvanceFrame();
+        for (size_t i = 0; i < 100; ++i)
+        {
+            memset(m_schema->Allocate(64, 8), 'b', 64);
+        }
+        for (size_t i = 0; i < 64; ++i)
+        {
+            EXPECT_EQ('a', allocation[i]);
+        }
+        EXPECT_EQ(64 + 100 * 64, m_schema->NumAllocatedBytes());
+
+        // Two frames later the buffer of the first frame is reused
+        m_schema->AdvanceFrame();
+        EXPECT_EQ(allocation, m_schema->Allocate(64, 8));
+        EXPECT_EQ(64 + 100 * 64, m_schema->NumAllocatedBytes());
+
+        m_schema->AdvanceFrame();
+        m_schema->AdvanceFrame();
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(FrameSchemaTestFixture, DeAllocate_OnlyTheLastAllocationIsReclaimed)
+    {
+        void* first = m_schema->Allocate(32, 8);
+        void* second = m_schema->Allocate(32, 8);
+        m_schema->DeAllocate(second, 32);
+        EXPECT_EQ(32, m_schema->NumAllocatedBytes());
+        EXPECT_EQ(second, m_schema->Allocate(32, 8));
+
+        m_schema->DeAllocate(first, 32);
+        EXPECT_EQ(64, m_schema->NumAllocatedBytes());
+        EXPECT_NE(first, m_schema->Allocate(32, 8));
+    }
+
+    TEST_F(FrameSchemaTestFixture, Resize_LastAllocationGrowsInPlace)
+    {
+        void* first = m_schema->Allocate(32, 8);
+        void* second = m_schema->Allocate(32, 8);
+
+        EXPECT_EQ(0, m_schema->Resize(first, 64));
+        EXPECT_EQ(256, m_schema->Resize(second, 256));
+        EXPECT_EQ(32 + 256, m_schema->NumAllocatedBytes());
+
+        // Growing past the end of the block leaves the allocation as it is
+        EXPECT_EQ(256, m_schema->Resize(second, 2 * BlockSize));
+        EXPECT_NE(second, m_schema->Allocate(32, 8));
+    }
+
+    TEST_F(FrameSchemaTestFixture, Statistics_TrackLastFrameAndHighWaterMark)
+    {
+        for (size_t i = 0; i < 3 * BlockSize / 128; ++i)
+        {
+            m_schema->Allocate(128, 8);
+        }
+        m_schema->AdvanceFrame();
+
+        AZ::FrameSchema::Statistics statistics = m_schema->GetStatistics();
+        EXPECT_EQ(1, statistics.m_frame);
+        EXPECT_EQ(3 * BlockSize, statistics.m_lastFrameBytes);
+        EXPECT_EQ(3 * BlockSize, statistics.m_highWaterMark);
+        EXPECT_EQ(1, statistics.m_numThreadArenas);
+        EXPECT_LE(3 * BlockSize, statistics.m_capacity);
+
+        m_schema->Allocate(128, 8);
+        m_schema->AdvanceFrame();
+        statistics = m_schema->GetStatistics();
+        EXPECT_EQ(128, statistics.m_lastFrameBytes);
+        EXPECT_EQ(3 * BlockSize, statistics.m_highWaterMark);
+    }
+
+    TEST_F(FrameSchemaTestFixture, AdvanceFrame_SpilledBufferIsReplacedWithOneBlock)
+    {
+        for (size_t i = 0; i < 3 * BlockSize / 128; ++i)
+        {
+            m_schema->Allocate(128, 8);
+        }
+        m_schema->AdvanceFrame();
+        m_schema->AdvanceFrame();
+
+        // The buffer now fits the whole frame in one block, so the allocations are contiguous
+        char* first = static_cast<char*>(m_schema->Allocate(128, 8));
+        for (size_t i = 1; i < 3 * BlockSize / 128; ++i)
+        {
+            EXPECT_EQ(first + i * 128, m_schema->Allocate(128, 8));
+        }
+    }
+
+    TEST_F(FrameSchemaTestFixture, AllocateOnThreads_ArenasOfExitedThreadsAreReused)
+    {
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocationsPerThread = 1000;
+        auto runThreads = [this]()
+        {
+            AZStd::thread threads[numThreads];
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                threads[threadIndex] = AZStd::thread([this, threadIndex]()
+                {
+                    AZStd::vector<char*> allocations;
+                    for (size_t i = 0; i < numAllocationsPerThread; ++i)
+                    {
+                        char* allocation = static_cast<char*>(m_schema->Allocate(16, 8));
+                        memset(allocation, static_cast<int>(threadIndex), 16);
+                        allocations.push_back(allocation);
+                    }
+                    for (char* allocation : allocations)
+                    {
+                        for (size_t i = 0; i < 16; ++i)
+                        {
+                            EXPECT_EQ(static_cast<char>(threadIndex), allocation[i]);
+                        }
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        };
+
+        // Threads that start after others exited take over their arenas, so there is never more than one per thread
+        runThreads();
+        EXPECT_GE(numThreads, m_schema->GetStatistics().m_numThreadArenas);
+        m_schema->AdvanceFrame();
+        runThreads();
+        EXPECT_GE(numThreads, m_schema->GetStatistics().m_numThreadArenas);
+        EXPECT_EQ(2 * numThreads * numAllocationsPerThread * 16, m_schema->NumAllocatedBytes());
+
+        // Once their memory is no longer in use the arenas of exited threads are freed
+        m_schema->AdvanceFrame();
+        m_schema->AdvanceFrame();
+        m_schema->GarbageCollect();
+        EXPECT_EQ(0, m_schema->GetStatistics().m_numThreadArenas);
+        EXPECT_EQ(0, m_schema->Capacity());
+    }
+
+    class FrameAllocatorTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+    };
+
+    TEST_F(FrameAllocatorTestFixture, FrameStdAllocator_VectorGrowsInPlace)
+    {
+        constexpr size_t numElements = 10000;
+        AZStd::vector<int, AZ::FrameStdAllocator> values;
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            values.push_back(static_cast<int>(i));
+        }
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            EXPECT_EQ(static_cast<int>(i), values[i]);
+        }
+
+        // The vector is the only user of the allocator, so it resized its memory instead of copying it
+        EXPECT_EQ(values.capacity() * sizeof(int), AZ::AllocatorInstance<AZ::FrameAllocator>::Get().NumAllocatedBytes());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class FrameAllocatorBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Create();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ_UNUSED(state);
+            AZ::AllocatorInstance<AZ::FrameAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+        }
+
+        // A frame worth of temporary allocations that are all released at the end of the frame
+        template<class Allocator>
+        static void RunFrame(AZStd::vector<void*>& allocations)
+        {
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                allocations[i] = AZ::AllocatorInstance<Allocator>::Get().Allocate(16 + (i % 16) * 8, 8);
+            }
+            benchmark::DoNotOptimize(allocations.data());
+            for (void* allocation : allocations)
+            {
+                AZ::AllocatorInstance<Allocator>::Get().DeAllocate(allocation);
+            }
+        }
+    };
+
+    BENCHMARK_DEFINE_F(FrameAllocatorBenchmarkFixture, SystemAllocator)(benchmark::State& state)
+    {
+        AZStd::vector<void*> allocations(state.range(0));
+        for (auto _ : state)
+        {
+            RunFrame<AZ::SystemAllocator>(allocations);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(FrameAllocatorBenchmarkFixture, SystemAllocator)->RangeMultiplier(8)->Range(64, 4096);
+
+    BENCHMARK_DEFINE_F(FrameAllocatorBenchmarkFixture, FrameAllocator)(benchmark::State& state)
+    {
+        AZStd::vector<void*> allocations(state.range(0));
+        for (auto _ : state)
+        {
+            RunFrame<AZ::FrameAllocator>(allocations);
+            static_cast<AZ::FrameAllocator&>(AZ::AllocatorInstance<AZ::FrameAllocator>::GetAllocator()).AdvanceFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(FrameAllocatorBenchmarkFixture, FrameAllocator)->RangeMultiplier(8)->Range(64, 4096);
+}
+#endif // HAVE_BENCHMARK
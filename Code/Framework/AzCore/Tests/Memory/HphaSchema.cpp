@@ -8,6 +8,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -110,6 +111,94 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    // Runs with the per thread cache of small allocations enabled (true) and disabled (false)
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+        , public ::testing::WithParamInterface<bool>
+    {
+    };
+
+    TEST_P(HphaSchemaThreadCacheTestFixture, AllocateAndDeAllocateOnDifferentThreads_AllMemoryIsReturned)
+    {
+        AZ::HphaSchema::Descriptor descriptor;
+        descriptor.m_useThreadCache = GetParam();
+        AZ::HphaSchema schema(descriptor);
+
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocationsPerThread = 1000;
+        using AllocationArray = AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>>;
+        AllocationArray allocations[numThreads];
+        AZStd::thread threads[numThreads];
+
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&schema, &allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocationsPerThread; ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    void* allocation = schema.Allocate(allocationSize, 0);
+                    memset(allocation, static_cast<int>(threadIndex), allocationSize);
+                    allocations[threadIndex].push_back(allocation);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_LT(0, schema.NumAllocatedBytes());
+
+        // Free every allocation on a different thread than the one that made it, which leaves the memory in the
+        // cache of that thread until it exits
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&schema, &allocations, threadIndex]()
+            {
+                const size_t allocatingThread = (threadIndex + 1) % numThreads;
+                for (size_t i = 0; i < allocations[allocatingThread].size(); ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    const unsigned char* bytes = static_cast<const unsigned char*>(allocations[allocatingThread][i]);
+                    EXPECT_EQ(allocatingThread, bytes[0]);
+                    EXPECT_EQ(allocatingThread, bytes[allocationSize - 1]);
+                    schema.DeAllocate(allocations[allocatingThread][i], allocationSize);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(0, schema.NumAllocatedBytes());
+
+        schema.GarbageCollect();
+        EXPECT_EQ(0, schema.NumAllocatedBytes());
+    }
+
+    TEST_P(HphaSchemaThreadCacheTestFixture, ReuseFreedAllocations_NumAllocatedBytesExcludesCachedMemory)
+    {
+        AZ::HphaSchema::Descriptor descriptor;
+        descriptor.m_useThreadCache = GetParam();
+        AZ::HphaSchema schema(descriptor);
+
+        for (size_t allocationSize : s_smallAllocationSizes)
+        {
+            void* allocation = schema.Allocate(allocationSize, 0);
+            EXPECT_LE(allocationSize, schema.NumAllocatedBytes());
+            EXPECT_LE(allocationSize, schema.AllocationSize(allocation));
+            schema.DeAllocate(allocation, allocationSize);
+            EXPECT_EQ(0, schema.NumAllocatedBytes());
+        }
+
+        schema.GarbageCollect();
+        EXPECT_EQ(0, schema.NumAllocatedBytes());
+    }
+
+    INSTANTIATE_TEST_CASE_P(ThreadCache,
+        HphaSchemaThreadCacheTestFixture,
+        ::testing::Bool());
 }
 
 
@@ -177,6 +266,45 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Schemas shared by all the threads of the threaded benchmark, with and without the per thread cache
+    static AZ::HphaSchema& GetThreadedBenchmarkSchema(bool useThreadCache)
+    {
+        auto createDescriptor = [](bool useCache)
+        {
+            AZ::HphaSchema::Descriptor descriptor;
+            descriptor.m_useThreadCache = useCache;
+            return descriptor;
+        };
+        static AZ::HphaSchema s_cachedSchema(createDescriptor(true));
+        static AZ::HphaSchema s_uncachedSchema(createDescriptor(false));
+        return useThreadCache ? s_cachedSchema : s_uncachedSchema;
+    }
+
+    // Small allocations and frees from 1 to 32 threads at once, this is where the bucket locks get contended
+    static void BM_ThreadedSmallAllocations(benchmark::State& state)
+    {
+        AZ::HphaSchema& schema = GetThreadedBenchmarkSchema(state.range(0) != 0);
+        void* allocations[64];
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < AZ_ARRAY_SIZE(allocations); ++i)
+            {
+                allocations[i] = schema.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            }
+            for (size_t i = 0; i < AZ_ARRAY_SIZE(allocations); ++i)
+            {
+                schema.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * AZ_ARRAY_SIZE(allocations));
+    }
+    BENCHMARK(BM_ThreadedSmallAllocations)
+        ->ArgNames({ "ThreadCache" })
+        ->Arg(0)
+        ->Arg(1)
+        ->ThreadRange(1, 32)
+        ->UseRealTime();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
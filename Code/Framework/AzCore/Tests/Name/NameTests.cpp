@@ -47,9 +47,19 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        //! Returns the entries that are still referenced, or that are kept alive by a hash collision.
+        //! Released entries that haven't been reclaimed yet are left out.
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> dictionary;
+            AZ::NameDictionary::Instance().ForEachEntry([&dictionary](AZ::Internal::NameData* nameData)
+            {
+                if (!AZ::NameDictionary::IsReleased(nameData))
+                {
+                    dictionary.emplace(nameData->GetHash(), nameData);
+                }
+            });
+            return dictionary;
         }
         
         static size_t GetEntryCount()
@@ -57,6 +67,24 @@ namespace UnitTest
             return GetDictionary().size();
         }
 
+        //! Returns the number of entries held by the dictionary, including released entries that haven't been reclaimed yet.
+        static size_t GetAllocatedEntryCount()
+        {
+            size_t count = 0;
+            AZ::NameDictionary::Instance().ForEachEntry([&count](AZ::Internal::NameData*) { ++count; });
+            return count;
+        }
+
+        static constexpr size_t GetReclaimBatchSize()
+        {
+            return AZ::NameDictionary::ReclaimBatchSize;
+        }
+
+        static constexpr size_t GetShardCount()
+        {
+            return AZ::NameDictionary::ShardCount;
+        }
+
         //! Directly calculate the hash value for a string without collision resolution
         static AZ::Name::Hash CalcDirectHashValue(AZStd::string_view name, const uint32_t maxUniqueHashes = std::numeric_limits<uint32_t>::max())
         {
@@ -267,9 +295,9 @@ namespace UnitTest
         EXPECT_EQ(NameDictionaryTester::GetEntryCount(), localDictionary.size());
 
         // Make sure all entries in the localDictionary got copied into the globalDictionary
+        const auto globalDictionary = NameDictionaryTester::GetDictionary();
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -621,6 +649,94 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, ReleasedName_MadeAgainBeforeReclaim_ReusesEntry)
+    {
+        AZ::Name name{"reused"};
+        const AZ::Name::Hash hash = name.GetHash();
+        const char* data = name.GetCStr();
+
+        name = AZ::Name{};
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+        EXPECT_EQ(1, NameDictionaryTester::GetAllocatedEntryCount());
+
+        // Released names can't be found by hash anymore
+        EXPECT_TRUE(AZ::Name{hash}.IsEmpty());
+
+        name = AZ::Name{"reused"};
+        EXPECT_EQ(hash, name.GetHash());
+        EXPECT_EQ(data, name.GetCStr());
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, ReleasedNames_ManyReleased_AreReclaimedInBatches)
+    {
+        const size_t nameCount = NameDictionaryTester::GetReclaimBatchSize() * NameDictionaryTester::GetShardCount() * 2;
+
+        AZStd::vector<AZ::Name> names;
+        names.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("reclaimed%zu", i));
+        }
+        EXPECT_EQ(nameCount, NameDictionaryTester::GetEntryCount());
+
+        names.clear();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+        EXPECT_LT(NameDictionaryTester::GetAllocatedEntryCount(), nameCount);
+
+        // Names can be added again after their entries were reclaimed
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            AZStd::string nameString = AZStd::string::format("reclaimed%zu", i);
+            AZ::Name name{nameString};
+            EXPECT_EQ(nameString, name.GetStringView());
+            EXPECT_EQ(name, AZ::Name{name.GetHash()});
+        }
+    }
+
+    TEST_F(NameTest, ConcurrencyDataTest_ThreadsShareAndReleaseNames_NamesStayValid)
+    {
+        constexpr size_t threadCount = 8;
+        constexpr size_t nameCount = 512;
+        constexpr size_t iterationCount = 20;
+
+        AZStd::vector<AZStd::string> nameStrings;
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            nameStrings.push_back(AZStd::string::format("shared%zu", i));
+        }
+
+        AZStd::atomic<size_t> mismatchCount{0};
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&nameStrings, &mismatchCount, threadIndex]()
+            {
+                for (size_t iteration = 0; iteration < iterationCount; ++iteration)
+                {
+                    for (size_t i = 0; i < nameCount; ++i)
+                    {
+                        const AZStd::string& nameString = nameStrings[(i + threadIndex * 7) % nameCount];
+                        AZ::Name name{nameString};
+                        AZ::Name copy = name;
+                        if (copy.GetStringView() != nameString || AZ::Name{nameString} != name)
+                        {
+                            ++mismatchCount;
+                        }
+                    }
+                }
+            });
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount);
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = AZ_TRAIT_UNIT_TEST_NAME_COUNT;
@@ -832,3 +948,113 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Shared by all threads of a benchmark run, set up and torn down by the first thread.
+    class NameBenchmarkEnvironment
+        : public UnitTest::AllocatorsBase
+    {
+    public:
+        static constexpr size_t NameCount = 1024;
+
+        void SetUpBenchmark()
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            for (size_t i = 0; i < NameCount; ++i)
+            {
+                m_nameStrings.push_back(AZStd::string::format("BenchmarkName%zu", i));
+            }
+        }
+
+        void TearDownBenchmark()
+        {
+            m_names = {};
+            m_nameStrings = {};
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        //! Keeps a reference to every name so the benchmarks measure lookups of existing names.
+        void HoldNames()
+        {
+            for (const AZStd::string& nameString : m_nameStrings)
+            {
+                m_names.emplace_back(nameString);
+            }
+        }
+
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_names;
+    };
+
+    static NameBenchmarkEnvironment s_nameBenchmarkEnvironment;
+
+    static void BM_Name_MakeExistingName(::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.SetUpBenchmark();
+            s_nameBenchmarkEnvironment.HoldNames();
+        }
+
+        size_t index = state.thread_index * 31;
+        while (state.KeepRunning())
+        {
+            AZ::Name name{s_nameBenchmarkEnvironment.m_nameStrings[index++ % NameBenchmarkEnvironment::NameCount]};
+            benchmark::DoNotOptimize(name);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_Name_MakeExistingName)->ThreadRange(1, 16);
+
+    static void BM_Name_Copy(::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.SetUpBenchmark();
+            s_nameBenchmarkEnvironment.HoldNames();
+        }
+
+        size_t index = state.thread_index * 31;
+        while (state.KeepRunning())
+        {
+            AZ::Name copy = s_nameBenchmarkEnvironment.m_names[index++ % NameBenchmarkEnvironment::NameCount];
+            benchmark::DoNotOptimize(copy);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_Name_Copy)->ThreadRange(1, 16);
+
+    // Nothing else holds the names, so every iteration releases the last reference.
+    static void BM_Name_MakeAndRelease(::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.SetUpBenchmark();
+        }
+
+        size_t index = state.thread_index * 31;
+        while (state.KeepRunning())
+        {
+            AZ::Name name{s_nameBenchmarkEnvironment.m_nameStrings[index++ % NameBenchmarkEnvironment::NameCount]};
+            benchmark::DoNotOptimize(name);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_Name_MakeAndRelease)->ThreadRange(1, 16);
+}
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <Tests/Serialization/Json/JsonSerializationTests.h>
+#include <Tests/Serialization/Json/TestCases.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace JsonSerializationTests
+{
+    //! A small set of classes that's laid out similar to a prefab with entities and components.
+    namespace StreamingPrefab
+    {
+        struct Component
+        {
+            AZ_RTTI(Component, "{0F3E56B4-8D3C-4B5A-9A27-4E1C3D9B6F01}");
+            AZ_CLASS_ALLOCATOR(Component, AZ::SystemAllocator, 0);
+
+            virtual ~Component() = default;
+
+            virtual Component* Clone() const
+            {
+                return aznew Component(*this);
+            }
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Component>()
+                    ->Field("Id", &Component::m_id);
+            }
+
+            virtual bool Equals(const Component& rhs) const
+            {
+                return azrtti_typeid(this) == azrtti_typeid(&rhs) && m_id == rhs.m_id;
+            }
+
+            AZ::u64 m_id = 0;
+        };
+
+        struct TransformComponent
+            : public Component
+        {
+            AZ_RTTI(TransformComponent, "{5B0D6E71-2C8A-4F0E-8D62-7A3E91C4B5D2}", Component);
+            AZ_CLASS_ALLOCATOR(TransformComponent, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<TransformComponent, Component>()
+                    ->Field("Translation", &TransformComponent::m_translation)
+                    ->Field("Scale", &TransformComponent::m_scale)
+                    ->Field("Parent", &TransformComponent::m_parent);
+            }
+
+            Component* Clone() const override
+            {
+                return aznew TransformComponent(*this);
+            }
+
+            bool Equals(const Component& rhs) const override
+            {
+                if (!Component::Equals(rhs))
+                {
+                    return false;
+                }
+                const auto& other = static_cast<const TransformComponent&>(rhs);
+                return m_translation == other.m_translation && m_scale == other.m_scale && m_parent == other.m_parent;
+            }
+
+            AZStd::vector<float> m_translation;
+            float m_scale = 1.0f;
+            AZ::u64 m_parent = 0;
+        };
+
+        struct TagComponent
+            : public Component
+        {
+            AZ_RTTI(TagComponent, "{C8E1A4F3-6B27-4D90-B5E3-19F2D7A06C84}", Component);
+            AZ_CLASS_ALLOCATOR(TagComponent, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<TagComponent, Component>()
+                    ->Field("Tags", &TagComponent::m_tags);
+            }
+
+            Component* Clone() const override
+            {
+                return aznew TagComponent(*this);
+            }
+
+            bool Equals(const Component& rhs) const override
+            {
+                return Component::Equals(rhs) && m_tags == static_cast<const TagComponent&>(rhs).m_tags;
+            }
+
+            AZStd::vector<AZStd::string> m_tags;
+        };
+
+        struct Entity
+        {
+            AZ_TYPE_INFO(Entity, "{7A9D2C5E-0B14-4E63-A8F7-D3C6B1E29F40}");
+            AZ_CLASS_ALLOCATOR(Entity, AZ::SystemAllocator, 0);
+
+            Entity() = default;
+            Entity(const Entity& rhs)
+            {
+                *this = rhs;
+            }
+            Entity(Entity&& rhs)
+                : m_name(AZStd::move(rhs.m_name))
+                , m_id(rhs.m_id)
+                , m_components(AZStd::move(rhs.m_components))
+                , m_properties(AZStd::move(rhs.m_properties))
+            {
+            }
+
+            Entity& operator=(const Entity& rhs)
+            {
+                if (this != &rhs)
+                {
+                    ClearComponents();
+                    m_name = rhs.m_name;
+                    m_id = rhs.m_id;
+                    m_properties = rhs.m_properties;
+                    for (const Component* component : rhs.m_components)
+                    {
+                        m_components.push_back(component ? component->Clone() : nullptr);
+                    }
+                }
+                return *this;
+            }
+
+            Entity& operator=(Entity&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    ClearComponents();
+                    m_name = AZStd::move(rhs.m_name);
+                    m_id = rhs.m_id;
+                    m_components = AZStd::move(rhs.m_components);
+                    m_properties = AZStd::move(rhs.m_properties);
+                }
+                return *this;
+            }
+
+            ~Entity()
+            {
+                ClearComponents();
+            }
+
+            void ClearComponents()
+            {
+                for (Component* component : m_components)
+                {
+                    delete component;
+                }
+                m_components.clear();
+            }
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<Entity>()
+                    ->Field("Name", &Entity::m_name)
+                    ->Field("Id", &Entity::m_id)
+                    ->Field("Components", &Entity::m_components)
+                    ->Field("Properties", &Entity::m_properties);
+            }
+
+            bool Equals(const Entity& rhs) const
+            {
+                if (m_name != rhs.m_name || m_id != rhs.m_id || m_properties != rhs.m_properties ||
+                    m_components.size() != rhs.m_components.size())
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < m_components.size(); ++i)
+                {
+                    if (!m_components[i] || !rhs.m_components[i] || !m_components[i]->Equals(*rhs.m_components[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            AZStd::string m_name;
+            AZ::u64 m_id = 0;
+            AZStd::vector<Component*> m_components;
+            AZStd::unordered_map<AZStd::string, float> m_properties;
+        };
+
+        struct Prefab
+        {
+            AZ_TYPE_INFO(Prefab, "{2E4B7D90-C1A3-4F58-9E06-B8D5F3A71C2E}");
+            AZ_CLASS_ALLOCATOR(Prefab, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                Component::Reflect(context);
+                TransformComponent::Reflect(context);
+                TagComponent::Reflect(context);
+                Entity::Reflect(context);
+                context.Class<Prefab>()
+                    ->Field("Source", &Prefab::m_source)
+                    ->Field("Entities", &Prefab::m_entities)
+                    ->Field("Layers", &Prefab::m_layers);
+            }
+
+            void Fill(size_t entityCount)
+            {
+                for (size_t i = 0; i < entityCount; ++i)
+                {
+                    Entity entity;
+                    entity.m_name = AZStd::string::format("Entity_%zu", i);
+                    entity.m_id = 0x1000 + i;
+
+                    auto transform = aznew TransformComponent();
+                    transform->m_id = i * 4;
+                    transform->m_translation = { static_cast<float>(i), static_cast<float>(i) * 0.5f, -1.0f };
+                    transform->m_scale = 1.0f + static_cast<float>(i % 7);
+                    transform->m_parent = i > 0 ? 0x1000 + (i - 1) / 2 : 0;
+                    entity.m_components.push_back(transform);
+
+                    auto tags = aznew TagComponent();
+                    tags->m_id = i * 4 + 1;
+                    tags->m_tags = { "Static", AZStd::string::format("Group_%zu", i % 16) };
+                    entity.m_components.push_back(tags);
+
+                    entity.m_properties["Health"] = 100.0f - static_cast<float>(i % 100);
+                    entity.m_properties["Speed"] = 0.25f * static_cast<float>(i % 9);
+
+                    m_entities.emplace(AZStd::string::format("Entity_[%zu]", 0x1000 + i), AZStd::move(entity));
+                }
+                m_layers = { "Default", "Gameplay" };
+                m_source = "Levels/Streaming/Streaming.prefab";
+            }
+
+            bool Equals(const Prefab& rhs) const
+            {
+                if (m_source != rhs.m_source || m_layers != rhs.m_layers || m_entities.size() != rhs.m_entities.size())
+                {
+                    return false;
+                }
+                for (const auto& [key, entity] : m_entities)
+                {
+                    auto it = rhs.m_entities.find(key);
+                    if (it == rhs.m_entities.end() || !entity.Equals(it->second))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            AZStd::string m_source;
+            AZStd::unordered_map<AZStd::string, Entity> m_entities;
+            AZStd::vector<AZStd::string> m_layers;
+        };
+    } // namespace StreamingPrefab
+
+    class JsonStreamingDeserializerTests
+        : public JsonSerializationTests
+    {
+    public:
+        struct LoadOutput
+        {
+            AZ::JsonSerializationResult::ResultCode m_result{ AZ::JsonSerializationResult::Tasks::ReadField };
+            AZStd::vector<AZStd::string> m_reports;
+        };
+
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            StreamingPrefab::Prefab::Reflect(*serializeContext);
+        }
+
+        static AZStd::string ToString(const rapidjson::Value& value)
+        {
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            value.Accept(writer);
+            return AZStd::string(buffer.GetString(), buffer.GetSize());
+        }
+
+        //! Loads json text through a document and through a stream and records the reported issues for both.
+        template<typename T>
+        void LoadBoth(AZStd::string_view json, T& documentInstance, LoadOutput& documentOutput, T& streamInstance, LoadOutput& streamOutput)
+        {
+            using namespace AZ::JsonSerializationResult;
+
+            AZ::JsonDeserializerSettings settings = *m_deserializationSettings;
+
+            LoadOutput* output = &documentOutput;
+            settings.m_reporting = [&output](AZStd::string_view message, ResultCode result, AZStd::string_view path) -> ResultCode
+            {
+                output->m_reports.push_back(AZStd::string::format("%.*s | %.*s | %s", AZ_STRING_ARG(path), AZ_STRING_ARG(message),
+                    result.ToString("").c_str()));
+                return result;
+            };
+
+            rapidjson::Document document;
+            document.Parse<rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag>(json.data(), json.size());
+            ASSERT_FALSE(document.HasParseError());
+            documentOutput.m_result = AZ::JsonSerialization::Load(documentInstance, document, settings);
+
+            output = &streamOutput;
+            AZ::IO::MemoryStream stream(json.data(), json.size());
+            streamOutput.m_result = AZ::JsonSerialization::LoadFromStream(streamInstance, stream, settings);
+        }
+
+        static void ExpectSameOutput(const LoadOutput& documentOutput, const LoadOutput& streamOutput)
+        {
+            EXPECT_STREQ(documentOutput.m_result.ToString("").c_str(), streamOutput.m_result.ToString("").c_str());
+            ASSERT_EQ(documentOutput.m_reports.size(), streamOutput.m_reports.size());
+            for (size_t i = 0; i < documentOutput.m_reports.size(); ++i)
+            {
+                EXPECT_STREQ(documentOutput.m_reports[i].c_str(), streamOutput.m_reports[i].c_str());
+            }
+        }
+    };
+
+    template<typename T>
+    class TypedJsonStreamingDeserializerTests
+        : public JsonStreamingDeserializerTests
+    {
+    public:
+        void Reflect(bool fullReflection)
+        {
+            T::Reflect(m_serializeContext, fullReflection);
+            m_fullyReflected = fullReflection;
+        }
+
+        void LoadAndCompare(AZStd::string_view json, const T& expected)
+        {
+            T documentInstance;
+            T streamInstance;
+            LoadOutput documentOutput;
+            LoadOutput streamOutput;
+            this->LoadBoth(json, documentInstance, documentOutput, streamInstance, streamOutput);
+
+            ExpectSameOutput(documentOutput, streamOutput);
+            EXPECT_TRUE(streamInstance.Equals(expected, m_fullyReflected));
+        }
+
+        bool m_fullyReflected = true;
+    };
+
+    TYPED_TEST_CASE(TypedJsonStreamingDeserializerTests, JsonSerializationTestCases);
+
+    TYPED_TEST(TypedJsonStreamingDeserializerTests, LoadFromStream_JsonWithoutDefaults_MatchesDocumentLoad)
+    {
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->LoadAndCompare(description.m_json, *description.m_instance);
+    }
+
+    TYPED_TEST(TypedJsonStreamingDeserializerTests, LoadFromStream_JsonWithSomeDefaults_MatchesDocumentLoad)
+    {
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->LoadAndCompare(description.m_jsonWithStrippedDefaults, *description.m_instance);
+    }
+
+    TYPED_TEST(TypedJsonStreamingDeserializerTests, LoadFromStream_JsonWithSomeDefaultsKept_MatchesDocumentLoad)
+    {
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->LoadAndCompare(description.m_jsonWithKeptDefaults, *description.m_instance);
+    }
+
+    TYPED_TEST(TypedJsonStreamingDeserializerTests, LoadFromStream_JsonAdditionalFields_MatchesDocumentLoad)
+    {
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_json);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kObjectType, this->m_jsonDocument->GetAllocator());
+        this->LoadAndCompare(this->ToString(*this->m_jsonDocument), *description.m_instance);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_Prefab_MatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        StreamingPrefab::Prefab source;
+        source.Fill(64);
+        ResultCode storeResult = AZ::JsonSerialization::Store(*m_jsonDocument, m_jsonDocument->GetAllocator(), source,
+            *m_serializationSettings);
+        ASSERT_NE(Processing::Halted, storeResult.GetProcessing());
+
+        StreamingPrefab::Prefab documentInstance;
+        StreamingPrefab::Prefab streamInstance;
+        LoadOutput documentOutput;
+        LoadOutput streamOutput;
+        LoadBoth(ToString(*m_jsonDocument), documentInstance, documentOutput, streamInstance, streamOutput);
+
+        ExpectSameOutput(documentOutput, streamOutput);
+        EXPECT_EQ(Outcomes::Success, streamOutput.m_result.GetOutcome());
+        EXPECT_TRUE(streamInstance.Equals(source));
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_ClearContainers_MatchesDocumentLoad)
+    {
+        m_deserializationSettings->m_clearContainers = true;
+
+        StreamingPrefab::Prefab documentInstance;
+        StreamingPrefab::Prefab streamInstance;
+        documentInstance.Fill(4);
+        streamInstance.Fill(4);
+        LoadOutput documentOutput;
+        LoadOutput streamOutput;
+        LoadBoth(R"({ "Layers": [ "Replaced" ], "Entities": { "Entity_[1]": { "Name": "Only" } } })",
+            documentInstance, documentOutput, streamInstance, streamOutput);
+
+        ExpectSameOutput(documentOutput, streamOutput);
+        EXPECT_TRUE(streamInstance.Equals(documentInstance));
+        ASSERT_EQ(1, streamInstance.m_entities.size());
+        EXPECT_STREQ("Only", streamInstance.m_entities.begin()->second.m_name.c_str());
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_ExplicitDefaultsAndEmptyContainers_MatchesDocumentLoad)
+    {
+        StreamingPrefab::Prefab documentInstance;
+        StreamingPrefab::Prefab streamInstance;
+        LoadOutput documentOutput;
+        LoadOutput streamOutput;
+        LoadBoth(R"({ "Source": {}, "Layers": [], "Entities": { "Entity_[1]": {}, "Entity_[2]": { "Properties": {} } } })",
+            documentInstance, documentOutput, streamInstance, streamOutput);
+
+        ExpectSameOutput(documentOutput, streamOutput);
+        EXPECT_TRUE(streamInstance.Equals(documentInstance));
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_UnknownFieldsAndInvalidValues_MatchesDocumentLoad)
+    {
+        StreamingPrefab::Prefab documentInstance;
+        StreamingPrefab::Prefab streamInstance;
+        LoadOutput documentOutput;
+        LoadOutput streamOutput;
+        LoadBoth(R"({
+                "Unknown": { "Nested": [ 1, { "Deeper": [] } ] },
+                "Layers": [ "Valid", 42, [ "Invalid" ], "AlsoValid" ],
+                "Entities": {
+                    "Entity_[1]": { "Name": 13, "Id": "Text", "Properties": { "Health": "High", "Speed": 2.0 } },
+                    "Entity_[2]": { "Components": [ { "$type": "TagComponent", "Tags": [ "Tag" ] }, { "$type": "Unknown" } ] }
+                },
+                "Source": "Valid/Path.prefab"
+            })", documentInstance, documentOutput, streamInstance, streamOutput);
+
+        ExpectSameOutput(documentOutput, streamOutput);
+        EXPECT_TRUE(streamInstance.Equals(documentInstance));
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_FixedCapacityContainerOverflow_MatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::fixed_vector<int, 2>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::fixed_vector<int, 2> documentInstance;
+        AZStd::fixed_vector<int, 2> streamInstance;
+        LoadOutput documentOutput;
+        LoadOutput streamOutput;
+        LoadBoth("[ 1, 2, 3, [ 4 ] ]", documentInstance, documentOutput, streamInstance, streamOutput);
+
+        ExpectSameOutput(documentOutput, streamOutput);
+        EXPECT_EQ(Outcomes::Skipped, streamOutput.m_result.GetOutcome());
+        EXPECT_EQ(documentInstance, streamInstance);
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_CommentsAndTrailingCommas_Loads)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr AZStd::string_view json = R"({
+                // Layers to load.
+                "Layers": [ "First", "Second", ],
+                /* The source file. */
+                "Source": "Path.prefab",
+            })";
+        StreamingPrefab::Prefab instance;
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        ResultCode result = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+
+        EXPECT_NE(Processing::Halted, result.GetProcessing());
+        EXPECT_EQ((AZStd::vector<AZStd::string>{ "First", "Second" }), instance.m_layers);
+        EXPECT_STREQ("Path.prefab", instance.m_source.c_str());
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_MalformedJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr AZStd::string_view json = R"({ "Layers": [ "First", "Second" ], "Entities": { "Entity_[1]": { "Name": )";
+        StreamingPrefab::Prefab instance;
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        ResultCode result = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+
+        EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
+        // Entries that were still being read are released.
+        EXPECT_TRUE(instance.m_entities.empty());
+    }
+
+    TEST_F(JsonStreamingDeserializerTests, LoadFromStream_LoadToNullPtr_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr AZStd::string_view json = "{}";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+        ResultCode result = AZ::JsonSerialization::LoadFromStream(nullptr, azrtti_typeid<StreamingPrefab::Prefab>(), stream,
+            *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
+    }
+} // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace JsonSerializationTests::StreamingPrefab;
+
+    //! Loads a generated prefab-like document with either a full document or the streaming deserializer. With the default
+    //! argument the json text is about 50 MB.
+    class JsonStreamingDeserializerBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponentDescriptor = AZ::JsonSystemComponent::CreateDescriptor();
+            m_jsonSystemComponentDescriptor->Reflect(m_serializeContext.get());
+            m_jsonSystemComponentDescriptor->Reflect(m_jsonRegistrationContext.get());
+            Prefab::Reflect(*m_serializeContext);
+
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            m_deserializerSettings.m_reporting = [](AZStd::string_view, AZ::JsonSerializationResult::ResultCode result,
+                AZStd::string_view) -> AZ::JsonSerializationResult::ResultCode
+            {
+                return result;
+            };
+
+            Prefab source;
+            source.Fill(aznumeric_cast<size_t>(state.range(0)));
+            AZ::JsonSerializerSettings serializerSettings;
+            serializerSettings.m_serializeContext = m_serializeContext.get();
+            serializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            serializerSettings.m_keepDefaults = true;
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), source, serializerSettings);
+            m_json = JsonSerializationTests::JsonStreamingDeserializerTests::ToString(document);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_json = AZStd::string();
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_jsonSystemComponentDescriptor->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            delete m_jsonSystemComponentDescriptor;
+            m_jsonSystemComponentDescriptor = nullptr;
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZ::ComponentDescriptor* m_jsonSystemComponentDescriptor = nullptr;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+        AZStd::string m_json;
+    };
+
+    BENCHMARK_DEFINE_F(JsonStreamingDeserializerBenchmarkFixture, LoadFromDocument)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Prefab loaded;
+            rapidjson::Document document;
+            document.Parse(m_json.c_str(), m_json.size());
+            AZ::JsonSerialization::Load(loaded, document, m_deserializerSettings);
+            state.counters["DocumentBytes"] = static_cast<double>(document.GetAllocator().Size());
+            benchmark::DoNotOptimize(loaded.m_entities.size());
+        }
+        state.SetBytesProcessed(state.iterations() * m_json.size());
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingDeserializerBenchmarkFixture, LoadFromDocument)
+        ->Arg(1024)->Arg(128 * 1024)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonStreamingDeserializerBenchmarkFixture, LoadFromStream)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Prefab loaded;
+            AZ::IO::MemoryStream stream(m_json.data(), m_json.size());
+            AZ::JsonSerialization::LoadFromStream(loaded, stream, m_deserializerSettings);
+            benchmark::DoNotOptimize(loaded.m_entities.size());
+        }
+        state.SetBytesProcessed(state.iterations() * m_json.size());
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingDeserializerBenchmarkFixture, LoadFromStream)
+        ->Arg(1024)->Arg(128 * 1024)->Unit(benchmark::kMillisecond);
+}
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
+namespace ObjectStreamContiguousContainerTestClasses
+{
+    struct ContiguousContainers
+    {
+        AZ_TYPE_INFO(ContiguousContainers, "{5C1D0F0E-7D35-4F43-9B9E-2E6C4E8B8A71}");
+        AZ_CLASS_ALLOCATOR(ContiguousContainers, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& serializeContext)
+        {
+            serializeContext.Class<ContiguousContainers>()
+                ->Field("floats", &ContiguousContainers::m_floats)
+                ->Field("ints", &ContiguousContainers::m_ints)
+                ->Field("doubles", &ContiguousContainers::m_doubles)
+                ->Field("positions", &ContiguousContainers::m_positions)
+                ->Field("flags", &ContiguousContainers::m_flags)
+                ->Field("indices", &ContiguousContainers::m_indices)
+                ->Field("names", &ContiguousContainers::m_names)
+                ;
+        }
+
+        void Fill(size_t numElements)
+        {
+            for (size_t i = 0; i < numElements; ++i)
+            {
+                m_floats.push_back(static_cast<float>(i) * 0.5f - 100.0f);
+                m_ints.push_back(static_cast<AZ::u32>(i * 2654435761u));
+                m_doubles.push_back(static_cast<double>(i) / 3.0);
+                m_positions.push_back(AZ::Vector3(static_cast<float>(i), -static_cast<float>(i), 0.25f));
+                m_flags.push_back(i % 3 == 0);
+            }
+            m_indices = { 3, 1, 4, 1, 5 };
+            m_names = { "first", "second" };
+        }
+
+        bool operator==(const ContiguousContainers& rhs) const
+        {
+            return m_floats == rhs.m_floats && m_ints == rhs.m_ints && m_doubles == rhs.m_doubles && m_positions == rhs.m_positions
+                && m_flags == rhs.m_flags && m_indices == rhs.m_indices && m_names == rhs.m_names;
+        }
+
+        AZStd::vector<float> m_floats;
+        AZStd::vector<AZ::u32> m_ints;
+        AZStd::vector<double> m_doubles;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<bool> m_flags;
+        AZStd::fixed_vector<AZ::u16, 8> m_indices;
+        AZStd::vector<AZStd::string> m_names;
+    };
+
+    struct IntVector
+    {
+        AZ_TYPE_INFO(IntVector, "{8E2A6C1B-3F47-4D0A-A8C5-1B7E9D3F6A20}");
+        AZ_CLASS_ALLOCATOR(IntVector, AZ::SystemAllocator, 0);
+
+        static bool ConvertAppend42(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
+        {
+            AZStd::vector<int> values;
+            AZ::SerializeContext::DataElementNode* valuesElement = classElement.FindSubElement(AZ_CRC("values"));
+            if (!valuesElement || !valuesElement->GetData(values))
+            {
+                return false;
+            }
+            values.push_back(42);
+            return valuesElement->SetData(context, values);
+        }
+
+        AZStd::vector<int> m_values;
+    };
+
+    struct SmallIntVector
+    {
+        AZ_TYPE_INFO(SmallIntVector, "{0F4B5E21-92C6-4B7D-8E13-6A9D0C2B7F54}");
+        AZ_CLASS_ALLOCATOR(SmallIntVector, AZ::SystemAllocator, 0);
+
+        AZStd::fixed_vector<int, 2> m_values;
+    };
+}
+
+namespace UnitTest
+{
+    using namespace ObjectStreamContiguousContainerTestClasses;
+
+    class ObjectStreamContiguousContainerTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            ContiguousContainers::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_serializeContext.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            AllocatorsFixture::TearDown();
+        }
+
+        template<class T>
+        AZStd::vector<char> Save(const T& object, AZ::ObjectStream::StreamType streamType = AZ::ObjectStream::ST_BINARY)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            EXPECT_TRUE(AZ::Utils::SaveObjectToStream(stream, streamType, &object, m_serializeContext.get()));
+            return buffer;
+        }
+
+        template<class T>
+        bool Load(AZStd::vector<char>& buffer, T& object)
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            return AZ::Utils::LoadObjectFromStreamInPlace(stream, object, m_serializeContext.get());
+        }
+
+        template<class T>
+        void ReflectIntVector(unsigned int version, AZ::SerializeContext::VersionConverter converter = nullptr)
+        {
+            m_serializeContext->EnableRemoveReflection();
+            m_serializeContext->Class<T>();
+            m_serializeContext->DisableRemoveReflection();
+            m_serializeContext->Class<T>()
+                ->Version(version, converter)
+                ->Field("values", &T::m_values);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+    };
+
+    TEST_F(ObjectStreamContiguousContainerTest, BinaryStream_ContiguousContainers_RoundTrip)
+    {
+        ContiguousContainers source;
+        source.Fill(1000);
+
+        AZStd::vector<char> buffer = Save(source);
+        ContiguousContainers loaded;
+        loaded.m_floats = { 1.0f, 2.0f };
+        ASSERT_TRUE(Load(buffer, loaded));
+        EXPECT_TRUE(source == loaded);
+    }
+
+    TEST_F(ObjectStreamContiguousContainerTest, BinaryStream_ContiguousContainers_StoreValuesWithoutElementHeaders)
+    {
+        constexpr size_t numElements = 1000;
+        ContiguousContainers source;
+        source.m_floats.resize(numElements);
+        source.m_positions.resize(numElements);
+
+        // The values are written back to back, per element headers would add at least 21 bytes per element
+        AZStd::vector<char> buffer = Save(source);
+        EXPECT_LT(buffer.size(), numElements * (sizeof(float) + 3 * sizeof(float)) + 1024);
+    }
+
+    TEST_F(ObjectStreamContiguousContainerTest, TextStreams_ContiguousContainers_RoundTrip)
+    {
+        ContiguousContainers source;
+        source.Fill(10);
+
+        for (AZ::ObjectStream::StreamType streamType : { AZ::ObjectStream::ST_XML, AZ::ObjectStream::ST_JSON })
+        {
+            AZStd::vector<char> buffer = Save(source, streamType);
+            ContiguousContainers loaded;
+            ASSERT_TRUE(Load(buffer, loaded));
+            EXPECT_TRUE(source == loaded);
+        }
+    }
+
+    TEST_F(ObjectStreamContiguousContainerTest, VersionConverter_ContiguousContainer_SeesAnElementPerEntry)
+    {
+        ReflectIntVector<IntVector>(1);
+        IntVector source;
+        source.m_values = { 1, 2, 3 };
+        AZStd::vector<char> buffer = Save(source);
+
+        ReflectIntVector<IntVector>(2, &IntVector::ConvertAppend42);
+        IntVector loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        EXPECT_EQ((AZStd::vector<int>{ 1, 2, 3, 42 }), loaded.m_values);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<IntVector>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(ObjectStreamContiguousContainerTest, BinaryStream_FixedVectorTooSmallForStoredElements_Fails)
+    {
+        ReflectIntVector<IntVector>(0);
+        IntVector source;
+        source.m_values = { 1, 2, 3 };
+        AZStd::vector<char> buffer = Save(source);
+
+        // Load the stream as a fixed_vector that only has room for two elements
+        auto replaceTypeId = [&buffer](const AZ::Uuid& sourceTypeId, const AZ::Uuid& targetTypeId)
+        {
+            auto typeIdPosition = AZStd::search(buffer.begin(), buffer.end(), sourceTypeId.begin(), sourceTypeId.end());
+            ASSERT_NE(buffer.end(), typeIdPosition);
+            AZStd::copy(targetTypeId.begin(), targetTypeId.end(), typeIdPosition);
+        };
+        replaceTypeId(azrtti_typeid<IntVector>(), azrtti_typeid<SmallIntVector>());
+        replaceTypeId(azrtti_typeid<AZStd::vector<int>>(), azrtti_typeid<AZStd::fixed_vector<int, 2>>());
+
+        ReflectIntVector<SmallIntVector>(0);
+        SmallIntVector loaded;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        AZ::ObjectStream::FilterDescriptor filter(nullptr, AZ::ObjectStream::FILTERFLAG_STRICT);
+        EXPECT_FALSE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get(), filter));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<IntVector>();
+        m_serializeContext->Class<SmallIntVector>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(ObjectStreamContiguousContainerTest, BinaryStreamVersion3_ElementPerEntry_Loads)
+    {
+        ReflectIntVector<IntVector>(0);
+
+        // Version 3 streams store an element with a header for every entry of a container
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        auto writeBigEndian = [&stream](auto value)
+        {
+            AZStd::endian_swap(value);
+            stream.Write(sizeof(value), &value);
+        };
+        auto writeElementHeader = [&stream, &writeBigEndian](AZ::u8 flags, AZ::u32 nameCrc, const AZ::Uuid& typeId)
+        {
+            stream.Write(sizeof(flags), &flags);
+            if (nameCrc)
+            {
+                writeBigEndian(nameCrc);
+            }
+            stream.Write(typeId.end() - typeId.begin(), typeId.begin());
+        };
+        constexpr AZ::u8 elementHeader = 1 << 3;
+        constexpr AZ::u8 hasValue = 1 << 4;
+        constexpr AZ::u8 hasName = 1 << 6;
+        constexpr AZ::u8 elementEnd = 0;
+
+        writeBigEndian(AZ::u8(0));
+        writeBigEndian(AZ::u32(3));
+        writeElementHeader(elementHeader, 0, azrtti_typeid<IntVector>());
+        writeElementHeader(elementHeader | hasName, AZ_CRC("values"), azrtti_typeid<AZStd::vector<int>>());
+        for (int value : { 7, -8, 9 })
+        {
+            writeElementHeader(elementHeader | hasName | hasValue | sizeof(int), AZ_CRC("element"), azrtti_typeid<int>());
+            writeBigEndian(value);
+            stream.Write(sizeof(elementEnd), &elementEnd);
+        }
+        stream.Write(sizeof(elementEnd), &elementEnd);
+        stream.Write(sizeof(elementEnd), &elementEnd);
+
+        IntVector loaded;
+        ASSERT_TRUE(Load(buffer, loaded));
+        EXPECT_EQ((AZStd::vector<int>{ 7, -8, 9 }), loaded.m_values);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<IntVector>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace ObjectStreamContiguousContainerTestClasses;
+
+    //! Loads generated assets with large containers of plain values from binary streams.
+    class ObjectStreamContiguousContainerBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            ContiguousContainers::Reflect(*m_serializeContext);
+
+            ContiguousContainers source;
+            source.Fill(state.range(0));
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, &source, m_serializeContext.get());
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_buffer = {};
+            m_serializeContext.reset();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(ObjectStreamContiguousContainerBenchmarkFixture, LoadBinary)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            ContiguousContainers loaded;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_buffer);
+            AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get());
+            benchmark::DoNotOptimize(loaded.m_floats.data());
+        }
+        state.SetBytesProcessed(state.iterations() * m_buffer.size());
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamContiguousContainerBenchmarkFixture, LoadBinary)->RangeMultiplier(16)->Range(16, 64 * 1024);
+}
+#endif // HAVE_BENCHMARK
@@ -6,13 +6,16 @@
  */
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -161,6 +164,29 @@ namespace SettingsRegistryTests
             return path;
         }
 
+        AZStd::string GetRegistryFolder() const
+        {
+            return AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        }
+
+        AZStd::string GetSettingsCachePath() const
+        {
+            return AZStd::string::format("%s/SettingsCache/Test.setregcache", m_testFolder->c_str());
+        }
+
+        //! Merges the test registry folder into the registry the same way the cache is created by applications and stores the cache.
+        bool MergeFolderAndStoreCache(AZ::SettingsRegistryImpl& registry, const AZ::SettingsRegistryInterface::Specializations& specializations)
+        {
+            AZ::SettingsRegistryInterface::CacheKey key = registry.CreateCacheKey(specializations, "Special");
+            registry.MergeSettingsFolder(GetRegistryFolder(), specializations, "Special");
+            return registry.StoreSettingsCache(GetSettingsCachePath(), key);
+        }
+
+        bool MergeCache(AZ::SettingsRegistryImpl& registry, const AZ::SettingsRegistryInterface::Specializations& specializations)
+        {
+            return registry.MergeSettingsCache(GetSettingsCachePath(), registry.CreateCacheKey(specializations, "Special"));
+        }
+
         void Visit(const AZStd::vector<RegistryEntry>& expected, AZStd::string_view path = "")
         {
             size_t counter = 0;
@@ -1755,4 +1781,121 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // MergeSettingsCache/StoreSettingsCache
+    //
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_UnchangedFiles_SettingsRestoredFromCache)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "Name": "Root", "Array": [ 1, -2, 3.5, null, true ] })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "Editor": { "Enabled": true } })");
+        CreateTestFile("Platform/Special/Memory.setreg", R"({ "Memory": 2, "Large": 18446744073709551615 })");
+
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, { "editor" }));
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        ASSERT_TRUE(MergeCache(cachedRegistry, { "editor" }));
+
+        AZ::SettingsRegistryMergeUtils::DumperSettings dumperSettings;
+        AZStd::string expected;
+        AZ::IO::ByteContainerStream<AZStd::string> expectedStream(&expected);
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(*m_registry, "", expectedStream, dumperSettings));
+        AZStd::string actual;
+        AZ::IO::ByteContainerStream<AZStd::string> actualStream(&actual);
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(cachedRegistry, "", actualStream, dumperSettings));
+        EXPECT_STREQ(expected.c_str(), actual.c_str());
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(cachedRegistry.Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+        AZ::u64 large = 0;
+        EXPECT_TRUE(cachedRegistry.Get(large, "/Large"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), large);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_FileRewrittenWithSameContent_SettingsRestoredFromCache)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, {}));
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        EXPECT_TRUE(MergeCache(cachedRegistry, {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_FileChanged_CacheIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, {}));
+
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1024 })");
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        EXPECT_FALSE(MergeCache(cachedRegistry, {}));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, cachedRegistry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_FileAddedToFolder_CacheIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, {}));
+
+        CreateTestFile("Platform/Special/Memory.setreg", R"({ "Memory": 1 })");
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        EXPECT_FALSE(MergeCache(cachedRegistry, {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_DifferentSpecializations_CacheIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, { "editor" }));
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        EXPECT_FALSE(MergeCache(cachedRegistry, { "game" }));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_DifferentInitialSettings_CacheIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, {}));
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        cachedRegistry.Set("/Override", true);
+        EXPECT_FALSE(MergeCache(cachedRegistry, {}));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, cachedRegistry.GetType("/Override"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_CorruptedCache_CacheIgnored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        ASSERT_TRUE(MergeFolderAndStoreCache(*m_registry, {}));
+
+        AZStd::string cachePath = GetSettingsCachePath();
+        AZ::IO::SystemFile file;
+        ASSERT_TRUE(file.Open(cachePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+        file.Seek(file.Length() - 1, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        file.Write("\xff", 1);
+        file.Close();
+
+        AZ::SettingsRegistryImpl cachedRegistry;
+        EXPECT_FALSE(MergeCache(cachedRegistry, {}));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsCache_MissingCache_ReturnsFalse)
+    {
+        EXPECT_FALSE(MergeCache(*m_registry, {}));
+    }
+
+    TEST_F(SettingsRegistryTest, StoreSettingsCache_MergeError_CacheNotStored)
+    {
+        CreateTestFile("Memory.setreg", "{ Memory: 0 }");
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(MergeFolderAndStoreCache(*m_registry, {}));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(GetSettingsCachePath().c_str()));
+    }
 } // namespace SettingsRegistryTests
@@ -26,6 +26,7 @@
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Slice/SliceMetadataInfoComponent.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Utils/Utils.h>
 
@@ -819,6 +820,73 @@ namespace UnitTest
             delete slice2Entity;
         }
     }
+
+    TEST_F(SliceTest, InstantiateInstancesWithIdenticalOverrides_EachInstanceGetsItsOwnPatchedEntities)
+    {
+        AZ::Entity* rootSliceEntity = aznew AZ::Entity();
+        AZ::SliceComponent* rootSliceComponent = rootSliceEntity->CreateComponent<AZ::SliceComponent>();
+        rootSliceComponent->SetSerializeContext(m_serializeContext);
+        rootSliceEntity->Init();
+        rootSliceEntity->Activate();
+
+        AZ::Entity* entityInRootSlice = aznew AZ::Entity();
+        entityInRootSlice->CreateComponent<MyTestComponent1>();
+        rootSliceComponent->AddEntity(entityInRootSlice);
+
+        AZ::Data::Asset<AZ::SliceAsset> rootSliceAssetRef = AZ::Data::AssetManager::Instance().CreateAsset<AZ::SliceAsset>(m_catalog->GenerateMockAssetId(), AZ::Data::AssetLoadBehavior::Default);
+        rootSliceAssetRef.Get()->SetData(rootSliceEntity, rootSliceComponent);
+
+        // Create a slice with three instances of the root slice, two of which share the same override.
+        constexpr int overrides[] = { 43, 7, 43 };
+        AZStd::vector<AZ::u8> sliceBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> sliceStream(&sliceBuffer);
+        {
+            AZ::Entity* sliceEntity = aznew AZ::Entity();
+            AZ::SliceComponent* sliceComponent = sliceEntity->CreateComponent<AZ::SliceComponent>();
+            sliceComponent->SetSerializeContext(m_serializeContext);
+
+            AZ::SliceComponent::SliceInstanceAddress addresses[AZ_ARRAY_SIZE(overrides)];
+            for (AZ::SliceComponent::SliceInstanceAddress& address : addresses)
+            {
+                address = sliceComponent->AddSlice(rootSliceAssetRef);
+            }
+
+            AZ::SliceComponent::EntityList entitiesInSlice;
+            sliceComponent->GetEntities(entitiesInSlice);
+            for (size_t i = 0; i < AZ_ARRAY_SIZE(overrides); ++i)
+            {
+                addresses[i].GetInstance()->GetInstantiated()->m_entities[0]->FindComponent<MyTestComponent1>()->m_int = overrides[i];
+            }
+
+            EXPECT_TRUE(AZ::Utils::SaveObjectToStream(sliceStream, AZ::ObjectStream::ST_BINARY, sliceEntity, m_serializeContext));
+            delete sliceEntity;
+        }
+
+        sliceStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        AZ::Entity* sliceEntity = AZ::Utils::LoadObjectFromStream<AZ::Entity>(sliceStream, m_serializeContext);
+        ASSERT_NE(nullptr, sliceEntity);
+        AZ::SliceComponent* sliceComponent = sliceEntity->FindComponent<AZ::SliceComponent>();
+        sliceComponent->SetSerializeContext(m_serializeContext);
+        AZ::SliceComponent::EntityList entitiesInSlice;
+        sliceComponent->GetEntities(entitiesInSlice);
+        ASSERT_EQ(AZ_ARRAY_SIZE(overrides), entitiesInSlice.size());
+
+        int overrideCounts[2] = { 0, 0 };
+        AZStd::unordered_set<AZ::EntityId> entityIds;
+        for (AZ::Entity* entity : entitiesInSlice)
+        {
+            const int value = entity->FindComponent<MyTestComponent1>()->m_int;
+            overrideCounts[0] += value == 43 ? 1 : 0;
+            overrideCounts[1] += value == 7 ? 1 : 0;
+            entityIds.insert(entity->GetId());
+        }
+        EXPECT_EQ(2, overrideCounts[0]);
+        EXPECT_EQ(1, overrideCounts[1]);
+        // Instances that share a patched result still need unique entity ids.
+        EXPECT_EQ(AZ_ARRAY_SIZE(overrides), entityIds.size());
+
+        delete sliceEntity;
+    }
 }
 
 #ifdef HAVE_BENCHMARK
@@ -891,5 +959,132 @@ namespace Benchmark
 
     BENCHMARK(BM_Slice_GenerateNewIdsAndFixRefs)->Arg(10)->Arg(1000);
 
+    //! Instantiates a slice holding many instances of a medium sized slice. Range 0 is the number of instances and range 1 the
+    //! number of different sets of overrides the instances are spread over. With as many sets as instances every patch is unique.
+    class SliceInstantiateBenchmarkFixture
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int EntitiesInSlice = 25;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = aznew AZ::SerializeContext(true, true);
+            m_sliceDescriptor = AZ::SliceComponent::CreateDescriptor();
+            m_sliceDescriptor->Reflect(m_serializeContext);
+            UnitTest::MyTestComponent1::Reflect(m_serializeContext);
+            UnitTest::MyTestComponent2::Reflect(m_serializeContext);
+            AZ::SliceMetadataInfoComponent::Reflect(m_serializeContext);
+            AZ::Entity::Reflect(m_serializeContext);
+            AZ::DataPatch::Reflect(m_serializeContext);
+
+            AZ::Data::AssetManager::Descriptor desc;
+            AZ::Data::AssetManager::Create(desc);
+            AZ::Data::AssetManager::Instance().RegisterHandler(aznew AZ::SliceAssetHandler(m_serializeContext), AZ::AzTypeInfo<AZ::SliceAsset>::Uuid());
+            m_catalog.reset(aznew UnitTest::SliceTest_MockCatalog());
+            AZ::Data::AssetManager::Instance().RegisterCatalog(m_catalog.get(), AZ::AzTypeInfo<AZ::SliceAsset>::Uuid());
+
+            CreateSlice(state.range(0), state.range(1));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_sliceBuffer = {};
+            m_sliceAsset.Release();
+            m_catalog->DisableCatalog();
+            m_catalog.reset();
+            AZ::Data::AssetManager::Destroy();
+            delete m_sliceDescriptor;
+            delete m_serializeContext;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void CreateSlice(int64_t instanceCount, int64_t overrideVariants)
+        {
+            AZ::Entity* assetEntity = aznew AZ::Entity();
+            AZ::SliceComponent* assetComponent = assetEntity->CreateComponent<AZ::SliceComponent>();
+            assetComponent->SetSerializeContext(m_serializeContext);
+            assetEntity->Init();
+            assetEntity->Activate();
+
+            AZ::EntityId previousEntityId;
+            for (int entityIndex = 0; entityIndex < EntitiesInSlice; ++entityIndex)
+            {
+                AZ::Entity* entity = aznew AZ::Entity();
+                entity->CreateComponent<UnitTest::MyTestComponent1>();
+                entity->CreateComponent<UnitTest::MyTestComponent1>();
+                entity->CreateComponent<UnitTest::MyTestComponent2>()->m_entityId = previousEntityId;
+                previousEntityId = entity->GetId();
+                assetComponent->AddEntity(entity);
+            }
+
+            m_sliceAsset = AZ::Data::AssetManager::Instance().CreateAsset<AZ::SliceAsset>(m_catalog->GenerateMockAssetId(), AZ::Data::AssetLoadBehavior::Default);
+            m_sliceAsset.Get()->SetData(assetEntity, assetComponent);
+
+            AZ::Entity* sliceEntity = aznew AZ::Entity();
+            AZ::SliceComponent* sliceComponent = sliceEntity->CreateComponent<AZ::SliceComponent>();
+            sliceComponent->SetSerializeContext(m_serializeContext);
+            for (int64_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+            {
+                sliceComponent->AddSlice(m_sliceAsset);
+            }
+
+            AZ::SliceComponent::EntityList entities;
+            sliceComponent->GetEntities(entities);
+            int64_t instanceIndex = 0;
+            for (const AZ::SliceComponent::SliceInstance& instance : sliceComponent->GetSlices().front().GetInstances())
+            {
+                const int variant = aznumeric_cast<int>(instanceIndex++ % overrideVariants);
+                for (AZ::Entity* entity : instance.GetInstantiated()->m_entities)
+                {
+                    UnitTest::MyTestComponent1* component = entity->FindComponent<UnitTest::MyTestComponent1>();
+                    component->m_int = variant + 1;
+                    component->m_float = static_cast<float>(variant) * 0.5f;
+                }
+            }
+
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_sliceBuffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, sliceEntity, m_serializeContext);
+            delete sliceEntity;
+        }
+
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        AZ::ComponentDescriptor* m_sliceDescriptor{ nullptr };
+        AZStd::unique_ptr<UnitTest::SliceTest_MockCatalog> m_catalog;
+        AZ::Data::Asset<AZ::SliceAsset> m_sliceAsset;
+        AZStd::vector<char> m_sliceBuffer;
+    };
+
+    BENCHMARK_DEFINE_F(SliceInstantiateBenchmarkFixture, InstantiatePatchedInstances)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_sliceBuffer);
+            AZ::Entity* sliceEntity = AZ::Utils::LoadObjectFromStream<AZ::Entity>(stream, m_serializeContext);
+            AZ::SliceComponent* sliceComponent = sliceEntity->FindComponent<AZ::SliceComponent>();
+            sliceComponent->SetSerializeContext(m_serializeContext);
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(sliceComponent->Instantiate());
+
+            state.PauseTiming();
+            delete sliceEntity;
+            state.ResumeTiming();
+        }
+    }
+    BENCHMARK_REGISTER_F(SliceInstantiateBenchmarkFixture, InstantiatePatchedInstances)
+        ->Args({ 1000, 4 })
+        ->Args({ 1000, 1000 })
+        ->Unit(benchmark::kMillisecond);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
@@ -93,13 +93,13 @@ namespace AZ::IO
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, u32 maxNumBlockJobs = 0)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, maxNumBlockJobs);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -185,6 +185,17 @@ namespace AZ::IO
             return false;
         }
 
+        static bool BlockSplitter(u64 blockSize, size_t compressedSize, AZStd::vector<CompressionBlock>& blocks)
+        {
+            // The fake compression is a copy, so compressed and uncompressed blocks line up.
+            for (size_t offset = 0; offset < compressedSize; offset += blockSize)
+            {
+                size_t size = AZStd::min(aznumeric_cast<size_t>(blockSize), compressedSize - offset);
+                blocks.push_back(CompressionBlock{ offset, size, offset, size });
+            }
+            return true;
+        }
+
         void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
         {
             CompressionInfo compressionInfo;
@@ -205,6 +216,14 @@ namespace AZ::IO
                         compressed, compressedSize, uncompressed, uncompressedBufferSize);
                 };
             }
+            if (m_blockSize > 0)
+            {
+                compressionInfo.m_blockSplitter = [blockSize = m_blockSize](const CompressionInfo&, const void*,
+                    size_t compressedSize, AZStd::vector<CompressionBlock>& blocks) -> bool
+                {
+                    return Streamer_FullDecompressorTest::BlockSplitter(blockSize, compressedSize, blocks);
+                };
+            }
 
             FileRequest* request = m_context->GetNewInternalRequest();
             request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
@@ -315,6 +334,7 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_blockSize{ 0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -393,4 +413,30 @@ namespace AZ::IO
         SetupEnvironment(4, 4);
         ProcessMultipleCompressedReads();
     }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadWithBlocks_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4);
+        m_blockSize = 64 * 1024;
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadWithBlocks_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 1, 4);
+        m_blockSize = 64 * 1024;
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(100 * 1024 + 256, 300 * 1024, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(100 * 1024 + 256, 300 * 1024);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_CorruptedReadWithBlocks_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 1, 4);
+        m_blockSize = 64 * 1024;
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed);
+    }
 } // namespace AZ::IO
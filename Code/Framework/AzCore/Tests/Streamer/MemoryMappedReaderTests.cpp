@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/FullFileDecompressor.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class MemoryMappedReaderTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<MemoryMappedReader>
+    {
+    public:
+        MemoryMappedReader CreateInstance() override
+        {
+            return MemoryMappedReader({ ".pak" }, 4, 2, AZStd::chrono::milliseconds(100));
+        }
+
+        void SetUp() override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_MemoryMappedReaderConformityTests, StreamStackEntryConformityTests, MemoryMappedReaderTestDescription);
+
+    class Streamer_MemoryMappedReaderTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        static constexpr u64 FakeFileLength = 64 * 1024;
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            m_context = new StreamerContext();
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_reader = AZStd::make_shared<MemoryMappedReader>(
+                AZStd::vector<AZStd::string>{ ".pak" }, 2, 2, AZStd::chrono::milliseconds(100));
+            m_reader->SetContext(*m_context);
+            m_reader->SetNext(m_mock);
+
+            m_archivePath.InitFromAbsolutePath(CreateFakeFile("Archive.pak"));
+            m_loosePath.InitFromAbsolutePath(CreateFakeFile("Loose.bin"));
+        }
+
+        void TearDown() override
+        {
+            m_reader.reset();
+            m_mock.reset();
+
+            delete m_context;
+            m_context = nullptr;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        AZStd::string CreateFakeFile(const char* fileName)
+        {
+            AZStd::string path = m_tempDirectory.Resolve(fileName);
+
+            AZStd::unique_ptr<u32[]> data(new u32[FakeFileLength >> 2]);
+            for (u64 i = 0; i < (FakeFileLength >> 2); ++i)
+            {
+                data[i] = aznumeric_caster(i << 2);
+            }
+
+            SystemFile file;
+            file.Open(path.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY);
+            file.Write(data.get(), FakeFileLength);
+            file.Close();
+            return path;
+        }
+
+        void ProcessUntilIdle(StreamStackEntry& stack, FileRequest* request)
+        {
+            stack.QueueRequest(request);
+            bool hasCompleted = false;
+            while (stack.ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                stack.UpdateStatus(status);
+                hasCompleted = status.m_isIdle;
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+        void ProcessUntilIdle(FileRequest* request)
+        {
+            ProcessUntilIdle(*m_reader, request);
+        }
+
+        static void VerifyBuffer(const u32* buffer, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < (size >> 2); ++i)
+            {
+                ASSERT_EQ(buffer[i], aznumeric_cast<u32>(offset + (i << 2)));
+            }
+        }
+
+        static bool Decompressor(const CompressionInfo&, const void* compressed, size_t compressedSize, void* uncompressed,
+            [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            AZ_Assert(compressedSize == uncompressedBufferSize, "Fake decompression algorithm only supports copying data.");
+            memcpy(uncompressed, compressed, compressedSize);
+            return true;
+        }
+
+    protected:
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        RequestPath m_archivePath;
+        RequestPath m_loosePath;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<MemoryMappedReader> m_reader;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_MemoryMappedReaderTest, ReadData_ReadFromArchive_DataIsCopiedFromMapping)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        constexpr u64 offset = 1024;
+        constexpr u64 size = 4096;
+        AZStd::unique_ptr<u32[]> buffer(new u32[size >> 2]);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), size, m_archivePath, offset, size);
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+
+        ProcessUntilIdle(request);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        VerifyBuffer(buffer.get(), offset, size);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, ReadData_ReadFromNonArchive_RequestIsForwarded)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        u32 buffer[64];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), m_loosePath, 0, sizeof(buffer));
+        m_reader->QueueRequest(request);
+
+        m_context->RecycleRequest(request);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, ReadData_ReadOutsideOfArchive_RequestIsForwarded)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        u32 buffer[64];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), m_archivePath, FakeFileLength, sizeof(buffer));
+        m_reader->QueueRequest(request);
+
+        m_context->RecycleRequest(request);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, CompressedReadData_StoredEntry_DataIsCopiedFromMapping)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        constexpr u64 entryOffset = 2048;
+        constexpr u64 entrySize = 8192;
+        constexpr u64 readOffset = 512;
+        constexpr u64 readSize = 1024;
+
+        CompressionInfo compressionInfo;
+        compressionInfo.m_archiveFilename = m_archivePath;
+        compressionInfo.m_compressedSize = entrySize;
+        compressionInfo.m_uncompressedSize = entrySize;
+        compressionInfo.m_offset = entryOffset;
+        compressionInfo.m_isCompressed = false;
+
+        AZStd::unique_ptr<u32[]> buffer(new u32[readSize >> 2]);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), buffer.get(), readOffset, readSize);
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+
+        ProcessUntilIdle(request);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        VerifyBuffer(buffer.get(), entryOffset + readOffset, readSize);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, CompressedReadData_CompressedEntry_DataIsDecompressedFromMapping)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        constexpr u64 entryOffset = 4096;
+        constexpr u64 entrySize = 16384;
+
+        CompressionInfo compressionInfo;
+        compressionInfo.m_archiveFilename = m_archivePath;
+        compressionInfo.m_compressedSize = entrySize;
+        compressionInfo.m_uncompressedSize = entrySize;
+        compressionInfo.m_offset = entryOffset;
+        compressionInfo.m_isCompressed = true;
+        compressionInfo.m_decompressor = &Streamer_MemoryMappedReaderTest::Decompressor;
+
+        AZStd::unique_ptr<u32[]> buffer(new u32[entrySize >> 2]);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), buffer.get(), 0, entrySize);
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+
+        ProcessUntilIdle(request);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        VerifyBuffer(buffer.get(), entryOffset, entrySize);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, CompressedReadData_BlockSplitEntryThroughConfiguredStack_OverlappingBlocksAreDecompressed)
+    {
+        using ::testing::_;
+        using ::testing::AnyNumber;
+
+        // Nothing should reach the file reads at the bottom of the stack.
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber());
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+        // Build the top of the stack the same way StreamerComponent does with the entries from streamer.game.setreg.
+        AZStd::vector<AZStd::shared_ptr<IStreamerStackConfig>> stackConfig;
+        stackConfig.push_back(AZStd::make_shared<FullFileDecompressorConfig>());
+        stackConfig.push_back(AZStd::make_shared<MemoryMappedReaderConfig>());
+        HardwareInformation hardware;
+        AZStd::shared_ptr<StreamStackEntry> stack = m_mock;
+        for (AZStd::shared_ptr<IStreamerStackConfig>& entryConfig : stackConfig)
+        {
+            stack = entryConfig->AddStreamStackEntry(hardware, AZStd::move(stack));
+        }
+        stack->SetContext(*m_context);
+
+        constexpr u64 entryOffset = 4096;
+        constexpr u64 entrySize = 32768;
+        constexpr u64 blockSize = 4096;
+        constexpr u64 readOffset = 6144;
+        constexpr u64 readSize = 16384;
+
+        AZStd::atomic<u32> numDecompressions{ 0 };
+        AZStd::atomic<u32> numFullDecompressions{ 0 };
+        CompressionInfo compressionInfo;
+        compressionInfo.m_archiveFilename = m_archivePath;
+        compressionInfo.m_compressedSize = entrySize;
+        compressionInfo.m_uncompressedSize = entrySize;
+        compressionInfo.m_offset = entryOffset;
+        compressionInfo.m_isCompressed = true;
+        compressionInfo.m_decompressor = [&numDecompressions, &numFullDecompressions](const CompressionInfo& info,
+            const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize) -> bool
+        {
+            ++numDecompressions;
+            if (compressedSize == entrySize)
+            {
+                ++numFullDecompressions;
+            }
+            return Streamer_MemoryMappedReaderTest::Decompressor(info, compressed, compressedSize, uncompressed, uncompressedBufferSize);
+        };
+        compressionInfo.m_blockSplitter = [](const CompressionInfo&, const void*, size_t compressedSize,
+            AZStd::vector<CompressionBlock>& blocks) -> bool
+        {
+            // The fake compression is a copy, so compressed and uncompressed blocks line up.
+            for (size_t offset = 0; offset < compressedSize; offset += blockSize)
+            {
+                blocks.push_back(CompressionBlock{ offset, blockSize, offset, blockSize });
+            }
+            return true;
+        };
+
+        AZStd::unique_ptr<u32[]> buffer(new u32[readSize >> 2]);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), buffer.get(), readOffset, readSize);
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+
+        ProcessUntilIdle(*stack, request);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        VerifyBuffer(buffer.get(), entryOffset + readOffset, readSize);
+        // The read covers part of the 2nd block up to part of the 6th block.
+        EXPECT_EQ(5u, numDecompressions.load());
+        EXPECT_EQ(0u, numFullDecompressions.load());
+    }
+} // namespace AZ::IO
@@ -24,6 +24,7 @@ set(FILES
     BehaviorContext.cpp
     BehaviorContextFixture.h
     Components.cpp
+    Console/AsyncLogSinkTests.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Debug.cpp
@@ -69,6 +70,7 @@ set(FILES
     UUIDTests.cpp
     XML.cpp
     Debug/AssetTracking.cpp
+    Debug/EventTraceRecorderTests.cpp
     Debug/LocalFileEventLoggerTests.cpp
     Debug/Trace.cpp
     Name/NameJsonSerializerTests.cpp
@@ -84,6 +86,7 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/MemoryMappedReaderTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
@@ -103,6 +106,7 @@ set(FILES
     Serialization/Json/JsonSerializationResultTests.cpp
     Serialization/Json/JsonSerializationTests.h
     Serialization/Json/JsonSerializationTests.cpp
+    Serialization/Json/JsonStreamingDeserializerTests.cpp
     Serialization/Json/JsonSerializerConformityTests.h
     Serialization/Json/JsonSerializerMock.h
     Serialization/Json/MapSerializerTests.cpp
@@ -126,7 +130,10 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/ObjectStreamContiguousContainerTests.cpp
     Math/AabbTests.cpp
+    Math/BatchMathPerformanceTests.cpp
+    Math/BatchMathTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
     Math/CrcTestsCompileTimeLiterals.h
@@ -165,6 +172,7 @@ set(FILES
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
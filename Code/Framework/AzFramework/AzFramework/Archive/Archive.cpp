@@ -54,6 +54,9 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, sys_PakMemoryMapped, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, read-only archives on disk are memory mapped and file data is read directly from the mapping.\n"
+        "Only affects archives that are opened after the value is changed.");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -146,7 +149,7 @@ namespace AZ::IO::ArchiveInternal
         int FSeek(uint64_t nOffset, int nMode);
         size_t FRead(void* pDest, size_t nSize, size_t nCount, AZ::IO::HandleType fileHandle);
         size_t FReadAll(void* pDest, size_t nFileSize, AZ::IO::HandleType fileHandle);
-        void* GetFileData(size_t& nFileSize, AZ::IO::HandleType fileHandle);
+        const void* GetFileData(size_t& nFileSize, AZ::IO::HandleType fileHandle);
         int FEof();
         char* FGets(char* pBuf, int n);
         int Getc();
@@ -268,7 +271,7 @@ namespace AZ::IO::ArchiveInternal
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void* ArchiveInternal::CZipPseudoFile::GetFileData(size_t& nFileSize, [[maybe_unused]] AZ::IO::HandleType fileHandle)
+    const void* ArchiveInternal::CZipPseudoFile::GetFileData(size_t& nFileSize, [[maybe_unused]] AZ::IO::HandleType fileHandle)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
@@ -279,7 +282,7 @@ namespace AZ::IO::ArchiveInternal
 
         nFileSize = GetFileSize();
 
-        void* pData = GetFile()->GetData();
+        const void* pData = GetFile()->GetData();
         m_nCurSeek = nFileSize;
         return pData;
     }
@@ -297,7 +300,7 @@ namespace AZ::IO::ArchiveInternal
             return nullptr;
         }
 
-        char* pData = (char*)GetFile()->GetData();
+        const char* pData = reinterpret_cast<const char*>(GetFile()->GetData());
         if (!pData)
         {
             return nullptr;
@@ -340,7 +343,7 @@ namespace AZ::IO::ArchiveInternal
         {
             return EOF;
         }
-        char* pData = (char*)GetFile()->GetData();
+        const char* pData = reinterpret_cast<const char*>(GetFile()->GetData());
         if (!pData)
         {
             return EOF;
@@ -1127,7 +1130,7 @@ namespace AZ::IO
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void* Archive::FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
+    const void* Archive::FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
@@ -1166,7 +1169,7 @@ namespace AZ::IO
         }
 
         // Add to the cache
-        void* pCachedData = nullptr;
+        const void* pCachedData = nullptr;
         {
             RawDataCacheLockGuard lock(m_cachedFileRawDataMutex);
 
@@ -1767,6 +1770,7 @@ namespace AZ::IO
     {
         m_nArchiveFlags = nArchiveFlags;
         m_pFileData = nullptr;
+        m_bFileDataIsView = false;
         m_pZip = pZip;
         m_pFileEntry = pFileEntry;
     }
@@ -1774,9 +1778,10 @@ namespace AZ::IO
     CCachedFileData::~CCachedFileData()
     {
         // forced destruction
-        if (m_pFileData)
+        if (m_pFileData && !m_bFileDataIsView)
         {
-            AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(m_pFileData);
+            // owned data is allocated by GetData, only views into the mapping are really read-only
+            AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(const_cast<void*>(m_pFileData));
             m_pFileData = nullptr;
         }
 
@@ -1822,7 +1827,7 @@ namespace AZ::IO
     }
 
     // return the data in the file, or nullptr if error
-    void* CCachedFileData::GetData(bool bRefreshCache, bool decompress)
+    const void* CCachedFileData::GetData(bool bRefreshCache, bool decompress)
     {
         // first, do a "dirty" fast check without locking the critical section
         // in most cases, the data's going to be already there, and if it's there,
@@ -1839,6 +1844,17 @@ namespace AZ::IO
                 // don't try to decompress if its not actually compressed
                 decompress = decompress && m_pFileEntry->IsCompressed();
 
+                // if the archive is memory mapped, data that doesn't need to be decompressed can be used in place
+                if (!decompress || !m_pFileEntry->IsCompressed())
+                {
+                    if (const void* view = m_pZip->GetFileDataView(m_pFileEntry))
+                    {
+                        m_bFileDataIsView = true;
+                        m_pFileData = view;
+                        return m_pFileData;
+                    }
+                }
+
                 // if we are going to decompress into the buffer, we MUST allocate enough for it!
                 // if we are either requesting decompressed data, or we are already decompressed, then we will need enough room for the
                 // decompressed data
@@ -1887,6 +1903,13 @@ namespace AZ::IO
 
         if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
+            if (const uint8_t* pView = reinterpret_cast<const uint8_t*>(m_pZip->GetFileDataView(m_pFileEntry)))
+            {
+                // Memory mapped archive, so only the requested range needs to be copied.
+                memcpy(pBuffer, pView + nFileOffset, aznumeric_cast<size_t>(nReadSize));
+                return nReadSize;
+            }
+
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             // Uncompressed read.
             if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, nullptr, pBuffer))
@@ -1896,7 +1919,7 @@ namespace AZ::IO
         }
         else
         {
-            uint8_t* pSrcBuffer = (uint8_t*)GetData();
+            const uint8_t* pSrcBuffer = reinterpret_cast<const uint8_t*>(GetData());
 
             if (pSrcBuffer)
             {
@@ -2026,6 +2049,12 @@ namespace AZ::IO
             return nullptr;
         }
 
+        if (pakOnDisk && sys_PakMemoryMapped && (nFactoryFlags & ZipDir::CacheFactory::FLAGS_READ_ONLY)
+            && !(nFactoryFlags & (ZipDir::CacheFactory::FLAGS_IN_MEMORY | ZipDir::CacheFactory::FLAGS_IN_MEMORY_CPU)))
+        {
+            nFactoryFlags |= ZipDir::CacheFactory::FLAGS_MEMORY_MAPPED;
+        }
+
         ZipDir::CacheFactory factory(ZipDir::ZD_INIT_FAST, nFactoryFlags);
 
         ZipDir::CachePtr cache = factory.New(szFullPath->c_str());
@@ -2549,6 +2578,11 @@ namespace AZ::IO
                     size_t nSizeUncompressed = uncompressedBufferSize;
                     return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
                 };
+                info.m_blockSplitter = []([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize,
+                    AZStd::vector<AZ::IO::CompressionBlock>& blocks)->bool
+                {
+                    return ZipDir::ZipRawSplitBlocks(compressed, compressedSize, blocks);
+                };
             }
         }
     }
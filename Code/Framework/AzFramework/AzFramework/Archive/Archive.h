@@ -54,7 +54,8 @@ namespace AZ::IO
         // the cache is refreshed. Otherwise, it returns whatever cache is (nullptr if the data isn't cached yet)
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
-        void* GetData(bool bRefreshCache = true, bool decompress = true);
+        // the data is read-only, it may point into a memory mapped archive.
+        const void* GetData(bool bRefreshCache = true, bool decompress = true);
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
 
@@ -66,7 +67,9 @@ namespace AZ::IO
 
         uint32_t GetFileDataOffset();
 
-        void* m_pFileData;
+        const void* m_pFileData;
+        // true if m_pFileData points into a memory mapped archive instead of memory owned by this object
+        bool m_bFileDataIsView;
 
         // the zip file in which this file is opened
         ZipDir::CachePtr m_pZip;
@@ -223,7 +226,7 @@ namespace AZ::IO
         AZ::IO::HandleType FOpen(AZStd::string_view pName, const char* mode, uint32_t nPathFlags = 0) override;
         size_t FReadRaw(void* data, size_t length, size_t elems, AZ::IO::HandleType handle) override;
         size_t FReadRawAll(void* data, size_t nFileSize, AZ::IO::HandleType handle) override;
-        void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
+        const void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
         size_t FWrite(const void* data, size_t length, size_t elems, AZ::IO::HandleType handle) override;
         size_t FSeek(AZ::IO::HandleType handle, uint64_t seek, int mode) override;
         uint64_t FTell(AZ::IO::HandleType handle) override;
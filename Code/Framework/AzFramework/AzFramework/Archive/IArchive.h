@@ -284,7 +284,8 @@ namespace AZ::IO
 
         // Get pointer to the internally cached, loaded data of the file.
         // WARNING! The returned pointer is only valid while the fileHandle has not been closed.
-        virtual void* FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize) = 0;
+        // The data is read-only, files in memory mapped archives are returned in place.
+        virtual const void* FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize) = 0;
 
         // Write file data, cannot be used for writing into the Archive.
         // Use INestedArchive interface for writing into the archivefiles.
@@ -180,6 +180,7 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_mappedFile.Close();
         m_allocator = nullptr;
         m_treeDir.Clear();
     }
@@ -244,7 +245,7 @@ namespace AZ::IO::ZipDir
         case CompressionCodec::Codec::ZLIB:
             return (uncompressedSize + (uncompressedSize >> 3) + 32);
         case CompressionCodec::Codec::ZSTD:
-            return ZSTD_compressBound(uncompressedSize);
+            return ZipRawCompressZSTDBound(uncompressedSize);
         case CompressionCodec::Codec::LZ4:
             return LZ4F_compressFrameBound(uncompressedSize, nullptr);
         default:
@@ -281,7 +282,7 @@ namespace AZ::IO::ZipDir
             switch (codec)
             {
             case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel, m_compressionDictionary.get());
                 break;
 
             case CompressionCodec::Codec::ZLIB:
@@ -711,6 +712,31 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
+        if (const void* pView = GetFileDataView(pFileEntry))
+        {
+            // Memory mapped archive, so copy or decompress straight from the mapped pages without an intermediate buffer.
+            if (pCompressed)
+            {
+                memcpy(pCompressed, pView, pFileEntry->desc.lSizeCompressed);
+            }
+            if (pUncompressed)
+            {
+                if (pFileEntry->nMethod == 0)
+                {
+                    memcpy(pUncompressed, pView, pFileEntry->desc.lSizeUncompressed);
+                }
+                else
+                {
+                    size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
+                    if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pView, pFileEntry->desc.lSizeCompressed))
+                    {
+                        return ZD_ERROR_CORRUPTED_DATA;
+                    }
+                }
+            }
+            return (pCompressed || pUncompressed) ? ZD_ERROR_SUCCESS : ZD_ERROR_INVALID_CALL;
+        }
+
         if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
         {
             return ZD_ERROR_IO_FAILED;
@@ -764,6 +790,27 @@ namespace AZ::IO::ZipDir
     }
 
 
+    const void* Cache::GetFileDataView(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry || !m_mappedFile.IsOpen())
+        {
+            return nullptr;
+        }
+
+        if (Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return nullptr;
+        }
+
+        if (!m_mappedFile.Contains(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeCompressed))
+        {
+            AZ_Warning("Archive", false, "File entry data at offset %" PRIu32 " is outside of the memory mapped archive %s",
+                pFileEntry->nFileDataOffset, GetFilePath());
+            return nullptr;
+        }
+        return m_mappedFile.GetData() + pFileEntry->nFileDataOffset;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // finds the file by exact path
     FileEntry* Cache::FindFile(AZStd::string_view szPathSrc, [[maybe_unused]] bool bFullInfo)
@@ -14,7 +14,9 @@
 //
 #pragma once
 
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
@@ -64,6 +66,13 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum UpdateFileCRC(AZStd::string_view szRelativePath, AZ::Crc32 dwCRC32);
 
+        // sets the dictionary that's used to compress files that are added with the zstd codec. The dictionary needs to be
+        // registered with AZ::ZStdDictionary::Register before the files can be read back.
+        void SetCompressionDictionary(AZStd::shared_ptr<const AZ::ZStdDictionary> dictionary)
+        {
+            m_compressionDictionary = AZStd::move(dictionary);
+        }
+
         // deletes the file from the archive
         ErrorEnum RemoveFile(AZStd::string_view szRelativePath);
 
@@ -80,6 +89,15 @@ namespace AZ::IO::ZipDir
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
+        // returns a pointer to the raw (possibly compressed) data of the file entry inside the memory mapped archive,
+        // or nullptr if the archive isn't memory mapped. The pointer stays valid as long as this cache is open.
+        const void* GetFileDataView(FileEntry* pFileEntry);
+
+        bool IsMemoryMapped() const
+        {
+            return m_mappedFile.IsOpen();
+        }
+
         void Free(void* ptr)
         {
             m_allocator->DeAllocate(ptr);
@@ -136,6 +154,12 @@ namespace AZ::IO::ZipDir
         AZ::IAllocatorAllocate* m_allocator;
         AZStd::string m_strFilePath;
 
+        // read-only view of the entire archive, only open if the cache was created with CacheFactory::FLAGS_MEMORY_MAPPED
+        AZ::IO::MemoryMappedFile m_mappedFile;
+
+        // optional dictionary used when adding files with the zstd codec
+        AZStd::shared_ptr<const AZ::ZStdDictionary> m_compressionDictionary;
+
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZStd::string> m_relativePathPool;
 
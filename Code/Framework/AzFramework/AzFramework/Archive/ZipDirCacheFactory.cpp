@@ -95,6 +95,17 @@ namespace AZ::IO::ZipDir
                 THROW_ZIPDIR_ERROR(ZD_ERROR_IO_FAILED, "Could not read the CDR of the pack file.");
                 return {};
             }
+
+            if ((m_nFlags & FLAGS_MEMORY_MAPPED) && !(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                // The mapping is optional, if it can't be created the cache falls back to reading through the file handle.
+                AZ::IO::FixedMaxPath resolvedPath;
+                if (!AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(resolvedPath, szFileName) ||
+                    !pCache->m_mappedFile.Open(resolvedPath.c_str()))
+                {
+                    AZ_Warning("Archive", false, "Unable to memory map archive '%s'. Falling back to regular file reads.", szFileName);
+                }
+            }
         }
         else
         {
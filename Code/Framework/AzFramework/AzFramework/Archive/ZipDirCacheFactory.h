@@ -41,6 +41,10 @@ namespace AZ::IO::ZipDir
 
             // if this is set, zip path will be searched inside other zips
             FLAGS_READ_INSIDE_PAK = 1 << 7,
+
+            // if this is set, a read-only archive is memory mapped and file data is read directly from the mapping
+            // instead of through file handle reads. Ignored for archives that are writable or nested inside other archives.
+            FLAGS_MEMORY_MAPPED = 1 << 8,
         };
 
         // initializes the internal structures
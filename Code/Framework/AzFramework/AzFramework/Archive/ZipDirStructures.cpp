@@ -8,6 +8,7 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Compression/zstd_compression.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzFramework/Archive/Codec.h>
@@ -521,7 +522,22 @@ namespace AZ::IO::ZipDir
         //check first 4 bytes to see what compression codec was used
         if (CompressionCodec::TestForZSTDMagic(pCompressed))
         {
-            size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            size_t result;
+            // Frames compressed with a dictionary store the id of the dictionary, which needs to have been registered to decompress.
+            if (unsigned int dictionaryId = ZSTD_getDictID_fromFrame(pCompressed, nSrcSize); dictionaryId != 0)
+            {
+                AZStd::shared_ptr<const AZ::ZStdDictionary> dictionary = AZ::ZStdDictionary::Find(dictionaryId);
+                if (!dictionary)
+                {
+                    AZ_Error("ZipDirStructures", false, "Unable to decompress using zstd: dictionary %u has not been registered.", dictionaryId);
+                    return Z_BUF_ERROR;
+                }
+                result = dictionary->Decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            }
+            else
+            {
+                result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            }
 
             if (ZSTD_isError(result))
             {
@@ -612,22 +628,80 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel,
+        const AZ::ZStdDictionary* dictionary)
     {
-        size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
+        const uint8_t* source = static_cast<const uint8_t*>(pUncompressed);
+        uint8_t* destination = static_cast<uint8_t*>(pCompressed);
+        size_t destinationOffset = 0;
+        size_t sourceOffset = 0;
 
-        int err = Z_OK;
+        // Every frame stores its own content size, which allows the frames to be found and decompressed independently.
+        do
+        {
+            size_t blockSize = AZStd::min(nSrcSize - sourceOffset, ZStdBlockSize);
+            size_t result = dictionary
+                ? dictionary->Compress(destination + destinationOffset, *pDestSize - destinationOffset, source + sourceOffset, blockSize)
+                : ZSTD_compress(destination + destinationOffset, *pDestSize - destinationOffset, source + sourceOffset, blockSize, 1);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error compressing using zstd: %s", ZSTD_getErrorName(result));
+                return Z_BUF_ERROR;
+            }
+            destinationOffset += result;
+            sourceOffset += blockSize;
+        } while (sourceOffset < nSrcSize);
+
+        *pDestSize = destinationOffset;
+        return Z_OK;
+    }
 
-        if (ZSTD_isError(result))
+    size_t ZipRawCompressZSTDBound(size_t nSrcSize)
+    {
+        size_t numFullBlocks = nSrcSize / ZStdBlockSize;
+        size_t remainder = nSrcSize % ZStdBlockSize;
+        size_t bound = numFullBlocks * ZSTD_compressBound(ZStdBlockSize);
+        if (remainder != 0 || numFullBlocks == 0)
         {
-            AZ_Error("Error compressing using zstd:%s", false, ZSTD_getErrorName(result));
-            err = Z_BUF_ERROR;
+            bound += ZSTD_compressBound(remainder);
         }
-        else
+        return bound;
+    }
+
+    bool ZipRawSplitBlocks(const void* pCompressed, size_t nSrcSize, AZStd::vector<AZ::IO::CompressionBlock>& blocks)
+    {
+        if (nSrcSize < sizeof(uint32_t) || !CompressionCodec::TestForZSTDMagic(pCompressed))
         {
-            *pDestSize = static_cast<size_t>(result);
+            return false;
         }
-        return err;
+
+        const uint8_t* data = static_cast<const uint8_t*>(pCompressed);
+        size_t compressedOffset = 0;
+        size_t uncompressedOffset = 0;
+        while (compressedOffset < nSrcSize)
+        {
+            const uint8_t* frame = data + compressedOffset;
+            size_t remaining = nSrcSize - compressedOffset;
+            size_t frameSize = ZSTD_findFrameCompressedSize(frame, remaining);
+            unsigned long long contentSize = ZSTD_getFrameContentSize(frame, remaining);
+            if (ZSTD_isError(frameSize) || contentSize == ZSTD_CONTENTSIZE_UNKNOWN || contentSize == ZSTD_CONTENTSIZE_ERROR)
+            {
+                return false;
+            }
+
+            // Skippable frames don't contain data.
+            if (contentSize > 0)
+            {
+                AZ::IO::CompressionBlock& block = blocks.emplace_back();
+                block.m_compressedOffset = compressedOffset;
+                block.m_compressedSize = frameSize;
+                block.m_uncompressedOffset = uncompressedOffset;
+                block.m_uncompressedSize = aznumeric_cast<size_t>(contentSize);
+                uncompressedOffset += block.m_uncompressedSize;
+            }
+            compressedOffset += frameSize;
+        }
+        return true;
     }
 
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
@@ -24,6 +25,11 @@
 
 struct z_stream_s;
 
+namespace AZ
+{
+    class ZStdDictionary;
+}
+
 namespace AZ::IO
 {
     class FileIOBase;
@@ -139,10 +145,22 @@ namespace AZ::IO::ZipDir
     // returns one of the Z_* errors (Z_OK upon success)
     int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
 
+    // splits compressed data into blocks that can be decompressed independently with ZipRawUncompress.
+    // Only zstd data that's stored as multiple frames can be split, for all other data false is returned.
+    bool ZipRawSplitBlocks(const void* pCompressed, size_t nSrcSize, AZStd::vector<AZ::IO::CompressionBlock>& blocks);
+
+    // size of the uncompressed data that's stored in a single independent zstd frame
+    inline constexpr size_t ZStdBlockSize = 256 * 1024;
+
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    // compresses the data with zstd. Data larger than ZStdBlockSize is stored as a sequence of independent frames so it can be
+    // decompressed in parallel. If a dictionary is provided, all frames are compressed with the dictionary.
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel,
+        const AZ::ZStdDictionary* dictionary = nullptr);
+    // returns the maximum size of the data after ZipRawCompressZSTD has compressed it
+    size_t ZipRawCompressZSTDBound(size_t nSrcSize);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
     // fseek wrapper with memory in file support.
@@ -72,6 +72,9 @@ namespace AzFramework
         void ResetContext() override;
         //////////////////////////////////////////////////////////////////////////
 
+        /// Adds multiple entities to the context at once, so they're initialized and activated as one batch.
+        void AddEntities(const EntityList& entities);
+
         static void Reflect(AZ::ReflectContext* context);
         static AZStd::shared_ptr<Scene> FindContainingScene(const EntityContextId& contextId);
 
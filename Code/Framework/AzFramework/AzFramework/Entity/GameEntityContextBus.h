@@ -83,6 +83,13 @@ namespace AzFramework
          */
         virtual void AddGameEntity(AZ::Entity* /*entity*/) = 0;
 
+        /**
+         * Adds existing entities to the game context as one batch.
+         * The entities are activated together, which is cheaper than adding them one at a time.
+         * @param entities The entities to add to the game context.
+         */
+        virtual void AddGameEntities(const AZStd::vector<AZ::Entity*>& /*entities*/) = 0;
+
         /**
          * Destroys an entity. 
          * The entity is immediately deactivated and will be destroyed on the next tick.
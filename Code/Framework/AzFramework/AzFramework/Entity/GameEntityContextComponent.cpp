@@ -143,6 +143,14 @@ namespace AzFramework
         AddEntity(entity);
     }
 
+    //=========================================================================
+    // GameEntityContextRequestBus::AddGameEntities
+    //=========================================================================
+    void GameEntityContextComponent::AddGameEntities(const EntityList& entities)
+    {
+        AddEntities(entities);
+    }
+
 
     //=========================================================================
     // CreateEntity
@@ -225,19 +233,26 @@ namespace AzFramework
             }
         }
 
+        EntityList entitiesToActivate;
+        entitiesToActivate.reserve(entities.size());
         for (AZ::Entity* entity : entities)
         {
-            if (entity->GetState() == AZ::Entity::State::Init)
+            if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
             {
-                if (entity->IsRuntimeActiveByDefault())
-                {
-                    entity->Activate();
-                #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                    PumpSystemEventsIfNeeded();
-                #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                }
+                entitiesToActivate.push_back(entity);
             }
         }
+
+        // Activating the entities as one batch allows entities with thread safe components to be activated on job threads.
+    #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+        AZ::Entity::ActivateEntities(entitiesToActivate,
+            [&PumpSystemEventsIfNeeded]([[maybe_unused]] AZ::Entity* entity)
+            {
+                PumpSystemEventsIfNeeded();
+            });
+    #else
+        AZ::Entity::ActivateEntities(entitiesToActivate);
+    #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
     }
 
     //=========================================================================
@@ -52,6 +52,7 @@ namespace AzFramework
         AZ::Entity* CreateGameEntity(const char* name) override;
         BehaviorEntity CreateGameEntityForBehaviorContext(const char* name) override;
         void AddGameEntity(AZ::Entity* entity) override;
+        void AddGameEntities(const EntityList& entities) override;
         void DestroyGameEntity(const AZ::EntityId&) override;
         void DestroyGameEntityAndDescendants(const AZ::EntityId&) override;
         void ActivateGameEntity(const AZ::EntityId&) override;
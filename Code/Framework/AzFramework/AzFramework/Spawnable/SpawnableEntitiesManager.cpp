@@ -335,11 +335,10 @@ namespace AzFramework
                         ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
             }
 
-            // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-            {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-            }
+            // Add to the game context as one batch, now the entities are active
+            AZStd::vector<AZ::Entity*> newEntities(
+                ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end());
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntities, newEntities);
 
             // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
             if (request.m_completionCallback)
@@ -416,11 +415,10 @@ namespace AzFramework
                         ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
             }
 
-            // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-            {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-            }
+            // Add to the game context as one batch, now the entities are active
+            AZStd::vector<AZ::Entity*> newEntities(
+                ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end());
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntities, newEntities);
 
             if (request.m_completionCallback)
             {
@@ -106,6 +106,34 @@ namespace AzNetworking
         ConnectionPacketEntry m_entries[MaxTrackableEntries];
     };
 
+    //! @class CompressionMetrics
+    //! @brief used to track the compression ratio and cost of the packets compressed or decompressed by a given connection.
+    class CompressionMetrics
+    {
+    public:
+
+        CompressionMetrics() = default;
+
+        //! Invoked whenever a packet payload is run through the compressor.
+        //! @param uncompressedBytes the size of the payload before compression
+        //! @param compressedBytes   the size of the payload after compression, or the uncompressed size if compression was discarded
+        //! @param elapsedTimeUs     the time spent in the compressor in microseconds
+        void LogPacket(uint32_t uncompressedBytes, uint32_t compressedBytes, uint64_t elapsedTimeUs);
+
+        //! Retrieve the ratio of uncompressed to compressed bytes for all logged packets.
+        //! @return the compression ratio, 1.0 if no packets have been logged
+        float GetCompressionRatio() const;
+
+        //! Retrieve the average time spent in the compressor per logged packet.
+        //! @return the average time per packet in microseconds
+        float GetAverageTimeUs() const;
+
+        uint32_t m_packetCount = 0;
+        uint64_t m_uncompressedBytes = 0;
+        uint64_t m_compressedBytes = 0;
+        uint64_t m_elapsedTimeUs = 0;
+    };
+
     //! @struct ConnectionMetrics
     //! @brief used to track general performance metrics for a given connection with respect to time.
     struct ConnectionMetrics
@@ -124,6 +152,8 @@ namespace AzNetworking
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
         ConnectionComputeRtt m_connectionRtt;
+        CompressionMetrics   m_sendCompression;
+        CompressionMetrics   m_recvCompression;
     };
 }
 
@@ -35,6 +35,32 @@ namespace AzNetworking
         return m_roundTripTime;
     }
 
+    inline void CompressionMetrics::LogPacket(uint32_t uncompressedBytes, uint32_t compressedBytes, uint64_t elapsedTimeUs)
+    {
+        ++m_packetCount;
+        m_uncompressedBytes += uncompressedBytes;
+        m_compressedBytes += compressedBytes;
+        m_elapsedTimeUs += elapsedTimeUs;
+    }
+
+    inline float CompressionMetrics::GetCompressionRatio() const
+    {
+        if (m_compressedBytes == 0)
+        {
+            return 1.0f;
+        }
+        return aznumeric_cast<float>(m_uncompressedBytes) / aznumeric_cast<float>(m_compressedBytes);
+    }
+
+    inline float CompressionMetrics::GetAverageTimeUs() const
+    {
+        if (m_packetCount == 0)
+        {
+            return 0.0f;
+        }
+        return aznumeric_cast<float>(m_elapsedTimeUs) / aznumeric_cast<float>(m_packetCount);
+    }
+
     inline void ConnectionMetrics::Reset()
     {
         *this = ConnectionMetrics();
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AzNetworking
+{
+    PooledPacketBuffer::PooledPacketBuffer(PacketBufferPool& pool)
+        : m_pool(pool)
+    {
+        ;
+    }
+
+    PacketBufferPool::~PacketBufferPool()
+    {
+        AZ_Assert(m_freeBuffers.size() == m_bufferCount, "%u packet buffers were not released before destroying their pool",
+            m_bufferCount - aznumeric_cast<uint32_t>(m_freeBuffers.size()));
+        for (PooledPacketBuffer* buffer : m_freeBuffers)
+        {
+            delete buffer;
+        }
+    }
+
+    PacketBufferPtr PacketBufferPool::Acquire()
+    {
+        PooledPacketBuffer* buffer = nullptr;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            if (!m_freeBuffers.empty())
+            {
+                buffer = m_freeBuffers.back();
+                m_freeBuffers.pop_back();
+            }
+            else
+            {
+                ++m_bufferCount;
+            }
+        }
+
+        if (buffer == nullptr)
+        {
+            buffer = new PooledPacketBuffer(*this);
+        }
+        return PacketBufferPtr(buffer);
+    }
+
+    uint32_t PacketBufferPool::GetBufferCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_bufferCount;
+    }
+
+    uint32_t PacketBufferPool::GetFreeBufferCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return aznumeric_cast<uint32_t>(m_freeBuffers.size());
+    }
+
+    void PacketBufferPool::Release(PooledPacketBuffer* buffer)
+    {
+        buffer->m_size = 0;
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_freeBuffers.push_back(buffer);
+    }
+}
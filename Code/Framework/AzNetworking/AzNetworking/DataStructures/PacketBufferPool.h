@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+
+namespace AzNetworking
+{
+    class PacketBufferPool;
+
+    //! @class PooledPacketBuffer
+    //! @brief reference counted packet buffer, which returns itself to the pool it was acquired from once the last reference is released.
+    //! Buffers are sized to hold a single Udp datagram, including the worst case inflation of compressing or encrypting it.
+    class PooledPacketBuffer
+    {
+    public:
+
+        static constexpr uint32_t Capacity = 2 * MaxUdpTransmissionUnit;
+
+        //! Returns the maximum number of bytes this buffer can hold.
+        //! @return the maximum number of bytes this buffer can hold
+        static constexpr uint32_t GetCapacity();
+
+        //! Returns the number of bytes in use.
+        //! @return the number of bytes in use
+        uint32_t GetSize() const;
+
+        //! Resizes the buffer, does not initialize new bytes.
+        //! @param newSize the number of bytes to size the buffer to
+        //! @return boolean true on success, false if newSize exceeds the capacity
+        bool Resize(uint32_t newSize);
+
+        //! Const raw buffer access.
+        //! @return const pointer to the internal memory buffer
+        const uint8_t* GetBuffer() const;
+
+        //! Non-const raw buffer access.
+        //! @return non-const pointer to the internal memory buffer
+        uint8_t* GetBuffer();
+
+        //! Overwrites the data in this buffer with the provided data.
+        //! @param buffer     pointer to the data to copy
+        //! @param bufferSize the number of bytes to copy
+        //! @return boolean true on success, false if bufferSize exceeds the capacity
+        bool CopyValues(const uint8_t* buffer, uint32_t bufferSize);
+
+        //! Reference counting, used by AZStd::intrusive_ptr.
+        //! @{
+        void add_ref();
+        void release();
+        //! @}
+
+    private:
+
+        friend class PacketBufferPool;
+
+        explicit PooledPacketBuffer(PacketBufferPool& pool);
+        ~PooledPacketBuffer() = default;
+
+        AZ_DISABLE_COPY_MOVE(PooledPacketBuffer);
+
+        PacketBufferPool& m_pool;
+        AZStd::atomic<uint32_t> m_refCount{ 0 };
+        uint32_t m_size = 0;
+        uint8_t m_buffer[Capacity];
+    };
+
+    using PacketBufferPtr = AZStd::intrusive_ptr<PooledPacketBuffer>;
+
+    //! @class PacketBufferPool
+    //! @brief thread safe pool of packet buffers, so packets can be handed between the socket, decryption, decompression and
+    //! dispatch without allocating or copying into intermediate buffers.
+    //! The pool must outlive every buffer acquired from it.
+    class PacketBufferPool
+    {
+    public:
+
+        PacketBufferPool() = default;
+        ~PacketBufferPool();
+
+        //! Returns an empty buffer, allocating a new one if no released buffers are available.
+        //! @return pointer to an empty buffer
+        PacketBufferPtr Acquire();
+
+        //! Returns the number of buffers allocated by this pool.
+        //! @return the number of buffers allocated by this pool
+        uint32_t GetBufferCount() const;
+
+        //! Returns the number of buffers available for reuse.
+        //! @return the number of buffers available for reuse
+        uint32_t GetFreeBufferCount() const;
+
+    private:
+
+        friend class PooledPacketBuffer;
+
+        void Release(PooledPacketBuffer* buffer);
+
+        AZ_DISABLE_COPY_MOVE(PacketBufferPool);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<PooledPacketBuffer*> m_freeBuffers;
+        uint32_t m_bufferCount = 0;
+    };
+}
+
+#include <AzNetworking/DataStructures/PacketBufferPool.inl>
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AzNetworking
+{
+    inline constexpr uint32_t PooledPacketBuffer::GetCapacity()
+    {
+        return Capacity;
+    }
+
+    inline uint32_t PooledPacketBuffer::GetSize() const
+    {
+        return m_size;
+    }
+
+    inline bool PooledPacketBuffer::Resize(uint32_t newSize)
+    {
+        if (newSize > GetCapacity())
+        {
+            return false;
+        }
+        m_size = newSize;
+        return true;
+    }
+
+    inline const uint8_t* PooledPacketBuffer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    inline uint8_t* PooledPacketBuffer::GetBuffer()
+    {
+        return m_buffer;
+    }
+
+    inline bool PooledPacketBuffer::CopyValues(const uint8_t* buffer, uint32_t bufferSize)
+    {
+        if (!Resize(bufferSize))
+        {
+            return false;
+        }
+        memcpy(m_buffer, buffer, bufferSize);
+        return true;
+    }
+
+    inline void PooledPacketBuffer::add_ref()
+    {
+        m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    inline void PooledPacketBuffer::release()
+    {
+        if (m_refCount.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+        {
+            m_pool.Release(this);
+        }
+    }
+}
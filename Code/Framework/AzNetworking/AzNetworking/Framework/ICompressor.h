@@ -71,6 +71,7 @@ namespace AzNetworking
 
         //! Decompress packet.
         //! Chunk based decompressors should loop internally in Decompress() to decompress all chunks of compData.
+        //! Network interfaces may decompress packets of different connections on multiple threads at the same time.
         //! @param compData       buffer to decompress
         //! @param compSize       length of data to decompress from compData
         //! @param uncompData     should be able to fit at least GetDecompressedBufferSize(compressedDataSize)
@@ -12,7 +12,9 @@
 #include <AzNetworking/Framework/NetworkInterfaceMetrics.h>
 #include <AzNetworking/ConnectionLayer/IConnectionSet.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Utilities/PacketCapture.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
@@ -73,6 +75,10 @@ namespace AzNetworking
         //! @param deltaTimeMs milliseconds since update was last invoked
         virtual void Update(AZ::TimeMs deltaTimeMs) = 0;
 
+        //! Writes any packets that are still queued for sending to the network.
+        //! Applications that send packets after Update should call this once they are done sending for the frame.
+        virtual void FlushSends() = 0;
+
         //! A helper function that transmits a packet on this connection reliably.
         //! Note that a packetId is not returned here, since retransmits may cause the packetId to change
         //! @param connectionId identifier of the connection to send to
@@ -106,9 +112,23 @@ namespace AzNetworking
         //! @return reference to the metrics tracked by this network interface
         NetworkInterfaceMetrics& GetMetrics();
 
+        //! Starts capturing the datagrams sent and received by this network interface to a capture file, replacing any active capture.
+        //! Only supported by Udp network interfaces.
+        //! @param filePath path of the capture file to write
+        //! @return boolean true on success, false if the capture file could not be opened
+        bool StartPacketCapture(const char* filePath);
+
+        //! Stops and flushes the active packet capture, if any.
+        void StopPacketCapture();
+
+        //! Returns the active packet capture, or nullptr if this network interface isn't capturing.
+        //! @return pointer to the active packet capture
+        PacketCaptureWriter* GetPacketCapture();
+
     private:
 
         NetworkInterfaceMetrics m_metrics;
+        AZStd::unique_ptr<PacketCaptureWriter> m_packetCapture;
     };
 
     inline const NetworkInterfaceMetrics& INetworkInterface::GetMetrics() const
@@ -120,4 +140,25 @@ namespace AzNetworking
     {
         return m_metrics;
     }
+
+    inline bool INetworkInterface::StartPacketCapture(const char* filePath)
+    {
+        AZStd::unique_ptr<PacketCaptureWriter> packetCapture = AZStd::make_unique<PacketCaptureWriter>();
+        if (!packetCapture->Open(filePath))
+        {
+            return false;
+        }
+        m_packetCapture = AZStd::move(packetCapture);
+        return true;
+    }
+
+    inline void INetworkInterface::StopPacketCapture()
+    {
+        m_packetCapture.reset();
+    }
+
+    inline PacketCaptureWriter* INetworkInterface::GetPacketCapture()
+    {
+        return m_packetCapture.get();
+    }
 }
@@ -15,6 +15,13 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(float, net_ReplayTimeScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Playback speed of ReplayPacketCapture, 2.0 replays twice as fast as captured");
+    AZ_CVAR(AZ::TimeMs, net_ReplayLatencyMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Latency in milliseconds added to every datagram replayed by ReplayPacketCapture");
+    AZ_CVAR(AZ::TimeMs, net_ReplayJitterMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum random latency in milliseconds added to every datagram replayed by ReplayPacketCapture");
+    AZ_CVAR(float, net_ReplayLossPercent, 0.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Percentage of datagrams dropped by ReplayPacketCapture");
+    AZ_CVAR(uint64_t, net_ReplaySeed, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Seed for the jitter and loss of ReplayPacketCapture, replays with the same seed are identical");
+    AZ_CVAR(uint16_t, net_ReplayRemapPortBase, 50000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Remote addresses replayed by ReplayPacketCapture are remapped to loopback ports starting at this port");
+
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -47,6 +54,7 @@ namespace AzNetworking
     NetworkingSystemComponent::~NetworkingSystemComponent()
     {
         // Delete all our network interfaces first so they can unregister from the reader and listen threads
+        m_replayDrivers.clear();
         m_networkInterfaces.clear();
 
         m_compressorFactories.clear();
@@ -71,7 +79,24 @@ namespace AzNetworking
 
     void NetworkingSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        AZ::TimeMs elapsedMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(deltaTime / 1000.0f));
+        AZ::TimeMs elapsedMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(deltaTime * 1000.0f));
+
+        // Replayed datagrams have to be injected before the swap to be processed this update
+        for (auto replayDriver = m_replayDrivers.begin(); replayDriver != m_replayDrivers.end();)
+        {
+            replayDriver->second->Update(elapsedMs);
+            if (replayDriver->second->IsComplete())
+            {
+                AZLOG_INFO("Finished replaying into %s, injected %u datagrams and dropped %u", replayDriver->first.GetCStr(),
+                    replayDriver->second->GetInjectedPacketCount(), replayDriver->second->GetDroppedPacketCount());
+                replayDriver = m_replayDrivers.erase(replayDriver);
+            }
+            else
+            {
+                ++replayDriver;
+            }
+        }
+
         m_readerThread->SwapBuffers();
         for (auto& networkInterface : m_networkInterfaces)
         {
@@ -118,6 +143,7 @@ namespace AzNetworking
 
     bool NetworkingSystemComponent::DestroyNetworkInterface(AZ::Name name)
     {
+        m_replayDrivers.erase(name);
         return m_networkInterfaces.erase(name) > 0;
     }
 
@@ -200,4 +226,84 @@ namespace AzNetworking
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
         }
     }
+
+    void NetworkingSystemComponent::StartPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("Usage: StartPacketCapture <interface name> <capture file>");
+            return;
+        }
+
+        const AZ::Name interfaceName(arguments[0]);
+        INetworkInterface* networkInterface = RetrieveNetworkInterface(interfaceName);
+        if (networkInterface == nullptr || networkInterface->GetType() != ProtocolType::Udp)
+        {
+            AZLOG_WARN("No Udp network interface named %s to capture", interfaceName.GetCStr());
+            return;
+        }
+
+        const AZStd::string capturePath(arguments[1]);
+        if (networkInterface->StartPacketCapture(capturePath.c_str()))
+        {
+            AZLOG_INFO("Capturing traffic of %s to %s", interfaceName.GetCStr(), capturePath.c_str());
+        }
+        else
+        {
+            AZLOG_ERROR("Failed to open packet capture file %s", capturePath.c_str());
+        }
+    }
+
+    void NetworkingSystemComponent::StopPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_WARN("Usage: StopPacketCapture <interface name>");
+            return;
+        }
+
+        const AZ::Name interfaceName(arguments[0]);
+        INetworkInterface* networkInterface = RetrieveNetworkInterface(interfaceName);
+        if (networkInterface == nullptr || networkInterface->GetPacketCapture() == nullptr)
+        {
+            AZLOG_WARN("Network interface %s is not capturing", interfaceName.GetCStr());
+            return;
+        }
+
+        AZLOG_INFO("Stopped capturing traffic of %s after %u datagrams", interfaceName.GetCStr(), networkInterface->GetPacketCapture()->GetPacketCount());
+        networkInterface->StopPacketCapture();
+    }
+
+    void NetworkingSystemComponent::ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("Usage: ReplayPacketCapture <interface name> <capture file>");
+            return;
+        }
+
+        const AZ::Name interfaceName(arguments[0]);
+        INetworkInterface* networkInterface = RetrieveNetworkInterface(interfaceName);
+        if (networkInterface == nullptr || networkInterface->GetType() != ProtocolType::Udp)
+        {
+            AZLOG_WARN("No Udp network interface named %s to replay into", interfaceName.GetCStr());
+            return;
+        }
+
+        UdpReplaySettings settings;
+        settings.m_timeScale = net_ReplayTimeScale;
+        settings.m_latencyMs = net_ReplayLatencyMs;
+        settings.m_jitterMs = net_ReplayJitterMs;
+        settings.m_lossPercent = net_ReplayLossPercent;
+        settings.m_seed = net_ReplaySeed;
+        settings.m_remapPortBase = net_ReplayRemapPortBase;
+
+        const AZStd::string capturePath(arguments[1]);
+        AZStd::unique_ptr<UdpReplayDriver> replayDriver = AZStd::make_unique<UdpReplayDriver>(static_cast<UdpNetworkInterface&>(*networkInterface), settings);
+        if (!replayDriver->Load(capturePath.c_str()))
+        {
+            return;
+        }
+        m_replayDrivers[interfaceName] = AZStd::move(replayDriver);
+    }
 }
@@ -13,6 +13,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpReplayDriver.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
@@ -68,11 +69,17 @@ namespace AzNetworking
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void StartPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        void StopPacketCapture(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
 
         AZ_CONSOLEFUNC(NetworkingSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for all instantiated network interfaces");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StartPacketCapture, AZ::ConsoleFunctorFlags::Null, "Captures the traffic of a Udp network interface, usage: StartPacketCapture <interface name> <capture file>");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StopPacketCapture, AZ::ConsoleFunctorFlags::Null, "Stops capturing the traffic of a network interface, usage: StopPacketCapture <interface name>");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, ReplayPacketCapture, AZ::ConsoleFunctorFlags::Null, "Replays the inbound traffic of a capture into an open Udp network interface, usage: ReplayPacketCapture <interface name> <capture file>");
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
@@ -80,5 +87,8 @@ namespace AzNetworking
 
         using CompressionFactories = AZStd::unordered_map<AZ::Name, AZStd::unique_ptr<ICompressorFactory>>;
         CompressionFactories m_compressorFactories;
+
+        using ReplayDrivers = AZStd::unordered_map<AZ::Name, AZStd::unique_ptr<UdpReplayDriver>>;
+        ReplayDrivers m_replayDrivers;
     };
 }
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDelta.h>
+
+namespace AzNetworking
+{
+    // The encoded data is the decoded size followed by a list of runs until the decoded size is reached.
+    // Every run is the number of unchanged bytes, the number of changed bytes and the changed bytes xored with the baseline.
+    // All counts are stored as variable length integers, 7 bits per byte with the high bit set if more bytes follow.
+    namespace BaselineDeltaInternal
+    {
+        class Writer
+        {
+        public:
+            Writer(uint8_t* buffer, uint32_t capacity)
+                : m_buffer(buffer)
+                , m_capacity(capacity)
+            {
+                ;
+            }
+
+            bool WriteByte(uint8_t value)
+            {
+                if (m_size >= m_capacity)
+                {
+                    return false;
+                }
+                m_buffer[m_size++] = value;
+                return true;
+            }
+
+            bool WriteCount(uint32_t value)
+            {
+                while (value >= 0x80)
+                {
+                    if (!WriteByte(static_cast<uint8_t>(value | 0x80)))
+                    {
+                        return false;
+                    }
+                    value >>= 7;
+                }
+                return WriteByte(static_cast<uint8_t>(value));
+            }
+
+            uint32_t GetSize() const
+            {
+                return m_size;
+            }
+
+        private:
+            uint8_t* m_buffer;
+            uint32_t m_capacity;
+            uint32_t m_size = 0;
+        };
+
+        class Reader
+        {
+        public:
+            Reader(const uint8_t* buffer, uint32_t size)
+                : m_buffer(buffer)
+                , m_size(size)
+            {
+                ;
+            }
+
+            bool ReadByte(uint8_t& outValue)
+            {
+                if (m_position >= m_size)
+                {
+                    return false;
+                }
+                outValue = m_buffer[m_position++];
+                return true;
+            }
+
+            bool ReadCount(uint32_t& outValue)
+            {
+                outValue = 0;
+                for (uint32_t shift = 0; shift < 35; shift += 7)
+                {
+                    uint8_t byte = 0;
+                    if (!ReadByte(byte))
+                    {
+                        return false;
+                    }
+                    outValue |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        private:
+            const uint8_t* m_buffer;
+            uint32_t m_size;
+            uint32_t m_position = 0;
+        };
+
+        inline uint8_t GetBaselineByte(const uint8_t* baseline, uint32_t baselineSize, uint32_t index)
+        {
+            return (index < baselineSize) ? baseline[index] : 0;
+        }
+    }
+
+    bool EncodeBaselineDelta(const uint8_t* data, uint32_t dataSize, const uint8_t* baseline, uint32_t baselineSize, uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize)
+    {
+        using namespace BaselineDeltaInternal;
+
+        outSize = 0;
+        Writer writer(outBuffer, outCapacity);
+        if (!writer.WriteCount(dataSize))
+        {
+            return false;
+        }
+
+        auto isChanged = [data, baseline, baselineSize](uint32_t index)
+        {
+            return data[index] != GetBaselineByte(baseline, baselineSize, index);
+        };
+
+        uint32_t position = 0;
+        while (position < dataSize)
+        {
+            const uint32_t unchangedStart = position;
+            while ((position < dataSize) && !isChanged(position))
+            {
+                ++position;
+            }
+
+            const uint32_t changedStart = position;
+            while (position < dataSize)
+            {
+                if (isChanged(position))
+                {
+                    ++position;
+                }
+                else if ((position + 1 < dataSize) && isChanged(position + 1))
+                {
+                    // A single unchanged byte costs less as part of the changed bytes than as a new run
+                    ++position;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            if (!writer.WriteCount(changedStart - unchangedStart) || !writer.WriteCount(position - changedStart))
+            {
+                return false;
+            }
+            for (uint32_t index = changedStart; index < position; ++index)
+            {
+                if (!writer.WriteByte(data[index] ^ GetBaselineByte(baseline, baselineSize, index)))
+                {
+                    return false;
+                }
+            }
+        }
+
+        outSize = writer.GetSize();
+        return true;
+    }
+
+    bool DecodeBaselineDelta(const uint8_t* encoded, uint32_t encodedSize, const uint8_t* baseline, uint32_t baselineSize, uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize)
+    {
+        using namespace BaselineDeltaInternal;
+
+        outSize = 0;
+        Reader reader(encoded, encodedSize);
+        uint32_t dataSize = 0;
+        if (!reader.ReadCount(dataSize) || (dataSize > outCapacity))
+        {
+            return false;
+        }
+
+        uint32_t position = 0;
+        while (position < dataSize)
+        {
+            uint32_t unchangedCount = 0;
+            uint32_t changedCount = 0;
+            if (!reader.ReadCount(unchangedCount) || !reader.ReadCount(changedCount))
+            {
+                return false;
+            }
+
+            // Every run needs to make progress, and may not write past the decoded size
+            const uint64_t runEnd = static_cast<uint64_t>(position) + unchangedCount + changedCount;
+            if ((runEnd == position) || (runEnd > dataSize))
+            {
+                return false;
+            }
+
+            for (const uint32_t unchangedEnd = position + unchangedCount; position < unchangedEnd; ++position)
+            {
+                outBuffer[position] = GetBaselineByte(baseline, baselineSize, position);
+            }
+            for (const uint32_t changedEnd = position + changedCount; position < changedEnd; ++position)
+            {
+                uint8_t delta = 0;
+                if (!reader.ReadByte(delta))
+                {
+                    return false;
+                }
+                outBuffer[position] = delta ^ GetBaselineByte(baseline, baselineSize, position);
+            }
+        }
+
+        outSize = dataSize;
+        return true;
+    }
+
+    bool GetBaselineDeltaDecodedSize(const uint8_t* encoded, uint32_t encodedSize, uint32_t& outSize)
+    {
+        BaselineDeltaInternal::Reader reader(encoded, encodedSize);
+        return reader.ReadCount(outSize);
+    }
+}
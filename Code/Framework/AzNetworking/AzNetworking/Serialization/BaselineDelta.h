@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace AzNetworking
+{
+    //! Encodes a buffer relative to a baseline buffer that the remote endpoint already has, for example the data of the last
+    //! acknowledged update of the same object.
+    //! Every byte is xored with the baseline byte at the same offset, bytes past the end of the baseline are xored with zero.
+    //! Runs of unchanged bytes are replaced by their length, so values that didn't change cost close to nothing, and values
+    //! that changed slightly only cost the bytes that differ.
+    //! The encoding is lossless for any baseline, but only compresses well if the data is laid out like the baseline.
+    //! @param data         the data to encode
+    //! @param dataSize     size of the data in bytes
+    //! @param baseline     the baseline to encode against, may be nullptr if baselineSize is 0
+    //! @param baselineSize size of the baseline in bytes
+    //! @param outBuffer    buffer to write the encoded data to
+    //! @param outCapacity  capacity of outBuffer in bytes
+    //! @param outSize      the number of bytes written to outBuffer
+    //! @return boolean true on success, false if the encoded data didn't fit into outBuffer
+    bool EncodeBaselineDelta(const uint8_t* data, uint32_t dataSize, const uint8_t* baseline, uint32_t baselineSize, uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize);
+
+    //! Decodes data encoded by EncodeBaselineDelta, using the same baseline the data was encoded against.
+    //! @param encoded      the encoded data
+    //! @param encodedSize  size of the encoded data in bytes
+    //! @param baseline     the baseline the data was encoded against, may be nullptr if baselineSize is 0
+    //! @param baselineSize size of the baseline in bytes
+    //! @param outBuffer    buffer to write the decoded data to
+    //! @param outCapacity  capacity of outBuffer in bytes
+    //! @param outSize      the number of bytes written to outBuffer
+    //! @return boolean true on success, false if the encoded data was malformed or didn't fit into outBuffer
+    bool DecodeBaselineDelta(const uint8_t* encoded, uint32_t encodedSize, const uint8_t* baseline, uint32_t baselineSize, uint8_t* outBuffer, uint32_t outCapacity, uint32_t& outSize);
+
+    //! Returns the size of the data encoded by EncodeBaselineDelta, without decoding it.
+    //! @param encoded     the encoded data
+    //! @param encodedSize size of the encoded data in bytes
+    //! @param outSize     the size of the decoded data in bytes
+    //! @return boolean true on success, false if the encoded data was malformed
+    bool GetBaselineDeltaDecodedSize(const uint8_t* encoded, uint32_t encodedSize, uint32_t& outSize);
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BitPackedSerializer.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    uint32_t GetBitCountForRange(uint64_t valueRange)
+    {
+        return (valueRange == 0) ? 0 : 64 - static_cast<uint32_t>(az_clz_u64(valueRange));
+    }
+
+    BitPackedInputSerializer::BitPackedInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    uint32_t BitPackedInputSerializer::GetSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    SerializerMode BitPackedInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool BitPackedInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool BitPackedInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(float));
+        return WriteBits(bits, 32);
+    }
+
+    bool BitPackedInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(double));
+        return WriteBits(bits, 64);
+    }
+
+    bool BitPackedInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < outSize; ++i)
+        {
+            if (!WriteBits(buffer[i], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool BitPackedInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool BitPackedInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* BitPackedInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t BitPackedInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t BitPackedInputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) / 8;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool BitPackedInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        // Unsigned arithmetic, so the full range of signed 64-bit types doesn't overflow
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t offsetValue = static_cast<uint64_t>(inputValue) - static_cast<uint64_t>(minValue);
+        return WriteBits(offsetValue, GetBitCountForRange(valueRange));
+    }
+
+    bool BitPackedInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitPosition) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitPosition / 8;
+            const uint32_t bitOffset = m_bitPosition % 8;
+            const uint32_t bitsInByte = AZStd::min(8 - bitOffset, bitCount);
+            const uint64_t mask = (uint64_t(1) << bitsInByte) - 1;
+            if (bitOffset == 0)
+            {
+                m_buffer[byteIndex] = 0;
+            }
+            m_buffer[byteIndex] |= static_cast<uint8_t>((value & mask) << bitOffset);
+            value >>= bitsInByte;
+            bitCount -= bitsInByte;
+            m_bitPosition += bitsInByte;
+        }
+        return true;
+    }
+
+    BitPackedOutputSerializer::BitPackedOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+        : m_bitPosition(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+    {
+        ;
+    }
+
+    uint32_t BitPackedOutputSerializer::GetReadSizeInBits() const
+    {
+        return m_bitPosition;
+    }
+
+    SerializerMode BitPackedOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool BitPackedOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        const uint64_t bit = ReadBits(1);
+        value = m_serializerValid ? (bit != 0) : value;
+        return m_serializerValid;
+    }
+
+    bool BitPackedOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool BitPackedOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
+    {
+        const uint32_t bits = static_cast<uint32_t>(ReadBits(32));
+        if (m_serializerValid)
+        {
+            memcpy(&value, &bits, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool BitPackedOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        const uint64_t bits = ReadBits(64);
+        if (m_serializerValid)
+        {
+            memcpy(&value, &bits, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool BitPackedOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; (i < outSize) && m_serializerValid; ++i)
+        {
+            buffer[i] = static_cast<uint8_t>(ReadBits(8));
+        }
+        return m_serializerValid;
+    }
+
+    bool BitPackedOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool BitPackedOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* BitPackedOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t BitPackedOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t BitPackedOutputSerializer::GetSize() const
+    {
+        return (m_bitPosition + 7) / 8;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool BitPackedOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t offsetValue = ReadBits(GetBitCountForRange(valueRange));
+        m_serializerValid &= (offsetValue <= valueRange);
+        if (m_serializerValid)
+        {
+            outValue = static_cast<ORIGINAL_TYPE>(offsetValue + static_cast<uint64_t>(minValue));
+        }
+        return m_serializerValid;
+    }
+
+    uint64_t BitPackedOutputSerializer::ReadBits(uint32_t bitCount)
+    {
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitPosition) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return 0;
+        }
+
+        uint64_t result = 0;
+        uint32_t resultShift = 0;
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitPosition / 8;
+            const uint32_t bitOffset = m_bitPosition % 8;
+            const uint32_t bitsInByte = AZStd::min(8 - bitOffset, bitCount);
+            const uint64_t mask = (uint64_t(1) << bitsInByte) - 1;
+            result |= ((static_cast<uint64_t>(m_buffer[byteIndex]) >> bitOffset) & mask) << resultShift;
+            resultShift += bitsInByte;
+            bitCount -= bitsInByte;
+            m_bitPosition += bitsInByte;
+        }
+        return result;
+    }
+}
@@ -127,6 +127,12 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void TcpNetworkInterface::FlushSends()
+    {
+        // Tcp sends are written to the socket immediately, nothing is queued
+        ;
+    }
+
     bool TcpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
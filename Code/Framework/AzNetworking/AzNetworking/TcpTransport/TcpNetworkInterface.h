@@ -93,6 +93,7 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress) override;
         void Update(AZ::TimeMs deltaTimeMs) override;
+        void FlushSends() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
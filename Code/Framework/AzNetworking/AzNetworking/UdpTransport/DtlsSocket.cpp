@@ -68,12 +68,12 @@ namespace AzNetworking
         UdpSocket::Close();
     }
 
-    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
+    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
     {
         if (!encrypt)
         {
             // If the packet has requested to remain unencrypted then just send directly
-            return UdpSocket::SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            return UdpSocket::SendInternal(address, data, size, packetBuffer, encrypt, dtlsEndpoint);
         }
 
         if (dtlsEndpoint.m_sslSocket == nullptr)
@@ -83,16 +83,23 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
+        // Encrypt straight into a pooled buffer, so queued sends don't need to copy the encrypted payload
+        PacketBufferPtr encryptedBuffer = GetPacketBufferPool().Acquire();
         // Write out the packet we were requested to send
         const int32_t sentBytesRaw = SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encryptedBuffer->GetBuffer(), aznumeric_cast<int32_t>(encryptedBuffer->GetCapacity()));
+        if (sentBytesEnc <= 0)
+        {
+            AZLOG_ERROR("Failed to encrypt a payload of %u bytes", size);
+            return SocketOpResultError;
+        }
+        encryptedBuffer->Resize(aznumeric_cast<uint32_t>(sentBytesEnc));
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
 
-        return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
+        return UdpSocket::SendInternal(address, encryptedBuffer->GetBuffer(), encryptedBuffer->GetSize(), encryptedBuffer, encrypt, dtlsEndpoint);
 #else
         return 0;
 #endif
@@ -56,7 +56,7 @@ namespace AzNetworking
 
     private:
 
-        int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
+        int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
 
         SSL_CTX* m_sslContext = nullptr;
     };
@@ -16,6 +16,9 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/std/chrono/clocks.h>
 
 namespace AzNetworking
 {
@@ -36,8 +39,12 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
+    AZ_CVAR(uint32_t, net_UdpDecodeShards, 4, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of job threads received Udp packets are decrypted and decompressed on, sharded by connection. Values below 2 decode on the network thread");
+    AZ_CVAR(uint32_t, net_UdpMinPacketsForParallelDecode, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The minimum number of packets received in an update to decode them on job threads");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
+    static constexpr uint32_t MaxDecodeShards = 64;
+
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
         const uint64_t intConnectionId = aznumeric_cast<uint64_t>(connectionId);
@@ -158,9 +165,23 @@ namespace AzNetworking
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
+            m_socket->FlushSendQueue();
             return;
         }
 
+        if (PacketCaptureWriter* packetCapture = GetPacketCapture())
+        {
+            for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+            {
+                if (packet.m_receivedBytes > 0)
+                {
+                    packetCapture->Record(PacketCaptureDirection::Inbound, packet.m_address, packet.m_buffer, aznumeric_cast<uint32_t>(packet.m_receivedBytes));
+                }
+            }
+        }
+
+        DecodeReceivedPackets(*packets);
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -195,51 +216,33 @@ namespace AzNetworking
                 continue;
             }
 
+            UdpPacketHeader header;
+            PacketBufferPtr decodedBuffer; // Keeps the decoded payload alive while the packet is processed, then returns it to the pool
+            const uint8_t* decodedPacketData = nullptr;
             int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            DecodedPacket& decodedPacket = m_decodedPackets[i];
+            if (decodedPacket.m_state == DecodedPacket::State::Decoded)
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                header = decodedPacket.m_header;
+                decodedBuffer = AZStd::move(decodedPacket.m_buffer);
+                decodedPacketData = decodedPacket.m_data;
+                decodedPacketSize = decodedPacket.m_size;
             }
-            else if (decodedPacketSize < 0)
+            else if (decodedPacket.m_state == DecodedPacket::State::Discarded)
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
                 continue;
             }
-
-            connection->GetMetrics().m_recvDatarate.LogPacket(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-            connection->GetMetrics().m_packetsRecv++;
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
-            {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
-            }
-
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            else
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+                uint64_t uncompressedBytes = 0;
+                const bool decoded = DecodePacket(*connection, packet, currentTimeMs, header, decodedBuffer,
+                    decodedPacketData, decodedPacketSize, uncompressedBytes);
+                GetMetrics().m_recvBytesUncompressed += uncompressedBytes;
+                if (!decoded)
                 {
-                    AZLOG_WARN("Failed to decompress packet!");
                     continue;
                 }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = m_decompressBuffer.GetSize();
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
 
             TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
             if (timeoutItem == nullptr)
@@ -319,6 +322,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Write everything sent since the last update to the socket
+        m_socket->FlushSendQueue();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -331,6 +337,14 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::FlushSends()
+    {
+        if (m_socket->IsOpen())
+        {
+            m_socket->FlushSendQueue();
+        }
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -381,6 +395,15 @@ namespace AzNetworking
         return m_socket->IsOpen();
     }
 
+    bool UdpNetworkInterface::InjectReceivedPacket(const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        if (!m_socket->IsOpen())
+        {
+            return false;
+        }
+        return m_readerThread.InjectPacket(m_socket.get(), address, data, size);
+    }
+
     void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
@@ -390,7 +413,160 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecodePacket
+    (
+        UdpConnection& connection,
+        const UdpReaderThread::ReceivedPacket& packet,
+        AZ::TimeMs currentTimeMs,
+        UdpPacketHeader& outHeader,
+        PacketBufferPtr& outBuffer,
+        const uint8_t*& outData,
+        int32_t& outSize,
+        uint64_t& outUncompressedBytes
+    ) const
+    {
+        // Unencrypted packets are passed through by the endpoint, and can be processed straight out of the received packet
+        PacketBufferPtr decodedBuffer;
+        if (m_socket->IsEncrypted())
+        {
+            decodedBuffer = m_socket->GetPacketBufferPool().Acquire();
+        }
+
+        int32_t decodedPacketSize = 0;
+        uint8_t* decryptData = (decodedBuffer != nullptr) ? decodedBuffer->GetBuffer() : nullptr;
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decryptData, decodedPacketSize);
+        if (decodedBuffer != nullptr)
+        {
+            decodedBuffer->Resize(aznumeric_cast<uint32_t>(AZStd::max(decodedPacketSize, 0)));
+        }
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return false;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return false;
+        }
+
+        connection.GetMetrics().m_recvDatarate.LogPacket(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+        connection.GetMetrics().m_packetsRecv++;
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outHeader.SerializePacketFlags(flagSerializer))
+            {
+                return false;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outUncompressedBytes += flagSerializer.GetReadSize();
+        }
+
+        if (m_compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed, the decrypted buffer is returned to the pool once decompressed
+            PacketBufferPtr decompressBuffer = m_socket->GetPacketBufferPool().Acquire();
+            const AZStd::chrono::high_resolution_clock::time_point decompressStart = AZStd::chrono::high_resolution_clock::now();
+            if (!DecompressPacket(decodedPacketData, decodedPacketSize, *decompressBuffer))
+            {
+                AZLOG_WARN("Failed to decompress packet!");
+                return false;
+            }
+            const AZStd::chrono::microseconds decompressTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - decompressStart);
+            connection.GetMetrics().m_recvCompression.LogPacket(decompressBuffer->GetSize(),
+                aznumeric_cast<uint32_t>(decodedPacketSize), aznumeric_cast<uint64_t>(decompressTime.count()));
+            decodedPacketData = decompressBuffer->GetBuffer();
+            decodedPacketSize = decompressBuffer->GetSize();
+            decodedBuffer = AZStd::move(decompressBuffer);
+        }
+        outUncompressedBytes += decodedPacketSize;
+
+        outBuffer = AZStd::move(decodedBuffer);
+        outData = decodedPacketData;
+        outSize = decodedPacketSize;
+        return true;
+    }
+
+    void UdpNetworkInterface::DecodeReceivedPackets(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        m_decodedPackets.clear();
+        m_decodedPackets.resize(packets.size());
+
+        const uint32_t shardCount = AZStd::min<uint32_t>(net_UdpDecodeShards, MaxDecodeShards);
+        if ((shardCount < 2) || (packets.size() < net_UdpMinPacketsForParallelDecode))
+        {
+            // Not worth the overhead of the jobs, decode while processing
+            return;
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr)
+        {
+            return;
+        }
+
+        while (m_decodeShards.size() < shardCount)
+        {
+            m_decodeShards.emplace_back(AZStd::make_unique<DecodeShard>());
+        }
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            DecodeShard& shard = *m_decodeShards[shardIndex];
+            shard.m_packetIndices.clear();
+            shard.m_recvBytesUncompressed = 0;
+        }
+
+        // Only established connections are decoded ahead, anything else may change state while earlier packets are processed
+        AZStd::vector<UdpConnection*> connections(packets.size(), nullptr);
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if ((connection == nullptr)
+             || (GetDisconnectReasonForSocketResult(packet.m_receivedBytes) != DisconnectReason::MAX)
+             || (connection->GetConnectionState() == ConnectionState::Disconnecting)
+             || (connection->GetConnectionState() == ConnectionState::Disconnected)
+             || connection->GetDtlsEndpoint().IsConnecting())
+            {
+                continue;
+            }
+
+            const uint32_t shardIndex = aznumeric_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+            connections[i] = connection;
+            m_decodeShards[shardIndex]->m_packetIndices.push_back(i);
+        }
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        AZ::parallel_for(uint32_t(0), shardCount, [this, &packets, &connections, currentTimeMs](uint32_t shardIndex)
+        {
+            DecodeShard& shard = *m_decodeShards[shardIndex];
+            for (uint32_t packetIndex : shard.m_packetIndices)
+            {
+                // The decoded payload either stays in the received packet, which is valid until the next update, or in a pooled buffer
+                DecodedPacket& decodedPacket = m_decodedPackets[packetIndex];
+                if (!DecodePacket(*connections[packetIndex], packets[packetIndex], currentTimeMs, decodedPacket.m_header, decodedPacket.m_buffer,
+                    decodedPacket.m_data, decodedPacket.m_size, shard.m_recvBytesUncompressed))
+                {
+                    decodedPacket.m_state = DecodedPacket::State::Discarded;
+                    continue;
+                }
+                decodedPacket.m_state = DecodedPacket::State::Decoded;
+            }
+        }, jobContext);
+
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            GetMetrics().m_recvBytesUncompressed += m_decodeShards[shardIndex]->m_recvBytesUncompressed;
+        }
+    }
+
+    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, PooledPacketBuffer& packetBufferOut) const
     {
         if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
         {
@@ -401,7 +577,6 @@ namespace AzNetworking
         AZStd::size_t uncompSize = 0;
         AZStd::size_t bytesConsumed = 0;
 
-        packetBufferOut.Resize(packetBufferOut.GetCapacity());
         const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
@@ -520,10 +695,12 @@ namespace AzNetworking
             return localPacketId;
         }
 
-        UdpPacketEncodingBuffer writeBuffer;
+        // Compress or copy the packet straight into a pooled buffer, which the socket queues without copying again
+        PacketBufferPtr sendBuffer = m_socket->GetPacketBufferPool().Acquire();
+        bool compressed = false;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), writeBuffer.GetCapacity());
+            NetworkInputSerializer flagSerializer(sendBuffer->GetBuffer(), sendBuffer->GetCapacity());
             ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
 
             header.SetPacketFlag(PacketFlag::Compressed, true);
@@ -540,23 +717,37 @@ namespace AzNetworking
             uint8_t* payload = buffer.GetBuffer() + flagSize;
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
-
-            if (compErr != CompressorError::Ok)
+            // Payloads that could inflate past the pooled buffer are sent uncompressed, this never happens for payloads within the MTU
+            if (flagSize + maxSizeNeeded <= sendBuffer->GetCapacity())
             {
-                AZLOG_ERROR("Failed to compress packet with error %d", aznumeric_cast<int32_t>(compErr));
-                return InvalidPacketId;
+                const AZStd::chrono::high_resolution_clock::time_point compressStart = AZStd::chrono::high_resolution_clock::now();
+                CompressorError compErr = m_compressor->Compress(payload, payloadSize, sendBuffer->GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+                const AZStd::chrono::microseconds compressTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - compressStart);
+
+                if (compErr != CompressorError::Ok)
+                {
+                    AZLOG_ERROR("Failed to compress packet with error %d", aznumeric_cast<int32_t>(compErr));
+                    return InvalidPacketId;
+                }
+
+                // Only use compression if there's actual gain
+                if (compressionMemBytesUsed < payloadSize)
+                {
+                    sendBuffer->Resize(aznumeric_cast<uint32_t>(flagSize + compressionMemBytesUsed));
+                    packetSize = sendBuffer->GetSize();
+                    compressed = true;
+                    // Track byte delta caused by compression
+                    GetMetrics().m_sendBytesCompressedDelta += (payloadSize - compressionMemBytesUsed);
+                }
+                connection.GetMetrics().m_sendCompression.LogPacket(payloadSize,
+                    compressed ? aznumeric_cast<uint32_t>(compressionMemBytesUsed) : payloadSize, aznumeric_cast<uint64_t>(compressTime.count()));
             }
+        }
 
-            // Only use compression if there's actual gain
-            if (compressionMemBytesUsed < payloadSize)
-            {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
-                packetSize = writeBuffer.GetSize();
-                packetData = writeBuffer.GetBuffer();
-                // Track byte delta caused by compression
-                GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+        if (!compressed && !sendBuffer->CopyValues(packetData, packetSize))
+        {
+            AZLOG_ERROR("PacketId %u exceeds the maximum Udp payload size and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
+            return InvalidPacketId;
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -570,7 +761,11 @@ namespace AzNetworking
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
         const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        if (PacketCaptureWriter* packetCapture = GetPacketCapture())
+        {
+            packetCapture->Record(PacketCaptureDirection::Outbound, address, sendBuffer->GetBuffer(), sendBuffer->GetSize());
+        }
+        if (m_socket->Send(address, sendBuffer, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
@@ -13,6 +13,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 #include <AzCore/std/containers/vector.h>
@@ -98,6 +99,7 @@ namespace AzNetworking
         bool Listen(uint16_t port) override;
         ConnectionId Connect(const IpAddress& remoteAddress) override;
         void Update(AZ::TimeMs deltaTimeMs) override;
+        void FlushSends() override;
         bool SendReliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         PacketId SendUnreliablePacket(ConnectionId connectionId, const IPacket& packet) override;
         bool WasPacketAcked(ConnectionId connectionId, PacketId packetId) override;
@@ -112,6 +114,13 @@ namespace AzNetworking
         //! @return boolean true if this connection instance is in an open state
         bool IsOpen() const;
 
+        //! Queues a datagram to be processed on the next update as if it had been received on the socket, used to replay captured traffic.
+        //! @param address the address the datagram appears to be received from
+        //! @param data    pointer to the datagram
+        //! @param size    the size of the datagram
+        //! @return boolean true on success, false if the network interface is not open yet or this update's receive buffer is full
+        bool InjectReceivedPacket(const IpAddress& address, const uint8_t* data, uint32_t size);
+
     private:
 
         //! Registers a packet with a timeout queue on the provided connection.
@@ -126,7 +135,35 @@ namespace AzNetworking
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, PooledPacketBuffer& packetBufferOut) const;
+
+        //! Decrypts and decompresses a received packet and reads its flags.
+        //! Packets that are neither encrypted nor compressed are passed through without copying.
+        //! @param connection           the connection the packet was received on
+        //! @param packet               the packet to decode
+        //! @param currentTimeMs        the time to log the packet at in the connection metrics
+        //! @param outHeader            on success, the header with the packet flags read
+        //! @param outBuffer            on success, the pooled buffer holding the decoded payload, null if the payload points into the packet
+        //! @param outData              on success, the decoded payload
+        //! @param outSize              on success, the size of the decoded payload
+        //! @param outUncompressedBytes the number of uncompressed bytes to add to the metrics
+        //! @return boolean true on success, false if the packet should be discarded
+        bool DecodePacket
+        (
+            UdpConnection& connection,
+            const UdpReaderThread::ReceivedPacket& packet,
+            AZ::TimeMs currentTimeMs,
+            UdpPacketHeader& outHeader,
+            PacketBufferPtr& outBuffer,
+            const uint8_t*& outData,
+            int32_t& outSize,
+            uint64_t& outUncompressedBytes
+        ) const;
+
+        //! Decodes the received packets of established connections on job threads, ahead of processing them in order.
+        //! Packets are sharded by connection, so the state of a connection is only touched by a single job.
+        //! @param packets the packets received since the last update
+        void DecodeReceivedPackets(const UdpReaderThread::ReceivedPackets& packets);
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -193,8 +230,31 @@ namespace AzNetworking
         };
         AZStd::vector<RemovedConnection> m_removedConnections;
 
-        UdpPacketEncodingBuffer m_decryptBuffer;
-        UdpPacketEncodingBuffer m_decompressBuffer;
+        //! A received packet that was decoded by DecodeReceivedPackets.
+        struct DecodedPacket
+        {
+            enum class State : uint8_t
+            {
+                NotDecoded, //!< Decoded while processing the packet
+                Decoded,
+                Discarded
+            };
+
+            UdpPacketHeader m_header;
+            PacketBufferPtr m_buffer; //!< Holds the decoded payload, unless it was passed through from the received packet
+            const uint8_t* m_data = nullptr;
+            int32_t m_size = 0;
+            State m_state = State::NotDecoded;
+        };
+
+        struct DecodeShard
+        {
+            AZStd::vector<uint32_t> m_packetIndices;
+            uint64_t m_recvBytesUncompressed = 0;
+        };
+
+        AZStd::vector<DecodedPacket> m_decodedPackets;
+        AZStd::vector<AZStd::unique_ptr<DecodeShard>> m_decodeShards;
 
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
@@ -114,6 +114,39 @@ namespace AzNetworking
         }
     }
 
+    bool UdpReaderThread::InjectPacket(UdpSocket* socket, const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        if (size > MaxUdpTransmissionUnit)
+        {
+            return false;
+        }
+
+        AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_mutex);
+        ReaderBuffer& back = m_readerBuffers[m_backIndex];
+        ByteBuffer<MaxUdpReceiveBufferSize>& receiveBuffer = back.m_receiveBuffer;
+        for (auto& socketEntry : back.m_entries)
+        {
+            if (socketEntry.m_socket != socket)
+            {
+                continue;
+            }
+
+            ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+            const uint32_t bufferHead = receiveBuffer.GetSize();
+            if ((receivedPackets.size() >= receivedPackets.capacity()) || (receiveBuffer.GetCapacity() - bufferHead < size))
+            {
+                return false;
+            }
+
+            uint8_t* packetData = receiveBuffer.GetBufferEnd();
+            memcpy(packetData, data, size);
+            receiveBuffer.Resize(bufferHead + size);
+            receivedPackets.push_back(ReceivedPacket(address, packetData, aznumeric_cast<int32_t>(size)));
+            return true;
+        }
+        return false;
+    }
+
     uint32_t UdpReaderThread::GetSocketCount() const
     {
         const int32_t frontIndex = 1 - m_backIndex;
@@ -175,27 +208,41 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
+                // Hand the free space at the end of the receive buffer to the socket as MTU sized slots, so packets are read in place
                 const uint32_t bufferHead = receiveBuffer.GetSize();
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                const uint32_t freeBufferSlots = aznumeric_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit);
+                const uint32_t freePacketSlots = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t freeSlotCount = AZStd::min(AZStd::min(freeBufferSlots, freePacketSlots), UdpSocket::MaxReceiveBatchCount);
+                if (freeSlotCount == 0)
                 {
-                    AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
-                        aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
+                    AZLOG_INFO("Receive buffer full, leaving data on the socket");
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                UdpSocket::ReceiveSlot slots[UdpSocket::MaxReceiveBatchCount];
+                for (uint32_t i = 0; i < freeSlotCount; ++i)
+                {
+                    slots[i].m_data = receiveBuffer.GetBufferEnd() + i * MaxUdpTransmissionUnit;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const int32_t receivedCount = socket->ReceiveBatch(slots, freeSlotCount);
+                if (receivedCount <= 0)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    break;
                 }
-                else
+
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    if (slots[i].m_receivedBytes > 0)
+                    {
+                        receivedPackets.push_back(ReceivedPacket(slots[i].m_address, slots[i].m_data, slots[i].m_receivedBytes));
+                    }
+                }
+                receiveBuffer.Resize(bufferHead + receivedCount * MaxUdpTransmissionUnit);
+
+                if (aznumeric_cast<uint32_t>(receivedCount) < freeSlotCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
@@ -58,6 +58,15 @@ namespace AzNetworking
         //! Should be called immediately before any registered sockets have processed their received packets.
         void SwapBuffers();
 
+        //! Queues a packet as if it had been read off the provided socket, it is returned by GetReceivedPackets() after the next SwapBuffers().
+        //! Used to replay captured traffic.
+        //! @param socket  pointer to the registered UdpSocket to queue the packet on
+        //! @param address the address the packet appears to be received from
+        //! @param data    pointer to the packet data to copy
+        //! @param size    the size of the packet data, at most MaxUdpTransmissionUnit bytes
+        //! @return boolean true on success, false if the socket is not registered yet or the receive buffer is full
+        bool InjectPacket(UdpSocket* socket, const IpAddress& address, const uint8_t* data, uint32_t size);
+
         //! Returns the number of active sockets bound to this thread.
         //! @return the number of active sockets bound to this thread
         uint32_t GetSocketCount() const;
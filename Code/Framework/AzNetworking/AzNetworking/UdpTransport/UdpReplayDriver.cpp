@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReplayDriver.h>
+#include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/sort.h>
+
+namespace AzNetworking
+{
+    UdpReplayDriver::UdpReplayDriver(UdpNetworkInterface& networkInterface, const UdpReplaySettings& settings)
+        : m_networkInterface(networkInterface)
+        , m_settings(settings)
+    {
+        if (m_networkInterface.IsEncrypted())
+        {
+            AZLOG_WARN("Replaying into encrypted network interface %s, captured handshakes can't be completed", m_networkInterface.GetName().GetCStr());
+        }
+    }
+
+    bool UdpReplayDriver::Load(const char* filePath)
+    {
+        CapturedPackets packets;
+        if (!ReadPacketCapture(filePath, packets))
+        {
+            return false;
+        }
+        Schedule(packets);
+        return true;
+    }
+
+    void UdpReplayDriver::Schedule(const CapturedPackets& packets)
+    {
+        m_scheduledPackets.clear();
+        m_simulatedTimeMs = AZ::TimeMs{ 0 };
+        m_nextPacketIndex = 0;
+        m_droppedPacketCount = 0;
+
+        AZ::SimpleLcgRandom random(m_settings.m_seed);
+        AZStd::map<IpAddress, IpAddress> remappedAddresses;
+        const float timeScale = AZStd::max(m_settings.m_timeScale, 0.001f);
+        const int64_t jitterMs = AZStd::max(aznumeric_cast<int64_t>(m_settings.m_jitterMs), int64_t{ 0 });
+        for (const CapturedPacket& packet : packets)
+        {
+            if (packet.m_direction != PacketCaptureDirection::Inbound)
+            {
+                continue;
+            }
+
+            // Always draw both values so the schedule of the remaining datagrams doesn't depend on which were dropped
+            const float lossRoll = random.GetRandomFloat() * 100.0f;
+            const int64_t jitterRoll = (jitterMs > 0) ? aznumeric_cast<int64_t>(random.GetRandom() % (jitterMs + 1)) : 0;
+            if (lossRoll < m_settings.m_lossPercent)
+            {
+                ++m_droppedPacketCount;
+                continue;
+            }
+
+            auto remapped = remappedAddresses.find(packet.m_address);
+            if (remapped == remappedAddresses.end())
+            {
+                const uint16_t port = aznumeric_cast<uint16_t>(m_settings.m_remapPortBase + remappedAddresses.size());
+                remapped = remappedAddresses.emplace(packet.m_address, IpAddress(127, 0, 0, 1, port)).first;
+            }
+
+            ScheduledPacket& scheduledPacket = m_scheduledPackets.emplace_back();
+            const int64_t scaledTimeMs = aznumeric_cast<int64_t>(aznumeric_cast<float>(aznumeric_cast<int64_t>(packet.m_timeMs)) / timeScale);
+            scheduledPacket.m_deliveryTimeMs = aznumeric_cast<AZ::TimeMs>(scaledTimeMs + aznumeric_cast<int64_t>(m_settings.m_latencyMs) + jitterRoll);
+            scheduledPacket.m_address = remapped->second;
+            scheduledPacket.m_data = packet.m_data;
+        }
+
+        // Stable so datagrams delivered on the same millisecond keep their captured order
+        AZStd::stable_sort(m_scheduledPackets.begin(), m_scheduledPackets.end(),
+            [](const ScheduledPacket& lhs, const ScheduledPacket& rhs) { return lhs.m_deliveryTimeMs < rhs.m_deliveryTimeMs; });
+
+        AZLOG_INFO("Scheduled %u datagrams from %u remote addresses for replay, dropping %u",
+            aznumeric_cast<uint32_t>(m_scheduledPackets.size()), aznumeric_cast<uint32_t>(remappedAddresses.size()), m_droppedPacketCount);
+    }
+
+    void UdpReplayDriver::Update(AZ::TimeMs deltaTimeMs)
+    {
+        m_simulatedTimeMs += deltaTimeMs;
+        while (m_nextPacketIndex < m_scheduledPackets.size())
+        {
+            const ScheduledPacket& packet = m_scheduledPackets[m_nextPacketIndex];
+            if (packet.m_deliveryTimeMs > m_simulatedTimeMs)
+            {
+                break;
+            }
+
+            if (!m_networkInterface.InjectReceivedPacket(packet.m_address, packet.m_data.data(), aznumeric_cast<uint32_t>(packet.m_data.size())))
+            {
+                // The receive buffer is full for this update, retry the rest on the next update
+                break;
+            }
+            ++m_nextPacketIndex;
+        }
+    }
+
+    bool UdpReplayDriver::IsComplete() const
+    {
+        return m_nextPacketIndex >= m_scheduledPackets.size();
+    }
+
+    uint32_t UdpReplayDriver::GetInjectedPacketCount() const
+    {
+        return m_nextPacketIndex;
+    }
+
+    uint32_t UdpReplayDriver::GetDroppedPacketCount() const
+    {
+        return m_droppedPacketCount;
+    }
+}
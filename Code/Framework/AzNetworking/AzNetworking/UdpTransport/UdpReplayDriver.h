@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/PacketCapture.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    class UdpNetworkInterface;
+
+    //! Settings controlling how captured traffic is replayed.
+    struct UdpReplaySettings
+    {
+        float m_timeScale = 1.0f; //!< Playback speed, 2.0 replays twice as fast as captured
+        AZ::TimeMs m_latencyMs = AZ::TimeMs{ 0 }; //!< Additional latency added to every datagram
+        AZ::TimeMs m_jitterMs = AZ::TimeMs{ 0 }; //!< Maximum random latency added to every datagram, may reorder datagrams
+        float m_lossPercent = 0.0f; //!< Percentage of datagrams to drop
+        uint64_t m_seed = 1; //!< Seed for jitter and loss, replays with the same seed and capture are identical
+        uint16_t m_remapPortBase = 50000; //!< Captured remote addresses are remapped to loopback ports starting at this port
+    };
+
+    //! @class UdpReplayDriver
+    //! @brief injects the inbound datagrams of a packet capture into a Udp network interface on a simulated clock.
+    //!
+    //! Delivery times, jitter and loss are all computed up front from the capture and the seed, so a replay is only driven by
+    //! the update deltas it is given. Each distinct remote address in the capture is remapped to a loopback address, so any
+    //! responses the network interface sends are dropped locally instead of reaching the hosts that were captured.
+    class UdpReplayDriver
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(UdpReplayDriver, AZ::SystemAllocator, 0);
+
+        //! Constructor.
+        //! @param networkInterface the open network interface to inject datagrams into
+        //! @param settings         settings controlling how captured traffic is replayed
+        UdpReplayDriver(UdpNetworkInterface& networkInterface, const UdpReplaySettings& settings);
+        ~UdpReplayDriver() = default;
+
+        //! Reads a capture file and schedules its inbound datagrams for replay.
+        //! @param filePath path of the capture file to replay
+        //! @return boolean true on success, false if the capture could not be read
+        bool Load(const char* filePath);
+
+        //! Schedules the inbound datagrams of a capture for replay, replacing anything previously scheduled.
+        //! @param packets the captured datagrams to replay
+        void Schedule(const CapturedPackets& packets);
+
+        //! Advances the simulated clock and injects every datagram that is due.
+        //! Should be called immediately before the reader thread swaps buffers.
+        //! @param deltaTimeMs milliseconds since the last update
+        void Update(AZ::TimeMs deltaTimeMs);
+
+        //! Returns true once every scheduled datagram has been injected or dropped.
+        //! @return boolean true if the replay is complete
+        bool IsComplete() const;
+
+        //! Returns the number of datagrams injected so far.
+        //! @return the number of datagrams injected so far
+        uint32_t GetInjectedPacketCount() const;
+
+        //! Returns the number of datagrams dropped to simulate packet loss.
+        //! @return the number of datagrams dropped to simulate packet loss
+        uint32_t GetDroppedPacketCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpReplayDriver);
+
+        struct ScheduledPacket
+        {
+            AZ::TimeMs m_deliveryTimeMs = AZ::TimeMs{ 0 };
+            IpAddress m_address;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        UdpNetworkInterface& m_networkInterface;
+        UdpReplaySettings m_settings;
+        AZStd::vector<ScheduledPacket> m_scheduledPackets;
+        AZ::TimeMs m_simulatedTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_nextPacketIndex = 0;
+        uint32_t m_droppedPacketCount = 0;
+    };
+}
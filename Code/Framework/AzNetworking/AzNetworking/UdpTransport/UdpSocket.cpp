@@ -10,6 +10,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
+#include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/algorithm.h>
@@ -22,6 +23,36 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, AZ_TRAIT_USE_SOCKET_BATCHED_IO, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, UDP sends are queued and written to the socket when the network interface is updated or flushed");
+
+    static sockaddr_in ToSockAddr(const IpAddress& address)
+    {
+        sockaddr_in sockAddr;
+        memset(&sockAddr, 0, sizeof(sockAddr));
+        sockAddr.sin_family = AF_INET;
+        sockAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+        sockAddr.sin_port = address.GetPort(ByteOrder::Network);
+        return sockAddr;
+    }
+
+    //! Filters and logs a receive error, returns 0 if the error can be ignored.
+    static int32_t ProcessReceiveError(int32_t error)
+    {
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+        }
+
+        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -97,6 +128,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        FlushSendQueue();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -108,6 +140,33 @@ namespace AzNetworking
         uint32_t size,
         bool encrypt,
         DtlsEndpoint& dtlsEndpoint,
+        const ConnectionQuality& connectionQuality
+    ) const
+    {
+        return SendPayload(address, data, size, PacketBufferPtr(), encrypt, dtlsEndpoint, connectionQuality);
+    }
+
+    int32_t UdpSocket::Send
+    (
+        const IpAddress& address,
+        const PacketBufferPtr& packetBuffer,
+        bool encrypt,
+        DtlsEndpoint& dtlsEndpoint,
+        const ConnectionQuality& connectionQuality
+    ) const
+    {
+        AZ_Assert(packetBuffer != nullptr, "NULL packet buffer passed to send");
+        return SendPayload(address, packetBuffer->GetBuffer(), packetBuffer->GetSize(), packetBuffer, encrypt, dtlsEndpoint, connectionQuality);
+    }
+
+    int32_t UdpSocket::SendPayload
+    (
+        const IpAddress& address,
+        const uint8_t* data,
+        uint32_t size,
+        [[maybe_unused]] const PacketBufferPtr& packetBuffer,
+        bool encrypt,
+        DtlsEndpoint& dtlsEndpoint,
         [[maybe_unused]] const ConnectionQuality& connectionQuality
     ) const
     {
@@ -139,7 +198,7 @@ namespace AzNetworking
         if (connectionQuality.m_latencyMs <= AZ::TimeMs{ 0 })
 #endif
         {
-            sentBytes = SendInternal(address, data, size, encrypt, dtlsEndpoint);
+            sentBytes = SendInternal(address, data, size, packetBuffer, encrypt, dtlsEndpoint);
 
             if (sentBytes < 0)
             {
@@ -191,54 +250,210 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return ProcessReceiveError(GetLastNetworkError());
+        }
+
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    int32_t UdpSocket::ReceiveBatch(ReceiveSlot* slots, uint32_t slotCount) const
+    {
+        AZ_Assert(slots != nullptr, "NULL slots pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+        uint32_t receivedCount = 0;
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        mmsghdr messages[MaxReceiveBatchCount];
+        iovec buffers[MaxReceiveBatchCount];
+        sockaddr_in fromAddresses[MaxReceiveBatchCount];
+        while (receivedCount < slotCount)
+        {
+            const uint32_t batchCount = AZStd::min(slotCount - receivedCount, MaxReceiveBatchCount);
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                buffers[i].iov_base = slots[receivedCount + i].m_data;
+                buffers[i].iov_len = MaxUdpTransmissionUnit;
+                memset(&messages[i], 0, sizeof(messages[i]));
+                messages[i].msg_hdr.msg_name = &fromAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(fromAddresses[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            const int32_t result = recvmmsg(static_cast<int32_t>(m_socketFd), messages, batchCount, MSG_DONTWAIT, nullptr);
+            if (result < 0)
             {
-                return 0;
+                const int32_t error = ProcessReceiveError(GetLastNetworkError());
+                if (error < 0 && receivedCount == 0)
+                {
+                    return error;
+                }
+                break;
             }
 
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            for (int32_t i = 0; i < result; ++i)
             {
-                if (ignoreForciblyClosedError)
+                ReceiveSlot& slot = slots[receivedCount + i];
+                slot.m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+                slot.m_receivedBytes = aznumeric_cast<int32_t>(messages[i].msg_len);
+                if (slot.m_receivedBytes > 0)
                 {
-                    return 0;
+                    m_recvPackets++;
+                    m_recvBytes += slot.m_receivedBytes;
                 }
-                else
+            }
+            receivedCount += aznumeric_cast<uint32_t>(result);
+
+            if (aznumeric_cast<uint32_t>(result) < batchCount)
+            {
+                // The socket has been drained
+                break;
+            }
+        }
+#else
+        for (; receivedCount < slotCount; ++receivedCount)
+        {
+            ReceiveSlot& slot = slots[receivedCount];
+            slot.m_receivedBytes = Receive(slot.m_address, slot.m_data, MaxUdpTransmissionUnit);
+            if (slot.m_receivedBytes <= 0)
+            {
+                if (slot.m_receivedBytes < 0 && receivedCount == 0)
                 {
-                    return SocketOpResultError;
+                    return slot.m_receivedBytes;
                 }
+                break;
             }
+        }
+#endif
+        return aznumeric_cast<int32_t>(receivedCount);
+    }
 
-            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+    void UdpSocket::FlushSendQueue() const
+    {
+        if (m_queuedSends.empty())
+        {
+            return;
         }
 
-        if (receivedBytes <= 0)
+        if (IsOpen())
         {
-            return 0;
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+            mmsghdr messages[MaxQueuedSends];
+            iovec buffers[MaxQueuedSends];
+            sockaddr_in destAddresses[MaxQueuedSends];
+            const uint32_t queuedCount = aznumeric_cast<uint32_t>(m_queuedSends.size());
+            for (uint32_t i = 0; i < queuedCount; ++i)
+            {
+                const QueuedSend& queuedSend = m_queuedSends[i];
+                destAddresses[i] = ToSockAddr(queuedSend.m_address);
+                buffers[i].iov_base = queuedSend.m_buffer->GetBuffer();
+                buffers[i].iov_len = queuedSend.m_buffer->GetSize();
+                memset(&messages[i], 0, sizeof(messages[i]));
+                messages[i].msg_hdr.msg_name = &destAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(destAddresses[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            uint32_t sentCount = 0;
+            while (sentCount < queuedCount)
+            {
+                const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, queuedCount - sentCount, 0);
+                if (result < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (ErrorIsWouldBlock(error))
+                    {
+                        // The send buffer is full, drop the remaining payloads just like individual sends would
+                        break;
+                    }
+
+                    // Skip the payload that failed and continue with the rest
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    ++sentCount;
+                    continue;
+                }
+                sentCount += aznumeric_cast<uint32_t>(result);
+            }
+#else
+            for (const QueuedSend& queuedSend : m_queuedSends)
+            {
+                if (SendTo(queuedSend.m_address, queuedSend.m_buffer->GetBuffer(), queuedSend.m_buffer->GetSize()) < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error))
+                    {
+                        AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+            }
+#endif
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        // Returns the sent buffers to the pool
+        m_queuedSends.clear();
     }
 
-    int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
+    int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
-        sockaddr_in destAddr;
-        memset(&destAddr, 0, sizeof(destAddr));
-        destAddr.sin_family = AF_INET;
-        destAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
-        destAddr.sin_port = address.GetPort(ByteOrder::Network);
-        return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
+        if (net_UdpBatchSends)
+        {
+            QueueSend(address, data, size, packetBuffer);
+            return aznumeric_cast<int32_t>(size);
+        }
+
+        // Keep payloads in order if batching was just disabled
+        FlushSendQueue();
+        return SendTo(address, data, size);
+    }
+
+    int32_t UdpSocket::SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        const sockaddr_in destAddr = ToSockAddr(address);
+        return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (const sockaddr*)&destAddr, sizeof(destAddr));
+    }
+
+    void UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer) const
+    {
+        if (m_queuedSends.full())
+        {
+            FlushSendQueue();
+        }
+
+        QueuedSend queuedSend;
+        queuedSend.m_address = address;
+        if ((packetBuffer != nullptr) && (packetBuffer->GetBuffer() == data) && (packetBuffer->GetSize() == size))
+        {
+            queuedSend.m_buffer = packetBuffer;
+        }
+        else
+        {
+            queuedSend.m_buffer = m_packetBufferPool.Acquire();
+            if (!queuedSend.m_buffer->CopyValues(data, size))
+            {
+                AZLOG_ERROR("Payload of %u bytes exceeds the maximum Udp payload size and will not be sent", size);
+                return;
+            }
+        }
+        m_queuedSends.push_back(AZStd::move(queuedSend));
     }
 
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
-        return SendInternal(data.m_address, data.m_dataBuffer.GetBuffer(), data.m_dataBuffer.GetSize(), data.m_encrypt, *data.m_dtlsEndpoint);
+        return SendInternal(data.m_address, data.m_dataBuffer.GetBuffer(), data.m_dataBuffer.GetSize(), PacketBufferPtr(), data.m_encrypt, *data.m_dtlsEndpoint);
     }
 #endif
 }
@@ -11,8 +11,10 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -41,6 +43,20 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! The maximum number of payloads Send queues before the queue is flushed.
+        static constexpr uint32_t MaxQueuedSends = 64;
+
+        //! The maximum number of payloads read by a single system call in ReceiveBatch.
+        static constexpr uint32_t MaxReceiveBatchCount = 64;
+
+        //! A buffer to receive a single payload into using ReceiveBatch.
+        struct ReceiveSlot
+        {
+            uint8_t*  m_data = nullptr;    // Buffer to write the payload to, must be able to hold MaxUdpTransmissionUnit bytes
+            IpAddress m_address;           // On success, the address of the endpoint that sent the payload
+            int32_t   m_receivedBytes = 0; // On success, the size of the received payload
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -85,6 +101,16 @@ namespace AzNetworking
         //! @return number of bytes sent, <= 0 on error
         int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
 
+        //! Sends a single pooled payload over the UDP socket to the connected endpoint.
+        //! Queued sends keep a reference to the buffer rather than copying the payload.
+        //! @param address           the address to send the payload to
+        //! @param packetBuffer      the buffer holding the payload to send
+        //! @param encrypt           signals that the payload should be encrypted before transmitting if encryption is supported
+        //! @param dtlsEndpoint      data required for DTLS encryption
+        //! @param connectionQuality debug connection quality parameters
+        //! @return number of bytes sent, <= 0 on error
+        int32_t Send(const IpAddress& address, const PacketBufferPtr& packetBuffer, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+
         //! Receives a payload from the UDP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
         //! @param outData    on success, address to write the received data to
@@ -92,6 +118,21 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, reading up to MaxReceiveBatchCount payloads per system call on
+        //! platforms that support it.
+        //! @param slots     the buffers to receive into, on success the address and size of each received payload are written back
+        //! @param slotCount the number of buffers available
+        //! @return number of slots filled, slots may hold empty payloads, < 0 on error
+        int32_t ReceiveBatch(ReceiveSlot* slots, uint32_t slotCount) const;
+
+        //! Writes all payloads queued by Send since the last flush to the socket.
+        //! Payloads are queued while net_UdpBatchSends is enabled, and written using a single system call on platforms that support it.
+        void FlushSendQueue() const;
+
+        //! Returns the pool of buffers used for the payloads sent and received on this socket.
+        //! @return the pool of buffers used for the payloads sent and received on this socket
+        PacketBufferPool& GetPacketBufferPool() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -125,11 +166,33 @@ namespace AzNetworking
         mutable uint32_t m_sentPacketsEncrypted = 0;
         mutable uint32_t m_sentBytesEncryptionInflation = 0;
 
-        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
+        //! Sends or queues a single payload.
+        //! @param packetBuffer the pooled buffer holding data, may be null if the payload isn't pooled
+        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
     private:
 
+        //! Common implementation of both Send methods.
+        int32_t SendPayload(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+
+        //! Writes a single payload to the socket.
+        int32_t SendTo(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        //! Adds a payload to the send queue, flushing the queue first if it's full.
+        //! Pooled payloads are queued by reference, anything else is copied into a pooled buffer.
+        void QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size, const PacketBufferPtr& packetBuffer) const;
+
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            PacketBufferPtr m_buffer;
+        };
+
+        // Declared ahead of the send queue, which holds buffers from the pool
+        mutable PacketBufferPool m_packetBufferPool;
+
         SocketFd m_socketFd = InvalidSocketFd;
+        mutable AZStd::fixed_vector<QueuedSend, MaxQueuedSends> m_queuedSends;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -14,6 +14,11 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline PacketBufferPool& UdpSocket::GetPacketBufferPool() const
+    {
+        return m_packetBufferPool;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/PacketCapture.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AzNetworking
+{
+    // Large enough for the serialized file header or record header
+    static constexpr uint32_t MaxCaptureHeaderSize = 32;
+
+    static bool SerializeRecordHeader(ISerializer& serializer, int64_t& timeMs, uint8_t& direction, IpAddress& address, uint16_t& size)
+    {
+        return serializer.Serialize(timeMs, "TimeMs")
+            && serializer.Serialize(direction, "Direction", 0, aznumeric_cast<uint8_t>(PacketCaptureDirection::Outbound))
+            && serializer.Serialize(address, "Address")
+            && serializer.Serialize(size, "Size", 0, aznumeric_cast<uint16_t>(MaxUdpTransmissionUnit));
+    }
+
+    bool PacketCaptureWriter::Open(const char* filePath)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_file.Close();
+        m_packetCount = 0;
+        m_startTimeMs = AZ::GetElapsedTimeMs();
+        if (!m_file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            return false;
+        }
+
+        uint8_t header[MaxCaptureHeaderSize];
+        NetworkInputSerializer networkSerializer(header, sizeof(header));
+        ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+        uint32_t magic = FileMagic;
+        uint16_t version = FileVersion;
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        m_file.Write(header, serializer.GetSize());
+        return true;
+    }
+
+    void PacketCaptureWriter::Close()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_file.Close();
+    }
+
+    bool PacketCaptureWriter::IsOpen() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_file.IsOpen();
+    }
+
+    void PacketCaptureWriter::Record(PacketCaptureDirection direction, const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        if (size > MaxUdpTransmissionUnit)
+        {
+            AZLOG_WARN("Skipping capture of a %u byte datagram, which exceeds the maximum transmission unit", size);
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (!m_file.IsOpen())
+        {
+            return;
+        }
+
+        int64_t timeMs = aznumeric_cast<int64_t>(AZ::GetElapsedTimeMs() - m_startTimeMs);
+        uint8_t directionValue = aznumeric_cast<uint8_t>(direction);
+        IpAddress remoteAddress = address;
+        uint16_t packetSize = aznumeric_cast<uint16_t>(size);
+
+        uint8_t header[MaxCaptureHeaderSize];
+        NetworkInputSerializer serializer(header, sizeof(header));
+        SerializeRecordHeader(serializer, timeMs, directionValue, remoteAddress, packetSize);
+        m_file.Write(header, serializer.GetSize());
+        m_file.Write(data, size);
+        ++m_packetCount;
+    }
+
+    uint32_t PacketCaptureWriter::GetPacketCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_packetCount;
+    }
+
+    bool ReadPacketCapture(const char* filePath, CapturedPackets& outPackets)
+    {
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(filePath);
+        AZStd::vector<uint8_t> fileData(fileSize);
+        if (fileSize == 0 || AZ::IO::SystemFile::Read(filePath, fileData.data(), fileSize) != fileSize)
+        {
+            AZLOG_ERROR("Failed to read packet capture %s", filePath);
+            return false;
+        }
+
+        const uint32_t captureSize = aznumeric_cast<uint32_t>(fileData.size());
+        uint32_t offset = 0;
+        {
+            NetworkOutputSerializer networkSerializer(fileData.data(), captureSize);
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+            uint32_t magic = 0;
+            uint16_t version = 0;
+            if (!serializer.Serialize(magic, "Magic") || !serializer.Serialize(version, "Version")
+                || magic != PacketCaptureWriter::FileMagic || version != PacketCaptureWriter::FileVersion)
+            {
+                AZLOG_ERROR("%s is not a supported packet capture", filePath);
+                return false;
+            }
+            offset = networkSerializer.GetReadSize();
+        }
+
+        while (offset < captureSize)
+        {
+            NetworkOutputSerializer serializer(fileData.data() + offset, captureSize - offset);
+            int64_t timeMs = 0;
+            uint8_t direction = 0;
+            IpAddress address;
+            uint16_t packetSize = 0;
+            if (!SerializeRecordHeader(serializer, timeMs, direction, address, packetSize) || serializer.GetUnreadSize() < packetSize)
+            {
+                // Captures are cut short if the process exits mid write, keep everything read up to that point
+                AZLOG_WARN("Packet capture %s is truncated after %u packets", filePath, aznumeric_cast<uint32_t>(outPackets.size()));
+                break;
+            }
+
+            const uint8_t* packetData = serializer.GetUnreadData();
+            CapturedPacket& packet = outPackets.emplace_back();
+            packet.m_timeMs = aznumeric_cast<AZ::TimeMs>(timeMs);
+            packet.m_direction = aznumeric_cast<PacketCaptureDirection>(direction);
+            packet.m_address = address;
+            packet.m_data.assign(packetData, packetData + packetSize);
+            offset += serializer.GetReadSize() + packetSize;
+        }
+        return true;
+    }
+}
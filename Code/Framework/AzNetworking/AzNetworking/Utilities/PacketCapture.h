@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AzNetworking
+{
+    enum class PacketCaptureDirection : uint8_t
+    {
+        Inbound,
+        Outbound
+    };
+
+    //! A single datagram read back from a packet capture file.
+    struct CapturedPacket
+    {
+        AZ::TimeMs m_timeMs = AZ::TimeMs{ 0 }; //!< Time since the capture was started
+        PacketCaptureDirection m_direction = PacketCaptureDirection::Inbound;
+        IpAddress m_address; //!< The remote address the datagram was received from or sent to
+        AZStd::vector<uint8_t> m_data;
+    };
+
+    using CapturedPackets = AZStd::vector<CapturedPacket>;
+
+    //! @class PacketCaptureWriter
+    //! @brief writes timestamped inbound and outbound datagrams of a network interface to a compact capture file.
+    //!
+    //! Inbound datagrams are captured as they were read off the socket, outbound datagrams are captured after compression and
+    //! before encryption. Captures of encrypted interfaces can't be replayed, since the inbound datagrams are still encrypted.
+    class PacketCaptureWriter
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(PacketCaptureWriter, AZ::SystemAllocator, 0);
+
+        static constexpr uint32_t FileMagic = 0x43505A41; // "AZPC"
+        static constexpr uint16_t FileVersion = 1;
+
+        PacketCaptureWriter() = default;
+        ~PacketCaptureWriter() = default;
+
+        //! Creates or overwrites the capture file at the provided path, timestamps are relative to this call.
+        //! @param filePath path of the capture file to write
+        //! @return boolean true on success, false if the file could not be opened
+        bool Open(const char* filePath);
+
+        //! Flushes and closes the capture file.
+        void Close();
+
+        //! Returns true if a capture file is open.
+        //! @return boolean true if a capture file is open
+        bool IsOpen() const;
+
+        //! Appends a datagram to the capture file, safe to call from multiple threads.
+        //! @param direction whether the datagram was received or sent
+        //! @param address   the remote address the datagram was received from or sent to
+        //! @param data      pointer to the datagram
+        //! @param size      the size of the datagram
+        void Record(PacketCaptureDirection direction, const IpAddress& address, const uint8_t* data, uint32_t size);
+
+        //! Returns the number of datagrams written.
+        //! @return the number of datagrams written
+        uint32_t GetPacketCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketCaptureWriter);
+
+        mutable AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        AZ::TimeMs m_startTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_packetCount = 0;
+    };
+
+    //! Reads all datagrams from a capture file.
+    //! @param filePath   path of the capture file to read
+    //! @param outPackets the datagrams read, in the order they were captured
+    //! @return boolean true on success, false if the file could not be read or is malformed
+    bool ReadPacketCapture(const char* filePath, CapturedPackets& outPackets);
+}
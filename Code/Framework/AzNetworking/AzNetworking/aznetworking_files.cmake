@@ -33,6 +33,9 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/PacketBufferPool.cpp
+    DataStructures/PacketBufferPool.h
+    DataStructures/PacketBufferPool.inl
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -48,6 +51,10 @@ set(FILES
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
     Serialization/AzContainerSerializers.h
+    Serialization/BaselineDelta.cpp
+    Serialization/BaselineDelta.h
+    Serialization/BitPackedSerializer.cpp
+    Serialization/BitPackedSerializer.h
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
@@ -117,6 +124,8 @@ set(FILES
     UdpTransport/UdpReaderThread.h
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
+    UdpTransport/UdpReplayDriver.cpp
+    UdpTransport/UdpReplayDriver.h
     UdpTransport/UdpSocket.cpp
     UdpTransport/UdpSocket.h
     UdpTransport/UdpSocket.inl
@@ -132,6 +141,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/PacketCapture.cpp
+    Utilities/PacketCapture.h
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -10,4 +10,25 @@
 
 namespace UnitTest
 {
+    TEST(CompressionMetrics, DefaultsWithoutPackets)
+    {
+        AzNetworking::CompressionMetrics metrics;
+        EXPECT_FLOAT_EQ(metrics.GetCompressionRatio(), 1.0f);
+        EXPECT_FLOAT_EQ(metrics.GetAverageTimeUs(), 0.0f);
+    }
+
+    TEST(CompressionMetrics, LogPacket)
+    {
+        AzNetworking::CompressionMetrics metrics;
+        metrics.LogPacket(400, 100, 10);
+        metrics.LogPacket(200, 100, 30);
+        EXPECT_EQ(metrics.m_packetCount, 2);
+        EXPECT_FLOAT_EQ(metrics.GetCompressionRatio(), 3.0f);
+        EXPECT_FLOAT_EQ(metrics.GetAverageTimeUs(), 20.0f);
+
+        AzNetworking::ConnectionMetrics connectionMetrics;
+        connectionMetrics.m_sendCompression = metrics;
+        connectionMetrics.Reset();
+        EXPECT_EQ(connectionMetrics.m_sendCompression.m_packetCount, 0);
+    }
 }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PacketBufferPool.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    TEST(PacketBufferPool, AcquireAndRelease)
+    {
+        AzNetworking::PacketBufferPool pool;
+        {
+            AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+            EXPECT_EQ(buffer->GetSize(), 0);
+            EXPECT_EQ(pool.GetBufferCount(), 1);
+            EXPECT_EQ(pool.GetFreeBufferCount(), 0);
+        }
+        EXPECT_EQ(pool.GetBufferCount(), 1);
+        EXPECT_EQ(pool.GetFreeBufferCount(), 1);
+    }
+
+    TEST(PacketBufferPool, ReusesReleasedBuffers)
+    {
+        AzNetworking::PacketBufferPool pool;
+        const uint8_t data[] = { 1, 2, 3, 4 };
+
+        const AzNetworking::PooledPacketBuffer* firstBuffer = nullptr;
+        {
+            AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+            EXPECT_TRUE(buffer->CopyValues(data, sizeof(data)));
+            firstBuffer = buffer.get();
+        }
+
+        AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+        EXPECT_EQ(buffer.get(), firstBuffer);
+        EXPECT_EQ(buffer->GetSize(), 0);
+        EXPECT_EQ(pool.GetBufferCount(), 1);
+    }
+
+    TEST(PacketBufferPool, SharedReferences)
+    {
+        AzNetworking::PacketBufferPool pool;
+        AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+        AzNetworking::PacketBufferPtr sharedBuffer = buffer;
+
+        buffer = nullptr;
+        EXPECT_EQ(pool.GetFreeBufferCount(), 0);
+
+        AzNetworking::PacketBufferPtr otherBuffer = pool.Acquire();
+        EXPECT_NE(otherBuffer.get(), sharedBuffer.get());
+        EXPECT_EQ(pool.GetBufferCount(), 2);
+
+        sharedBuffer = nullptr;
+        otherBuffer = nullptr;
+        EXPECT_EQ(pool.GetFreeBufferCount(), 2);
+    }
+
+    TEST(PacketBufferPool, CapacityLimits)
+    {
+        AzNetworking::PacketBufferPool pool;
+        AzNetworking::PacketBufferPtr buffer = pool.Acquire();
+
+        uint8_t data[AzNetworking::PooledPacketBuffer::Capacity + 1] = {};
+        EXPECT_TRUE(buffer->CopyValues(data, AzNetworking::PooledPacketBuffer::Capacity));
+        EXPECT_EQ(buffer->GetSize(), AzNetworking::PooledPacketBuffer::Capacity);
+        EXPECT_FALSE(buffer->CopyValues(data, sizeof(data)));
+        EXPECT_FALSE(buffer->Resize(AzNetworking::PooledPacketBuffer::Capacity + 1));
+        EXPECT_TRUE(buffer->Resize(AzNetworking::MaxUdpTransmissionUnit));
+        EXPECT_EQ(buffer->GetSize(), AzNetworking::MaxUdpTransmissionUnit);
+    }
+}
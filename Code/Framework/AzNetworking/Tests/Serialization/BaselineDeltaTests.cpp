@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class BaselineDeltaTests
+        : public AllocatorsFixture
+    {
+    public:
+        //! Encodes the data against the baseline, decodes it again and verifies the result matches the data.
+        //! @return the size of the encoded data
+        uint32_t RoundTrip(const AZStd::vector<uint8_t>& data, const AZStd::vector<uint8_t>& baseline)
+        {
+            AZStd::vector<uint8_t> encoded(data.size() * 2 + 16);
+            uint32_t encodedSize = 0;
+            EXPECT_TRUE(EncodeBaselineDelta(data.data(), aznumeric_cast<uint32_t>(data.size()), baseline.data(),
+                aznumeric_cast<uint32_t>(baseline.size()), encoded.data(), aznumeric_cast<uint32_t>(encoded.size()), encodedSize));
+
+            uint32_t decodedSize = 0;
+            EXPECT_TRUE(GetBaselineDeltaDecodedSize(encoded.data(), encodedSize, decodedSize));
+            EXPECT_EQ(data.size(), decodedSize);
+
+            AZStd::vector<uint8_t> decoded(decodedSize);
+            EXPECT_TRUE(DecodeBaselineDelta(encoded.data(), encodedSize, baseline.data(), aznumeric_cast<uint32_t>(baseline.size()),
+                decoded.data(), aznumeric_cast<uint32_t>(decoded.size()), decodedSize));
+            EXPECT_EQ(data, decoded);
+            return encodedSize;
+        }
+    };
+
+    TEST_F(BaselineDeltaTests, EmptyBaseline_RoundTrip)
+    {
+        AZStd::vector<uint8_t> data = { 1, 2, 3, 0, 0, 0, 0, 4, 5 };
+        RoundTrip(data, {});
+    }
+
+    TEST_F(BaselineDeltaTests, IdenticalBaseline_EncodesSize)
+    {
+        AZStd::vector<uint8_t> data(200);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        // The decoded size and a single run of 200 unchanged bytes
+        EXPECT_EQ(5, RoundTrip(data, data));
+    }
+
+    TEST_F(BaselineDeltaTests, ChangedBytes_OnlyChangesEncoded)
+    {
+        AZStd::vector<uint8_t> baseline(64, 0xA5);
+        AZStd::vector<uint8_t> data = baseline;
+        data[10] = 0x00;
+        data[12] = 0xFF;
+        data[40] = 0x11;
+        // Size, then 10 unchanged 3 changed (including the unchanged byte in between), then 27 unchanged 1 changed, then 23 unchanged
+        EXPECT_EQ(1 + 2 + 3 + 2 + 1 + 2, RoundTrip(data, baseline));
+    }
+
+    TEST_F(BaselineDeltaTests, DifferentSizes_RoundTrip)
+    {
+        AZStd::vector<uint8_t> shortData = { 9, 8, 7 };
+        AZStd::vector<uint8_t> longData(300, 0x3C);
+        RoundTrip(shortData, longData);
+        RoundTrip(longData, shortData);
+    }
+
+    TEST_F(BaselineDeltaTests, EncodeBufferTooSmall_Fails)
+    {
+        AZStd::vector<uint8_t> data(32, 0x42);
+        uint8_t encoded[8];
+        uint32_t encodedSize = 0;
+        EXPECT_FALSE(EncodeBaselineDelta(data.data(), aznumeric_cast<uint32_t>(data.size()), nullptr, 0, encoded, sizeof(encoded), encodedSize));
+    }
+
+    TEST_F(BaselineDeltaTests, MalformedData_Fails)
+    {
+        uint8_t decoded[16];
+        uint32_t decodedSize = 0;
+
+        // Decoded size larger than the output buffer
+        const uint8_t tooLarge[] = { 17, 17, 0 };
+        EXPECT_FALSE(DecodeBaselineDelta(tooLarge, sizeof(tooLarge), nullptr, 0, decoded, sizeof(decoded), decodedSize));
+
+        // A run past the decoded size
+        const uint8_t runTooLong[] = { 4, 5, 0 };
+        EXPECT_FALSE(DecodeBaselineDelta(runTooLong, sizeof(runTooLong), nullptr, 0, decoded, sizeof(decoded), decodedSize));
+
+        // An empty run would never finish
+        const uint8_t emptyRun[] = { 4, 0, 0 };
+        EXPECT_FALSE(DecodeBaselineDelta(emptyRun, sizeof(emptyRun), nullptr, 0, decoded, sizeof(decoded), decodedSize));
+
+        // Truncated changed bytes
+        const uint8_t truncated[] = { 4, 0, 4, 1, 2 };
+        EXPECT_FALSE(DecodeBaselineDelta(truncated, sizeof(truncated), nullptr, 0, decoded, sizeof(decoded), decodedSize));
+    }
+}
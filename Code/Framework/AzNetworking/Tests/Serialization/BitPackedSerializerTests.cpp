@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/BitPackedSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    struct BitPackedTestStruct
+    {
+        bool m_flag = false;
+        uint8_t m_smallValue = 0;
+        int32_t m_signedValue = 0;
+        int64_t m_fullRangeValue = 0;
+        float m_floatValue = 0.0f;
+        double m_doubleValue = 0.0;
+        QuantizedValues<3, 2, -256, 256> m_position;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            serializer.Serialize(m_flag, "Flag");
+            serializer.Serialize(m_smallValue, "SmallValue", uint8_t(0), uint8_t(5));
+            serializer.Serialize(m_signedValue, "SignedValue", -100, 100);
+            serializer.Serialize(m_fullRangeValue, "FullRangeValue");
+            serializer.Serialize(m_floatValue, "FloatValue");
+            serializer.Serialize(m_doubleValue, "DoubleValue");
+            serializer.Serialize(m_position, "Position");
+            return serializer.IsValid();
+        }
+    };
+
+    TEST(BitPackedSerializerTests, GetBitCountForRange)
+    {
+        EXPECT_EQ(0, GetBitCountForRange(0));
+        EXPECT_EQ(1, GetBitCountForRange(1));
+        EXPECT_EQ(2, GetBitCountForRange(3));
+        EXPECT_EQ(3, GetBitCountForRange(4));
+        EXPECT_EQ(8, GetBitCountForRange(255));
+        EXPECT_EQ(32, GetBitCountForRange(0xFFFFFFFF));
+        EXPECT_EQ(64, GetBitCountForRange(0xFFFFFFFFFFFFFFFF));
+    }
+
+    TEST(BitPackedSerializerTests, SerializeValues_RoundTrip)
+    {
+        BitPackedTestStruct input;
+        input.m_flag = true;
+        input.m_smallValue = 5;
+        input.m_signedValue = -73;
+        input.m_fullRangeValue = AZStd::numeric_limits<int64_t>::min();
+        input.m_floatValue = -1234.5f;
+        input.m_doubleValue = 3.0e100;
+        input.m_position = AZ::Vector3(-255.0f, 0.5f, 100.0f);
+
+        uint8_t buffer[64];
+        BitPackedInputSerializer inputSerializer(buffer, sizeof(buffer));
+        EXPECT_TRUE(input.Serialize(inputSerializer));
+        // 1 + 3 + 8 + 64 + 32 + 64 + 3 * 16
+        EXPECT_EQ(220, inputSerializer.GetSizeInBits());
+        EXPECT_EQ(28, inputSerializer.GetSize());
+
+        BitPackedTestStruct output;
+        BitPackedOutputSerializer outputSerializer(buffer, inputSerializer.GetSize());
+        EXPECT_TRUE(output.Serialize(outputSerializer));
+        EXPECT_EQ(inputSerializer.GetSizeInBits(), outputSerializer.GetReadSizeInBits());
+        EXPECT_EQ(input.m_flag, output.m_flag);
+        EXPECT_EQ(input.m_smallValue, output.m_smallValue);
+        EXPECT_EQ(input.m_signedValue, output.m_signedValue);
+        EXPECT_EQ(input.m_fullRangeValue, output.m_fullRangeValue);
+        EXPECT_EQ(input.m_floatValue, output.m_floatValue);
+        EXPECT_EQ(input.m_doubleValue, output.m_doubleValue);
+        EXPECT_EQ(input.m_position, output.m_position);
+    }
+
+    TEST(BitPackedSerializerTests, SerializeBytes_RoundTrip)
+    {
+        char input[16] = "bit packed";
+        uint32_t inputSize = 10;
+
+        uint8_t buffer[32];
+        BitPackedInputSerializer inputSerializer(buffer, sizeof(buffer));
+        bool flag = true;
+        inputSerializer.Serialize(flag, "UnalignBytes");
+        EXPECT_TRUE(inputSerializer.SerializeBytes(reinterpret_cast<uint8_t*>(input), sizeof(input), true, inputSize, "Bytes"));
+        // 1 + 5 + 10 * 8
+        EXPECT_EQ(86, inputSerializer.GetSizeInBits());
+
+        char output[16] = {};
+        uint32_t outputSize = 0;
+        BitPackedOutputSerializer outputSerializer(buffer, inputSerializer.GetSize());
+        outputSerializer.Serialize(flag, "UnalignBytes");
+        EXPECT_TRUE(outputSerializer.SerializeBytes(reinterpret_cast<uint8_t*>(output), sizeof(output), true, outputSize, "Bytes"));
+        EXPECT_EQ(inputSize, outputSize);
+        EXPECT_STREQ(input, output);
+    }
+
+    TEST(BitPackedSerializerTests, SerializeValue_OutOfRange_Invalidates)
+    {
+        uint8_t buffer[8];
+        BitPackedInputSerializer inputSerializer(buffer, sizeof(buffer));
+        int32_t value = 101;
+        EXPECT_FALSE(inputSerializer.Serialize(value, "Value", -100, 100));
+        EXPECT_FALSE(inputSerializer.IsValid());
+    }
+
+    TEST(BitPackedSerializerTests, SerializeValue_BufferFull_Invalidates)
+    {
+        uint8_t buffer[4];
+        BitPackedInputSerializer inputSerializer(buffer, sizeof(buffer));
+        uint32_t value = 1;
+        EXPECT_TRUE(inputSerializer.Serialize(value, "Value", 0, 0x00FFFFFF));
+        EXPECT_FALSE(inputSerializer.Serialize(value, "Value", 0, 0xFF));
+        EXPECT_FALSE(inputSerializer.IsValid());
+
+        BitPackedOutputSerializer outputSerializer(buffer, 3);
+        EXPECT_TRUE(outputSerializer.Serialize(value, "Value", 0, 0x00FFFFFF));
+        EXPECT_FALSE(outputSerializer.Serialize(value, "Value", 0, 0xFF));
+        EXPECT_FALSE(outputSerializer.IsValid());
+    }
+
+    TEST(BitPackedSerializerTests, TrackChangedSerializer_TracksChanges)
+    {
+        uint8_t buffer[8];
+        uint16_t value = 300;
+        BitPackedInputSerializer inputSerializer(buffer, sizeof(buffer));
+        inputSerializer.Serialize(value, "Value", 0, 1000);
+
+        TrackChangedSerializer<BitPackedOutputSerializer> unchangedSerializer(buffer, inputSerializer.GetSize());
+        unchangedSerializer.Serialize(value, "Value", 0, 1000);
+        EXPECT_FALSE(unchangedSerializer.GetTrackedChangesFlag());
+
+        value = 0;
+        TrackChangedSerializer<BitPackedOutputSerializer> changedSerializer(buffer, inputSerializer.GetSize());
+        changedSerializer.Serialize(value, "Value", 0, 1000);
+        EXPECT_TRUE(changedSerializer.GetTrackedChangesFlag());
+        EXPECT_EQ(300, value);
+    }
+}
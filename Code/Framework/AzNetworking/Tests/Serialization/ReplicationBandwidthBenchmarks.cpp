@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/Serialization/AzContainerSerializers.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/BitPackedSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! The replicated state of a single entity, laid out like a character with a NetworkTransformComponent and a few gameplay
+    //! properties.
+    struct EntityState
+    {
+        enum Field : uint8_t
+        {
+            Translation = 1 << 0,
+            Rotation = 1 << 1,
+            Scale = 1 << 2,
+            Health = 1 << 3,
+            AnimationState = 1 << 4,
+            IsCrouching = 1 << 5,
+            AllFields = (1 << 6) - 1
+        };
+
+        AZ::Vector3 m_translation = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        float m_scale = 1.0f;
+        uint16_t m_health = 1000;
+        uint8_t m_animationState = 0;
+        bool m_isCrouching = false;
+
+        //! Returns the fields that differ from the other state.
+        uint8_t GetChangedFields(const EntityState& rhs) const
+        {
+            return (m_translation != rhs.m_translation ? Translation : 0)
+                | (m_rotation != rhs.m_rotation ? Rotation : 0)
+                | (m_scale != rhs.m_scale ? Scale : 0)
+                | (m_health != rhs.m_health ? Health : 0)
+                | (m_animationState != rhs.m_animationState ? AnimationState : 0)
+                | (m_isCrouching != rhs.m_isCrouching ? IsCrouching : 0);
+        }
+
+        //! Serializes the changed fields, the same way generated components serialize their dirty network properties.
+        bool Serialize(ISerializer& serializer, uint8_t changedFields)
+        {
+            serializer.Serialize(changedFields, "ChangedFields", uint8_t(0), uint8_t(AllFields));
+            if (changedFields & Translation)
+            {
+                serializer.Serialize(m_translation, "Translation");
+            }
+            if (changedFields & Rotation)
+            {
+                serializer.Serialize(m_rotation, "Rotation");
+            }
+            if (changedFields & Scale)
+            {
+                serializer.Serialize(m_scale, "Scale");
+            }
+            if (changedFields & Health)
+            {
+                serializer.Serialize(m_health, "Health", uint16_t(0), uint16_t(1000));
+            }
+            if (changedFields & AnimationState)
+            {
+                serializer.Serialize(m_animationState, "AnimationState", uint8_t(0), uint8_t(15));
+            }
+            if (changedFields & IsCrouching)
+            {
+                serializer.Serialize(m_isCrouching, "IsCrouching");
+            }
+            return serializer.IsValid();
+        }
+    };
+
+    //! The recorded state of every entity on every network tick.
+    struct EntityStateTrace
+    {
+        uint32_t m_entityCount = 0;
+        uint32_t m_tickCount = 0;
+        //! Indexed by tick * m_entityCount + entity.
+        AZStd::vector<EntityState> m_states;
+
+        const EntityState& GetState(uint32_t tick, uint32_t entity) const
+        {
+            return m_states[tick * m_entityCount + entity];
+        }
+
+        //! Records a trace of characters that alternate between standing idle and walking around, changing direction smoothly,
+        //! and occasionally taking damage or crouching. The random seed is fixed so every run replays the same trace.
+        static EntityStateTrace Record(uint32_t entityCount, uint32_t tickCount, float tickSeconds)
+        {
+            EntityStateTrace trace;
+            trace.m_entityCount = entityCount;
+            trace.m_tickCount = tickCount;
+            trace.m_states.resize(entityCount * tickCount);
+
+            AZ::SimpleLcgRandom random(42);
+            struct Simulation
+            {
+                EntityState m_state;
+                float m_heading = 0.0f;
+                float m_turnRate = 0.0f;
+                float m_speed = 0.0f;
+                uint32_t m_ticksUntilChange = 0;
+            };
+            AZStd::vector<Simulation> entities(entityCount);
+            for (Simulation& entity : entities)
+            {
+                entity.m_state.m_translation = AZ::Vector3(random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, 0.0f);
+                entity.m_heading = random.GetRandomFloat() * AZ::Constants::TwoPi;
+            }
+
+            for (uint32_t tick = 0; tick < tickCount; ++tick)
+            {
+                for (uint32_t index = 0; index < entityCount; ++index)
+                {
+                    Simulation& entity = entities[index];
+                    if (entity.m_ticksUntilChange == 0)
+                    {
+                        // Pick a new activity, a third of the time the character stands still
+                        const bool walking = random.GetRandomFloat() > 0.33f;
+                        entity.m_speed = walking ? 2.0f + random.GetRandomFloat() * 4.0f : 0.0f;
+                        entity.m_turnRate = walking ? (random.GetRandomFloat() - 0.5f) * 2.0f : 0.0f;
+                        entity.m_state.m_animationState = walking ? static_cast<uint8_t>(1 + random.GetRandom() % 3) : 0;
+                        entity.m_state.m_isCrouching = !walking && (random.GetRandomFloat() > 0.7f);
+                        entity.m_ticksUntilChange = 30 + random.GetRandom() % 240;
+                    }
+                    --entity.m_ticksUntilChange;
+
+                    if (entity.m_speed > 0.0f)
+                    {
+                        entity.m_heading += entity.m_turnRate * tickSeconds;
+                        const AZ::Vector3 direction(AZ::Cos(entity.m_heading), AZ::Sin(entity.m_heading), 0.0f);
+                        entity.m_state.m_translation += direction * (entity.m_speed * tickSeconds);
+                        entity.m_state.m_rotation = AZ::Quaternion::CreateRotationZ(entity.m_heading);
+                    }
+                    if ((entity.m_state.m_health > 0) && (random.GetRandom() % 500 == 0))
+                    {
+                        entity.m_state.m_health -= AZStd::min<uint16_t>(entity.m_state.m_health, static_cast<uint16_t>(random.GetRandom() % 100));
+                    }
+                    trace.m_states[tick * entityCount + index] = entity.m_state;
+                }
+            }
+            return trace;
+        }
+    };
+
+    //! Replays an entity state trace through the replication serializers and reports the resulting bandwidth.
+    //! Like the entity replicators, every tick sends the fields of each entity that changed since the state the client last
+    //! acknowledged. Acknowledgements arrive AckDelayTicks after a send, which is about 50ms of round trip time at 60Hz.
+    //! The BytesPerUpdate and BytesPerTick counters are the payload sizes without packet headers, the measured time is the cost
+    //! of encoding the whole trace.
+    class ReplicationBandwidthBenchmark
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 64;
+        static constexpr uint32_t TickCount = 600;
+        static constexpr float TickSeconds = 1.0f / 60.0f;
+        static constexpr uint32_t AckDelayTicks = 3;
+        static constexpr uint32_t MaxUpdateSize = 256;
+
+        enum class Encoding
+        {
+            ByteAligned,
+            BitPacked,
+            BitPackedBaselineDelta
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_trace = EntityStateTrace::Record(EntityCount, TickCount, TickSeconds);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_trace = {};
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void ReplayTrace(::benchmark::State& state, Encoding encoding)
+        {
+            struct SentUpdate
+            {
+                uint32_t m_tick = 0;
+                EntityState m_state;
+                uint32_t m_size = 0;
+                uint8_t m_data[MaxUpdateSize];
+            };
+            struct Replicator
+            {
+                //! The most recent sent update that was acknowledged, followed by the updates that are still in flight.
+                AZStd::vector<SentUpdate> m_sentUpdates;
+            };
+
+            uint64_t totalBytes = 0;
+            uint64_t totalUpdates = 0;
+            uint64_t totalTicks = 0;
+            for (auto _ : state)
+            {
+                AZStd::vector<Replicator> replicators(m_trace.m_entityCount);
+                for (uint32_t tick = 0; tick < m_trace.m_tickCount; ++tick)
+                {
+                    for (uint32_t entity = 0; entity < m_trace.m_entityCount; ++entity)
+                    {
+                        Replicator& replicator = replicators[entity];
+
+                        // Drop all acknowledged updates except for the most recent one, which is the baseline
+                        auto firstInFlight = AZStd::find_if(replicator.m_sentUpdates.begin(), replicator.m_sentUpdates.end(),
+                            [tick](const SentUpdate& update) { return update.m_tick + AckDelayTicks > tick; });
+                        if (firstInFlight - replicator.m_sentUpdates.begin() > 1)
+                        {
+                            replicator.m_sentUpdates.erase(replicator.m_sentUpdates.begin(), firstInFlight - 1);
+                        }
+                        const bool hasBaseline = !replicator.m_sentUpdates.empty() && (replicator.m_sentUpdates.front().m_tick + AckDelayTicks <= tick);
+
+                        EntityState current = m_trace.GetState(tick, entity);
+                        const uint8_t changedFields = hasBaseline ? current.GetChangedFields(replicator.m_sentUpdates.front().m_state) : uint8_t(EntityState::AllFields);
+                        if (changedFields == 0)
+                        {
+                            continue;
+                        }
+
+                        SentUpdate& update = replicator.m_sentUpdates.emplace_back();
+                        update.m_tick = tick;
+                        update.m_state = current;
+                        uint32_t sentBytes = 0;
+                        switch (encoding)
+                        {
+                        case Encoding::ByteAligned:
+                        {
+                            NetworkInputSerializer serializer(update.m_data, MaxUpdateSize);
+                            current.Serialize(serializer, changedFields);
+                            sentBytes = update.m_size = serializer.GetSize();
+                        }
+                        break;
+                        case Encoding::BitPacked:
+                        case Encoding::BitPackedBaselineDelta:
+                        {
+                            BitPackedInputSerializer serializer(update.m_data, MaxUpdateSize);
+                            current.Serialize(serializer, changedFields);
+                            sentBytes = update.m_size = serializer.GetSize();
+                            if (encoding == Encoding::BitPackedBaselineDelta)
+                            {
+                                // Look the baseline up again, emplace_back may have reallocated the sent updates
+                                const SentUpdate* baseline = hasBaseline ? &replicator.m_sentUpdates.front() : nullptr;
+                                uint8_t encoded[MaxUpdateSize * 2];
+                                EncodeBaselineDelta(update.m_data, update.m_size, baseline ? baseline->m_data : nullptr,
+                                    baseline ? baseline->m_size : 0, encoded, sizeof(encoded), sentBytes);
+                                ::benchmark::DoNotOptimize(encoded);
+                                // The sequence id of the baseline is sent along with the delta
+                                sentBytes += hasBaseline ? sizeof(uint16_t) : 0;
+                            }
+                        }
+                        break;
+                        }
+
+                        totalBytes += sentBytes;
+                        ++totalUpdates;
+                    }
+                    ++totalTicks;
+                }
+            }
+
+            state.SetItemsProcessed(totalUpdates);
+            state.counters["BytesPerUpdate"] = ::benchmark::Counter(totalUpdates ? static_cast<double>(totalBytes) / totalUpdates : 0.0);
+            state.counters["BytesPerTick"] = ::benchmark::Counter(totalTicks ? static_cast<double>(totalBytes) / totalTicks : 0.0);
+        }
+
+    protected:
+        EntityStateTrace m_trace;
+    };
+
+    BENCHMARK_DEFINE_F(ReplicationBandwidthBenchmark, ByteAligned)(::benchmark::State& state)
+    {
+        ReplayTrace(state, Encoding::ByteAligned);
+    }
+
+    BENCHMARK_DEFINE_F(ReplicationBandwidthBenchmark, BitPacked)(::benchmark::State& state)
+    {
+        ReplayTrace(state, Encoding::BitPacked);
+    }
+
+    BENCHMARK_DEFINE_F(ReplicationBandwidthBenchmark, BitPackedBaselineDelta)(::benchmark::State& state)
+    {
+        ReplayTrace(state, Encoding::BitPackedBaselineDelta);
+    }
+
+    BENCHMARK_REGISTER_F(ReplicationBandwidthBenchmark, ByteAligned)->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ReplicationBandwidthBenchmark, BitPacked)->Unit(::benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ReplicationBandwidthBenchmark, BitPackedBaselineDelta)->Unit(::benchmark::kMillisecond);
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Measures UDP throughput over the loopback interface.
+    //! The argument is the number of packets sent per simulated network tick, each tick flushes the send queue once and then drains
+    //! the receiving socket. items_per_second is measured against CPU time, so its inverse is the CPU cost per packet.
+    class UdpSocketLoopbackBenchmark
+        : public ::UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t PayloadSize = 200;
+        static constexpr uint32_t MaxReceiveAttempts = 1000;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            ::UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver->Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+
+            sockaddr_in address;
+            socklen_t addressLen = sizeof(address);
+            getsockname(static_cast<int32_t>(m_receiver->GetSocketFd()), (sockaddr*)&address, &addressLen);
+            m_receiverAddress = IpAddress(127, 0, 0, 1, ntohs(address.sin_port));
+
+            m_payload.resize(PayloadSize, 0xA5);
+            m_receiveBuffer.resize(UdpSocket::MaxReceiveBatchCount * MaxUdpTransmissionUnit);
+            for (uint32_t i = 0; i < UdpSocket::MaxReceiveBatchCount; ++i)
+            {
+                m_slots[i].m_data = m_receiveBuffer.data() + i * MaxUdpTransmissionUnit;
+            }
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_sender.reset();
+            m_receiver.reset();
+            m_dtlsEndpoint.reset();
+            m_payload = {};
+            m_receiveBuffer = {};
+            ::UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Sends packetCount packets and receives them, returns the number of packets received.
+        uint32_t SendAndReceive(uint32_t packetCount)
+        {
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                m_sender->Send(m_receiverAddress, m_payload.data(), PayloadSize, false, *m_dtlsEndpoint, m_connectionQuality);
+            }
+            m_sender->FlushSendQueue();
+
+            uint32_t receivedCount = 0;
+            for (uint32_t attempt = 0; (receivedCount < packetCount) && (attempt < MaxReceiveAttempts); ++attempt)
+            {
+                const uint32_t slotCount = AZStd::min(packetCount - receivedCount, UdpSocket::MaxReceiveBatchCount);
+                const int32_t result = m_receiver->ReceiveBatch(m_slots, slotCount);
+                if (result < 0)
+                {
+                    break;
+                }
+                receivedCount += aznumeric_cast<uint32_t>(result);
+            }
+            return receivedCount;
+        }
+
+    protected:
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        IpAddress m_receiverAddress;
+        AZStd::vector<uint8_t> m_payload;
+        AZStd::vector<uint8_t> m_receiveBuffer;
+        UdpSocket::ReceiveSlot m_slots[UdpSocket::MaxReceiveBatchCount];
+    };
+
+    BENCHMARK_DEFINE_F(UdpSocketLoopbackBenchmark, SendAndReceive)(benchmark::State& state)
+    {
+        const uint32_t packetsPerTick = aznumeric_cast<uint32_t>(state.range(0));
+        int64_t receivedPackets = 0;
+        for (auto _ : state)
+        {
+            receivedPackets += SendAndReceive(packetsPerTick);
+        }
+        state.SetItemsProcessed(receivedPackets);
+    }
+
+    BENCHMARK_REGISTER_F(UdpSocketLoopbackBenchmark, SendAndReceive)
+        ->Arg(1)
+        ->Arg(8)
+        ->Arg(UdpSocket::MaxQueuedSends)
+        ->Unit(benchmark::kMicrosecond);
+}
+
+#endif
@@ -8,14 +8,33 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpReplayDriver.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(AZ::TimeMs, net_UdpPacketTimeSliceMs);
+    AZ_CVAR_EXTERNED(uint32_t, net_UdpDecodeShards);
+    AZ_CVAR_EXTERNED(uint32_t, net_UdpMinPacketsForParallelDecode);
+    AZ_CVAR_EXTERNED(AZ::CVarFixedString, net_UdpCompressor);
+}
 
 namespace UnitTest
 {
@@ -298,4 +317,478 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestCaptureAndReplay)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string capturePath = tempDirectory.Resolve("UdpServer.netcap");
+
+        {
+            TestUdpServer testServer;
+            ASSERT_TRUE(testServer.m_serverNetworkInterface->StartPacketCapture(capturePath.c_str()));
+            TestUdpClient testClient;
+
+            constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+            const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+            for (;;)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+                bool canTerminate = (testServer.m_serverNetworkInterface->GetConnectionSet().GetConnectionCount() == 1);
+                if (canTerminate || timeExpired)
+                {
+                    break;
+                }
+            }
+
+            EXPECT_GT(testServer.m_serverNetworkInterface->GetPacketCapture()->GetPacketCount(), 0);
+            testServer.m_serverNetworkInterface->StopPacketCapture();
+        }
+
+        // Replay the captured client traffic into a fresh interface, the replayed client should connect again
+        const AZ::Name replayName = AZ::Name(AZStd::string_view("UdpReplayTarget"));
+        TestUdpConnectionListener replayListener;
+        UdpNetworkInterface* replayInterface = static_cast<UdpNetworkInterface*>(AZ::Interface<INetworking>::Get()->CreateNetworkInterface(replayName, ProtocolType::Udp, TrustZone::ExternalClientToServer, replayListener));
+        ASSERT_TRUE(replayInterface->Listen(12346));
+
+        UdpReplayDriver replayDriver(*replayInterface, UdpReplaySettings());
+        ASSERT_TRUE(replayDriver.Load(capturePath.c_str()));
+        EXPECT_FALSE(replayDriver.IsComplete());
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            replayDriver.Update(AZ::TimeMs{ 25 });
+            m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            bool timeExpired = (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs);
+            bool canTerminate = replayDriver.IsComplete() && (replayInterface->GetConnectionSet().GetConnectionCount() == 1);
+            if (canTerminate || timeExpired)
+            {
+                break;
+            }
+        }
+
+        EXPECT_TRUE(replayDriver.IsComplete());
+        EXPECT_EQ(replayDriver.GetDroppedPacketCount(), 0);
+        EXPECT_EQ(replayInterface->GetConnectionSet().GetConnectionCount(), 1);
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(replayName);
+    }
+
+    static uint16_t GetBoundPort(const UdpSocket& socket)
+    {
+        sockaddr_in address;
+        socklen_t addressLen = sizeof(address);
+        getsockname(static_cast<int32_t>(socket.GetSocketFd()), (sockaddr*)&address, &addressLen);
+        return ntohs(address.sin_port);
+    }
+
+    TEST_F(UdpTransportTests, UdpSocketBatchedSendAndReceive)
+    {
+        constexpr uint32_t NumTestPackets = UdpSocket::MaxQueuedSends + UdpSocket::MaxReceiveBatchCount / 2;
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        ASSERT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(receiver.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        const IpAddress receiverAddress(127, 0, 0, 1, GetBoundPort(receiver));
+
+        DtlsEndpoint dtlsEndpoint;
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            const uint32_t payload[2] = { i, ~i };
+            const uint8_t* payloadData = reinterpret_cast<const uint8_t*>(payload);
+            EXPECT_EQ(aznumeric_cast<int32_t>(sizeof(payload)), sender.Send(receiverAddress, payloadData, sizeof(payload), false, dtlsEndpoint, ConnectionQuality()));
+        }
+        // Sends past the queue size flush the queue, the rest waits for an explicit flush
+        sender.FlushSendQueue();
+
+        AZStd::vector<uint8_t> buffer(NumTestPackets * MaxUdpTransmissionUnit);
+        UdpSocket::ReceiveSlot slots[NumTestPackets];
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            slots[i].m_data = buffer.data() + i * MaxUdpTransmissionUnit;
+        }
+
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < NumTestPackets && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 5000 })
+        {
+            const int32_t result = receiver.ReceiveBatch(slots + receivedCount, NumTestPackets - receivedCount);
+            ASSERT_GE(result, 0);
+            receivedCount += result;
+            if (result == 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        ASSERT_EQ(NumTestPackets, receivedCount);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            uint32_t payload[2];
+            ASSERT_EQ(aznumeric_cast<int32_t>(sizeof(payload)), slots[i].m_receivedBytes);
+            memcpy(payload, slots[i].m_data, sizeof(payload));
+            EXPECT_EQ(i, payload[0]);
+            EXPECT_EQ(~i, payload[1]);
+            EXPECT_EQ(GetBoundPort(sender), slots[i].m_address.GetPort(ByteOrder::Host));
+        }
+        EXPECT_EQ(NumTestPackets, receiver.GetRecvPackets());
+    }
+
+    //! Prefixes the payload with a marker and rejects data without it, so corrupt packets fail to decompress.
+    class TestUdpCompressor
+        : public ICompressor
+    {
+    public:
+        static constexpr uint8_t Marker = 0xC5;
+
+        TestUdpCompressor(AZStd::thread_id mainThreadId, AZStd::atomic<uint32_t>& jobThreadDecompressCount, AZStd::atomic<uint32_t>& failedDecompressCount)
+            : m_mainThreadId(mainThreadId)
+            , m_jobThreadDecompressCount(jobThreadDecompressCount)
+            , m_failedDecompressCount(failedDecompressCount)
+        {
+        }
+
+        bool Init() override
+        {
+            return true;
+        }
+
+        CompressorType GetType() const override
+        {
+            return CompressorType{ 0xC5 };
+        }
+
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override
+        {
+            return maxCompSize - 1;
+        }
+
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override
+        {
+            return uncompSize + 1;
+        }
+
+        CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            if (compDataSize < uncompSize + 1)
+            {
+                return CompressorError::InsufficientBuffer;
+            }
+            uint8_t* output = static_cast<uint8_t*>(compData);
+            output[0] = Marker;
+            memcpy(output + 1, uncompData, uncompSize);
+            compSize = uncompSize + 1;
+            return CompressorError::Ok;
+        }
+
+        CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            if (AZStd::this_thread::get_id() != m_mainThreadId)
+            {
+                m_jobThreadDecompressCount++;
+            }
+
+            const uint8_t* input = static_cast<const uint8_t*>(compData);
+            if ((compDataSize < 1) || (input[0] != Marker))
+            {
+                m_failedDecompressCount++;
+                return CompressorError::CorruptData;
+            }
+            if (uncompDataSize < compDataSize - 1)
+            {
+                return CompressorError::InsufficientBuffer;
+            }
+            memcpy(uncompData, input + 1, compDataSize - 1);
+            consumedSize = compDataSize;
+            uncompSize = compDataSize - 1;
+            return CompressorError::Ok;
+        }
+
+    private:
+        AZStd::thread_id m_mainThreadId;
+        AZStd::atomic<uint32_t>& m_jobThreadDecompressCount;
+        AZStd::atomic<uint32_t>& m_failedDecompressCount;
+    };
+
+    class TestUdpCompressorFactory
+        : public ICompressorFactory
+    {
+    public:
+        AZStd::unique_ptr<ICompressor> Create() override
+        {
+            return AZStd::make_unique<TestUdpCompressor>(m_mainThreadId, m_jobThreadDecompressCount, m_failedDecompressCount);
+        }
+
+        AZ::Name GetFactoryName() const override
+        {
+            return AZ::Name(AZStd::string_view("TestUdpCompressor"));
+        }
+
+        AZStd::thread_id m_mainThreadId = AZStd::this_thread::get_id();
+        AZStd::atomic<uint32_t> m_jobThreadDecompressCount{ 0 };
+        AZStd::atomic<uint32_t> m_failedDecompressCount{ 0 };
+    };
+
+    //! Provides the global job context the network interfaces decode received packets on.
+    class TestUdpJobManager
+        : public AZ::JobManagerBus::Handler
+    {
+    public:
+        TestUdpJobManager()
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobManagerBus::Handler::BusConnect();
+        }
+
+        ~TestUdpJobManager()
+        {
+            AZ::JobManagerBus::Handler::BusDisconnect();
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        AZ::JobManager* GetManager() override
+        {
+            return m_jobManager;
+        }
+
+        AZ::JobContext* GetGlobalContext() override
+        {
+            return m_jobContext;
+        }
+
+    private:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    class TestUdpPayloadPacket
+        : public IPacket
+    {
+    public:
+        static constexpr PacketType Type = aznumeric_cast<PacketType>(CorePackets::PacketType::MAX);
+        static constexpr uint32_t ValueCount = 16;
+
+        TestUdpPayloadPacket() = default;
+        TestUdpPayloadPacket(uint32_t clientIndex, uint32_t sequence)
+            : m_clientIndex(clientIndex)
+            , m_sequence(sequence)
+        {
+            for (uint32_t i = 0; i < ValueCount; ++i)
+            {
+                m_values[i] = GetExpectedValue(clientIndex, sequence, i);
+            }
+        }
+
+        static uint32_t GetExpectedValue(uint32_t clientIndex, uint32_t sequence, uint32_t valueIndex)
+        {
+            return (clientIndex << 24) ^ (sequence << 8) ^ valueIndex;
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return Type;
+        }
+
+        AZStd::unique_ptr<IPacket> Clone() const override
+        {
+            return AZStd::make_unique<TestUdpPayloadPacket>(*this);
+        }
+
+        bool Serialize(ISerializer& serializer) override
+        {
+            serializer.Serialize(m_clientIndex, "ClientIndex");
+            serializer.Serialize(m_sequence, "Sequence");
+            for (uint32_t i = 0; i < ValueCount; ++i)
+            {
+                serializer.Serialize(m_values[i], "Value");
+            }
+            return serializer.IsValid();
+        }
+
+        uint32_t m_clientIndex = 0;
+        uint32_t m_sequence = 0;
+        uint32_t m_values[ValueCount] = {};
+    };
+
+    //! Records the payload packets received from every client, in the order they were processed.
+    class TestUdpPayloadListener
+        : public TestUdpConnectionListener
+    {
+    public:
+        bool OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+        {
+            if (packetHeader.GetPacketType() != TestUdpPayloadPacket::Type)
+            {
+                return TestUdpConnectionListener::OnPacketReceived(connection, packetHeader, serializer);
+            }
+
+            TestUdpPayloadPacket packet;
+            if (!packet.Serialize(serializer) || packet.m_clientIndex >= m_receivedPackets.size())
+            {
+                return false;
+            }
+            m_receivedPackets[packet.m_clientIndex].push_back(packet);
+            return true;
+        }
+
+        AZStd::vector<AZStd::vector<TestUdpPayloadPacket>> m_receivedPackets;
+    };
+
+    TEST_F(UdpTransportTests, ParallelDecode_MultipleCompressedClients_KeepsPayloadAndOrder)
+    {
+        constexpr uint32_t NumTestClients = 8;
+        constexpr uint32_t NumSendRounds = 8;
+        constexpr uint32_t PacketsPerRound = 16;
+        constexpr uint32_t PacketsPerClient = NumSendRounds * PacketsPerRound;
+
+        const uint32_t previousDecodeShards = net_UdpDecodeShards;
+        const uint32_t previousMinPackets = net_UdpMinPacketsForParallelDecode;
+        const AZ::TimeMs previousTimeSliceMs = net_UdpPacketTimeSliceMs;
+        const AZ::CVarFixedString previousCompressor = net_UdpCompressor;
+        net_UdpDecodeShards = 4;
+        net_UdpMinPacketsForParallelDecode = 0;
+        net_UdpPacketTimeSliceMs = AZ::TimeMs{ 5000 }; // Don't discard packets because a debug build is slow
+        net_UdpCompressor = AZ::CVarFixedString("TestUdpCompressor");
+
+        TestUdpJobManager jobManager;
+        TestUdpCompressorFactory compressorFactory;
+        m_networkingSystemComponent->RegisterCompressorFactory(&compressorFactory);
+
+        {
+            const AZ::Name serverName = AZ::Name(AZStd::string_view("UdpParallelDecodeServer"));
+            TestUdpPayloadListener serverListener;
+            serverListener.m_receivedPackets.resize(NumTestClients);
+            UdpNetworkInterface* serverInterface = static_cast<UdpNetworkInterface*>(AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+                serverName, ProtocolType::Udp, TrustZone::ExternalClientToServer, serverListener));
+            ASSERT_TRUE(serverInterface->Listen(12347));
+
+            TestUdpConnectionListener clientListener;
+            AZStd::vector<AZ::Name> clientNames;
+            AZStd::vector<INetworkInterface*> clientInterfaces;
+            AZStd::vector<ConnectionId> clientConnectionIds;
+            for (uint32_t i = 0; i < NumTestClients; ++i)
+            {
+                clientNames.push_back(AZ::Name(AZStd::string::format("UdpParallelDecodeClient%u", i)));
+                clientInterfaces.push_back(AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+                    clientNames.back(), ProtocolType::Udp, TrustZone::ExternalClientToServer, clientListener));
+                clientConnectionIds.push_back(clientInterfaces.back()->Connect(IpAddress(127, 0, 0, 1, 12347)));
+            }
+
+            auto tickUntil = [this](const AZStd::function<bool()>& condition)
+            {
+                constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+                const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+                while (!condition() && (AZ::GetElapsedTimeMs() - startTimeMs <= TotalIterationTimeMs))
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+                    m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+                }
+            };
+
+            tickUntil([&]()
+            {
+                bool connected = serverInterface->GetConnectionSet().GetConnectionCount() == NumTestClients;
+                for (INetworkInterface* clientInterface : clientInterfaces)
+                {
+                    connected &= clientInterface->GetConnectionSet().GetConnectionCount() == 1;
+                }
+                return connected;
+            });
+            ASSERT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+
+            // Packets that fail to decode on a job thread are discarded, without affecting the other packets of the connection
+            AZStd::vector<IpAddress> clientAddresses;
+            serverInterface->GetConnectionSet().VisitConnections([&clientAddresses](IConnection& connection)
+            {
+                clientAddresses.push_back(connection.GetRemoteAddress());
+            });
+            UdpPacketHeader corruptHeader;
+            corruptHeader.SetPacketFlag(PacketFlag::Compressed, true);
+            uint8_t corruptPacket[32] = {};
+            NetworkInputSerializer corruptSerializer(corruptPacket, sizeof(corruptPacket));
+            ASSERT_TRUE(corruptHeader.SerializePacketFlags(corruptSerializer));
+            const uint32_t corruptPacketSize = corruptSerializer.GetSize() + 8; // Payload without the compressor's marker
+
+            uint32_t injectedCount = 0;
+            for (uint32_t round = 0; round < NumSendRounds; ++round)
+            {
+                for (uint32_t clientIndex = 0; clientIndex < NumTestClients; ++clientIndex)
+                {
+                    for (uint32_t i = 0; i < PacketsPerRound; ++i)
+                    {
+                        const TestUdpPayloadPacket packet(clientIndex, round * PacketsPerRound + i);
+                        clientInterfaces[clientIndex]->SendUnreliablePacket(clientConnectionIds[clientIndex], packet);
+                    }
+                }
+                if (round == NumSendRounds / 2)
+                {
+                    for (const IpAddress& clientAddress : clientAddresses)
+                    {
+                        injectedCount += serverInterface->InjectReceivedPacket(clientAddress, corruptPacket, corruptPacketSize) ? 1 : 0;
+                    }
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+                m_networkingSystemComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            }
+
+            tickUntil([&]()
+            {
+                bool received = true;
+                for (const AZStd::vector<TestUdpPayloadPacket>& packets : serverListener.m_receivedPackets)
+                {
+                    received &= packets.size() >= PacketsPerClient;
+                }
+                return received;
+            });
+
+            EXPECT_EQ(serverInterface->GetConnectionSet().GetConnectionCount(), NumTestClients);
+            EXPECT_EQ(injectedCount, NumTestClients);
+            EXPECT_EQ(compressorFactory.m_failedDecompressCount.load(), injectedCount);
+            EXPECT_GT(compressorFactory.m_jobThreadDecompressCount.load(), 0u);
+            for (uint32_t clientIndex = 0; clientIndex < NumTestClients; ++clientIndex)
+            {
+                const AZStd::vector<TestUdpPayloadPacket>& packets = serverListener.m_receivedPackets[clientIndex];
+                ASSERT_EQ(packets.size(), PacketsPerClient);
+                for (uint32_t sequence = 0; sequence < PacketsPerClient; ++sequence)
+                {
+                    // Packets of a connection are processed in the order they were sent
+                    EXPECT_EQ(packets[sequence].m_sequence, sequence);
+                    for (uint32_t i = 0; i < TestUdpPayloadPacket::ValueCount; ++i)
+                    {
+                        EXPECT_EQ(packets[sequence].m_values[i], TestUdpPayloadPacket::GetExpectedValue(clientIndex, packets[sequence].m_sequence, i));
+                    }
+                }
+            }
+
+            for (const AZ::Name& clientName : clientNames)
+            {
+                AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(clientName);
+            }
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(serverName);
+        }
+
+        m_networkingSystemComponent->UnregisterCompressorFactory(compressorFactory.GetFactoryName());
+        net_UdpCompressor = previousCompressor;
+        net_UdpPacketTimeSliceMs = previousTimeSliceMs;
+        net_UdpMinPacketsForParallelDecode = previousMinPackets;
+        net_UdpDecodeShards = previousDecodeShards;
+    }
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/PacketCapture.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class PacketCaptureTests
+        : public AllocatorsFixture
+    {
+    public:
+
+        void SetUp() override
+        {
+            SetupAllocator();
+
+            m_loggerComponent = new AZ::LoggerSystemComponent;
+            m_timeComponent = new AZ::TimeSystemComponent;
+        }
+
+        void TearDown() override
+        {
+            delete m_timeComponent;
+            delete m_loggerComponent;
+
+            TeardownAllocator();
+        }
+
+        AZ::LoggerSystemComponent* m_loggerComponent;
+        AZ::TimeSystemComponent* m_timeComponent;
+    };
+
+    TEST_F(PacketCaptureTests, WriteAndRead)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string capturePath = tempDirectory.Resolve("Test.netcap");
+        const IpAddress clientAddress(127, 0, 0, 1, 33333);
+        const AZStd::vector<uint8_t> inbound = { 1, 2, 3, 4, 5 };
+        const AZStd::vector<uint8_t> outbound = { 6, 7, 8 };
+
+        PacketCaptureWriter writer;
+        ASSERT_TRUE(writer.Open(capturePath.c_str()));
+        EXPECT_TRUE(writer.IsOpen());
+        writer.Record(PacketCaptureDirection::Inbound, clientAddress, inbound.data(), aznumeric_cast<uint32_t>(inbound.size()));
+        writer.Record(PacketCaptureDirection::Outbound, clientAddress, outbound.data(), aznumeric_cast<uint32_t>(outbound.size()));
+        EXPECT_EQ(writer.GetPacketCount(), 2);
+        writer.Close();
+        EXPECT_FALSE(writer.IsOpen());
+
+        // Nothing is recorded once the capture is closed
+        writer.Record(PacketCaptureDirection::Inbound, clientAddress, inbound.data(), aznumeric_cast<uint32_t>(inbound.size()));
+        EXPECT_EQ(writer.GetPacketCount(), 2);
+
+        CapturedPackets packets;
+        ASSERT_TRUE(ReadPacketCapture(capturePath.c_str(), packets));
+        ASSERT_EQ(packets.size(), 2);
+
+        EXPECT_EQ(packets[0].m_direction, PacketCaptureDirection::Inbound);
+        EXPECT_EQ(packets[0].m_address, clientAddress);
+        EXPECT_EQ(packets[0].m_data, inbound);
+
+        EXPECT_EQ(packets[1].m_direction, PacketCaptureDirection::Outbound);
+        EXPECT_EQ(packets[1].m_address, clientAddress);
+        EXPECT_EQ(packets[1].m_data, outbound);
+        EXPECT_GE(packets[1].m_timeMs, packets[0].m_timeMs);
+    }
+
+    TEST_F(PacketCaptureTests, RejectsMissingFile)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        CapturedPackets packets;
+        EXPECT_FALSE(ReadPacketCapture(tempDirectory.Resolve("Missing.netcap").c_str(), packets));
+        EXPECT_TRUE(packets.empty());
+    }
+}
@@ -12,17 +12,23 @@ set(FILES
     DataStructures/FixedSizeBitsetTests.cpp
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
+    DataStructures/PacketBufferPoolTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Serialization/BaselineDeltaTests.cpp
+    Serialization/BitPackedSerializerTests.cpp
     Serialization/DeltaSerializerTests.cpp
+    Serialization/ReplicationBandwidthBenchmarks.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputSerializerTests.cpp
     Serialization/NetworkOutputSerializerTests.cpp
     Serialization/TrackChangedSerializerTests.cpp
     TcpTransport/TcpTransportTests.cpp
+    UdpTransport/UdpSocketBenchmarks.cpp
     UdpTransport/UdpTransportTests.cpp
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/PacketCaptureTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
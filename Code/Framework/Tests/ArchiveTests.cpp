@@ -120,14 +120,14 @@ namespace UnitTest
                 ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
 
                 size_t fileSize = 0;
-                char* pFileBuffer = (char*)archive->FGetCachedFileData(fileHandle, fileSize);
+                const char* pFileBuffer = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle, fileSize));
                 ASSERT_NE(nullptr, pFileBuffer);
                 EXPECT_EQ(dataLen, fileSize);
                 EXPECT_EQ(0, memcmp(pFileBuffer, testData, dataLen));
 
                 // 2nd call to FGetCachedFileData, same file handle
                 fileSize = 0;
-                char* pFileBuffer2 = (char*)archive->FGetCachedFileData(fileHandle, fileSize);
+                const char* pFileBuffer2 = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle, fileSize));
                 EXPECT_NE(nullptr, pFileBuffer2);
                 EXPECT_EQ(pFileBuffer, pFileBuffer2);
                 EXPECT_EQ(dataLen, fileSize);
@@ -136,7 +136,7 @@ namespace UnitTest
                 fileSize = 0;
                 {
                     AZ::IO::HandleType fileHandle2 = archive->FOpen(testFilePath, "rb", 0);
-                    char* pFileBuffer3 = (char*)archive->FGetCachedFileData(fileHandle2, fileSize);
+                    const char* pFileBuffer3 = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle2, fileSize));
                     ASSERT_NE(nullptr,pFileBuffer3);
                     EXPECT_EQ(dataLen, fileSize);
                     EXPECT_EQ(0, memcmp(pFileBuffer3, testData, dataLen));
@@ -44,7 +44,7 @@ struct CryPakMock
     MOCK_METHOD3(FOpen, AZ::IO::HandleType(AZStd::string_view pName, const char* mode, uint32_t nFlags));
     MOCK_METHOD4(FReadRaw, size_t(void* data, size_t length, size_t elems, AZ::IO::HandleType handle));
     MOCK_METHOD3(FReadRawAll, size_t(void* data, size_t nFileSize, AZ::IO::HandleType handle));
-    MOCK_METHOD2(FGetCachedFileData, void*(AZ::IO::HandleType handle, size_t & nFileSize));
+    MOCK_METHOD2(FGetCachedFileData, const void*(AZ::IO::HandleType handle, size_t & nFileSize));
     MOCK_METHOD4(FWrite, size_t(const void* data, size_t length, size_t elems, AZ::IO::HandleType handle));
     MOCK_METHOD3(FGets, char*(char*, int, AZ::IO::HandleType));
     MOCK_METHOD1(Getc, int(AZ::IO::HandleType));
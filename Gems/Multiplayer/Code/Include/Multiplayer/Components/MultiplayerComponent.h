@@ -101,25 +101,24 @@ namespace Multiplayer
         return GetEntity()->FindComponent<ComponentType>();
     }
 
-    template <typename TYPE>
-    inline void SerializeNetworkPropertyHelper
+    template <typename SERIALIZE_VALUE>
+    inline void SerializeNetworkPropertyHelperInternal
     (
         AzNetworking::ISerializer& serializer, 
         bool modifyRecord, 
         AzNetworking::FixedSizeBitsetView& bitset, 
         int32_t bitIndex, 
-        TYPE& value, 
-        const char* name, 
         NetComponentId componentId, 
         PropertyIndex propertyIndex, 
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        const SERIALIZE_VALUE& serializeValue
     )
     {
         if (bitset.GetBit(bitIndex))
         {
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            serializeValue();
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
                 // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
@@ -141,4 +140,43 @@ namespace Multiplayer
             }
         }
     }
+
+    template <typename TYPE>
+    inline void SerializeNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer, 
+        bool modifyRecord, 
+        AzNetworking::FixedSizeBitsetView& bitset, 
+        int32_t bitIndex, 
+        TYPE& value, 
+        const char* name, 
+        NetComponentId componentId, 
+        PropertyIndex propertyIndex, 
+        MultiplayerStats& stats
+    )
+    {
+        SerializeNetworkPropertyHelperInternal(serializer, modifyRecord, bitset, bitIndex, componentId, propertyIndex, stats,
+            [&serializer, &value, name]() { serializer.Serialize(value, name); });
+    }
+
+    //! Overload for network properties that declare a Min and Max value range, bit packing serializers only send the bits the range requires.
+    template <typename TYPE>
+    inline void SerializeNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer, 
+        bool modifyRecord, 
+        AzNetworking::FixedSizeBitsetView& bitset, 
+        int32_t bitIndex, 
+        TYPE& value, 
+        const char* name, 
+        NetComponentId componentId, 
+        PropertyIndex propertyIndex, 
+        MultiplayerStats& stats,
+        const TYPE& minValue,
+        const TYPE& maxValue
+    )
+    {
+        SerializeNetworkPropertyHelperInternal(serializer, modifyRecord, bitset, bitIndex, componentId, propertyIndex, stats,
+            [&serializer, &value, name, &minValue, &maxValue]() { serializer.Serialize(value, name, minValue, maxValue); });
+    }
 }
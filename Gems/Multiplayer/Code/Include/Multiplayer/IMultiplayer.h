@@ -133,6 +133,12 @@ namespace Multiplayer
         return (networkEntityManager != nullptr) ? networkEntityManager->GetNetworkEntityTracker() : nullptr;
     }
 
+    inline ReplicationGrid* GetReplicationGrid()
+    {
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        return (networkEntityManager != nullptr) ? networkEntityManager->GetReplicationGrid() : nullptr;
+    }
+
     inline NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker()
     {
         INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
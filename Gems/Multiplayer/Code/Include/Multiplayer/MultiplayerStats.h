@@ -25,6 +25,11 @@ namespace Multiplayer
         uint64_t m_clientConnectionCount = 0;
         uint64_t m_serverConnectionCount = 0;
 
+        //! Number of network updates sent and the time spent sending the most recent one, in microseconds.
+        //! Receiving and handling packets happens in the network interface updates, see NetworkInterfaceMetrics::m_updateTimeMs.
+        uint64_t m_networkUpdateCount = 0;
+        uint64_t m_networkSendUpdateTimeUs = 0;
+
         uint64_t m_recordMetricIndex = 0;
         AZ::TimeMs m_totalHistoryTimeMs = AZ::TimeMs{ 0 };
 
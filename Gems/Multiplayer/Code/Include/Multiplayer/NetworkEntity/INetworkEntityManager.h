@@ -19,6 +19,7 @@ namespace Multiplayer
     class NetworkEntityAuthorityTracker;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
+    class ReplicationGrid;
 
     using EntityExitDomainEvent = AZ::Event<const ConstNetworkEntityHandle&>;
     using ControllersActivatedEvent = AZ::Event<const ConstNetworkEntityHandle&, EntityIsMigrating>;
@@ -48,6 +49,10 @@ namespace Multiplayer
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
 
+        //! Returns the ReplicationGrid for this INetworkEntityManager instance.
+        //! @return the ReplicationGrid for this INetworkEntityManager instance
+        virtual ReplicationGrid* GetReplicationGrid() = 0;
+
         //! Returns the HostId for this INetworkEntityManager instance.
         //! @return the HostId for this INetworkEntityManager instance
         virtual HostId GetHostId() const = 0;
@@ -78,6 +78,14 @@ namespace Multiplayer
         //! @return the current value of HasValidPrefabId
         bool GetHasValidPrefabId() const;
 
+        //! Sets whether Data holds a bit packed, baseline delta encoded property stream.
+        //! @param value true if Data is bit packed
+        void SetIsBitPacked(bool value);
+
+        //! Gets the current value of IsBitPacked.
+        //! @return the current value of IsBitPacked
+        bool GetIsBitPacked() const;
+
         //! Sets the current value for PrefabEntityId.
         //! @param value the value to set PrefabEntityId to
         void SetPrefabEntityId(const PrefabEntityId& value);
@@ -111,6 +119,7 @@ namespace Multiplayer
         bool           m_wasMigrated = false;
         bool           m_takeOwnership = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_isBitPacked = false;
         PrefabEntityId m_prefabEntityId;
 
         // Only allocated if we actually have data
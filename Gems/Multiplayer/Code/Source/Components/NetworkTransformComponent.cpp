@@ -6,6 +6,8 @@
  */
 
 #include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Source/ReplicationWindows/ReplicationGrid.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/EBus/IEventScheduler.h>
@@ -66,6 +68,12 @@ namespace Multiplayer
     {
         m_previousTransform.SetTranslation(m_targetTransform.GetTranslation());
         m_targetTransform.SetTranslation(translation);
+
+        // Server proxies are tracked by the replication grid as well
+        if (ReplicationGrid* replicationGrid = GetReplicationGrid())
+        {
+            replicationGrid->UpdateEntity(GetNetEntityId(), translation);
+        }
     }
 
     void NetworkTransformComponent::OnScaleChangedEvent(float scale)
@@ -118,5 +126,10 @@ namespace Multiplayer
         SetRotation(worldTm.GetRotation());
         SetTranslation(worldTm.GetTranslation());
         SetScale(worldTm.GetUniformScale());
+
+        if (ReplicationGrid* replicationGrid = GetReplicationGrid())
+        {
+            replicationGrid->UpdateEntity(GetNetEntityId(), worldTm.GetTranslation());
+        }
     }
 }
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <LoadTest/LoadTestHarness.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzNetworking/Framework/INetworking.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    static const INetworkInterface* GetServerNetworkInterface()
+    {
+        return AZ::Interface<INetworking>::Get()->RetrieveNetworkInterface(AZ::Name(MPNetworkInterfaceName));
+    }
+
+    LoadTestHarness::LoadTestHarness(const LoadTestSettings& settings)
+        : m_settings(settings)
+        , m_inputRpc(SyntheticInputRpc::Find())
+    {
+        m_settings.m_clientsPerStep = AZStd::max(m_settings.m_clientsPerStep, 1u);
+        if (!m_inputRpc.IsValid())
+        {
+            AZLOG_WARN("LocalPredictionPlayerInputComponent is not registered, simulated clients will not send input");
+        }
+
+        m_lastNetworkUpdateCount = AZ::Interface<IMultiplayer>::Get()->GetStats().m_networkUpdateCount;
+        AZLOG_INFO("Starting load test against %s, ramping up to %u clients by %u every %lld ms",
+            m_settings.m_serverAddress.GetString().c_str(), m_settings.m_maxClients, m_settings.m_clientsPerStep,
+            aznumeric_cast<int64_t>(m_settings.m_stepDurationMs));
+
+        StartStep();
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    LoadTestHarness::~LoadTestHarness()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    bool LoadTestHarness::IsComplete() const
+    {
+        return m_isComplete;
+    }
+
+    void LoadTestHarness::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_isComplete)
+        {
+            return;
+        }
+
+        for (AZStd::unique_ptr<SimulatedClient>& client : m_clients)
+        {
+            client->Update(m_settings.m_inputRateMs);
+        }
+        SampleServer();
+        ++m_stepTickCount;
+
+        if (AZ::GetElapsedTimeMs() - m_stepStartTimeMs < m_settings.m_stepDurationMs)
+        {
+            return;
+        }
+
+        ReportStep();
+        if (m_clients.size() >= m_settings.m_maxClients)
+        {
+            AZLOG_INFO("Load test complete after %u steps", m_stepIndex);
+            m_isComplete = true;
+            return;
+        }
+        StartStep();
+    }
+
+    int LoadTestHarness::GetTickOrder()
+    {
+        // Tick immediately after the multiplayer system component so the stats of the current frame are available
+        return AZ::TICK_PLACEMENT + 2;
+    }
+
+    void LoadTestHarness::StartStep()
+    {
+        const uint32_t clientCount = AZStd::min(aznumeric_cast<uint32_t>(m_clients.size()) + m_settings.m_clientsPerStep, m_settings.m_maxClients);
+        while (m_clients.size() < clientCount)
+        {
+            const uint32_t clientIndex = aznumeric_cast<uint32_t>(m_clients.size());
+            m_clients.emplace_back(AZStd::make_unique<SimulatedClient>(clientIndex, m_settings.m_serverAddress, m_inputRpc, m_latencySamples));
+        }
+
+        const NetworkInterfaceMetrics& metrics = GetServerNetworkInterface()->GetMetrics();
+        m_stepStartSendBytes = metrics.m_sendBytes;
+        m_stepStartRecvBytes = metrics.m_recvBytes;
+        m_stepStartInterfaceUpdateTimeMs = metrics.m_updateTimeMs;
+        m_stepStartInterfaceRecvTimeMs = metrics.m_recvTimeMs;
+        m_stepTickCount = 0;
+        m_stepStartEntityUpdates = 0;
+        m_stepStartInputs = 0;
+        for (const AZStd::unique_ptr<SimulatedClient>& client : m_clients)
+        {
+            m_stepStartEntityUpdates += client->GetEntityUpdateCount();
+            m_stepStartInputs += client->GetInputCount();
+        }
+
+        m_sendUpdateTimeSamples.Clear();
+        m_latencySamples.Clear();
+        m_stepStartTimeMs = AZ::GetElapsedTimeMs();
+        ++m_stepIndex;
+    }
+
+    void LoadTestHarness::SampleServer()
+    {
+        // The server only sends updates every sv_serverSendRateMs, so only sample frames where it did
+        const MultiplayerStats& stats = AZ::Interface<IMultiplayer>::Get()->GetStats();
+        if (stats.m_networkUpdateCount != m_lastNetworkUpdateCount)
+        {
+            m_lastNetworkUpdateCount = stats.m_networkUpdateCount;
+            m_sendUpdateTimeSamples.AddSample(stats.m_networkSendUpdateTimeUs);
+        }
+    }
+
+    void LoadTestHarness::ReportStep()
+    {
+        const float stepSeconds = AZStd::max(aznumeric_cast<float>(aznumeric_cast<int64_t>(AZ::GetElapsedTimeMs() - m_stepStartTimeMs)) / 1000.0f, 0.001f);
+        const uint32_t clientCount = aznumeric_cast<uint32_t>(m_clients.size());
+        const float perClientDivisor = aznumeric_cast<float>(AZStd::max(clientCount, 1u));
+
+        uint32_t acceptedCount = 0;
+        uint64_t entityUpdates = 0;
+        uint64_t inputs = 0;
+        for (const AZStd::unique_ptr<SimulatedClient>& client : m_clients)
+        {
+            acceptedCount += client->IsAccepted() ? 1 : 0;
+            entityUpdates += client->GetEntityUpdateCount();
+            inputs += client->GetInputCount();
+        }
+
+        const NetworkInterfaceMetrics& metrics = GetServerNetworkInterface()->GetMetrics();
+        const float sendKbps = aznumeric_cast<float>(metrics.m_sendBytes - m_stepStartSendBytes) / 1024.0f / stepSeconds;
+        const float recvKbps = aznumeric_cast<float>(metrics.m_recvBytes - m_stepStartRecvBytes) / 1024.0f / stepSeconds;
+
+        AZLOG_INFO("Load test step %u: %u clients, %u accepted", m_stepIndex, clientCount, acceptedCount);
+        AZLOG_INFO("  Server send update time us: p50 %llu, p95 %llu, p99 %llu, max %llu over %u updates",
+            aznumeric_cast<AZ::u64>(m_sendUpdateTimeSamples.GetPercentile(50.0f)),
+            aznumeric_cast<AZ::u64>(m_sendUpdateTimeSamples.GetPercentile(95.0f)),
+            aznumeric_cast<AZ::u64>(m_sendUpdateTimeSamples.GetPercentile(99.0f)),
+            aznumeric_cast<AZ::u64>(m_sendUpdateTimeSamples.GetMax()),
+            m_sendUpdateTimeSamples.GetSampleCount());
+        // The network interface only tracks totals in milliseconds, so its time is reported as an average per frame
+        const float interfaceUpdateMs = aznumeric_cast<float>(aznumeric_cast<int64_t>(metrics.m_updateTimeMs - m_stepStartInterfaceUpdateTimeMs));
+        const float interfaceRecvMs = aznumeric_cast<float>(aznumeric_cast<int64_t>(metrics.m_recvTimeMs - m_stepStartInterfaceRecvTimeMs));
+        const float tickDivisor = aznumeric_cast<float>(AZStd::max(m_stepTickCount, 1u));
+        AZLOG_INFO("  Server network interface update time ms: %.3f per frame (receive and packet handling %.3f) over %u frames",
+            interfaceUpdateMs / tickDivisor, interfaceRecvMs / tickDivisor, m_stepTickCount);
+        AZLOG_INFO("  Server bandwidth KB/s: send %.2f (%.2f per client), recv %.2f (%.2f per client)",
+            sendKbps, sendKbps / perClientDivisor, recvKbps, recvKbps / perClientDivisor);
+        AZLOG_INFO("  Replication latency ms: p50 %llu, p95 %llu, p99 %llu, max %llu over %u packets",
+            aznumeric_cast<AZ::u64>(m_latencySamples.GetPercentile(50.0f)),
+            aznumeric_cast<AZ::u64>(m_latencySamples.GetPercentile(95.0f)),
+            aznumeric_cast<AZ::u64>(m_latencySamples.GetPercentile(99.0f)),
+            aznumeric_cast<AZ::u64>(m_latencySamples.GetMax()),
+            m_latencySamples.GetSampleCount());
+        AZLOG_INFO("  Entity updates received: %llu, inputs sent: %llu",
+            aznumeric_cast<AZ::u64>(entityUpdates - m_stepStartEntityUpdates), aznumeric_cast<AZ::u64>(inputs - m_stepStartInputs));
+    }
+}
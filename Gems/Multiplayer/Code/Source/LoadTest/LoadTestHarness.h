@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <LoadTest/LoadTestSamples.h>
+#include <LoadTest/SimulatedClient.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Multiplayer
+{
+    struct LoadTestSettings
+    {
+        //! Address of the server the simulated clients connect to
+        AzNetworking::IpAddress m_serverAddress;
+        //! Total number of simulated clients to ramp up to
+        uint32_t m_maxClients = 0;
+        //! Number of simulated clients added at the start of each step
+        uint32_t m_clientsPerStep = 10;
+        //! Duration of each step, metrics are reported at the end of each step
+        AZ::TimeMs m_stepDurationMs = AZ::TimeMs{ 10000 };
+        //! Milliseconds between synthetic inputs sent by each simulated client
+        AZ::TimeMs m_inputRateMs = AZ::TimeMs{ 33 };
+    };
+
+    //! @class LoadTestHarness
+    //! @brief Ramps up simulated clients against a server in the same process and reports how the server scales.
+    //!
+    //! Clients are added in steps. At the end of each step the harness logs the percentiles of the time the server spends sending
+    //! network updates, the time the server's network interface spends receiving and handling packets, the bandwidth of the server's
+    //! network interface in total and per client, and the replication latency percentiles observed by the simulated clients, then
+    //! starts the next step. The test completes after the step that reached the maximum client count.
+    class LoadTestHarness final
+        : public AZ::TickBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(LoadTestHarness, AZ::SystemAllocator, 0);
+
+        LoadTestHarness(const LoadTestSettings& settings);
+        ~LoadTestHarness() override;
+
+        //! Returns true once every step has been run and reported.
+        //! @return boolean true once the load test has completed
+        bool IsComplete() const;
+
+        //! AZ::TickBus::Handler overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(LoadTestHarness);
+
+        void StartStep();
+        void SampleServer();
+        void ReportStep();
+
+        LoadTestSettings m_settings;
+        SyntheticInputRpc m_inputRpc;
+        AZStd::vector<AZStd::unique_ptr<SimulatedClient>> m_clients;
+
+        LoadTestSamples m_sendUpdateTimeSamples;
+        LoadTestSamples m_latencySamples;
+
+        AZ::TimeMs m_stepStartTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_stepIndex = 0;
+        uint64_t m_lastNetworkUpdateCount = 0;
+        uint32_t m_stepTickCount = 0;
+        AZ::TimeMs m_stepStartInterfaceUpdateTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_stepStartInterfaceRecvTimeMs = AZ::TimeMs{ 0 };
+        uint64_t m_stepStartSendBytes = 0;
+        uint64_t m_stepStartRecvBytes = 0;
+        uint64_t m_stepStartEntityUpdates = 0;
+        uint64_t m_stepStartInputs = 0;
+        bool m_isComplete = false;
+    };
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <LoadTest/LoadTestSamples.h>
+#include <AzCore/std/sort.h>
+#include <cmath>
+
+namespace Multiplayer
+{
+    void LoadTestSamples::AddSample(uint64_t value)
+    {
+        m_samples.push_back(value);
+        m_isSorted = false;
+    }
+
+    void LoadTestSamples::Clear()
+    {
+        m_samples.clear();
+        m_isSorted = true;
+    }
+
+    uint32_t LoadTestSamples::GetSampleCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_samples.size());
+    }
+
+    uint64_t LoadTestSamples::GetPercentile(float percentile)
+    {
+        if (m_samples.empty())
+        {
+            return 0;
+        }
+
+        Sort();
+        const float clampedPercentile = AZStd::clamp(percentile, 0.0f, 100.0f);
+        const size_t rank = aznumeric_cast<size_t>(std::ceil(clampedPercentile * aznumeric_cast<float>(m_samples.size()) / 100.0f));
+        return m_samples[AZStd::max<size_t>(rank, 1) - 1];
+    }
+
+    uint64_t LoadTestSamples::GetMax()
+    {
+        if (m_samples.empty())
+        {
+            return 0;
+        }
+
+        Sort();
+        return m_samples.back();
+    }
+
+    void LoadTestSamples::Sort()
+    {
+        if (!m_isSorted)
+        {
+            AZStd::sort(m_samples.begin(), m_samples.end());
+            m_isSorted = true;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class LoadTestSamples
+    //! @brief Collects the samples of a single load test measurement and computes percentiles over them.
+    class LoadTestSamples
+    {
+    public:
+        LoadTestSamples() = default;
+
+        //! Adds a sample.
+        //! @param value the value to add
+        void AddSample(uint64_t value);
+
+        //! Removes all samples.
+        void Clear();
+
+        //! Returns the number of samples collected.
+        //! @return the number of samples collected
+        uint32_t GetSampleCount() const;
+
+        //! Returns the nearest rank percentile of the collected samples, or 0 if there are none.
+        //! @param percentile the percentile to compute, in the range [0, 100]
+        //! @return the smallest sample greater than or equal to the requested percentage of all samples
+        uint64_t GetPercentile(float percentile);
+
+        //! Returns the largest sample collected, or 0 if there are none.
+        //! @return the largest sample collected
+        uint64_t GetMax();
+
+    private:
+        void Sort();
+
+        AZStd::vector<uint64_t> m_samples;
+        bool m_isSorted = true;
+    };
+}
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <LoadTest/SimulatedClient.h>
+#include <LoadTest/LoadTestSamples.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/string/string.h>
+#include <AzNetworking/Framework/INetworking.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    // Must match the parameters of SendClientInput in LocalPredictionPlayerInputComponent.AutoComponent.xml
+    struct SyntheticInputRpcParams
+        : public IRpcParamStruct
+    {
+        SyntheticInputRpcParams(const NetworkInputArray& inputArray)
+            : m_inputArray(inputArray)
+        {
+            ;
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_inputArray, "inputArray")
+                && serializer.Serialize(m_stateHash, "stateHash")
+                && serializer.Serialize(m_clientState, "clientState");
+        }
+
+        NetworkInputArray m_inputArray;
+        AZ::HashValue32 m_stateHash = AZ::HashValue32{ 0 };
+        AzNetworking::PacketEncodingBuffer m_clientState;
+    };
+
+    SyntheticInputRpc SyntheticInputRpc::Find()
+    {
+        static const AZ::Name InputComponentName = AZ::Name("LocalPredictionPlayerInputComponent");
+        static const AZStd::string_view InputRpcName = "SendClientInput";
+
+        SyntheticInputRpc result;
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        for (NetComponentId netComponentId = NetComponentId{ 0 }; netComponentId != InvalidNetComponentId; ++netComponentId)
+        {
+            const MultiplayerComponentRegistry::ComponentData& componentData = componentRegistry->GetMultiplayerComponentData(netComponentId);
+            if (componentData.m_componentName.IsEmpty())
+            {
+                // Component ids are assigned sequentially, this is the end of the registered components
+                break;
+            }
+            if (componentData.m_componentName != InputComponentName)
+            {
+                continue;
+            }
+
+            // Rpc names past the last rpc of the component are reported as unknown
+            for (RpcIndex rpcIndex = RpcIndex{ 0 }; rpcIndex < RpcIndex{ 64 }; ++rpcIndex)
+            {
+                if (InputRpcName == componentRegistry->GetComponentRpcName(netComponentId, rpcIndex))
+                {
+                    result.m_netComponentId = netComponentId;
+                    result.m_rpcIndex = rpcIndex;
+                    break;
+                }
+            }
+            break;
+        }
+        return result;
+    }
+
+    bool SyntheticInputRpc::IsValid() const
+    {
+        return m_netComponentId != InvalidNetComponentId;
+    }
+
+    SimulatedClient::SimulatedClient(uint32_t clientIndex, const IpAddress& serverAddress, const SyntheticInputRpc& inputRpc, LoadTestSamples& latencySamples)
+        : m_name(AZStd::string::format("LoadTestClient%u", clientIndex))
+        , m_inputRpc(inputRpc)
+        , m_latencySamples(latencySamples)
+    {
+        // The synthetic input carries no component inputs, so it doesn't need to be attached to a local entity
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            m_inputArray[i].AttachNetBindComponent(nullptr);
+        }
+
+        m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(m_name, ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+        m_networkInterface->Connect(serverAddress);
+    }
+
+    SimulatedClient::~SimulatedClient()
+    {
+        AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(m_name);
+    }
+
+    void SimulatedClient::Update(AZ::TimeMs inputRateMs)
+    {
+        if (m_connection == nullptr || m_controlledEntityId == InvalidNetEntityId || !m_inputRpc.IsValid())
+        {
+            return;
+        }
+
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (currentTimeMs - m_lastInputTimeMs >= inputRateMs)
+        {
+            m_lastInputTimeMs = currentTimeMs;
+            SendSyntheticInput();
+            // The harness ticks after INetworking, don't hold the input back until the next network update
+            m_networkInterface->FlushSends();
+        }
+    }
+
+    bool SimulatedClient::IsAccepted() const
+    {
+        return m_isAccepted;
+    }
+
+    uint64_t SimulatedClient::GetEntityUpdateCount() const
+    {
+        return m_entityUpdateCount;
+    }
+
+    uint64_t SimulatedClient::GetInputCount() const
+    {
+        return m_inputCount;
+    }
+
+    void SimulatedClient::SendSyntheticInput()
+    {
+        // Like a real client, resend the most recent inputs with every new input to cover for packet loss
+        ++m_lastInputId;
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            NetworkInput& input = m_inputArray[i];
+            input.SetClientInputId(m_lastInputId - ClientInputId{ static_cast<uint16_t>(i) });
+            input.SetHostFrameId(m_lastHostFrameId);
+            input.SetHostTimeMs(m_lastHostTimeMs);
+        }
+
+        SyntheticInputRpcParams rpcParams(m_inputArray);
+        NetworkEntityRpcMessage rpcMessage(RpcDeliveryType::AutonomousToAuthority, m_controlledEntityId, m_inputRpc.m_netComponentId, m_inputRpc.m_rpcIndex, ReliabilityType::Unreliable);
+        rpcMessage.SetRpcParams(rpcParams);
+
+        MultiplayerPackets::EntityRpcs entityRpcsPacket;
+        entityRpcsPacket.ModifyEntityRpcs().push_back(AZStd::move(rpcMessage));
+        m_connection->SendUnreliablePacket(entityRpcsPacket);
+        ++m_inputCount;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        return false;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        // A real client would load the level first, simulated clients are ready right away
+        m_isAccepted = true;
+        return connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Simulated clients usually share a process with the server, applying the server's cvars would be redundant
+        return true;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        // Host time is the server's elapsed time when it sent the update, which is only comparable to ours in the same process
+        const AZ::TimeMs latencyMs = AZ::GetElapsedTimeMs() - packet.GetHostTimeMs();
+        m_latencySamples.AddSample(aznumeric_cast<uint64_t>(AZStd::max(latencyMs, AZ::TimeMs{ 0 })));
+
+        if ((m_lastHostFrameId == InvalidHostFrameId) || (packet.GetHostFrameId() > m_lastHostFrameId))
+        {
+            m_lastHostFrameId = packet.GetHostFrameId();
+            m_lastHostTimeMs = packet.GetHostTimeMs();
+        }
+
+        for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+        {
+            if (updateMessage.GetIsDelete())
+            {
+                if (updateMessage.GetEntityId() == m_controlledEntityId)
+                {
+                    m_controlledEntityId = InvalidNetEntityId;
+                }
+            }
+            else if (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous)
+            {
+                m_controlledEntityId = updateMessage.GetEntityId();
+            }
+        }
+        m_entityUpdateCount += packet.GetEntityMessages().size();
+        return true;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Rpcs like input corrections are consumed without being handled
+        return true;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        return false;
+    }
+
+    bool SimulatedClient::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityResyncRequests& packet
+    )
+    {
+        // Simulated clients don't replicate entities back to the server, so there is nothing to resend
+        return true;
+    }
+
+    ConnectResult SimulatedClient::ValidateConnect
+    (
+        [[maybe_unused]] const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        // Simulated clients never accept incoming connections
+        return ConnectResult::Rejected;
+    }
+
+    void SimulatedClient::OnConnect(AzNetworking::IConnection* connection)
+    {
+        m_connection = connection;
+        connection->SendReliablePacket(MultiplayerPackets::Connect(0));
+    }
+
+    bool SimulatedClient::OnPacketReceived(AzNetworking::IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void SimulatedClient::OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId)
+    {
+        ;
+    }
+
+    void SimulatedClient::OnDisconnect(AzNetworking::IConnection* connection, DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint)
+    {
+        if (connection == m_connection)
+        {
+            const AZStd::string reasonString = ToString(reason);
+            AZLOG_INFO("Simulated client %s disconnected due to %s", m_name.GetCStr(), reasonString.c_str());
+            m_connection = nullptr;
+            m_isAccepted = false;
+            m_controlledEntityId = InvalidNetEntityId;
+        }
+    }
+}
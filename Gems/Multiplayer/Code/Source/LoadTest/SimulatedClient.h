@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+#include <NetworkInput/NetworkInputArray.h>
+#include <AzCore/Name/Name.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    class LoadTestSamples;
+
+    //! Identifies the rpc simulated clients invoke on their controlled entity to send synthetic input.
+    struct SyntheticInputRpc
+    {
+        NetComponentId m_netComponentId = InvalidNetComponentId;
+        RpcIndex m_rpcIndex = RpcIndex{ 0 };
+
+        //! Looks up LocalPredictionPlayerInputComponent::SendClientInput in the multiplayer component registry.
+        //! @return the rpc to invoke, IsValid() is false if the component is not registered
+        static SyntheticInputRpc Find();
+
+        bool IsValid() const;
+    };
+
+    //! @class SimulatedClient
+    //! @brief A headless multiplayer client used for load testing a server.
+    //!
+    //! Each simulated client owns its own Udp network interface and performs the same handshake as a real client, then consumes
+    //! entity updates without instantiating any entities. Once the server has told the client which entity it controls, the client
+    //! sends synthetic input carrying no component inputs at a fixed rate.
+    class SimulatedClient final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SimulatedClient, AZ::SystemAllocator, 0);
+
+        //! Constructor, creates the network interface and starts connecting to the server.
+        //! @param clientIndex    unique index of this client, used to name its network interface
+        //! @param serverAddress  address of the server to connect to
+        //! @param inputRpc       the rpc to invoke to send synthetic input
+        //! @param latencySamples receives the replication latency in milliseconds of every entity update packet
+        SimulatedClient(uint32_t clientIndex, const AzNetworking::IpAddress& serverAddress, const SyntheticInputRpc& inputRpc, LoadTestSamples& latencySamples);
+        ~SimulatedClient() override;
+
+        //! Sends synthetic input if it is due.
+        //! @param inputRateMs milliseconds between synthetic inputs
+        void Update(AZ::TimeMs inputRateMs);
+
+        //! Returns true once the server has accepted this client.
+        //! @return boolean true once the server has accepted this client
+        bool IsAccepted() const;
+
+        //! Returns the number of entity update messages consumed.
+        //! @return the number of entity update messages consumed
+        uint64_t GetEntityUpdateCount() const;
+
+        //! Returns the number of synthetic inputs sent.
+        //! @return the number of synthetic inputs sent
+        uint64_t GetInputCount() const;
+
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityResyncRequests& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        bool OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(SimulatedClient);
+
+        void SendSyntheticInput();
+
+        AZ::Name m_name;
+        SyntheticInputRpc m_inputRpc;
+        LoadTestSamples& m_latencySamples;
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AzNetworking::IConnection* m_connection = nullptr;
+        bool m_isAccepted = false;
+
+        NetEntityId m_controlledEntityId = InvalidNetEntityId;
+        HostFrameId m_lastHostFrameId = InvalidHostFrameId;
+        AZ::TimeMs m_lastHostTimeMs = AZ::TimeMs{ 0 };
+        AZ::TimeMs m_lastInputTimeMs = AZ::TimeMs{ 0 };
+        ClientInputId m_lastInputId = ClientInputId{ 0 };
+        NetworkInputArray m_inputArray;
+
+        uint64_t m_entityUpdateCount = 0;
+        uint64_t m_inputCount = 0;
+    };
+}
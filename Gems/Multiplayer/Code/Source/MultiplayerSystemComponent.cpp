@@ -25,6 +25,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/chrono/clocks.h>
 
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
@@ -79,6 +80,9 @@ namespace Multiplayer
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
+    AZ_CVAR(uint32_t, sv_loadTestClientsPerStep, 10, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Default number of simulated clients StartLoadTest adds at each step");
+    AZ_CVAR(AZ::TimeMs, sv_loadTestStepDurationMs, AZ::TimeMs{ 10000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Default duration of each StartLoadTest step, metrics are logged at the end of each step");
+    AZ_CVAR(AZ::TimeMs, sv_loadTestInputRateMs, AZ::TimeMs{ 33 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Milliseconds between synthetic inputs sent by each load test client");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -156,6 +160,7 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::Deactivate()
     {
+        m_loadTestHarness.reset();
         AZ::Interface<IMultiplayer>::Unregister(this);
         AZ::TickBus::Handler::BusDisconnect();
     }
@@ -167,6 +172,12 @@ namespace Multiplayer
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
 
+        if ((m_loadTestHarness != nullptr) && m_loadTestHarness->IsComplete())
+        {
+            // Disconnects the simulated clients from the previous load test
+            m_loadTestHarness.reset();
+        }
+
         TickVisibleNetworkEntities(deltaTime, serverRateSeconds);
 
         if (GetAgentType() == MultiplayerAgentType::ClientServer
@@ -175,12 +186,16 @@ namespace Multiplayer
             m_serverSendAccumulator += deltaTime;
             if (m_serverSendAccumulator < serverRateSeconds)
             {
+                // Rpcs sent while ticking entities shouldn't wait for the next network update either
+                m_networkInterface->FlushSends();
                 return;
             }
             m_serverSendAccumulator -= serverRateSeconds;
             m_networkTime.IncrementHostFrameId();
         }
 
+        const AZStd::chrono::high_resolution_clock::time_point sendUpdateStart = AZStd::chrono::high_resolution_clock::now();
+
         // Handle deferred local rpc messages that were generated during the updates
         m_networkEntityManager.DispatchLocalDeferredRpcMessages();
 
@@ -220,6 +235,10 @@ namespace Multiplayer
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
         }
 
+        const AZStd::chrono::microseconds sendUpdateTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::high_resolution_clock::now() - sendUpdateStart);
+        stats.m_networkSendUpdateTimeUs = aznumeric_cast<uint64_t>(sendUpdateTime.count());
+        stats.m_networkUpdateCount++;
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -247,6 +266,9 @@ namespace Multiplayer
         {
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
+
+        // INetworking ticks before us, write what we sent this frame now instead of with the next network update
+        m_networkInterface->FlushSends();
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -438,6 +460,29 @@ namespace Multiplayer
         return false;
     }
 
+    bool MultiplayerSystemComponent::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityResyncRequests& packet
+    )
+    {
+        bool handledAll = true;
+        if (connection->GetUserData() == nullptr)
+        {
+            AZLOG_WARN("Missing connection data, likely due to a connection in the process of closing, entity resync requests size %u", aznumeric_cast<uint32_t>(packet.GetEntityIds().size()));
+            return handledAll;
+        }
+
+        EntityReplicationManager& replicationManager = reinterpret_cast<IConnectionData*>(connection->GetUserData())->GetReplicationManager();
+        for (NetEntityId entityId : packet.GetEntityIds())
+        {
+            handledAll &= replicationManager.HandleEntityResyncRequest(entityId);
+        }
+
+        return handledAll;
+    }
+
     ConnectResult MultiplayerSystemComponent::ValidateConnect
     (
         [[maybe_unused]] const IpAddress& remoteAddress,
@@ -630,6 +675,57 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
     }
 
+    void MultiplayerSystemComponent::StartLoadTest(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (GetAgentType() != MultiplayerAgentType::DedicatedServer && GetAgentType() != MultiplayerAgentType::ClientServer)
+        {
+            AZLOG_WARN("StartLoadTest requires a hosted server, use the host command first");
+            return;
+        }
+
+        if (m_networkInterface->GetType() != ProtocolType::Udp)
+        {
+            AZLOG_WARN("StartLoadTest requires the server to use the udp protocol");
+            return;
+        }
+
+        if (arguments.size() < 1)
+        {
+            AZLOG_WARN("StartLoadTest requires the maximum number of simulated clients");
+            return;
+        }
+
+        LoadTestSettings settings;
+        settings.m_serverAddress = IpAddress(127, 0, 0, 1, sv_port);
+        settings.m_clientsPerStep = sv_loadTestClientsPerStep;
+        settings.m_stepDurationMs = sv_loadTestStepDurationMs;
+        settings.m_inputRateMs = sv_loadTestInputRateMs;
+        if (!AZ::ConsoleTypeHelpers::StringToValue(settings.m_maxClients, arguments[0]))
+        {
+            AZLOG_WARN("StartLoadTest failed to parse maximum client count %.*s", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+        if (arguments.size() > 1)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(settings.m_clientsPerStep, arguments[1]);
+        }
+        if (arguments.size() > 2)
+        {
+            AZ::ConsoleTypeHelpers::StringToValue(settings.m_stepDurationMs, arguments[2]);
+        }
+
+        m_loadTestHarness = AZStd::make_unique<LoadTestHarness>(settings);
+    }
+
+    void MultiplayerSystemComponent::StopLoadTest([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (m_loadTestHarness != nullptr)
+        {
+            AZLOG_INFO("Stopping load test");
+            m_loadTestHarness.reset();
+        }
+    }
+
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
     {
         const float targetAdjustBlend = AZStd::clamp(deltaTime / serverRateSeconds, 0.0f, 1.0f);
@@ -9,6 +9,7 @@
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Editor/MultiplayerEditorConnection.h>
+#include <LoadTest/LoadTestHarness.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
@@ -67,6 +68,7 @@ namespace Multiplayer
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
         bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityResyncRequests& packet);
     
         //! IConnectionListener interface
         //! @{
@@ -93,6 +95,8 @@ namespace Multiplayer
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void StartLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        void StopLoadTest(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
@@ -103,6 +107,8 @@ namespace Multiplayer
         NetworkEntityHandle SpawnDefaultPlayerPrefab();
         
         AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for the current multiplayer session");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, StartLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Connects simulated clients to this server in steps and logs server scaling metrics, usage: StartLoadTest <maxClients> [clientsPerStep] [stepDurationMs]");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, StopLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Stops a running load test and disconnects its simulated clients");
 
         AzNetworking::INetworkInterface* m_networkInterface = nullptr;
         AzNetworking::INetworkInterface* m_networkEditorInterface = nullptr;
@@ -123,6 +129,8 @@ namespace Multiplayer
         double m_serverSendAccumulator = 0.0;
         float m_renderBlendFactor = 0.0f;
 
+        AZStd::unique_ptr<LoadTestHarness> m_loadTestHarness;
+
 #if !defined(AZ_RELEASE_BUILD)
         MultiplayerEditorConnection m_editorConnectionListener;
 #endif
@@ -20,6 +20,8 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/BitPackedSerializer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
@@ -95,6 +97,7 @@ namespace Multiplayer
     void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+        SendEntityResyncRequests();
         SendEntityUpdates(hostTimeMs);
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -315,6 +318,20 @@ namespace Multiplayer
         }
     }
 
+    void EntityReplicationManager::SendEntityResyncRequests()
+    {
+        while (!m_resyncRequestsPendingSend.empty())
+        {
+            MultiplayerPackets::EntityResyncRequests resyncRequestsPacket;
+            while (!m_resyncRequestsPendingSend.empty() && !resyncRequestsPacket.GetEntityIds().full())
+            {
+                resyncRequestsPacket.ModifyEntityIds().push_back(m_resyncRequestsPendingSend.back());
+                m_resyncRequestsPendingSend.pop_back();
+            }
+            m_connection.SendReliablePacket(resyncRequestsPacket);
+        }
+    }
+
     void EntityReplicationManager::Clear(bool forMigration)
     {
         if (forMigration)
@@ -333,6 +350,8 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        m_entitiesPendingResync.clear();
+        m_resyncRequestsPendingSend.clear();
         m_entityReplicatorMap.clear();
     }
 
@@ -754,12 +773,27 @@ namespace Multiplayer
     {
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+
+        // Bit packed updates are delta encoded against a previously received update, decode them before anything else
+        // Even if we drop the update, the remote endpoint sees the packet acked and may use it as a baseline for future updates
+        const bool isBitPacked = updateMessage.GetIsBitPacked() && !updateMessage.GetIsDelete();
+        if (isBitPacked && !DecodeBitPackedUpdate(entityReplicator, updateMessage))
+        {
+            // The remote endpoint considers this update delivered, so it won't resend what it contained on its own
+            RequestEntityResync(updateMessage.GetEntityId());
+            return true;
+        }
+
         UpdateValidationResult result = ValidateUpdate(updateMessage, packetHeader.GetPacketId(), entityReplicator);
         switch (result)
         {
         case UpdateValidationResult::HandleMessage:
             break;
         case UpdateValidationResult::DropMessage:
+            if (isBitPacked && !AddReceivedBaseline(updateMessage.GetEntityId(), packetHeader.GetPacketId()))
+            {
+                RequestEntityResync(updateMessage.GetEntityId());
+            }
             return true;
         case UpdateValidationResult::DropMessageAndDisconnect:
             return false;
@@ -772,8 +806,6 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), updateMessage.GetData()->GetSize());
-
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
         {
@@ -789,6 +821,10 @@ namespace Multiplayer
                 // Note that we need to make sure the replicator is not marked for removal if we're server authority
                 // If a client migrates and we receive a property update message out-of-order, this would re-create a replicator which would be bad
                 AZLOG_ERROR("Unable to process NetworkEntityUpdateMessage without a prefabEntityId, our local EntityReplicator is not set up or is configured incorrectly");
+                if (isBitPacked)
+                {
+                    RequestEntityResync(updateMessage.GetEntityId());
+                }
                 return true;
             }
 
@@ -797,12 +833,120 @@ namespace Multiplayer
         }
 
         // This may implicitly create a replicator for us
-        bool handled = HandlePropertyChangeMessage(entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+        bool handled = false;
+        if (isBitPacked)
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::BitPackedOutputSerializer> outputSerializer(m_decodedBitPackedUpdate.data(), aznumeric_cast<uint32_t>(m_decodedBitPackedUpdate.size()));
+            handled = HandlePropertyChangeMessage(entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+            if (!AddReceivedBaseline(updateMessage.GetEntityId(), packetHeader.GetPacketId()))
+            {
+                RequestEntityResync(updateMessage.GetEntityId());
+            }
+        }
+        else
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), updateMessage.GetData()->GetSize());
+            handled = HandlePropertyChangeMessage(entityReplicator, packetHeader.GetPacketId(), updateMessage.GetEntityId(), updateMessage.GetNetworkRole(), outputSerializer, prefabEntityId);
+        }
         AZ_Assert(handled, "Failed to handle NetworkEntityUpdateMessage message");
 
         return handled;
     }
 
+    bool EntityReplicationManager::DecodeBitPackedUpdate(EntityReplicator* entityReplicator, const NetworkEntityUpdateMessage& updateMessage)
+    {
+        const AzNetworking::PacketEncodingBuffer* data = updateMessage.GetData();
+        AzNetworking::NetworkOutputSerializer headerSerializer(data->GetBuffer(), data->GetSize());
+        bool hasBaseline = false;
+        uint16_t baselineId = 0;
+        headerSerializer.Serialize(hasBaseline, "HasBaseline");
+        if (hasBaseline)
+        {
+            headerSerializer.Serialize(baselineId, "BaselineId", AZStd::numeric_limits<uint16_t>::min(), AZStd::numeric_limits<uint16_t>::max());
+        }
+
+        const AZStd::vector<uint8_t>* baseline = nullptr;
+        if (hasBaseline)
+        {
+            const PropertySubscriber* propSubscriber = (entityReplicator != nullptr) ? entityReplicator->GetPropertySubscriber() : nullptr;
+            baseline = (propSubscriber != nullptr) ? propSubscriber->FindReceivedBaseline(AzNetworking::SequenceId{ baselineId }) : nullptr;
+            if (baseline == nullptr)
+            {
+                AZLOG_WARN("EntityReplicationManager: Dropping bit packed update for entity id %u, baseline %u is no longer available",
+                    aznumeric_cast<uint32_t>(updateMessage.GetEntityId()), static_cast<uint32_t>(baselineId));
+                return false;
+            }
+        }
+
+        const uint8_t* encoded = data->GetBuffer() + headerSerializer.GetReadSize();
+        const uint32_t encodedSize = data->GetSize() - headerSerializer.GetReadSize();
+        uint32_t decodedSize = 0;
+        bool success = headerSerializer.IsValid()
+                    && AzNetworking::GetBaselineDeltaDecodedSize(encoded, encodedSize, decodedSize)
+                    && (decodedSize <= AzNetworking::MaxPacketSize);
+        if (success)
+        {
+            m_decodedBitPackedUpdate.resize_no_construct(decodedSize);
+            success = AzNetworking::DecodeBaselineDelta
+            (
+                encoded, encodedSize,
+                hasBaseline ? baseline->data() : nullptr, hasBaseline ? aznumeric_cast<uint32_t>(baseline->size()) : 0,
+                m_decodedBitPackedUpdate.data(), decodedSize, decodedSize
+            );
+        }
+        if (!success)
+        {
+            AZLOG_WARN("EntityReplicationManager: Dropping malformed bit packed update for entity id %u", aznumeric_cast<uint32_t>(updateMessage.GetEntityId()));
+        }
+        m_decodedBitPackedUpdateHasBaseline = hasBaseline;
+        return success;
+    }
+
+    bool EntityReplicationManager::AddReceivedBaseline(NetEntityId entityId, AzNetworking::PacketId packetId)
+    {
+        // Look the replicator up again, handling the update may have replaced it
+        EntityReplicator* entityReplicator = GetEntityReplicator(entityId);
+        PropertySubscriber* propSubscriber = (entityReplicator != nullptr) ? entityReplicator->GetPropertySubscriber() : nullptr;
+        if (propSubscriber != nullptr)
+        {
+            propSubscriber->AddReceivedBaseline(packetId, m_decodedBitPackedUpdate.data(), aznumeric_cast<uint32_t>(m_decodedBitPackedUpdate.size()));
+            if (!m_decodedBitPackedUpdateHasBaseline)
+            {
+                // We are back in sync with the remote endpoint, any later loss needs a new resync request
+                m_entitiesPendingResync.erase(entityId);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void EntityReplicationManager::RequestEntityResync(NetEntityId entityId)
+    {
+        // Only ask once until an update without a baseline is kept, otherwise every update the remote endpoint sends
+        // before it received the request would trigger yet another full resend
+        if (m_entitiesPendingResync.insert(entityId).second)
+        {
+            AZLOG(NET_RepUpdate, "EntityReplicationManager: Requesting resync for entity id %u from remote manager id %d",
+                aznumeric_cast<uint32_t>(entityId), aznumeric_cast<int32_t>(GetRemoteHostId()));
+            m_resyncRequestsPendingSend.push_back(entityId);
+        }
+    }
+
+    bool EntityReplicationManager::HandleEntityResyncRequest(NetEntityId entityId)
+    {
+        EntityReplicator* entityReplicator = GetEntityReplicator(entityId);
+        PropertyPublisher* propPublisher = (entityReplicator != nullptr) ? entityReplicator->GetPropertyPublisher() : nullptr;
+        if (propPublisher != nullptr)
+        {
+            AZLOG(NET_RepUpdate, "EntityReplicationManager: Resync requested for entity id %u by remote manager id %d",
+                aznumeric_cast<uint32_t>(entityId), aznumeric_cast<int32_t>(GetRemoteHostId()));
+            propPublisher->SetResyncing();
+            AddReplicatorToPendingSend(*entityReplicator);
+        }
+        // The entity may have left the replication window since the request was sent, which is not an error
+        return true;
+    }
+
     bool EntityReplicationManager::HandleEntityRpcMessage(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcMessage& message)
     {
         EntityReplicator* entityReplicator = GetEntityReplicator(message.GetEntityId());
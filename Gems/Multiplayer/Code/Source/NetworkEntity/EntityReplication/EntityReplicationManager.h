@@ -85,6 +85,11 @@ namespace Multiplayer
         bool HandleEntityUpdateMessage(AzNetworking::IConnection* invokingConnection, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
         bool HandleEntityRpcMessage(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcMessage& message);
 
+        //! Resends the full state of an entity without a baseline, requested by a remote endpoint that could not decode its bit packed updates.
+        //! @param entityId the entity to resend
+        //! @return boolean true if the request was handled
+        bool HandleEntityResyncRequest(NetEntityId entityId);
+
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
         void SetMaxRemoteEntitiesPendingCreationCount(uint32_t maxPendingEntities);
@@ -120,6 +125,7 @@ namespace Multiplayer
 
         void SendEntityUpdates(AZ::TimeMs hostTimeMs);
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
+        void SendEntityResyncRequests();
 
         void MigrateEntityInternal(NetEntityId entityId);
         void OnEntityExitDomain(const ConstNetworkEntityHandle& entityHandle);
@@ -143,6 +149,18 @@ namespace Multiplayer
             const PrefabEntityId& prefabEntityId
         );
 
+        //! Decodes a bit packed update into m_decodedBitPackedUpdate, and whether it was delta encoded against a baseline into m_decodedBitPackedUpdateHasBaseline.
+        //! @return boolean true on success, false if the update is malformed or its baseline is no longer available
+        bool DecodeBitPackedUpdate(EntityReplicator* entityReplicator, const NetworkEntityUpdateMessage& updateMessage);
+
+        //! Keeps the last decoded bit packed update on the entity's replicator, so future updates can be delta encoded against it.
+        //! @return boolean true if the update was kept, false if the entity has no replicator to keep it on
+        bool AddReceivedBaseline(NetEntityId entityId, AzNetworking::PacketId packetId);
+
+        //! Asks the remote endpoint to resend the full state of an entity without a baseline.
+        //! Used whenever a bit packed update of the entity is lost to us after it was acked, as the remote endpoint may delta encode against it.
+        void RequestEntityResync(NetEntityId entityId);
+
         void AddReplicatorToPendingRemoval(const EntityReplicator& replicator);
         void ClearRemovedReplicators();
 
@@ -183,6 +201,10 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! Entities we requested a resync for, until we keep a bit packed update without a baseline for them
+        AZStd::unordered_set<NetEntityId> m_entitiesPendingResync;
+        AZStd::vector<NetEntityId> m_resyncRequestsPendingSend;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -204,6 +226,8 @@ namespace Multiplayer
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
+        AZStd::vector<uint8_t> m_decodedBitPackedUpdate;
+        bool m_decodedBitPackedUpdateHasBaseline = false;
         Mode m_updateMode = Mode::Invalid;
 
         friend class EntityReplicator;
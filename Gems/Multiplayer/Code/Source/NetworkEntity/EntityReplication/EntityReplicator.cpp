@@ -31,6 +31,8 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(bool, net_EntityReplicationBitPacking, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enable to send entity updates as bit packed streams, using the value ranges of network properties");
+
     EntityReplicator::EntityReplicator
     (
         EntityReplicationManager& replicationManager,
@@ -433,9 +435,17 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        if (net_EntityReplicationBitPacking)
+        {
+            updateMessage.SetIsBitPacked(true);
+            m_propertyPublisher->UpdateBitPackedSerialization(updateMessage.ModifyData());
+        }
+        else
+        {
+            AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
+            m_propertyPublisher->UpdateSerialization(inputSerializer);
+            updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        }
 
         return updateMessage;
     }
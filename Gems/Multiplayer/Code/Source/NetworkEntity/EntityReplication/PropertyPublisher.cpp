@@ -7,12 +7,16 @@
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/BitPackedSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_EntityReplicationBaselineDelta, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Enable to delta encode bit packed entity updates against the last update acknowledged by the remote endpoint");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, NetBindComponent* netBindComponent, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
@@ -20,6 +24,7 @@ namespace Multiplayer
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentBaselines(net_EntityReplicatorRecordsMax + 1)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
         m_pendingRecord.SetRemoteNetworkRole(remoteNetworkRole);
@@ -66,6 +71,15 @@ namespace Multiplayer
         m_replicatorState = EntityReplicatorState::Rebasing;
     }
 
+    void PropertyPublisher::SetResyncing()
+    {
+        // Creating and rebasing already send the full state without a baseline, and a deleted entity has nothing left to resend
+        if (m_replicatorState == EntityReplicatorState::Updating)
+        {
+            m_resyncRequested = true;
+        }
+    }
+
     void PropertyPublisher::GenerateRecord()
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
@@ -90,7 +104,7 @@ namespace Multiplayer
         m_sentRecords.erase(mostRecentAckedIter, m_sentRecords.end());
 
         // Nothing to send
-        if (!m_pendingRecord.HasChanges() && m_sentRecords.empty() && m_remoteReplicatorEstablished)
+        if (!m_pendingRecord.HasChanges() && m_sentRecords.empty() && m_remoteReplicatorEstablished && !m_resyncRequested)
         {
             return false;
         }
@@ -100,6 +114,7 @@ namespace Multiplayer
     bool PropertyPublisher::PrepareAddEntityRecord()
     {
         m_sentRecords.clear();
+        m_sentBaselines.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         m_sentRecords.push_front(m_pendingRecord);
         return true;
@@ -111,6 +126,7 @@ namespace Multiplayer
 
         // This is basically an Add record, but we don't want to send back predictable values
         m_sentRecords.clear();
+        m_sentBaselines.clear();
         m_netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
         // Don't send predictable properties back to the Autonomous unless we correct them
         if (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
@@ -123,6 +139,13 @@ namespace Multiplayer
 
     bool PropertyPublisher::PrepareUpdateEntityRecord()
     {
+        // A resync resends everything the remote endpoint may have missed, which is the same record as a rebase
+        if (m_resyncRequested)
+        {
+            m_resyncRequested = false;
+            return PrepareRebaseEntityRecord();
+        }
+
         // If we reach the maximum outstanding records, reset the replication state
         if (m_sentRecords.size() >= net_EntityReplicatorRecordsMax)
         {
@@ -171,6 +194,19 @@ namespace Multiplayer
 
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
+        // Fill in the packet id for the last sent bit packed stream, if this update was bit packed
+        if (!m_sentBaselines.empty() && (m_sentBaselines.front().m_sentPacketId == AzNetworking::InvalidPacketId))
+        {
+            if (packetId == AzNetworking::InvalidPacketId)
+            {
+                m_sentBaselines.pop_front();
+            }
+            else
+            {
+                m_sentBaselines.front().m_sentPacketId = packetId;
+            }
+        }
+
         // Fill in the packet id for the last sent update
         ReplicationRecord& lastSentRecord = m_sentRecords.front();
         AZ_Assert(lastSentRecord.m_sentPacketId == AzNetworking::InvalidPacketId, "Assumed we pushed on a packet in UpdateSerialization");
@@ -306,6 +342,65 @@ namespace Multiplayer
         return success;
     }
 
+    const PropertyPublisher::SentBaseline* PropertyPublisher::GetAckedBaseline()
+    {
+        // Skip the front entry, that is the stream we are about to send
+        for (auto iter = m_sentBaselines.begin() + 1; iter != m_sentBaselines.end(); ++iter)
+        {
+            if (m_connection.WasPacketAcked(iter->m_sentPacketId))
+            {
+                // Anything older than the most recent acked stream is never going to be used as a baseline again
+                m_sentBaselines.erase(iter + 1, m_sentBaselines.end());
+                return &m_sentBaselines.back();
+            }
+        }
+        return nullptr;
+    }
+
+    bool PropertyPublisher::UpdateBitPackedSerialization(AzNetworking::PacketEncodingBuffer& outData)
+    {
+        AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
+
+        // Serialize the raw bit packed stream, and keep a copy around as a potential baseline for future updates
+        AzNetworking::BitPackedInputSerializer bitPackedSerializer(outData.GetBuffer(), outData.GetCapacity());
+        if (!UpdateSerialization(bitPackedSerializer))
+        {
+            outData.Resize(0);
+            return false;
+        }
+        m_sentBaselines.push_front(SentBaseline());
+        AZStd::vector<uint8_t>& rawData = m_sentBaselines.front().m_data;
+        rawData.assign(outData.GetBuffer(), outData.GetBuffer() + bitPackedSerializer.GetSize());
+
+        const SentBaseline* baseline = net_EntityReplicationBaselineDelta ? GetAckedBaseline() : nullptr;
+        AzNetworking::NetworkInputSerializer headerSerializer(outData.GetBuffer(), outData.GetCapacity());
+        bool hasBaseline = (baseline != nullptr);
+        headerSerializer.Serialize(hasBaseline, "HasBaseline");
+        if (hasBaseline)
+        {
+            uint16_t baselineId = aznumeric_cast<uint16_t>(AzNetworking::ToSequenceId(baseline->m_sentPacketId));
+            headerSerializer.Serialize(baselineId, "BaselineId", AZStd::numeric_limits<uint16_t>::min(), AZStd::numeric_limits<uint16_t>::max());
+        }
+
+        // Without a baseline the stream is encoded against zeros, which still compresses runs of zeros
+        const uint32_t headerSize = headerSerializer.GetSize();
+        uint32_t encodedSize = 0;
+        const bool success = AzNetworking::EncodeBaselineDelta
+        (
+            rawData.data(), aznumeric_cast<uint32_t>(rawData.size()),
+            hasBaseline ? baseline->m_data.data() : nullptr, hasBaseline ? aznumeric_cast<uint32_t>(baseline->m_data.size()) : 0,
+            outData.GetBuffer() + headerSize, outData.GetCapacity() - headerSize, encodedSize
+        );
+        if (!success)
+        {
+            AZLOG_ERROR("EntityReplicator: Bit packed update does not fit into the packet");
+            outData.Resize(0);
+            return false;
+        }
+        outData.Resize(headerSize + encodedSize);
+        return true;
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
 namespace AzNetworking
@@ -30,6 +31,10 @@ namespace Multiplayer
 
         void SetRebasing();
 
+        //! Sends the full state of the entity without a baseline with the next update.
+        //! Used when the remote endpoint could not decode our bit packed updates and has lost track of our baselines.
+        void SetResyncing();
+
         bool IsDeleting() const;
         bool IsDeleted() const;
         void SetDeleting();
@@ -43,6 +48,7 @@ namespace Multiplayer
         bool RequiresSerialization();
         bool PrepareSerialization();
         bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        bool UpdateBitPackedSerialization(AzNetworking::PacketEncodingBuffer& outData);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -62,6 +68,13 @@ namespace Multiplayer
             Prepared,
         };
 
+        //! A bit packed property stream, along with the packet it was sent in
+        struct SentBaseline
+        {
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
         EntityReplicatorState GetReplicatorState() const;
 
         //! Check if we have data to send
@@ -82,6 +95,9 @@ namespace Multiplayer
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
 
+        //! Drops baselines older than the most recently acked one, and returns the most recently acked baseline if any.
+        const SentBaseline* GetAckedBaseline();
+
         EntityReplicatorState m_replicatorState = EntityReplicatorState::Creating;
         EntityReplicatorSerializationPhase m_serializationPhase = EntityReplicatorSerializationPhase::Ready;
         OwnsLifetime m_ownsLifetime = OwnsLifetime::False;
@@ -94,6 +110,10 @@ namespace Multiplayer
         //! List of sent records (history of m_currentRecord)
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
+
+        //! List of sent bit packed property streams, the remote endpoint keeps the ones it received to decode deltas against
+        AZStd::ring_buffer<SentBaseline> m_sentBaselines;
         bool m_remoteReplicatorEstablished = false;
+        bool m_resyncRequested = false;
     };
 }
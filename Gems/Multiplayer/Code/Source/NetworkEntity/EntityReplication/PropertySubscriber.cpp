@@ -8,12 +8,17 @@
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(uint32_t, net_EntityReplicatorRecordsMax);
+
     PropertySubscriber::PropertySubscriber(EntityReplicationManager& replicationManager, NetBindComponent* netBindComponent)
         : m_replicationManager(replicationManager)
         , m_netBindComponent(netBindComponent)
+        // The publisher only delta encodes against one of its outstanding records, keep at least that many
+        , m_receivedBaselines(net_EntityReplicatorRecordsMax + 1)
     {
         ;
     }
@@ -49,4 +54,26 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    void PropertySubscriber::AddReceivedBaseline(AzNetworking::PacketId packetId, const uint8_t* data, uint32_t size)
+    {
+        // Overwrites the oldest stream once full
+        m_receivedBaselines.push_front(ReceivedBaseline());
+        m_receivedBaselines.front().m_packetId = packetId;
+        m_receivedBaselines.front().m_data.assign(data, data + size);
+    }
+
+    const AZStd::vector<uint8_t>* PropertySubscriber::FindReceivedBaseline(AzNetworking::SequenceId baselineId) const
+    {
+        // Sequence ids wrap around, prefer the most recent packet if more than one matches
+        const ReceivedBaseline* result = nullptr;
+        for (const ReceivedBaseline& baseline : m_receivedBaselines)
+        {
+            if ((AzNetworking::ToSequenceId(baseline.m_packetId) == baselineId) && ((result == nullptr) || (baseline.m_packetId > result->m_packetId)))
+            {
+                result = &baseline;
+            }
+        }
+        return (result != nullptr) ? &result->m_data : nullptr;
+    }
 }
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -33,6 +35,17 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Keeps a received bit packed property stream, the remote endpoint may delta encode future updates against it.
+        //! @param packetId the packet the stream was received in
+        //! @param data     the decoded bit packed property stream
+        //! @param size     size of the stream in bytes
+        void AddReceivedBaseline(AzNetworking::PacketId packetId, const uint8_t* data, uint32_t size);
+
+        //! Finds a previously received bit packed property stream.
+        //! @param baselineId the sequence id of the packet the stream was received in
+        //! @return pointer to the stream, or nullptr if it is no longer available
+        const AZStd::vector<uint8_t>* FindReceivedBaseline(AzNetworking::SequenceId baselineId) const;
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -41,5 +54,12 @@ namespace Multiplayer
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_lastRecievedTimeMs = AZ::TimeMs{ 0 };
         AZ::TimeMs m_markForRemovalTimeMs = AZ::TimeMs{ 0 };
+
+        struct ReceivedBaseline
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+        AZStd::ring_buffer<ReceivedBaseline> m_receivedBaselines;
     };
 }
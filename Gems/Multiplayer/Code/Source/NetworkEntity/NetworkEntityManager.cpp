@@ -45,6 +45,7 @@ namespace Multiplayer
         m_hostId = hostId;
         m_entityDomain = AZStd::move(entityDomain);
         m_updateEntityDomainEvent.Enqueue(net_EntityDomainUpdateMs, true);
+        m_replicationGrid.Initialize(m_networkEntityTracker);
     }
 
     NetworkEntityTracker* NetworkEntityManager::GetNetworkEntityTracker()
@@ -62,6 +63,11 @@ namespace Multiplayer
         return &m_multiplayerComponentRegistry;
     }
 
+    ReplicationGrid* NetworkEntityManager::GetReplicationGrid()
+    {
+        return &m_replicationGrid;
+    }
+
     HostId NetworkEntityManager::GetHostId() const
     {
         return m_hostId;
@@ -145,6 +151,7 @@ namespace Multiplayer
         //    rootSlice->RemoveEntity(entity);
         //}
         m_networkEntityTracker.clear();
+        m_replicationGrid.Clear();
     }
 
     void NetworkEntityManager::AddEntityMarkedDirtyHandler(AZ::Event<>::Handler& entityMarkedDirtyHandler)
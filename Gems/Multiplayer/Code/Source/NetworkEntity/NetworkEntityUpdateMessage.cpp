@@ -19,6 +19,7 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_takeOwnership(rhs.m_takeOwnership)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isBitPacked(rhs.m_isBitPacked)
         , m_prefabEntityId(rhs.m_prefabEntityId)
         , m_data(AZStd::move(rhs.m_data))
     {
@@ -32,6 +33,7 @@ namespace Multiplayer
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_takeOwnership(rhs.m_takeOwnership)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isBitPacked(rhs.m_isBitPacked)
         , m_prefabEntityId(rhs.m_prefabEntityId)
     {
         if (rhs.m_data != nullptr)
@@ -74,6 +76,7 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_takeOwnership = rhs.m_takeOwnership;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isBitPacked = rhs.m_isBitPacked;
         m_prefabEntityId = rhs.m_prefabEntityId;
         m_data = AZStd::move(rhs.m_data);
         return *this;
@@ -87,6 +90,7 @@ namespace Multiplayer
         m_wasMigrated = rhs.m_wasMigrated;
         m_takeOwnership = rhs.m_takeOwnership;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isBitPacked = rhs.m_isBitPacked;
         m_prefabEntityId = rhs.m_prefabEntityId;
         if (rhs.m_data != nullptr)
         {
@@ -105,6 +109,7 @@ namespace Multiplayer
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_takeOwnership == rhs.m_takeOwnership)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
+             && (m_isBitPacked == rhs.m_isBitPacked)
              && (m_prefabEntityId == rhs.m_prefabEntityId));
     }
 
@@ -169,6 +174,16 @@ namespace Multiplayer
         return m_hasValidPrefabId;
     }
 
+    void NetworkEntityUpdateMessage::SetIsBitPacked(bool value)
+    {
+        m_isBitPacked = value;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsBitPacked() const
+    {
+        return m_isBitPacked;
+    }
+
     void NetworkEntityUpdateMessage::SetPrefabEntityId(const PrefabEntityId& value)
     {
         m_hasValidPrefabId = true;
@@ -208,11 +223,12 @@ namespace Multiplayer
         // Always serialize the entityId
         serializer.Serialize(m_entityId, "EntityId");
 
-        // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
+        // Use the upper 5 bits for boolean flags, and the lower 3 bits for the network role
         uint8_t networkTypeAndFlags = (m_isDelete ? 0x80 : 0x00)
                                     | (m_wasMigrated ? 0x40 : 0x00)
                                     | (m_takeOwnership ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
+                                    | (m_isBitPacked ? 0x08 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
@@ -221,7 +237,8 @@ namespace Multiplayer
             m_wasMigrated = (networkTypeAndFlags & 0x40) == 0x40;
             m_takeOwnership = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
-            m_networkRole = static_cast<NetEntityRole>(networkTypeAndFlags & 0x0F);
+            m_isBitPacked = (networkTypeAndFlags & 0x08) == 0x08;
+            m_networkRole = static_cast<NetEntityRole>(networkTypeAndFlags & 0x07);
         }
 
         if (!m_isDelete)
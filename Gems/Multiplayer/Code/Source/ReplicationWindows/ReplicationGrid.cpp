@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationGrid.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, sv_MinReplicationWindowsForParallelUpdate, 4, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum number of client replication windows before window updates are spread across the job system");
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs);
+
+    ReplicationGrid::ReplicationGrid(float cellSize)
+        : m_cellSize(cellSize)
+        , m_inverseCellSize(1.0f / cellSize)
+        , m_updateReplicationWindowsEvent([this]() { UpdateReplicationWindows(); }, AZ::Name("ReplicationGrid update replication windows event"))
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        AZ_Assert(cellSize > 0.0f, "ReplicationGrid cell size must be positive");
+    }
+
+    ReplicationGrid::~ReplicationGrid()
+    {
+        // Replication windows are owned by connections, which may outlive the grid during shutdown
+        m_replicationWindows.clear();
+    }
+
+    void ReplicationGrid::Initialize(const NetworkEntityTracker& entityTracker)
+    {
+        if (m_initialized)
+        {
+            return;
+        }
+        m_initialized = true;
+
+        // Entities may have been activated before we started tracking
+        for (const auto& trackedEntity : entityTracker)
+        {
+            AZ::Entity* entity = trackedEntity.second;
+            if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active))
+            {
+                OnEntityActivated(entity);
+            }
+        }
+
+        AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+        AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        m_updateReplicationWindowsEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+    }
+
+    bool ReplicationGrid::IsInitialized() const
+    {
+        return m_initialized;
+    }
+
+    void ReplicationGrid::AddEntity(NetEntityId netEntityId, const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position)
+    {
+        auto locationIter = m_entryLocations.find(netEntityId);
+        if (locationIter != m_entryLocations.end())
+        {
+            RemoveFromCell(locationIter->second);
+            m_entryLocations.erase(locationIter);
+        }
+
+        const CellKey cellKey = GetCellKey(position);
+        Cell& cell = m_cells[cellKey];
+        m_entryLocations[netEntityId] = EntryLocation{ cellKey, aznumeric_cast<uint32_t>(cell.size()) };
+        cell.push_back(Entry{ entityHandle, position, netEntityId });
+    }
+
+    void ReplicationGrid::UpdateEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto locationIter = m_entryLocations.find(netEntityId);
+        if (locationIter == m_entryLocations.end())
+        {
+            return;
+        }
+
+        EntryLocation& location = locationIter->second;
+        const CellKey cellKey = GetCellKey(position);
+        if (cellKey == location.m_cellKey)
+        {
+            // Most updates stay within the same cell
+            m_cells[cellKey][location.m_index].m_position = position;
+            return;
+        }
+
+        Entry entry = m_cells[location.m_cellKey][location.m_index];
+        entry.m_position = position;
+        RemoveFromCell(location);
+
+        Cell& cell = m_cells[cellKey];
+        location = EntryLocation{ cellKey, aznumeric_cast<uint32_t>(cell.size()) };
+        cell.push_back(AZStd::move(entry));
+    }
+
+    void ReplicationGrid::RemoveEntity(NetEntityId netEntityId)
+    {
+        auto locationIter = m_entryLocations.find(netEntityId);
+        if (locationIter != m_entryLocations.end())
+        {
+            RemoveFromCell(locationIter->second);
+            m_entryLocations.erase(locationIter);
+        }
+    }
+
+    void ReplicationGrid::Clear()
+    {
+        m_cells.clear();
+        m_entryLocations.clear();
+    }
+
+    uint32_t ReplicationGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entryLocations.size());
+    }
+
+    float ReplicationGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    void ReplicationGrid::AddReplicationWindow(ServerToClientReplicationWindow* replicationWindow)
+    {
+        m_replicationWindows.push_back(replicationWindow);
+    }
+
+    void ReplicationGrid::RemoveReplicationWindow(ServerToClientReplicationWindow* replicationWindow)
+    {
+        auto windowIter = AZStd::find(m_replicationWindows.begin(), m_replicationWindows.end(), replicationWindow);
+        if (windowIter != m_replicationWindows.end())
+        {
+            m_replicationWindows.erase(windowIter);
+        }
+    }
+
+    void ReplicationGrid::UpdateReplicationWindows()
+    {
+        AZStd::vector<ServerToClientReplicationWindow*> updatingWindows;
+        updatingWindows.reserve(m_replicationWindows.size());
+        for (ServerToClientReplicationWindow* replicationWindow : m_replicationWindows)
+        {
+            if (replicationWindow->PrepareWindowUpdate())
+            {
+                updatingWindows.push_back(replicationWindow);
+            }
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        if (updatingWindows.size() >= sv_MinReplicationWindowsForParallelUpdate)
+        {
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        }
+
+        // Gathering only reads the grid and entity state, so every window can gather on its own job while this thread waits
+        if (jobContext != nullptr)
+        {
+            AZ::parallel_for(static_cast<size_t>(0), updatingWindows.size(), [this, &updatingWindows](size_t windowIndex)
+            {
+                updatingWindows[windowIndex]->GatherCandidates(*this);
+            }, jobContext);
+        }
+        else
+        {
+            for (ServerToClientReplicationWindow* replicationWindow : updatingWindows)
+            {
+                replicationWindow->GatherCandidates(*this);
+            }
+        }
+
+        for (ServerToClientReplicationWindow* replicationWindow : updatingWindows)
+        {
+            replicationWindow->ApplyCandidates();
+        }
+    }
+
+    void ReplicationGrid::RemoveFromCell(const EntryLocation& location)
+    {
+        // Swap the last entry of the cell into the removed slot, and fix up the location of the moved entry
+        Cell& cell = m_cells[location.m_cellKey];
+        if (location.m_index + 1 < cell.size())
+        {
+            cell[location.m_index] = AZStd::move(cell.back());
+            m_entryLocations[cell[location.m_index].m_netEntityId].m_index = location.m_index;
+        }
+        cell.pop_back();
+    }
+
+    void ReplicationGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity, GetNetworkEntityTracker());
+        NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((netBindComponent != nullptr) && (transformInterface != nullptr))
+        {
+            AddEntity(netBindComponent->GetNetEntityId(), entityHandle, transformInterface->GetWorldTranslation());
+        }
+    }
+
+    void ReplicationGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity, GetNetworkEntityTracker());
+        NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if (netBindComponent != nullptr)
+        {
+            RemoveEntity(netBindComponent->GetNetEntityId());
+        }
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class NetworkEntityTracker;
+    class ServerToClientReplicationWindow;
+
+    //! @class ReplicationGrid
+    //! @brief Spatial hash of networked entity positions, used by the server to client replication windows to find nearby entities.
+    //! The grid divides the horizontal plane into square cells, entities are added when they activate and moved incrementally
+    //! whenever their NetworkTransformComponent changes position.
+    //! The grid also drives the updates of all server to client replication windows, gathering candidates for every window in
+    //! parallel on the job system, and then applying the results on the main thread.
+    class ReplicationGrid
+    {
+    public:
+        static constexpr float DefaultCellSize = 100.0f;
+
+        struct Entry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+        };
+
+        explicit ReplicationGrid(float cellSize = DefaultCellSize);
+        ~ReplicationGrid();
+
+        //! Starts tracking entity activations and updating replication windows, only invoked for authoritative hosts.
+        //! @param entityTracker the tracker of all networked entities, entities that are already active are added to the grid
+        void Initialize(const NetworkEntityTracker& entityTracker);
+
+        //! Returns whether the grid is tracking entity activations.
+        //! @return boolean true if Initialize has been invoked
+        bool IsInitialized() const;
+
+        //! Adds an entity to the grid, or moves it if it has already been added.
+        //! @param netEntityId  the networkId of the entity
+        //! @param entityHandle handle of the entity
+        //! @param position     the world position of the entity
+        void AddEntity(NetEntityId netEntityId, const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position);
+
+        //! Moves an entity that was previously added to the grid, does nothing if the entity is not in the grid.
+        //! @param netEntityId the networkId of the entity
+        //! @param position    the new world position of the entity
+        void UpdateEntity(NetEntityId netEntityId, const AZ::Vector3& position);
+
+        //! Removes an entity from the grid.
+        //! @param netEntityId the networkId of the entity
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Removes all entities from the grid.
+        void Clear();
+
+        //! Returns the number of entities in the grid.
+        //! @return the number of entities in the grid
+        uint32_t GetEntityCount() const;
+
+        //! Returns the size of a grid cell.
+        //! @return the size of a grid cell in meters
+        float GetCellSize() const;
+
+        //! Invokes visitor(const Entry& entry, float distanceSquared) for every entity within radius of a position.
+        //! Enumeration only reads the grid, any number of threads may enumerate as long as no entities are added, moved or removed.
+        //! @param position the center of the query
+        //! @param radius   the radius of the query
+        //! @param visitor  the function to invoke for every entity within radius
+        template <typename VISITOR>
+        void EnumerateRadius(const AZ::Vector3& position, float radius, VISITOR&& visitor) const;
+
+        //! Registers a replication window to be updated by the grid.
+        //! @param replicationWindow the replication window to update
+        void AddReplicationWindow(ServerToClientReplicationWindow* replicationWindow);
+
+        //! Unregisters a replication window.
+        //! @param replicationWindow the replication window to stop updating
+        void RemoveReplicationWindow(ServerToClientReplicationWindow* replicationWindow);
+
+        //! Updates all registered replication windows.
+        void UpdateReplicationWindows();
+
+    private:
+        using CellKey = uint64_t;
+        using Cell = AZStd::vector<Entry>;
+
+        struct EntryLocation
+        {
+            CellKey m_cellKey = 0;
+            uint32_t m_index = 0;
+        };
+
+        int32_t GetCellCoordinate(float value) const;
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        static CellKey MakeCellKey(int32_t cellX, int32_t cellY);
+
+        void RemoveFromCell(const EntryLocation& location);
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+
+        AZStd::unordered_map<CellKey, Cell> m_cells;
+        AZStd::unordered_map<NetEntityId, EntryLocation> m_entryLocations;
+        float m_cellSize = DefaultCellSize;
+        float m_inverseCellSize = 1.0f / DefaultCellSize;
+        bool m_initialized = false;
+
+        AZStd::vector<ServerToClientReplicationWindow*> m_replicationWindows;
+        AZ::ScheduledEvent m_updateReplicationWindowsEvent;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+    };
+}
+
+#include <Source/ReplicationWindows/ReplicationGrid.inl>
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    inline int32_t ReplicationGrid::GetCellCoordinate(float value) const
+    {
+        // Clamp so positions far outside of any sensible world can't overflow the cell coordinates
+        static constexpr float MaxCellCoordinate = 1.0e9f;
+        return static_cast<int32_t>(AZ::GetClamp(floorf(value * m_inverseCellSize), -MaxCellCoordinate, MaxCellCoordinate));
+    }
+
+    inline ReplicationGrid::CellKey ReplicationGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return MakeCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+    }
+
+    inline ReplicationGrid::CellKey ReplicationGrid::MakeCellKey(int32_t cellX, int32_t cellY)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellX)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellY));
+    }
+
+    template <typename VISITOR>
+    inline void ReplicationGrid::EnumerateRadius(const AZ::Vector3& position, float radius, VISITOR&& visitor) const
+    {
+        const float radiusSquared = radius * radius;
+        auto visitCell = [&position, radiusSquared, &visitor](const Cell& cell)
+        {
+            for (const Entry& entry : cell)
+            {
+                const float distanceSquared = position.GetDistanceSq(entry.m_position);
+                if (distanceSquared <= radiusSquared)
+                {
+                    visitor(entry, distanceSquared);
+                }
+            }
+        };
+
+        const int32_t minX = GetCellCoordinate(position.GetX() - radius);
+        const int32_t maxX = GetCellCoordinate(position.GetX() + radius);
+        const int32_t minY = GetCellCoordinate(position.GetY() - radius);
+        const int32_t maxY = GetCellCoordinate(position.GetY() + radius);
+
+        // If the query covers more cells than the grid has, it's cheaper to walk the occupied cells than to look up every covered cell
+        const uint64_t coveredCellCount = static_cast<uint64_t>(static_cast<int64_t>(maxX) - minX + 1) * static_cast<uint64_t>(static_cast<int64_t>(maxY) - minY + 1);
+        if (coveredCellCount >= m_cells.size())
+        {
+            for (const auto& cell : m_cells)
+            {
+                visitCell(cell.second);
+            }
+            return;
+        }
+
+        for (int32_t cellX = minX; cellX <= maxX; ++cellX)
+        {
+            for (int32_t cellY = minY; cellY <= maxY; ++cellY)
+            {
+                auto cellIter = m_cells.find(MakeCellKey(cellX, cellY));
+                if (cellIter != m_cells.end())
+                {
+                    visitCell(cellIter->second);
+                }
+            }
+        }
+    }
+}
@@ -6,8 +6,8 @@
  */
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/ReplicationWindows/ReplicationGrid.h>
 #include <Multiplayer/Components/NetBindComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -70,12 +70,29 @@ namespace Multiplayer
         //    mp_ControlledFilteredEntityComponent->AddFilteredEntityEventHandle(m_FilteredEntityAddedEventHandle);
         //}
 
-        m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        // The replication grid updates all windows together, so their gathers can run in parallel
+        ReplicationGrid* replicationGrid = GetReplicationGrid();
+        if ((replicationGrid != nullptr) && replicationGrid->IsInitialized())
+        {
+            replicationGrid->AddReplicationWindow(this);
+        }
+        else
+        {
+            m_updateWindowEvent.Enqueue(sv_ClientReplicationWindowUpdateMs, true);
+        }
 
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
         AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
     }
 
+    ServerToClientReplicationWindow::~ServerToClientReplicationWindow()
+    {
+        if (ReplicationGrid* replicationGrid = GetReplicationGrid())
+        {
+            replicationGrid->RemoveReplicationWindow(this);
+        }
+    }
+
     bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
     {
         // if we don't have a controlled entity anymore, don't send updates (validate this)
@@ -83,6 +100,8 @@ namespace Multiplayer
         {
             m_replicationSet.clear();
         }
+
+        // Always report the set, the replication manager reconciles it against replicators it may have added or removed itself
         return true;
     }
 
@@ -112,63 +131,89 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
-        // clear the candidate queue, we're going to rebuild it
-        ReplicationCandidateQueue clearQueue;
-        clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
-        m_candidateQueue.swap(clearQueue);
-        m_replicationSet.clear();
+        if (PrepareWindowUpdate())
+        {
+            if (ReplicationGrid* replicationGrid = GetReplicationGrid())
+            {
+                GatherCandidates(*replicationGrid);
+            }
+            ApplyCandidates();
+        }
+    }
 
+    bool ServerToClientReplicationWindow::PrepareWindowUpdate()
+    {
         NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
         if (!netBindComponent || !netBindComponent->HasController())
         {
             // if we don't have a controlled entity, or we no longer have control of the entity, don't run the update
-            return;
+            if (!m_replicationSet.empty())
+            {
+                m_candidateQueue = ReplicationCandidateQueue();
+                m_replicationSet.clear();
+            }
+            return false;
         }
 
         EvaluateConnection();
 
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
-        const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
+        m_controlledEntityPosition = transformInterface->GetWorldTranslation();
+        return true;
+    }
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+    void ServerToClientReplicationWindow::GatherCandidates(const ReplicationGrid& replicationGrid)
+    {
+        m_gatheredCandidates.clear();
+        replicationGrid.EnumerateRadius(m_controlledEntityPosition, sv_ClientAwarenessRadius,
+            [this](const ReplicationGrid::Entry& entry, float distanceSquared)
             {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                //if (mp_ControlledFilteredEntityComponent && mp_ControlledFilteredEntityComponent->IsEntityFiltered(iterator.Get()))
+                //{
+                //    return;
+                //}
+
+                // Copy the handle, handles cache lookups internally and the grid entries are shared between all windows
+                ConstNetworkEntityHandle entityHandle = entry.m_entityHandle;
+                if (!sv_ReplicateServerProxies)
                 {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                    const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+                    if ((netBindComponent != nullptr) && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
                     {
-                        gatheredEntries.push_back(visEntry);
+                        // Proxy replication disabled
+                        return;
                     }
                 }
-            }
-        );
 
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+                const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                m_gatheredCandidates.emplace_back(entityHandle, priority);
+            });
 
-        // Add all the neighbors
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
+        // Only keep the highest priority candidates
+        const uint32_t maxCandidates = sv_MaxEntitiesToTrackReplication;
+        if (m_gatheredCandidates.size() > maxCandidates)
         {
-            //if (mp_ControlledFilteredEntityComponent && mp_ControlledFilteredEntityComponent->IsEntityFiltered(iterator.Get()))
-            //{
-            //    continue;
-            //}
-
-            // We want to find the closest extent to the player and prioritize using that distance
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-            NetBindComponent* entryNetBindComponent = entity->template FindComponent<NetBindComponent>();
-            if (entryNetBindComponent != nullptr)
-            {
-                const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-                const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
-                const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
-                const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
+            AZStd::partial_sort(m_gatheredCandidates.begin(), m_gatheredCandidates.begin() + maxCandidates, m_gatheredCandidates.end(),
+                [](const PrioritizedReplicationCandidate& lhs, const PrioritizedReplicationCandidate& rhs) { return lhs.m_priority > rhs.m_priority; });
+            m_gatheredCandidates.resize(maxCandidates);
+        }
+    }
 
-                NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
-                AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
-            }
+    void ServerToClientReplicationWindow::ApplyCandidates()
+    {
+        // clear the candidate queue, we're going to rebuild it
+        ReplicationCandidateQueue clearQueue;
+        clearQueue.get_container().reserve(sv_MaxEntitiesToTrackReplication);
+        m_candidateQueue.swap(clearQueue);
+
+        m_replicationSet.clear();
+
+        // Add all the neighbors
+        for (PrioritizedReplicationCandidate& candidate : m_gatheredCandidates)
+        {
+            AddEntityToReplicationSet(candidate.m_entityHandle, candidate.m_priority, 0.0f);
         }
+        m_gatheredCandidates.clear();
 
         // Add in Autonomous Entities
         // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
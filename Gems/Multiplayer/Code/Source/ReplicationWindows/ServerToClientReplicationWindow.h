@@ -19,6 +19,7 @@
 namespace Multiplayer
 {
     class NetSystemComponent;
+    class ReplicationGrid;
 
     class ServerToClientReplicationWindow
         : public IReplicationWindow
@@ -38,6 +39,7 @@ namespace Multiplayer
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
         ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection);
+        ~ServerToClientReplicationWindow() override;
 
         //! IReplicationWindow interface
         //! @{
@@ -49,6 +51,16 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! Window updates are split into phases so the ReplicationGrid can gather candidates for many windows in parallel.
+        //! @{
+        //! Main thread, returns false if the window doesn't need to gather candidates.
+        bool PrepareWindowUpdate();
+        //! Any thread, only reads the grid and entity state, and writes to this window's gathered candidates.
+        void GatherCandidates(const ReplicationGrid& replicationGrid);
+        //! Main thread, rebuilds the replication set from the gathered candidates.
+        void ApplyCandidates();
+        //! @}
+
     private:
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
@@ -64,6 +76,8 @@ namespace Multiplayer
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
+        AZStd::vector<PrioritizedReplicationCandidate> m_gatheredCandidates;
+        AZ::Vector3 m_controlledEntityPosition = AZ::Vector3::CreateZero();
 
         AZ::ScheduledEvent m_updateWindowEvent;
 
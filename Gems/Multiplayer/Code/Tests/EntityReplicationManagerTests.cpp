@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/BaselineDelta.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/UdpTransport/UdpPacketHeader.h>
+#include <AzTest/AzTest.h>
+#include <MultiplayerSystemComponent.h>
+#include <IMultiplayerConnectionMock.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+
+namespace UnitTest
+{
+    using ::testing::_;
+    using ::testing::Invoke;
+    using ::testing::NiceMock;
+    using ::testing::Return;
+
+    class EntityReplicationManagerTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            m_netComponent = new AzNetworking::NetworkingSystemComponent();
+            m_mpComponent = new Multiplayer::MultiplayerSystemComponent();
+
+            m_connection = new NiceMock<IMultiplayerConnectionMock>(AzNetworking::ConnectionId(1), AzNetworking::IpAddress(), AzNetworking::ConnectionRole::Connector);
+            ON_CALL(*m_connection, GetConnectionMtu()).WillByDefault(Return(1200u));
+            ON_CALL(*m_connection, SendReliablePacket(_)).WillByDefault(Invoke([this](const AzNetworking::IPacket& packet)
+            {
+                if (packet.GetPacketType() == MultiplayerPackets::EntityResyncRequests::Type)
+                {
+                    for (Multiplayer::NetEntityId entityId : static_cast<const MultiplayerPackets::EntityResyncRequests&>(packet).GetEntityIds())
+                    {
+                        m_resyncRequests.push_back(entityId);
+                    }
+                }
+                return true;
+            }));
+
+            // Client managers trust every update from the server, so nothing is dropped by validation
+            m_replicationManager = new Multiplayer::EntityReplicationManager
+            (
+                *m_connection, *m_mpComponent, Multiplayer::EntityReplicationManager::Mode::LocalClientToRemoteServer
+            );
+        }
+
+        void TearDown() override
+        {
+            delete m_replicationManager;
+            delete m_connection;
+            delete m_mpComponent;
+            delete m_netComponent;
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        static Multiplayer::NetworkEntityUpdateMessage CreateBitPackedUpdate(Multiplayer::NetEntityId entityId, bool hasBaseline)
+        {
+            Multiplayer::NetworkEntityUpdateMessage updateMessage(Multiplayer::NetEntityRole::Client, entityId);
+            updateMessage.SetIsBitPacked(true);
+
+            AzNetworking::PacketEncodingBuffer& data = updateMessage.ModifyData();
+            AzNetworking::NetworkInputSerializer headerSerializer(data.GetBuffer(), data.GetCapacity());
+            uint16_t baselineId = 7;
+            headerSerializer.Serialize(hasBaseline, "HasBaseline");
+            if (hasBaseline)
+            {
+                headerSerializer.Serialize(baselineId, "BaselineId", AZStd::numeric_limits<uint16_t>::min(), AZStd::numeric_limits<uint16_t>::max());
+            }
+
+            const uint8_t properties[] = { 1, 2, 3, 0, 0, 0, 4 };
+            const uint32_t headerSize = headerSerializer.GetSize();
+            uint32_t encodedSize = 0;
+            EXPECT_TRUE(AzNetworking::EncodeBaselineDelta
+            (
+                properties, aznumeric_cast<uint32_t>(AZ_ARRAY_SIZE(properties)), nullptr, 0,
+                data.GetBuffer() + headerSize, data.GetCapacity() - headerSize, encodedSize
+            ));
+            data.Resize(headerSize + encodedSize);
+            return updateMessage;
+        }
+
+        bool HandleUpdate(const Multiplayer::NetworkEntityUpdateMessage& updateMessage)
+        {
+            const AzNetworking::UdpPacketHeader header(MultiplayerPackets::EntityUpdates::Type, AzNetworking::PacketId(++m_lastPacketId));
+            return m_replicationManager->HandleEntityUpdateMessage(m_connection, header, updateMessage);
+        }
+
+        AzNetworking::NetworkingSystemComponent* m_netComponent = nullptr;
+        Multiplayer::MultiplayerSystemComponent* m_mpComponent = nullptr;
+        NiceMock<IMultiplayerConnectionMock>* m_connection = nullptr;
+        Multiplayer::EntityReplicationManager* m_replicationManager = nullptr;
+        AZStd::vector<Multiplayer::NetEntityId> m_resyncRequests;
+        uint32_t m_lastPacketId = 0;
+    };
+
+    TEST_F(EntityReplicationManagerTests, MissingBaseline_RequestsResync)
+    {
+        const Multiplayer::NetEntityId entityId = Multiplayer::NetEntityId(5);
+
+        // The update is acked regardless, so it must not be treated as a disconnect
+        EXPECT_TRUE(HandleUpdate(CreateBitPackedUpdate(entityId, true)));
+        m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+        ASSERT_EQ(m_resyncRequests.size(), 1u);
+        EXPECT_EQ(m_resyncRequests[0], entityId);
+
+        // Later updates still delta encoded against the lost baseline don't ask again
+        EXPECT_TRUE(HandleUpdate(CreateBitPackedUpdate(entityId, true)));
+        EXPECT_TRUE(HandleUpdate(CreateBitPackedUpdate(entityId, true)));
+        m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+        EXPECT_EQ(m_resyncRequests.size(), 1u);
+
+        // Other entities are tracked separately
+        const Multiplayer::NetEntityId otherEntityId = Multiplayer::NetEntityId(6);
+        EXPECT_TRUE(HandleUpdate(CreateBitPackedUpdate(otherEntityId, true)));
+        m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+        ASSERT_EQ(m_resyncRequests.size(), 2u);
+        EXPECT_EQ(m_resyncRequests[1], otherEntityId);
+    }
+
+    TEST_F(EntityReplicationManagerTests, UpdateWithoutReplicator_RequestsResync)
+    {
+        // The update decodes, but without a replicator there is nothing to keep it on as a baseline
+        const Multiplayer::NetEntityId entityId = Multiplayer::NetEntityId(5);
+        EXPECT_TRUE(HandleUpdate(CreateBitPackedUpdate(entityId, false)));
+        m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+        ASSERT_EQ(m_resyncRequests.size(), 1u);
+        EXPECT_EQ(m_resyncRequests[0], entityId);
+    }
+
+    TEST_F(EntityReplicationManagerTests, ResyncRequestForUnknownEntity_IsIgnored)
+    {
+        EXPECT_TRUE(m_replicationManager->HandleEntityResyncRequest(Multiplayer::NetEntityId(5)));
+        m_replicationManager->SendUpdates(AZ::TimeMs{ 0 });
+        EXPECT_TRUE(m_resyncRequests.empty());
+    }
+}
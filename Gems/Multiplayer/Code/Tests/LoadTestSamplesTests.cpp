@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/LoadTest/LoadTestSamples.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class LoadTestSamplesTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+        }
+
+        void TearDown() override
+        {
+            TeardownAllocator();
+        }
+    };
+
+    TEST_F(LoadTestSamplesTests, EmptySamples)
+    {
+        Multiplayer::LoadTestSamples samples;
+        EXPECT_EQ(samples.GetSampleCount(), 0u);
+        EXPECT_EQ(samples.GetPercentile(50.0f), 0u);
+        EXPECT_EQ(samples.GetMax(), 0u);
+    }
+
+    TEST_F(LoadTestSamplesTests, NearestRankPercentiles)
+    {
+        Multiplayer::LoadTestSamples samples;
+
+        // Added in reverse to verify samples are sorted before computing percentiles
+        for (uint64_t value = 100; value > 0; --value)
+        {
+            samples.AddSample(value);
+        }
+
+        EXPECT_EQ(samples.GetSampleCount(), 100u);
+        EXPECT_EQ(samples.GetPercentile(0.0f), 1u);
+        EXPECT_EQ(samples.GetPercentile(50.0f), 50u);
+        EXPECT_EQ(samples.GetPercentile(95.0f), 95u);
+        EXPECT_EQ(samples.GetPercentile(99.0f), 99u);
+        EXPECT_EQ(samples.GetPercentile(100.0f), 100u);
+        EXPECT_EQ(samples.GetMax(), 100u);
+
+        // Samples added after a percentile query must still be accounted for
+        samples.AddSample(1000);
+        EXPECT_EQ(samples.GetMax(), 1000u);
+        EXPECT_EQ(samples.GetPercentile(100.0f), 1000u);
+    }
+
+    TEST_F(LoadTestSamplesTests, ClearSamples)
+    {
+        Multiplayer::LoadTestSamples samples;
+        samples.AddSample(5);
+        samples.AddSample(7);
+        EXPECT_EQ(samples.GetPercentile(50.0f), 5u);
+
+        samples.Clear();
+        EXPECT_EQ(samples.GetSampleCount(), 0u);
+        EXPECT_EQ(samples.GetMax(), 0u);
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/ReplicationGrid.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_set.h>
+
+namespace UnitTest
+{
+    class ReplicationGridTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            m_grid = AZStd::make_unique<Multiplayer::ReplicationGrid>(10.0f);
+        }
+
+        void TearDown() override
+        {
+            m_grid.reset();
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        void AddEntity(uint32_t netEntityId, const AZ::Vector3& position)
+        {
+            m_grid->AddEntity(Multiplayer::NetEntityId{ netEntityId }, Multiplayer::ConstNetworkEntityHandle(), position);
+        }
+
+        AZStd::unordered_set<Multiplayer::NetEntityId> Enumerate(const AZ::Vector3& position, float radius)
+        {
+            AZStd::unordered_set<Multiplayer::NetEntityId> result;
+            m_grid->EnumerateRadius(position, radius, [&result](const Multiplayer::ReplicationGrid::Entry& entry, float)
+            {
+                EXPECT_TRUE(result.insert(entry.m_netEntityId).second);
+            });
+            return result;
+        }
+
+        AZStd::unique_ptr<Multiplayer::ReplicationGrid> m_grid;
+    };
+
+    TEST_F(ReplicationGridTests, EnumerateRadius)
+    {
+        AddEntity(1, AZ::Vector3(0.0f, 0.0f, 0.0f));
+        AddEntity(2, AZ::Vector3(5.0f, 0.0f, 0.0f));
+        AddEntity(3, AZ::Vector3(-25.0f, 0.0f, 0.0f));
+        AddEntity(4, AZ::Vector3(100.0f, 100.0f, 0.0f));
+        EXPECT_EQ(m_grid->GetEntityCount(), 4);
+
+        AZStd::unordered_set<Multiplayer::NetEntityId> result = Enumerate(AZ::Vector3::CreateZero(), 30.0f);
+        EXPECT_EQ(result.size(), 3);
+        EXPECT_EQ(result.count(Multiplayer::NetEntityId{ 4 }), 0);
+
+        result = Enumerate(AZ::Vector3::CreateZero(), 6.0f);
+        EXPECT_EQ(result.size(), 2);
+        EXPECT_EQ(result.count(Multiplayer::NetEntityId{ 3 }), 0);
+
+        // Large radii walk the occupied cells instead of every covered cell
+        result = Enumerate(AZ::Vector3::CreateZero(), 1000.0f);
+        EXPECT_EQ(result.size(), 4);
+    }
+
+    TEST_F(ReplicationGridTests, EnumerateReportsDistance)
+    {
+        AddEntity(1, AZ::Vector3(3.0f, 4.0f, 0.0f));
+        m_grid->EnumerateRadius(AZ::Vector3::CreateZero(), 10.0f, [](const Multiplayer::ReplicationGrid::Entry&, float distanceSquared)
+        {
+            EXPECT_FLOAT_EQ(distanceSquared, 25.0f);
+        });
+    }
+
+    TEST_F(ReplicationGridTests, UpdateEntity)
+    {
+        AddEntity(1, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        AddEntity(2, AZ::Vector3(2.0f, 2.0f, 0.0f));
+        AddEntity(3, AZ::Vector3(3.0f, 3.0f, 0.0f));
+
+        // Move within the same cell
+        m_grid->UpdateEntity(Multiplayer::NetEntityId{ 2 }, AZ::Vector3(4.0f, 4.0f, 0.0f));
+        EXPECT_EQ(Enumerate(AZ::Vector3(4.0f, 4.0f, 0.0f), 0.5f).size(), 1);
+
+        // Move the first entity of the cell far away, the last entity is swapped into its slot
+        m_grid->UpdateEntity(Multiplayer::NetEntityId{ 1 }, AZ::Vector3(500.0f, -500.0f, 0.0f));
+        EXPECT_EQ(Enumerate(AZ::Vector3::CreateZero(), 10.0f).size(), 2);
+        EXPECT_EQ(Enumerate(AZ::Vector3(500.0f, -500.0f, 0.0f), 1.0f).size(), 1);
+
+        // The swapped entity must still be tracked correctly
+        m_grid->UpdateEntity(Multiplayer::NetEntityId{ 3 }, AZ::Vector3(-500.0f, 500.0f, 0.0f));
+        AZStd::unordered_set<Multiplayer::NetEntityId> result = Enumerate(AZ::Vector3(-500.0f, 500.0f, 0.0f), 1.0f);
+        EXPECT_EQ(result.size(), 1);
+        EXPECT_EQ(result.count(Multiplayer::NetEntityId{ 3 }), 1);
+        EXPECT_EQ(m_grid->GetEntityCount(), 3);
+
+        // Unknown entities are ignored
+        m_grid->UpdateEntity(Multiplayer::NetEntityId{ 10 }, AZ::Vector3::CreateZero());
+        EXPECT_EQ(m_grid->GetEntityCount(), 3);
+    }
+
+    TEST_F(ReplicationGridTests, RemoveEntity)
+    {
+        AddEntity(1, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        AddEntity(2, AZ::Vector3(2.0f, 2.0f, 0.0f));
+        AddEntity(3, AZ::Vector3(3.0f, 3.0f, 0.0f));
+
+        m_grid->RemoveEntity(Multiplayer::NetEntityId{ 1 });
+        EXPECT_EQ(m_grid->GetEntityCount(), 2);
+        m_grid->RemoveEntity(Multiplayer::NetEntityId{ 3 });
+        EXPECT_EQ(m_grid->GetEntityCount(), 1);
+
+        AZStd::unordered_set<Multiplayer::NetEntityId> result = Enumerate(AZ::Vector3::CreateZero(), 10.0f);
+        EXPECT_EQ(result.size(), 1);
+        EXPECT_EQ(result.count(Multiplayer::NetEntityId{ 2 }), 1);
+
+        // Adding an entity twice moves it
+        AddEntity(2, AZ::Vector3(50.0f, 50.0f, 0.0f));
+        EXPECT_EQ(m_grid->GetEntityCount(), 1);
+        EXPECT_TRUE(Enumerate(AZ::Vector3::CreateZero(), 10.0f).empty());
+
+        m_grid->Clear();
+        EXPECT_EQ(m_grid->GetEntityCount(), 0);
+        EXPECT_TRUE(Enumerate(AZ::Vector3::CreateZero(), 1000.0f).empty());
+    }
+}
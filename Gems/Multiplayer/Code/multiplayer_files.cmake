@@ -66,6 +66,12 @@ set(FILES
     Source/Editor/MultiplayerEditorConnection.h
     Source/EntityDomains/FullOwnershipEntityDomain.cpp
     Source/EntityDomains/FullOwnershipEntityDomain.h
+    Source/LoadTest/LoadTestHarness.cpp
+    Source/LoadTest/LoadTestHarness.h
+    Source/LoadTest/LoadTestSamples.cpp
+    Source/LoadTest/LoadTestSamples.h
+    Source/LoadTest/SimulatedClient.cpp
+    Source/LoadTest/SimulatedClient.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
@@ -106,6 +112,9 @@ set(FILES
     Source/Physics/PhysicsUtils.cpp
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
+    Source/ReplicationWindows/ReplicationGrid.cpp
+    Source/ReplicationWindows/ReplicationGrid.h
+    Source/ReplicationWindows/ReplicationGrid.inl
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
     Source/ReplicationWindows/ServerToClientReplicationWindow.h
 )
@@ -7,8 +7,11 @@
 
 set(FILES
     Tests/Main.cpp
+    Tests/EntityReplicationManagerTests.cpp
     Tests/IMultiplayerConnectionMock.h
+    Tests/LoadTestSamplesTests.cpp
     Tests/MultiplayerSystemTests.cpp
+    Tests/ReplicationGridTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
 )
@@ -14,6 +14,7 @@
 #include "MultiplayerCompressionSystemComponent.h"
 #include "LZ4Compressor.h"
 #include "MultiplayerCompressionFactory.h"
+#include "ZStdCompressionFactory.h"
 
 namespace MultiplayerCompression
 {
@@ -50,11 +51,15 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_zstdCompressionFactory = new ZStdCompressionFactory();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_zstdCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_zstdCompressionFactory->GetFactoryName());
+        delete m_zstdCompressionFactory;
     }
 }
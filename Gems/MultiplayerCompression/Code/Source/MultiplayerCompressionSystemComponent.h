@@ -11,6 +11,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <ZStdCompressionFactory.h>
 
 namespace MultiplayerCompression
 {
@@ -40,5 +41,6 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        ZStdCompressionFactory* m_zstdCompressionFactory;
     };
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZStdCompressionFactory.h"
+#include "ZStdCompressor.h"
+#include "ZStdSampleWriter.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(AZ::CVarFixedString, net_ZStdCompressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of the trained dictionary used by the zstd compressor, compresses without a dictionary if empty. Both endpoints must use the same dictionary.");
+    AZ_CVAR(int32_t, net_ZStdCompressionLevel, AZ::ZStdDictionary::DefaultCompressionLevel, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Compression level used by the zstd compressor and its dictionary.");
+    AZ_CVAR(AZ::CVarFixedString, net_ZStdSampleCapturePath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, uncompressed packet payloads are captured to this file for dictionary training.");
+    AZ_CVAR(uint32_t, net_ZStdSampleCaptureMaxSamples, 100000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of packet payloads to capture for dictionary training.");
+
+    // zstd dictionaries are typically around 100KB, anything much larger is unlikely to be a dictionary
+    static constexpr size_t MaxDictionaryFileSize = 4 * 1024 * 1024;
+
+    ZStdCompressionFactory::ZStdCompressionFactory() = default;
+    ZStdCompressionFactory::~ZStdCompressionFactory() = default;
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> ZStdCompressionFactory::Create()
+    {
+        LoadConfiguration();
+
+        AZStd::unique_ptr<ZStdCompressor> compressor = AZStd::make_unique<ZStdCompressor>(m_dictionary, net_ZStdCompressionLevel, m_sampleWriter);
+        if (!compressor->Init())
+        {
+            AZLOG_ERROR("Failed to initialize the zstd compressor");
+            return nullptr;
+        }
+        return compressor;
+    }
+
+    AZ::Name ZStdCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    void ZStdCompressionFactory::LoadConfiguration()
+    {
+        if (m_configurationLoaded)
+        {
+            return;
+        }
+        m_configurationLoaded = true;
+
+        const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(net_ZStdCompressionDictionary);
+        if (!dictionaryPath.empty())
+        {
+            AZ::Outcome<AZStd::vector<uint8_t>, AZStd::string> dictionaryFile = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath, MaxDictionaryFileSize);
+            if (dictionaryFile.IsSuccess())
+            {
+                const AZStd::vector<uint8_t>& dictionaryData = dictionaryFile.GetValue();
+                m_dictionary = AZStd::make_shared<AZ::ZStdDictionary>(dictionaryData.data(), dictionaryData.size(), net_ZStdCompressionLevel);
+                AZLOG_INFO("Loaded zstd dictionary %u from %s", m_dictionary->GetId(), dictionaryPath.c_str());
+            }
+            else
+            {
+                AZLOG_ERROR("Failed to load zstd dictionary: %s", dictionaryFile.GetError().c_str());
+            }
+        }
+
+        const AZ::CVarFixedString capturePath = static_cast<AZ::CVarFixedString>(net_ZStdSampleCapturePath);
+        if (!capturePath.empty())
+        {
+            m_sampleWriter = AZStd::make_shared<ZStdSampleWriter>();
+            if (!m_sampleWriter->Open(capturePath.c_str(), net_ZStdSampleCaptureMaxSamples))
+            {
+                AZLOG_ERROR("Failed to open zstd sample capture file %s", capturePath.c_str());
+                m_sampleWriter.reset();
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+namespace MultiplayerCompression
+{
+    class ZStdSampleWriter;
+
+    //! @class ZStdCompressionFactory
+    //! @brief Creates zstd compressors, selected by setting `net_UdpCompressor` or `net_TcpCompressor` to MultiplayerZStdCompressor.
+    //!
+    //! The dictionary named by `net_ZStdCompressionDictionary` is loaded once and shared by every compressor this factory creates.
+    //! Setting `net_ZStdSampleCapturePath` captures uncompressed payloads for the MultiplayerCompression.DictionaryTrainer tool.
+    class ZStdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        ZStdCompressionFactory();
+        ~ZStdCompressionFactory() override;
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        //! Loads the configured dictionary and opens the sample capture file, the first time a compressor is created.
+        void LoadConfiguration();
+
+        const AZ::Name m_name = AZ::Name("MultiplayerZStdCompressor");
+        bool m_configurationLoaded = false;
+        AZStd::shared_ptr<const AZ::ZStdDictionary> m_dictionary;
+        AZStd::shared_ptr<ZStdSampleWriter> m_sampleWriter;
+    };
+}
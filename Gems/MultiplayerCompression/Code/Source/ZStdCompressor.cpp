@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZStdCompressor.h"
+#include "ZStdSampleWriter.h"
+
+namespace MultiplayerCompression
+{
+    namespace
+    {
+        // Decompression may run on several job threads at once, so each thread keeps its own context
+        struct ThreadDecompressionContext
+        {
+            ~ThreadDecompressionContext()
+            {
+                ZSTD_freeDCtx(m_context);
+            }
+
+            ZSTD_DCtx* Get()
+            {
+                if (m_context == nullptr)
+                {
+                    m_context = ZSTD_createDCtx();
+                }
+                return m_context;
+            }
+
+            ZSTD_DCtx* m_context = nullptr;
+        };
+        thread_local ThreadDecompressionContext s_decompressionContext;
+    }
+
+    ZStdCompressor::ZStdCompressor(AZStd::shared_ptr<const AZ::ZStdDictionary> dictionary, int compressionLevel, AZStd::shared_ptr<ZStdSampleWriter> sampleWriter)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_compressionLevel(compressionLevel)
+        , m_sampleWriter(AZStd::move(sampleWriter))
+    {
+        ;
+    }
+
+    ZStdCompressor::~ZStdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+    }
+
+    bool ZStdCompressor::Init()
+    {
+        if (m_dictionary != nullptr && !m_dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Invalid zstd dictionary provided, compressing without a dictionary");
+            m_dictionary = nullptr;
+        }
+
+        if (m_dictionary == nullptr && m_compressionContext == nullptr)
+        {
+            m_compressionContext = ZSTD_createCCtx();
+        }
+        return m_dictionary != nullptr || m_compressionContext != nullptr;
+    }
+
+    size_t ZStdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZStdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_dictionary == nullptr && m_compressionContext == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compress called before Init");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_sampleWriter != nullptr)
+        {
+            m_sampleWriter->Write(uncompData, uncompSize);
+        }
+
+        const size_t result = (m_dictionary != nullptr)
+            ? m_dictionary->Compress(compData, compDataSize, uncompData, uncompSize)
+            : ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B) with error %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        compSize = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZStdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (m_dictionary != nullptr)
+            ? m_dictionary->Decompress(uncompData, uncompDataSize, compData, compDataSize)
+            : ZSTD_decompressDCtx(s_decompressionContext.Get(), uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            // Also covers frames compressed with a different dictionary, which is most likely a configuration mismatch between endpoints
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B) with error %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+namespace MultiplayerCompression
+{
+    class ZStdSampleWriter;
+
+    static const char* ZStdCompressorName = "ZStd";
+    static const AzNetworking::CompressorType ZStdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZStdCompressorName)));
+
+    //! @class ZStdCompressor
+    //! @brief Implements a zstd Compressor against the AzNetworking Compressor interface for use with the Multiplayer Gem.
+    //!
+    //! Every packet is compressed as an independent frame, so lost or reordered datagrams never affect other packets. Game packets
+    //! are too small for zstd to find much redundancy within a single packet, so an optional dictionary trained offline on
+    //! captured traffic can be provided to share context across packets. Both endpoints must use the same dictionary.
+    class ZStdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdCompressor, AZ::SystemAllocator, 0);
+
+        //! Constructor.
+        //! @param dictionary       optional dictionary to compress and decompress with
+        //! @param compressionLevel zstd compression level used without a dictionary, dictionaries carry their own level
+        //! @param sampleWriter     optional writer that uncompressed payloads are captured to for dictionary training
+        ZStdCompressor
+        (
+            AZStd::shared_ptr<const AZ::ZStdDictionary> dictionary = nullptr,
+            int compressionLevel = AZ::ZStdDictionary::DefaultCompressionLevel,
+            AZStd::shared_ptr<ZStdSampleWriter> sampleWriter = nullptr
+        );
+        ~ZStdCompressor() override;
+
+        const char* GetName() const { return ZStdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZStdCompressorType; };
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(ZStdCompressor);
+
+        AZStd::shared_ptr<const AZ::ZStdDictionary> m_dictionary;
+        ZSTD_CCtx* m_compressionContext = nullptr; // Compression only happens on the thread updating the network interface
+        int m_compressionLevel = AZ::ZStdDictionary::DefaultCompressionLevel;
+        AZStd::shared_ptr<ZStdSampleWriter> m_sampleWriter;
+    };
+}
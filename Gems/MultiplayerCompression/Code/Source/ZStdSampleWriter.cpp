@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZStdSampleWriter.h"
+
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace MultiplayerCompression
+{
+    bool ReadZStdSamples(const uint8_t* fileData, size_t fileSize, AZStd::vector<uint8_t>& outSamples, AZStd::vector<size_t>& outSampleSizes)
+    {
+        size_t offset = 0;
+        while (offset < fileSize)
+        {
+            if (fileSize - offset < ZStdSampleHeaderSize)
+            {
+                return false;
+            }
+
+            const uint8_t* header = fileData + offset;
+            const size_t sampleSize = aznumeric_cast<size_t>(header[0])
+                | (aznumeric_cast<size_t>(header[1]) << 8)
+                | (aznumeric_cast<size_t>(header[2]) << 16)
+                | (aznumeric_cast<size_t>(header[3]) << 24);
+            offset += ZStdSampleHeaderSize;
+
+            if (fileSize - offset < sampleSize)
+            {
+                return false;
+            }
+
+            outSamples.insert(outSamples.end(), fileData + offset, fileData + offset + sampleSize);
+            outSampleSizes.push_back(sampleSize);
+            offset += sampleSize;
+        }
+        return true;
+    }
+
+    bool ZStdSampleWriter::Open(const char* filePath, uint32_t maxSamples)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_file.Close();
+        m_maxSamples = maxSamples;
+        m_sampleCount = 0;
+        return m_file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY);
+    }
+
+    void ZStdSampleWriter::Write(const void* data, size_t size)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (!m_file.IsOpen() || m_sampleCount >= m_maxSamples)
+        {
+            return;
+        }
+
+        const uint32_t sampleSize = aznumeric_cast<uint32_t>(size);
+        const uint8_t header[ZStdSampleHeaderSize] =
+        {
+            aznumeric_cast<uint8_t>(sampleSize & 0xFF),
+            aznumeric_cast<uint8_t>((sampleSize >> 8) & 0xFF),
+            aznumeric_cast<uint8_t>((sampleSize >> 16) & 0xFF),
+            aznumeric_cast<uint8_t>((sampleSize >> 24) & 0xFF)
+        };
+        m_file.Write(header, ZStdSampleHeaderSize);
+        m_file.Write(data, size);
+        ++m_sampleCount;
+    }
+
+    uint32_t ZStdSampleWriter::GetSampleCount() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return m_sampleCount;
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace MultiplayerCompression
+{
+    //! Dictionary training sample files hold back to back records of a 32 bit little endian payload size followed by the payload.
+    static constexpr uint32_t ZStdSampleHeaderSize = sizeof(uint32_t);
+
+    //! Splits the contents of a sample file into the layout expected by AZ::ZStdDictionary::Train.
+    //! @param fileData       the contents of a sample file
+    //! @param fileSize       the size of the sample file contents
+    //! @param outSamples     the sample payloads are appended back to back to this buffer
+    //! @param outSampleSizes the size of each appended sample payload
+    //! @return boolean true on success, false if the file is truncated
+    bool ReadZStdSamples(const uint8_t* fileData, size_t fileSize, AZStd::vector<uint8_t>& outSamples, AZStd::vector<size_t>& outSampleSizes);
+
+    //! @class ZStdSampleWriter
+    //! @brief Captures uncompressed packet payloads to a sample file, which the dictionary trainer tool trains a zstd dictionary from.
+    class ZStdSampleWriter
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdSampleWriter, AZ::SystemAllocator, 0);
+
+        ZStdSampleWriter() = default;
+        ~ZStdSampleWriter() = default;
+
+        //! Creates or overwrites the sample file at the provided path.
+        //! @param filePath   path of the sample file to write
+        //! @param maxSamples the number of samples after which further writes are ignored
+        //! @return boolean true on success, false if the file could not be opened
+        bool Open(const char* filePath, uint32_t maxSamples);
+
+        //! Appends a sample to the sample file, safe to call from multiple threads.
+        //! @param data pointer to the sample payload
+        //! @param size the size of the sample payload
+        void Write(const void* data, size_t size);
+
+        //! Returns the number of samples written.
+        //! @return the number of samples written
+        uint32_t GetSampleCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(ZStdSampleWriter);
+
+        mutable AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        uint32_t m_maxSamples = 0;
+        uint32_t m_sampleCount = 0;
+    };
+}
@@ -9,8 +9,11 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZStdCompressor.h>
+#include <ZStdSampleWriter.h>
 
 #include <AzCore/Compression/Compression.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -126,4 +129,139 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+// Builds small packet like samples out of a handful of repeating tokens, which is where dictionaries pay off
+static void BuildZStdSamples(AZStd::vector<uint8_t>& samples, AZStd::vector<size_t>& sampleSizes)
+{
+    constexpr uint32_t SampleCount = 2000;
+    constexpr uint32_t TokensPerSample = 12;
+    constexpr uint32_t TokenCount = 16;
+    constexpr uint32_t TokenSize = 8;
+
+    uint32_t seed = 12345;
+    auto nextRandom = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 24; };
+
+    uint8_t tokens[TokenCount][TokenSize];
+    for (uint32_t tokenIndex = 0; tokenIndex < TokenCount; ++tokenIndex)
+    {
+        for (uint32_t byteIndex = 0; byteIndex < TokenSize; ++byteIndex)
+        {
+            tokens[tokenIndex][byteIndex] = aznumeric_cast<uint8_t>(nextRandom());
+        }
+    }
+
+    for (uint32_t sampleIndex = 0; sampleIndex < SampleCount; ++sampleIndex)
+    {
+        for (uint32_t tokenIndex = 0; tokenIndex < TokensPerSample; ++tokenIndex)
+        {
+            const uint8_t* token = tokens[nextRandom() % TokenCount];
+            samples.insert(samples.end(), token, token + TokenSize);
+        }
+        sampleSizes.push_back(TokensPerSample * TokenSize);
+    }
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdRoundTrip)
+{
+    AzNetworking::UdpPacketEncodingBuffer buffer;
+    buffer.Resize(buffer.GetCapacity());
+    memset(buffer.GetBuffer(), 255, buffer.GetCapacity());
+
+    MultiplayerCompression::ZStdCompressor zstdCompressor;
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    const size_t maxCompressedSize = zstdCompressor.GetMaxCompressedBufferSize(buffer.GetSize());
+    AZStd::vector<uint8_t> compressedBuffer(maxCompressedSize);
+    AZStd::vector<uint8_t> decompressedBuffer(buffer.GetSize());
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(buffer.GetBuffer(), buffer.GetSize(), compressedBuffer.data(), maxCompressedSize, compressedSize);
+    ASSERT_EQ(compressStatus, AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, buffer.GetSize());
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize);
+    ASSERT_EQ(decompressStatus, AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_EQ(uncompressedSize, buffer.GetSize());
+    EXPECT_EQ(memcmp(decompressedBuffer.data(), buffer.GetBuffer(), uncompressedSize), 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdDictionary)
+{
+    AZStd::vector<uint8_t> samples;
+    AZStd::vector<size_t> sampleSizes;
+    BuildZStdSamples(samples, sampleSizes);
+
+    const AZStd::vector<AZ::u8> dictionaryData = AZ::ZStdDictionary::Train(samples.data(), sampleSizes.data(), aznumeric_cast<AZ::u32>(sampleSizes.size()), 8 * 1024);
+    ASSERT_FALSE(dictionaryData.empty());
+    auto dictionary = AZStd::make_shared<AZ::ZStdDictionary>(dictionaryData.data(), dictionaryData.size());
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZStdCompressor plainCompressor;
+    MultiplayerCompression::ZStdCompressor dictionaryCompressor(dictionary);
+    ASSERT_TRUE(plainCompressor.Init());
+    ASSERT_TRUE(dictionaryCompressor.Init());
+
+    const size_t sampleSize = sampleSizes[0];
+    const size_t maxCompressedSize = dictionaryCompressor.GetMaxCompressedBufferSize(sampleSize);
+    AZStd::vector<uint8_t> compressedBuffer(maxCompressedSize);
+    AZStd::vector<uint8_t> decompressedBuffer(sampleSize);
+    size_t plainCompressedSize = 0;
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    EXPECT_EQ(plainCompressor.Compress(samples.data(), sampleSize, compressedBuffer.data(), maxCompressedSize, plainCompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(dictionaryCompressor.Compress(samples.data(), sampleSize, compressedBuffer.data(), maxCompressedSize, compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, plainCompressedSize);
+
+    ASSERT_EQ(dictionaryCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, sampleSize);
+    EXPECT_EQ(memcmp(decompressedBuffer.data(), samples.data(), sampleSize), 0);
+
+    // Frames compressed with a dictionary can't be decompressed without it
+    EXPECT_EQ(plainCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdCorruptTest)
+{
+    uint8_t badInput[64];
+    memset(badInput, 0xAB, sizeof(badInput));
+    uint8_t buffer[64];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZStdCompressor zstdCompressor;
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(badInput, sizeof(badInput), buffer, sizeof(buffer), consumedSize, uncompressedSize);
+    EXPECT_EQ(decompressStatus, AzNetworking::CompressorError::CorruptData);
+
+    size_t compressedSize = 0;
+    EXPECT_EQ(zstdCompressor.Compress(nullptr, 4, buffer, sizeof(buffer), compressedSize), AzNetworking::CompressorError::Uninitialized);
+    EXPECT_EQ(zstdCompressor.Decompress(nullptr, 4, buffer, sizeof(buffer), consumedSize, uncompressedSize), AzNetworking::CompressorError::Uninitialized);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZStdReadSamples)
+{
+    const uint8_t sampleFile[] = { 2, 0, 0, 0, 10, 11, 1, 0, 0, 0, 12, 3, 0, 0, 0, 13 };
+    AZStd::vector<uint8_t> samples;
+    AZStd::vector<size_t> sampleSizes;
+
+    // The last sample is truncated, the complete samples ahead of it are still read
+    EXPECT_FALSE(MultiplayerCompression::ReadZStdSamples(sampleFile, sizeof(sampleFile), samples, sampleSizes));
+    ASSERT_EQ(sampleSizes.size(), 2);
+    EXPECT_EQ(sampleSizes[0], 2);
+    EXPECT_EQ(sampleSizes[1], 1);
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_EQ(samples[0], 10);
+    EXPECT_EQ(samples[2], 12);
+
+    samples.clear();
+    sampleSizes.clear();
+    EXPECT_TRUE(MultiplayerCompression::ReadZStdSamples(sampleFile, 11, samples, sampleSizes));
+    EXPECT_EQ(sampleSizes.size(), 2);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
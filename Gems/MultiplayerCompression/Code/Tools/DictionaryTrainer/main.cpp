@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/string.h>
+
+#include <ZStdSampleWriter.h>
+
+// Trains a zstd dictionary for the MultiplayerZStdCompressor from sample files captured with net_ZStdSampleCapturePath.
+// Usage: MultiplayerCompression.DictionaryTrainer <output dictionary> <sample file> [<sample file>...] [--max-size <bytes>]
+
+static const char* ToolWindowName = "DictionaryTrainer";
+static constexpr size_t DefaultMaxDictionarySize = 110 * 1024; // zstd's recommended dictionary size
+
+enum class DictionaryTrainerResult : int
+{
+    Success = 0,
+    InvalidArg,
+    FailedToReadSamples,
+    FailedToTrain,
+    FailedToWriteDictionary
+};
+
+struct DictionaryTrainerParams
+{
+    AZStd::string m_outputPath;
+    AZStd::vector<AZStd::string> m_samplePaths;
+    size_t m_maxDictionarySize = DefaultMaxDictionarySize;
+};
+
+static bool ParseArgs(int argc, char* argv[], DictionaryTrainerParams& params)
+{
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        const AZStd::string arg = argv[argIndex];
+        if (arg == "--max-size")
+        {
+            if (++argIndex >= argc)
+            {
+                return false;
+            }
+            params.m_maxDictionarySize = aznumeric_cast<size_t>(AZStd::stoull(AZStd::string(argv[argIndex])));
+        }
+        else if (params.m_outputPath.empty())
+        {
+            params.m_outputPath = arg;
+        }
+        else
+        {
+            params.m_samplePaths.push_back(arg);
+        }
+    }
+    return !params.m_outputPath.empty() && !params.m_samplePaths.empty() && params.m_maxDictionarySize > 0;
+}
+
+static DictionaryTrainerResult TrainDictionary(const DictionaryTrainerParams& params)
+{
+    AZStd::vector<uint8_t> samples;
+    AZStd::vector<size_t> sampleSizes;
+    for (const AZStd::string& samplePath : params.m_samplePaths)
+    {
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(samplePath.c_str());
+        if (fileSize == 0)
+        {
+            AZ_Error(ToolWindowName, false, "Sample file \"%s\" is empty or does not exist.", samplePath.c_str());
+            return DictionaryTrainerResult::FailedToReadSamples;
+        }
+
+        AZStd::vector<uint8_t> fileData(fileSize);
+        if (AZ::IO::SystemFile::Read(samplePath.c_str(), fileData.data(), fileSize) != fileSize)
+        {
+            AZ_Error(ToolWindowName, false, "Failed to read sample file \"%s\".", samplePath.c_str());
+            return DictionaryTrainerResult::FailedToReadSamples;
+        }
+
+        if (!MultiplayerCompression::ReadZStdSamples(fileData.data(), fileData.size(), samples, sampleSizes))
+        {
+            // Captures are cut short if the process exits mid write, the samples read up to that point are still usable
+            AZ_Warning(ToolWindowName, false, "Sample file \"%s\" is truncated, ignoring the last sample.", samplePath.c_str());
+        }
+    }
+
+    AZ_Printf(ToolWindowName, "Training a dictionary of up to %zu bytes from %zu samples (%zu bytes).\n",
+        params.m_maxDictionarySize, sampleSizes.size(), samples.size());
+    const AZStd::vector<AZ::u8> dictionary = AZ::ZStdDictionary::Train(samples.data(), sampleSizes.data(),
+        aznumeric_cast<AZ::u32>(sampleSizes.size()), params.m_maxDictionarySize);
+    if (dictionary.empty())
+    {
+        AZ_Error(ToolWindowName, false, "Failed to train a dictionary, try capturing more samples.");
+        return DictionaryTrainerResult::FailedToTrain;
+    }
+
+    AZ::IO::SystemFile outputFile;
+    if (!outputFile.Open(params.m_outputPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY)
+        || outputFile.Write(dictionary.data(), dictionary.size()) != dictionary.size())
+    {
+        AZ_Error(ToolWindowName, false, "Failed to write dictionary to \"%s\".", params.m_outputPath.c_str());
+        return DictionaryTrainerResult::FailedToWriteDictionary;
+    }
+
+    AZ_Printf(ToolWindowName, "Wrote %zu byte dictionary to \"%s\".\n", dictionary.size(), params.m_outputPath.c_str());
+    return DictionaryTrainerResult::Success;
+}
+
+int main(int argc, char* argv[])
+{
+    AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+    DictionaryTrainerResult result = DictionaryTrainerResult::InvalidArg;
+    {
+        DictionaryTrainerParams params;
+        if (ParseArgs(argc, argv, params))
+        {
+            result = TrainDictionary(params);
+        }
+        else
+        {
+            AZ_Printf(ToolWindowName, "Usage: %s <output dictionary> <sample file> [<sample file>...] [--max-size <bytes>]\n", argv[0]);
+        }
+    }
+    AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+    return static_cast<int>(result);
+}
@@ -12,4 +12,10 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/ZStdCompressionFactory.cpp
+    Source/ZStdCompressionFactory.h
+    Source/ZStdCompressor.cpp
+    Source/ZStdCompressor.h
+    Source/ZStdSampleWriter.cpp
+    Source/ZStdSampleWriter.h
 )
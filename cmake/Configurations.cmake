@@ -181,6 +181,10 @@ foreach(conf IN LISTS CMAKE_CONFIGURATION_TYPES)
     set(CMAKE_EXE_LINKER_FLAGS_${UCONF} CACHE STRING "Flags to pass to the linker when creating an executable for ${conf}")
 endforeach()
 
+# AVX2/FMA code generation is opt-in, as the resulting binaries don't run on CPUs without these instruction sets.
+# When enabled, AZ::Simd uses FMA instructions and the 8 wide Simd::Vec8 type maps to AVX registers.
+set(LY_SIMD_AVX2 OFF CACHE BOOL "Build x64 targets with AVX2 and FMA instructions enabled")
+
 # flags are defined per platform, follow platform files under Platform/<PlatformName>/Configurations_<platformname>.cmake
 ly_get_absolute_pal_filename(pal_dir ${CMAKE_CURRENT_SOURCE_DIR}/cmake/Platform/${PAL_PLATFORM_NAME})
 include(${pal_dir}/Configurations_${PAL_PLATFORM_NAME_LOWERCASE}.cmake)
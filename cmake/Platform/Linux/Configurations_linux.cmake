@@ -18,6 +18,13 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
             -fPIC
             -msse4.1
     )
+    if(LY_SIMD_AVX2)
+        ly_append_configurations_options(
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
 else()
 
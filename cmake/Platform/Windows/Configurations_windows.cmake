@@ -21,6 +21,12 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
         LINK
             /MACHINE:X64
     )
+    if(LY_SIMD_AVX2)
+        ly_append_configurations_options(
+            COMPILATION
+                /arch:AVX2
+        )
+    endif()
 
 elseif(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 
@@ -39,6 +45,13 @@ elseif(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
             -mf16c
             -Wno-deprecated-declarations
     )
+    if(LY_SIMD_AVX2)
+        ly_append_configurations_options(
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
 
 else()